@@ -3,6 +3,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -14,9 +15,18 @@ extern "C" {
 // DO NOT EDIT MANUALLY - regenerate using scripts/generate_header.py
 // ============================================================================
 
+// Completion callback for *_async entry points: (ctx, status, result).
+// On success `result` must be freed with the matching *_free function; on a
+// non-zero status it is the error message (or NULL), freed with free_string.
+typedef void (*ffi_completion_callback_t)(void*, int32_t, char*);
+
+// Signpost callback for core_set_signpost_callback: (name, is_begin, id).
+// The begin and end of one call carry the same id.
+typedef void (*ffi_signpost_callback_t)(const char*, bool, uint64_t);
+
 
 // ============================================================================
-// ACTIVITY FUNCTIONS (21 functions)
+// ACTIVITY FUNCTIONS (24 functions)
 // ============================================================================
 
 int32_t activity_create(const char*, char**);
@@ -39,6 +49,9 @@ int32_t activity_bulk_update_status(const char*, char**);
 int32_t activity_get_workload_by_project(const char*, char**);
 int32_t activity_find_stale(const char*, char**);
 int32_t activity_get_progress_analysis(const char*, char**);
+int32_t activity_list_open(const char*, uint64_t*);
+int32_t activity_list_async(const char*, void*, ffi_completion_callback_t);
+int32_t activity_get_statistics_async(const char*, void*, ffi_completion_callback_t);
 void activity_free(char*);
 
 // ============================================================================
@@ -70,7 +83,13 @@ int32_t hash_password(const char*, char**);
 void free_string(char*);
 
 // ============================================================================
-// COMPRESSION FUNCTIONS (32 functions)
+// BATCH FUNCTIONS (1 functions)
+// ============================================================================
+
+int32_t core_execute_batch(const char*, char**);
+
+// ============================================================================
+// COMPRESSION FUNCTIONS (33 functions)
 // ============================================================================
 
 int32_t compression_compress_document(const char*, char**);
@@ -82,6 +101,7 @@ int32_t compression_get_document_status(const char*, char**);
 int32_t compression_update_priority(const char*, char**);
 int32_t compression_bulk_update_priority(const char*, char**);
 int32_t compression_is_document_in_use(const char*, char**);
+int32_t compression_compress_document_async(const char*, void*, ffi_completion_callback_t);
 void compression_free(char*);
 int32_t compression_get_queue_entries(const char*, char**);
 int32_t compression_get_default_config(char**);
@@ -107,10 +127,15 @@ int32_t compression_detect_ios_capabilities(char**);
 int32_t compression_cleanup_stale_documents(char**);
 
 // ============================================================================
-// CORE FUNCTIONS (7 functions)
+// CORE FUNCTIONS (12 functions)
 // ============================================================================
 
 int32_t initialize_library(const char*, const char*, bool, const char*);
+int32_t initialize_library_with_config(const char*, const char*, bool, const char*, const char*);
+int32_t library_finish_startup(char**);
+int32_t library_get_startup_report(char**);
+int32_t core_get_performance_metrics(char**);
+void core_set_signpost_callback(ffi_signpost_callback_t);
 void set_offline_mode(bool);
 int32_t get_device_id(char**);
 bool is_offline_mode(void);
@@ -119,7 +144,15 @@ char* get_last_error(void);
 int32_t set_ios_storage_path(const char*);
 
 // ============================================================================
-// DOCUMENT FUNCTIONS (26 functions)
+// CURSOR FUNCTIONS (3 functions)
+// ============================================================================
+
+int32_t cursor_next(uint64_t, uint32_t, char**);
+int32_t cursor_close(uint64_t);
+void cursor_free(char*);
+
+// ============================================================================
+// DOCUMENT FUNCTIONS (30 functions)
 // ============================================================================
 
 int32_t document_type_create(const char*, char**);
@@ -147,10 +180,14 @@ int32_t document_get_versions(const char*, char**);
 int32_t document_get_access_logs(const char*, char**);
 int32_t document_upload_from_path(const char*, char**);
 int32_t document_bulk_upload_from_paths(const char*, char**);
+int32_t document_upload_bytes(const char*, const uint8_t*, size_t, char**);
+int32_t document_bulk_upload_bytes(const char*, const uint8_t* const*, const size_t*, size_t, char**);
+int32_t document_download_bytes(const char*, uint8_t**, size_t*, char**);
 void document_free(char*);
+void document_buffer_free(uint8_t*, size_t);
 
 // ============================================================================
-// DONOR FUNCTIONS (19 functions)
+// DONOR FUNCTIONS (22 functions)
 // ============================================================================
 
 int32_t donor_create(const char*, char**);
@@ -171,10 +208,13 @@ int32_t donor_find_with_recent_donations(const char*, char**);
 int32_t donor_find_by_date_range(const char*, char**);
 int32_t donor_get_with_funding_details(const char*, char**);
 int32_t donor_get_with_document_timeline(const char*, char**);
+int32_t donor_list_open(const char*, uint64_t*);
+int32_t donor_list_async(const char*, void*, ffi_completion_callback_t);
+int32_t donor_get_statistics_async(const char*, void*, ffi_completion_callback_t);
 void donor_free(char*);
 
 // ============================================================================
-// EXPORT FUNCTIONS (30 functions)
+// EXPORT FUNCTIONS (32 functions)
 // ============================================================================
 
 int32_t export_create_export(const char*, const char*, char**);
@@ -205,11 +245,13 @@ int32_t export_unified_by_date_range(const char*, const char*, char**);
 int32_t export_media_documents_by_entity(const char*, const char*, char**);
 int32_t export_create_custom(const char*, const char*, char**);
 int32_t export_validate_request(const char*, const char*, char**);
+int32_t export_unified_all_domains_async(const char*, const char*, void*, ffi_completion_callback_t);
+int32_t export_unified_by_date_range_async(const char*, const char*, void*, ffi_completion_callback_t);
 void export_free(char*);
 int32_t export_create(const char*, char**);
 
 // ============================================================================
-// FUNDING FUNCTIONS (18 functions)
+// FUNDING FUNCTIONS (19 functions)
 // ============================================================================
 
 int32_t funding_create(const char*, char**);
@@ -229,10 +271,11 @@ int32_t funding_get_by_project_summary(const char*, char**);
 int32_t funding_get_timeline(const char*, char**);
 int32_t funding_upload_document(const char*, char**);
 int32_t funding_upload_documents_bulk(const char*, char**);
+int32_t funding_list_async(const char*, void*, ffi_completion_callback_t);
 void funding_free(char*);
 
 // ============================================================================
-// LIVELIHOOD FUNCTIONS (23 functions)
+// LIVELIHOOD FUNCTIONS (25 functions)
 // ============================================================================
 
 int32_t livelihood_create(const char*, char**);
@@ -257,16 +300,20 @@ int32_t livelihood_get_with_participant_details(const char*, char**);
 int32_t livelihood_get_with_document_timeline(const char*, char**);
 int32_t livelihood_upload_document(const char*, char**);
 int32_t livelihood_upload_documents_bulk(const char*, char**);
+int32_t livelihood_list_async(const char*, void*, ffi_completion_callback_t);
+int32_t livelihood_get_dashboard_metrics_async(const char*, void*, ffi_completion_callback_t);
 void livelihood_free(char*);
 
 // ============================================================================
-// PARTICIPANT FUNCTIONS (33 functions)
+// PARTICIPANT FUNCTIONS (39 functions)
 // ============================================================================
 
 int32_t participant_create(const char*, char**);
 int32_t participant_create_with_documents(const char*, char**);
 int32_t participant_get(const char*, char**);
 int32_t participant_list(const char*, char**);
+int32_t participant_list_buf(const char*, const uint8_t**, size_t*);
+int32_t participant_list_into(const char*, uint8_t*, size_t, size_t*);
 int32_t participant_update(const char*, char**);
 int32_t participant_delete(const char*, char**);
 int32_t participant_find_ids_by_filter(const char*, char**);
@@ -277,6 +324,7 @@ int32_t participant_get_with_enrichment(const char*, char**);
 int32_t participant_get_comprehensive_statistics(const char*, char**);
 int32_t participant_get_document_references(const char*, char**);
 int32_t participant_bulk_update_streaming(const char*, char**);
+int32_t participant_bulk_create(const char*, char**);
 int32_t participant_get_index_optimization_suggestions(const char*, char**);
 int32_t participant_find_ids_by_filter_optimized(const char*, char**);
 int32_t participant_upload_document(const char*, char**);
@@ -295,10 +343,13 @@ int32_t participant_get_with_workshops(const char*, char**);
 int32_t participant_get_with_livelihoods(const char*, char**);
 int32_t participant_get_with_document_timeline(const char*, char**);
 int32_t participant_check_duplicates(const char*, char**);
+int32_t participant_list_open(const char*, uint64_t*);
+int32_t participant_list_async(const char*, void*, ffi_completion_callback_t);
+int32_t participant_get_demographics_async(const char*, void*, ffi_completion_callback_t);
 void participant_free(char*);
 
 // ============================================================================
-// PROJECT FUNCTIONS (24 functions)
+// PROJECT FUNCTIONS (27 functions)
 // ============================================================================
 
 int32_t project_create(const char*, char**);
@@ -324,10 +375,20 @@ int32_t project_get_strategic_goal_distribution(const char*, char**);
 int32_t project_find_stale(const char*, char**);
 int32_t project_get_document_coverage_analysis(const char*, char**);
 int32_t project_get_activity_timeline(const char*, char**);
+int32_t project_list_open(const char*, uint64_t*);
+int32_t project_list_async(const char*, void*, ffi_completion_callback_t);
+int32_t project_get_statistics_async(const char*, void*, ffi_completion_callback_t);
 void project_free(char*);
 
 // ============================================================================
-// STRATEGIC_GOAL FUNCTIONS (21 functions)
+// STATS FUNCTIONS (2 functions)
+// ============================================================================
+
+int32_t stats_rebuild(const char*, char**);
+void stats_free(char*);
+
+// ============================================================================
+// STRATEGIC_GOAL FUNCTIONS (24 functions)
 // ============================================================================
 
 int32_t strategic_goal_create(const char*, char**);
@@ -350,8 +411,18 @@ int32_t strategic_goal_get_status_distribution(const char*, char**);
 int32_t strategic_goal_get_value_statistics(const char*, char**);
 int32_t strategic_goal_get_filtered_ids(const char*, char**);
 int32_t strategic_goal_list_summaries(const char*, char**);
+int32_t strategic_goal_list_open(const char*, uint64_t*);
+int32_t strategic_goal_list_async(const char*, void*, ffi_completion_callback_t);
+int32_t strategic_goal_list_summaries_async(const char*, void*, ffi_completion_callback_t);
 void strategic_goal_free(char*);
 
+// ============================================================================
+// SYNC FUNCTIONS (2 functions)
+// ============================================================================
+
+int32_t sync_compact_change_log(const char*, char**);
+void sync_free(char*);
+
 // ============================================================================
 // USER FUNCTIONS (9 functions)
 // ============================================================================
@@ -367,7 +438,7 @@ int32_t user_get_stats(const char*, char**);
 void user_free(char*);
 
 // ============================================================================
-// WORKSHOP FUNCTIONS (25 functions)
+// WORKSHOP FUNCTIONS (27 functions)
 // ============================================================================
 
 int32_t workshop_create(const char*, char**);
@@ -394,6 +465,8 @@ int32_t workshop_get_budget_summaries_for_project(const char*, char**);
 int32_t workshop_find_participants_with_missing_evaluations(const char*, char**);
 int32_t workshop_upload_document(const char*, char**);
 int32_t workshop_upload_documents_bulk(const char*, char**);
+int32_t workshop_list_async(const char*, void*, ffi_completion_callback_t);
+int32_t workshop_get_budget_statistics_async(const char*, void*, ffi_completion_callback_t);
 void workshop_free(char*);
 
 #ifdef __cplusplus
@@ -0,0 +1,145 @@
+-- Full-text search indexes for participant, project and activity search.
+--
+-- External-content FTS5 tables: the text stays in the base table and the FTS
+-- table only holds the index, keyed on the base table's rowid. Triggers keep
+-- the index in step with every INSERT/UPDATE/DELETE, including rows written
+-- by sync. Soft-deleted rows stay indexed; queries filter on deleted_at.
+--
+-- Note: the base tables use TEXT primary keys, so their rowids are only
+-- stable until a VACUUM. Run `INSERT INTO <table>_fts(<table>_fts) VALUES('rebuild')`
+-- after vacuuming.
+
+-- participants
+CREATE VIRTUAL TABLE IF NOT EXISTS participants_fts USING fts5(
+    name, gender, age_group, location, disability_type,
+    content='participants',
+    content_rowid='rowid',
+    tokenize='unicode61 remove_diacritics 2',
+    prefix='2 3'
+);
+
+CREATE TRIGGER IF NOT EXISTS participants_fts_insert AFTER INSERT ON participants
+BEGIN
+    INSERT INTO participants_fts(rowid, name, gender, age_group, location, disability_type) VALUES (new.rowid, new.name, new.gender, new.age_group, new.location, new.disability_type);
+END;
+
+CREATE TRIGGER IF NOT EXISTS participants_fts_delete AFTER DELETE ON participants
+BEGIN
+    INSERT INTO participants_fts(participants_fts, rowid, name, gender, age_group, location, disability_type) VALUES ('delete', old.rowid, old.name, old.gender, old.age_group, old.location, old.disability_type);
+END;
+
+CREATE TRIGGER IF NOT EXISTS participants_fts_update AFTER UPDATE OF name, gender, age_group, location, disability_type ON participants
+BEGIN
+    INSERT INTO participants_fts(participants_fts, rowid, name, gender, age_group, location, disability_type) VALUES ('delete', old.rowid, old.name, old.gender, old.age_group, old.location, old.disability_type);
+    INSERT INTO participants_fts(rowid, name, gender, age_group, location, disability_type) VALUES (new.rowid, new.name, new.gender, new.age_group, new.location, new.disability_type);
+END;
+
+INSERT INTO participants_fts(participants_fts) VALUES ('rebuild');
+
+-- workshops
+CREATE VIRTUAL TABLE IF NOT EXISTS workshops_fts USING fts5(
+    purpose, location,
+    content='workshops',
+    content_rowid='rowid',
+    tokenize='unicode61 remove_diacritics 2',
+    prefix='2 3'
+);
+
+CREATE TRIGGER IF NOT EXISTS workshops_fts_insert AFTER INSERT ON workshops
+BEGIN
+    INSERT INTO workshops_fts(rowid, purpose, location) VALUES (new.rowid, new.purpose, new.location);
+END;
+
+CREATE TRIGGER IF NOT EXISTS workshops_fts_delete AFTER DELETE ON workshops
+BEGIN
+    INSERT INTO workshops_fts(workshops_fts, rowid, purpose, location) VALUES ('delete', old.rowid, old.purpose, old.location);
+END;
+
+CREATE TRIGGER IF NOT EXISTS workshops_fts_update AFTER UPDATE OF purpose, location ON workshops
+BEGIN
+    INSERT INTO workshops_fts(workshops_fts, rowid, purpose, location) VALUES ('delete', old.rowid, old.purpose, old.location);
+    INSERT INTO workshops_fts(rowid, purpose, location) VALUES (new.rowid, new.purpose, new.location);
+END;
+
+INSERT INTO workshops_fts(workshops_fts) VALUES ('rebuild');
+
+-- livelihoods
+CREATE VIRTUAL TABLE IF NOT EXISTS livelihoods_fts USING fts5(
+    type, description,
+    content='livelihoods',
+    content_rowid='rowid',
+    tokenize='unicode61 remove_diacritics 2',
+    prefix='2 3'
+);
+
+CREATE TRIGGER IF NOT EXISTS livelihoods_fts_insert AFTER INSERT ON livelihoods
+BEGIN
+    INSERT INTO livelihoods_fts(rowid, type, description) VALUES (new.rowid, new.type, new.description);
+END;
+
+CREATE TRIGGER IF NOT EXISTS livelihoods_fts_delete AFTER DELETE ON livelihoods
+BEGIN
+    INSERT INTO livelihoods_fts(livelihoods_fts, rowid, type, description) VALUES ('delete', old.rowid, old.type, old.description);
+END;
+
+CREATE TRIGGER IF NOT EXISTS livelihoods_fts_update AFTER UPDATE OF type, description ON livelihoods
+BEGIN
+    INSERT INTO livelihoods_fts(livelihoods_fts, rowid, type, description) VALUES ('delete', old.rowid, old.type, old.description);
+    INSERT INTO livelihoods_fts(rowid, type, description) VALUES (new.rowid, new.type, new.description);
+END;
+
+INSERT INTO livelihoods_fts(livelihoods_fts) VALUES ('rebuild');
+
+-- projects
+CREATE VIRTUAL TABLE IF NOT EXISTS projects_fts USING fts5(
+    name, objective, outcome, responsible_team,
+    content='projects',
+    content_rowid='rowid',
+    tokenize='unicode61 remove_diacritics 2',
+    prefix='2 3'
+);
+
+CREATE TRIGGER IF NOT EXISTS projects_fts_insert AFTER INSERT ON projects
+BEGIN
+    INSERT INTO projects_fts(rowid, name, objective, outcome, responsible_team) VALUES (new.rowid, new.name, new.objective, new.outcome, new.responsible_team);
+END;
+
+CREATE TRIGGER IF NOT EXISTS projects_fts_delete AFTER DELETE ON projects
+BEGIN
+    INSERT INTO projects_fts(projects_fts, rowid, name, objective, outcome, responsible_team) VALUES ('delete', old.rowid, old.name, old.objective, old.outcome, old.responsible_team);
+END;
+
+CREATE TRIGGER IF NOT EXISTS projects_fts_update AFTER UPDATE OF name, objective, outcome, responsible_team ON projects
+BEGIN
+    INSERT INTO projects_fts(projects_fts, rowid, name, objective, outcome, responsible_team) VALUES ('delete', old.rowid, old.name, old.objective, old.outcome, old.responsible_team);
+    INSERT INTO projects_fts(rowid, name, objective, outcome, responsible_team) VALUES (new.rowid, new.name, new.objective, new.outcome, new.responsible_team);
+END;
+
+INSERT INTO projects_fts(projects_fts) VALUES ('rebuild');
+
+-- activities
+CREATE VIRTUAL TABLE IF NOT EXISTS activities_fts USING fts5(
+    description, kpi,
+    content='activities',
+    content_rowid='rowid',
+    tokenize='unicode61 remove_diacritics 2',
+    prefix='2 3'
+);
+
+CREATE TRIGGER IF NOT EXISTS activities_fts_insert AFTER INSERT ON activities
+BEGIN
+    INSERT INTO activities_fts(rowid, description, kpi) VALUES (new.rowid, new.description, new.kpi);
+END;
+
+CREATE TRIGGER IF NOT EXISTS activities_fts_delete AFTER DELETE ON activities
+BEGIN
+    INSERT INTO activities_fts(activities_fts, rowid, description, kpi) VALUES ('delete', old.rowid, old.description, old.kpi);
+END;
+
+CREATE TRIGGER IF NOT EXISTS activities_fts_update AFTER UPDATE OF description, kpi ON activities
+BEGIN
+    INSERT INTO activities_fts(activities_fts, rowid, description, kpi) VALUES ('delete', old.rowid, old.description, old.kpi);
+    INSERT INTO activities_fts(rowid, description, kpi) VALUES (new.rowid, new.description, new.kpi);
+END;
+
+INSERT INTO activities_fts(activities_fts) VALUES ('rebuild');
@@ -0,0 +1,449 @@
+-- Materialized counters for dashboard statistics.
+--
+-- One row per (table, dimension, bucket) holding the number of active rows
+-- (deleted_at IS NULL) with that value, so `count_by_*` style breakdowns read
+-- a handful of rows instead of grouping the whole table. `_active` and
+-- `_total` hold the active and overall row counts of each table.
+--
+-- Triggers update the counters inside the statement that changes the row, so
+-- they commit or roll back together with the create/update/delete. NULL
+-- values are stored as is_null = 1 with an empty bucket. If the counters ever
+-- drift they can be recomputed with the `stats_rebuild` FFI call.
+
+CREATE TABLE IF NOT EXISTS stat_counters (
+    table_name TEXT NOT NULL,
+    dimension TEXT NOT NULL,
+    is_null INTEGER NOT NULL DEFAULT 0,
+    bucket TEXT NOT NULL DEFAULT '',
+    row_count INTEGER NOT NULL DEFAULT 0,
+    PRIMARY KEY (table_name, dimension, is_null, bucket)
+) WITHOUT ROWID;
+
+-- participants
+CREATE TRIGGER IF NOT EXISTS participants_stats_insert AFTER INSERT ON participants
+BEGIN
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'participants', '_total', 0, '', 1 WHERE 1
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'participants', '_active', 0, '', 1 WHERE new.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'participants', 'gender', new.gender IS NULL, COALESCE(CAST(new.gender AS TEXT), ''), 1 WHERE new.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'participants', 'age_group', new.age_group IS NULL, COALESCE(CAST(new.age_group AS TEXT), ''), 1 WHERE new.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'participants', 'location', new.location IS NULL, COALESCE(CAST(new.location AS TEXT), ''), 1 WHERE new.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'participants', 'disability', new.disability IS NULL, COALESCE(CAST(new.disability AS TEXT), ''), 1 WHERE new.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'participants', 'disability_type', new.disability_type IS NULL, COALESCE(CAST(new.disability_type AS TEXT), ''), 1 WHERE new.deleted_at IS NULL AND new.disability = 1
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+END;
+
+CREATE TRIGGER IF NOT EXISTS participants_stats_delete AFTER DELETE ON participants
+BEGIN
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'participants', '_total', 0, '', -1 WHERE 1
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'participants', '_active', 0, '', -1 WHERE old.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'participants', 'gender', old.gender IS NULL, COALESCE(CAST(old.gender AS TEXT), ''), -1 WHERE old.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'participants', 'age_group', old.age_group IS NULL, COALESCE(CAST(old.age_group AS TEXT), ''), -1 WHERE old.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'participants', 'location', old.location IS NULL, COALESCE(CAST(old.location AS TEXT), ''), -1 WHERE old.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'participants', 'disability', old.disability IS NULL, COALESCE(CAST(old.disability AS TEXT), ''), -1 WHERE old.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'participants', 'disability_type', old.disability_type IS NULL, COALESCE(CAST(old.disability_type AS TEXT), ''), -1 WHERE old.deleted_at IS NULL AND old.disability = 1
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+END;
+
+CREATE TRIGGER IF NOT EXISTS participants_stats_update AFTER UPDATE OF deleted_at, age_group, disability, disability_type, gender, location ON participants
+BEGIN
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'participants', '_active', 0, '', -1 WHERE old.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'participants', 'gender', old.gender IS NULL, COALESCE(CAST(old.gender AS TEXT), ''), -1 WHERE old.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'participants', 'age_group', old.age_group IS NULL, COALESCE(CAST(old.age_group AS TEXT), ''), -1 WHERE old.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'participants', 'location', old.location IS NULL, COALESCE(CAST(old.location AS TEXT), ''), -1 WHERE old.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'participants', 'disability', old.disability IS NULL, COALESCE(CAST(old.disability AS TEXT), ''), -1 WHERE old.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'participants', 'disability_type', old.disability_type IS NULL, COALESCE(CAST(old.disability_type AS TEXT), ''), -1 WHERE old.deleted_at IS NULL AND old.disability = 1
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'participants', '_active', 0, '', 1 WHERE new.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'participants', 'gender', new.gender IS NULL, COALESCE(CAST(new.gender AS TEXT), ''), 1 WHERE new.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'participants', 'age_group', new.age_group IS NULL, COALESCE(CAST(new.age_group AS TEXT), ''), 1 WHERE new.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'participants', 'location', new.location IS NULL, COALESCE(CAST(new.location AS TEXT), ''), 1 WHERE new.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'participants', 'disability', new.disability IS NULL, COALESCE(CAST(new.disability AS TEXT), ''), 1 WHERE new.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'participants', 'disability_type', new.disability_type IS NULL, COALESCE(CAST(new.disability_type AS TEXT), ''), 1 WHERE new.deleted_at IS NULL AND new.disability = 1
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+END;
+
+-- projects
+CREATE TRIGGER IF NOT EXISTS projects_stats_insert AFTER INSERT ON projects
+BEGIN
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'projects', '_total', 0, '', 1 WHERE 1
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'projects', '_active', 0, '', 1 WHERE new.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'projects', 'status_id', new.status_id IS NULL, COALESCE(CAST(new.status_id AS TEXT), ''), 1 WHERE new.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'projects', 'strategic_goal_id', new.strategic_goal_id IS NULL, COALESCE(CAST(new.strategic_goal_id AS TEXT), ''), 1 WHERE new.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'projects', 'responsible_team', new.responsible_team IS NULL, COALESCE(CAST(new.responsible_team AS TEXT), ''), 1 WHERE new.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+END;
+
+CREATE TRIGGER IF NOT EXISTS projects_stats_delete AFTER DELETE ON projects
+BEGIN
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'projects', '_total', 0, '', -1 WHERE 1
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'projects', '_active', 0, '', -1 WHERE old.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'projects', 'status_id', old.status_id IS NULL, COALESCE(CAST(old.status_id AS TEXT), ''), -1 WHERE old.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'projects', 'strategic_goal_id', old.strategic_goal_id IS NULL, COALESCE(CAST(old.strategic_goal_id AS TEXT), ''), -1 WHERE old.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'projects', 'responsible_team', old.responsible_team IS NULL, COALESCE(CAST(old.responsible_team AS TEXT), ''), -1 WHERE old.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+END;
+
+CREATE TRIGGER IF NOT EXISTS projects_stats_update AFTER UPDATE OF deleted_at, responsible_team, status_id, strategic_goal_id ON projects
+BEGIN
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'projects', '_active', 0, '', -1 WHERE old.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'projects', 'status_id', old.status_id IS NULL, COALESCE(CAST(old.status_id AS TEXT), ''), -1 WHERE old.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'projects', 'strategic_goal_id', old.strategic_goal_id IS NULL, COALESCE(CAST(old.strategic_goal_id AS TEXT), ''), -1 WHERE old.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'projects', 'responsible_team', old.responsible_team IS NULL, COALESCE(CAST(old.responsible_team AS TEXT), ''), -1 WHERE old.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'projects', '_active', 0, '', 1 WHERE new.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'projects', 'status_id', new.status_id IS NULL, COALESCE(CAST(new.status_id AS TEXT), ''), 1 WHERE new.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'projects', 'strategic_goal_id', new.strategic_goal_id IS NULL, COALESCE(CAST(new.strategic_goal_id AS TEXT), ''), 1 WHERE new.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'projects', 'responsible_team', new.responsible_team IS NULL, COALESCE(CAST(new.responsible_team AS TEXT), ''), 1 WHERE new.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+END;
+
+-- activities
+CREATE TRIGGER IF NOT EXISTS activities_stats_insert AFTER INSERT ON activities
+BEGIN
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'activities', '_total', 0, '', 1 WHERE 1
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'activities', '_active', 0, '', 1 WHERE new.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'activities', 'status_id', new.status_id IS NULL, COALESCE(CAST(new.status_id AS TEXT), ''), 1 WHERE new.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'activities', 'project_id', new.project_id IS NULL, COALESCE(CAST(new.project_id AS TEXT), ''), 1 WHERE new.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+END;
+
+CREATE TRIGGER IF NOT EXISTS activities_stats_delete AFTER DELETE ON activities
+BEGIN
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'activities', '_total', 0, '', -1 WHERE 1
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'activities', '_active', 0, '', -1 WHERE old.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'activities', 'status_id', old.status_id IS NULL, COALESCE(CAST(old.status_id AS TEXT), ''), -1 WHERE old.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'activities', 'project_id', old.project_id IS NULL, COALESCE(CAST(old.project_id AS TEXT), ''), -1 WHERE old.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+END;
+
+CREATE TRIGGER IF NOT EXISTS activities_stats_update AFTER UPDATE OF deleted_at, project_id, status_id ON activities
+BEGIN
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'activities', '_active', 0, '', -1 WHERE old.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'activities', 'status_id', old.status_id IS NULL, COALESCE(CAST(old.status_id AS TEXT), ''), -1 WHERE old.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'activities', 'project_id', old.project_id IS NULL, COALESCE(CAST(old.project_id AS TEXT), ''), -1 WHERE old.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'activities', '_active', 0, '', 1 WHERE new.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'activities', 'status_id', new.status_id IS NULL, COALESCE(CAST(new.status_id AS TEXT), ''), 1 WHERE new.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'activities', 'project_id', new.project_id IS NULL, COALESCE(CAST(new.project_id AS TEXT), ''), 1 WHERE new.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+END;
+
+-- workshops
+CREATE TRIGGER IF NOT EXISTS workshops_stats_insert AFTER INSERT ON workshops
+BEGIN
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'workshops', '_total', 0, '', 1 WHERE 1
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'workshops', '_active', 0, '', 1 WHERE new.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'workshops', 'location', new.location IS NULL, COALESCE(CAST(new.location AS TEXT), ''), 1 WHERE new.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'workshops', 'project_id', new.project_id IS NULL, COALESCE(CAST(new.project_id AS TEXT), ''), 1 WHERE new.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+END;
+
+CREATE TRIGGER IF NOT EXISTS workshops_stats_delete AFTER DELETE ON workshops
+BEGIN
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'workshops', '_total', 0, '', -1 WHERE 1
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'workshops', '_active', 0, '', -1 WHERE old.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'workshops', 'location', old.location IS NULL, COALESCE(CAST(old.location AS TEXT), ''), -1 WHERE old.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'workshops', 'project_id', old.project_id IS NULL, COALESCE(CAST(old.project_id AS TEXT), ''), -1 WHERE old.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+END;
+
+CREATE TRIGGER IF NOT EXISTS workshops_stats_update AFTER UPDATE OF deleted_at, location, project_id ON workshops
+BEGIN
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'workshops', '_active', 0, '', -1 WHERE old.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'workshops', 'location', old.location IS NULL, COALESCE(CAST(old.location AS TEXT), ''), -1 WHERE old.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'workshops', 'project_id', old.project_id IS NULL, COALESCE(CAST(old.project_id AS TEXT), ''), -1 WHERE old.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'workshops', '_active', 0, '', 1 WHERE new.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'workshops', 'location', new.location IS NULL, COALESCE(CAST(new.location AS TEXT), ''), 1 WHERE new.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'workshops', 'project_id', new.project_id IS NULL, COALESCE(CAST(new.project_id AS TEXT), ''), 1 WHERE new.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+END;
+
+-- donors
+CREATE TRIGGER IF NOT EXISTS donors_stats_insert AFTER INSERT ON donors
+BEGIN
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'donors', '_total', 0, '', 1 WHERE 1
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'donors', '_active', 0, '', 1 WHERE new.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'donors', 'type', new.type IS NULL, COALESCE(CAST(new.type AS TEXT), ''), 1 WHERE new.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'donors', 'country', new.country IS NULL, COALESCE(CAST(new.country AS TEXT), ''), 1 WHERE new.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+END;
+
+CREATE TRIGGER IF NOT EXISTS donors_stats_delete AFTER DELETE ON donors
+BEGIN
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'donors', '_total', 0, '', -1 WHERE 1
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'donors', '_active', 0, '', -1 WHERE old.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'donors', 'type', old.type IS NULL, COALESCE(CAST(old.type AS TEXT), ''), -1 WHERE old.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'donors', 'country', old.country IS NULL, COALESCE(CAST(old.country AS TEXT), ''), -1 WHERE old.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+END;
+
+CREATE TRIGGER IF NOT EXISTS donors_stats_update AFTER UPDATE OF deleted_at, country, type ON donors
+BEGIN
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'donors', '_active', 0, '', -1 WHERE old.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'donors', 'type', old.type IS NULL, COALESCE(CAST(old.type AS TEXT), ''), -1 WHERE old.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'donors', 'country', old.country IS NULL, COALESCE(CAST(old.country AS TEXT), ''), -1 WHERE old.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'donors', '_active', 0, '', 1 WHERE new.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'donors', 'type', new.type IS NULL, COALESCE(CAST(new.type AS TEXT), ''), 1 WHERE new.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'donors', 'country', new.country IS NULL, COALESCE(CAST(new.country AS TEXT), ''), 1 WHERE new.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+END;
+
+-- strategic_goals
+CREATE TRIGGER IF NOT EXISTS strategic_goals_stats_insert AFTER INSERT ON strategic_goals
+BEGIN
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'strategic_goals', '_total', 0, '', 1 WHERE 1
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'strategic_goals', '_active', 0, '', 1 WHERE new.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'strategic_goals', 'status_id', new.status_id IS NULL, COALESCE(CAST(new.status_id AS TEXT), ''), 1 WHERE new.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'strategic_goals', 'responsible_team', new.responsible_team IS NULL, COALESCE(CAST(new.responsible_team AS TEXT), ''), 1 WHERE new.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+END;
+
+CREATE TRIGGER IF NOT EXISTS strategic_goals_stats_delete AFTER DELETE ON strategic_goals
+BEGIN
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'strategic_goals', '_total', 0, '', -1 WHERE 1
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'strategic_goals', '_active', 0, '', -1 WHERE old.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'strategic_goals', 'status_id', old.status_id IS NULL, COALESCE(CAST(old.status_id AS TEXT), ''), -1 WHERE old.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'strategic_goals', 'responsible_team', old.responsible_team IS NULL, COALESCE(CAST(old.responsible_team AS TEXT), ''), -1 WHERE old.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+END;
+
+CREATE TRIGGER IF NOT EXISTS strategic_goals_stats_update AFTER UPDATE OF deleted_at, responsible_team, status_id ON strategic_goals
+BEGIN
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'strategic_goals', '_active', 0, '', -1 WHERE old.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'strategic_goals', 'status_id', old.status_id IS NULL, COALESCE(CAST(old.status_id AS TEXT), ''), -1 WHERE old.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'strategic_goals', 'responsible_team', old.responsible_team IS NULL, COALESCE(CAST(old.responsible_team AS TEXT), ''), -1 WHERE old.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'strategic_goals', '_active', 0, '', 1 WHERE new.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'strategic_goals', 'status_id', new.status_id IS NULL, COALESCE(CAST(new.status_id AS TEXT), ''), 1 WHERE new.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+    INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'strategic_goals', 'responsible_team', new.responsible_team IS NULL, COALESCE(CAST(new.responsible_team AS TEXT), ''), 1 WHERE new.deleted_at IS NULL
+    ON CONFLICT (table_name, dimension, is_null, bucket) DO UPDATE SET row_count = row_count + excluded.row_count;
+END;
+
+-- Backfill from existing rows
+INSERT INTO stat_counters (table_name, dimension, row_count) SELECT 'participants', '_total', COUNT(*) FROM participants;
+INSERT INTO stat_counters (table_name, dimension, row_count) SELECT 'participants', '_active', COUNT(*) FROM participants WHERE deleted_at IS NULL;
+INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'participants', 'gender', gender IS NULL, COALESCE(CAST(gender AS TEXT), ''), COUNT(*) FROM participants WHERE deleted_at IS NULL GROUP BY gender;
+INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'participants', 'age_group', age_group IS NULL, COALESCE(CAST(age_group AS TEXT), ''), COUNT(*) FROM participants WHERE deleted_at IS NULL GROUP BY age_group;
+INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'participants', 'location', location IS NULL, COALESCE(CAST(location AS TEXT), ''), COUNT(*) FROM participants WHERE deleted_at IS NULL GROUP BY location;
+INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'participants', 'disability', disability IS NULL, COALESCE(CAST(disability AS TEXT), ''), COUNT(*) FROM participants WHERE deleted_at IS NULL GROUP BY disability;
+INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'participants', 'disability_type', disability_type IS NULL, COALESCE(CAST(disability_type AS TEXT), ''), COUNT(*) FROM participants WHERE deleted_at IS NULL AND disability = 1 GROUP BY disability_type;
+
+INSERT INTO stat_counters (table_name, dimension, row_count) SELECT 'projects', '_total', COUNT(*) FROM projects;
+INSERT INTO stat_counters (table_name, dimension, row_count) SELECT 'projects', '_active', COUNT(*) FROM projects WHERE deleted_at IS NULL;
+INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'projects', 'status_id', status_id IS NULL, COALESCE(CAST(status_id AS TEXT), ''), COUNT(*) FROM projects WHERE deleted_at IS NULL GROUP BY status_id;
+INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'projects', 'strategic_goal_id', strategic_goal_id IS NULL, COALESCE(CAST(strategic_goal_id AS TEXT), ''), COUNT(*) FROM projects WHERE deleted_at IS NULL GROUP BY strategic_goal_id;
+INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'projects', 'responsible_team', responsible_team IS NULL, COALESCE(CAST(responsible_team AS TEXT), ''), COUNT(*) FROM projects WHERE deleted_at IS NULL GROUP BY responsible_team;
+
+INSERT INTO stat_counters (table_name, dimension, row_count) SELECT 'activities', '_total', COUNT(*) FROM activities;
+INSERT INTO stat_counters (table_name, dimension, row_count) SELECT 'activities', '_active', COUNT(*) FROM activities WHERE deleted_at IS NULL;
+INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'activities', 'status_id', status_id IS NULL, COALESCE(CAST(status_id AS TEXT), ''), COUNT(*) FROM activities WHERE deleted_at IS NULL GROUP BY status_id;
+INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'activities', 'project_id', project_id IS NULL, COALESCE(CAST(project_id AS TEXT), ''), COUNT(*) FROM activities WHERE deleted_at IS NULL GROUP BY project_id;
+
+INSERT INTO stat_counters (table_name, dimension, row_count) SELECT 'workshops', '_total', COUNT(*) FROM workshops;
+INSERT INTO stat_counters (table_name, dimension, row_count) SELECT 'workshops', '_active', COUNT(*) FROM workshops WHERE deleted_at IS NULL;
+INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'workshops', 'location', location IS NULL, COALESCE(CAST(location AS TEXT), ''), COUNT(*) FROM workshops WHERE deleted_at IS NULL GROUP BY location;
+INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'workshops', 'project_id', project_id IS NULL, COALESCE(CAST(project_id AS TEXT), ''), COUNT(*) FROM workshops WHERE deleted_at IS NULL GROUP BY project_id;
+
+INSERT INTO stat_counters (table_name, dimension, row_count) SELECT 'donors', '_total', COUNT(*) FROM donors;
+INSERT INTO stat_counters (table_name, dimension, row_count) SELECT 'donors', '_active', COUNT(*) FROM donors WHERE deleted_at IS NULL;
+INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'donors', 'type', type IS NULL, COALESCE(CAST(type AS TEXT), ''), COUNT(*) FROM donors WHERE deleted_at IS NULL GROUP BY type;
+INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'donors', 'country', country IS NULL, COALESCE(CAST(country AS TEXT), ''), COUNT(*) FROM donors WHERE deleted_at IS NULL GROUP BY country;
+
+INSERT INTO stat_counters (table_name, dimension, row_count) SELECT 'strategic_goals', '_total', COUNT(*) FROM strategic_goals;
+INSERT INTO stat_counters (table_name, dimension, row_count) SELECT 'strategic_goals', '_active', COUNT(*) FROM strategic_goals WHERE deleted_at IS NULL;
+INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'strategic_goals', 'status_id', status_id IS NULL, COALESCE(CAST(status_id AS TEXT), ''), COUNT(*) FROM strategic_goals WHERE deleted_at IS NULL GROUP BY status_id;
+INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+    SELECT 'strategic_goals', 'responsible_team', responsible_team IS NULL, COALESCE(CAST(responsible_team AS TEXT), ''), COUNT(*) FROM strategic_goals WHERE deleted_at IS NULL GROUP BY responsible_team;
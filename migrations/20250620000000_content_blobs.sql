@@ -0,0 +1,51 @@
+-- Content-addressed storage for document files.
+--
+-- Uploaded files are stored once per SHA-256 of their bytes under
+-- `blobs/<first two hex digits>/<hash>`; every media document with the same
+-- bytes points at that file and carries the hash in `content_hash`.
+--
+-- `ref_count` is the number of active (deleted_at IS NULL) media documents
+-- referencing the blob. Triggers keep it current inside the statement that
+-- changes the document, so it commits or rolls back with it. The compressed
+-- file and the remote blob key are recorded once per blob so that compression
+-- and upload can be skipped for every further document with the same content.
+-- The FileDeletionWorker only removes blob files no active document needs.
+
+CREATE TABLE IF NOT EXISTS content_blobs (
+    content_hash TEXT PRIMARY KEY NOT NULL,
+    file_path TEXT NOT NULL,
+    size_bytes INTEGER NOT NULL,
+    ref_count INTEGER NOT NULL DEFAULT 0,
+    compressed_file_path TEXT NULL,
+    compressed_size_bytes INTEGER NULL,
+    remote_blob_key TEXT NULL,
+    created_at TEXT NOT NULL DEFAULT (strftime('%Y-%m-%dT%H:%M:%fZ', 'now')),
+    updated_at TEXT NOT NULL DEFAULT (strftime('%Y-%m-%dT%H:%M:%fZ', 'now'))
+);
+
+CREATE INDEX IF NOT EXISTS idx_content_blobs_file_path ON content_blobs(file_path);
+CREATE INDEX IF NOT EXISTS idx_content_blobs_compressed_file_path ON content_blobs(compressed_file_path) WHERE compressed_file_path IS NOT NULL;
+
+ALTER TABLE media_documents ADD COLUMN content_hash TEXT NULL;
+
+CREATE INDEX IF NOT EXISTS idx_media_documents_content_hash ON media_documents(content_hash) WHERE content_hash IS NOT NULL;
+
+CREATE TRIGGER IF NOT EXISTS media_documents_blob_ref_insert AFTER INSERT ON media_documents
+WHEN new.content_hash IS NOT NULL AND new.deleted_at IS NULL
+BEGIN
+    UPDATE content_blobs SET ref_count = ref_count + 1 WHERE content_hash = new.content_hash;
+END;
+
+CREATE TRIGGER IF NOT EXISTS media_documents_blob_ref_delete AFTER DELETE ON media_documents
+WHEN old.content_hash IS NOT NULL AND old.deleted_at IS NULL
+BEGIN
+    UPDATE content_blobs SET ref_count = ref_count - 1 WHERE content_hash = old.content_hash;
+END;
+
+CREATE TRIGGER IF NOT EXISTS media_documents_blob_ref_update AFTER UPDATE OF content_hash, deleted_at ON media_documents
+BEGIN
+    UPDATE content_blobs SET ref_count = ref_count - 1
+    WHERE old.deleted_at IS NULL AND content_hash = old.content_hash;
+    UPDATE content_blobs SET ref_count = ref_count + 1
+    WHERE new.deleted_at IS NULL AND content_hash = new.content_hash;
+END;
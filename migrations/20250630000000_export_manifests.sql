@@ -0,0 +1,20 @@
+-- High-water marks of incremental exports.
+--
+-- One row per exported domain (table). After an incremental export finished
+-- successfully, `row_updated_at`/`row_id` hold the (updated_at, id) of the
+-- last row it emitted and `tombstone_deleted_at`/`tombstone_id` the
+-- (deleted_at, id) of the last tombstone. The next incremental export of the
+-- domain only reads what sorts after those positions. A failed export leaves
+-- the marks untouched, so nothing is skipped.
+
+CREATE TABLE IF NOT EXISTS export_manifests (
+    domain TEXT PRIMARY KEY NOT NULL,
+    row_updated_at TEXT NULL,
+    row_id TEXT NULL,
+    tombstone_deleted_at TEXT NULL,
+    tombstone_id TEXT NULL,
+    last_export_id TEXT NULL,
+    last_exported_at TEXT NULL
+);
+
+CREATE INDEX IF NOT EXISTS idx_tombstones_type_deleted_at ON tombstones(entity_type, deleted_at, id);
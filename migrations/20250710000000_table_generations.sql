@@ -0,0 +1,105 @@
+-- Per-table write generations for the FFI result cache.
+--
+-- Every insert, update or delete on a tracked table bumps its generation.
+-- The triggers run inside the statement that changes the row, so a bump
+-- commits or rolls back with the write itself, whether it comes from a
+-- repository, an applied sync merge or a delete. Cached results remember
+-- the generations they were computed at and are recomputed once any of
+-- their tables has moved on.
+
+CREATE TABLE IF NOT EXISTS table_generations (
+    table_name TEXT PRIMARY KEY,
+    generation INTEGER NOT NULL DEFAULT 0
+) WITHOUT ROWID;
+
+INSERT OR IGNORE INTO table_generations (table_name) VALUES
+    ('strategic_goals'),
+    ('projects'),
+    ('project_funding'),
+    ('workshops'),
+    ('document_types'),
+    ('media_documents');
+
+-- strategic_goals
+CREATE TRIGGER IF NOT EXISTS strategic_goals_generation_insert AFTER INSERT ON strategic_goals
+BEGIN
+    UPDATE table_generations SET generation = generation + 1 WHERE table_name = 'strategic_goals';
+END;
+CREATE TRIGGER IF NOT EXISTS strategic_goals_generation_update AFTER UPDATE ON strategic_goals
+BEGIN
+    UPDATE table_generations SET generation = generation + 1 WHERE table_name = 'strategic_goals';
+END;
+CREATE TRIGGER IF NOT EXISTS strategic_goals_generation_delete AFTER DELETE ON strategic_goals
+BEGIN
+    UPDATE table_generations SET generation = generation + 1 WHERE table_name = 'strategic_goals';
+END;
+
+-- projects
+CREATE TRIGGER IF NOT EXISTS projects_generation_insert AFTER INSERT ON projects
+BEGIN
+    UPDATE table_generations SET generation = generation + 1 WHERE table_name = 'projects';
+END;
+CREATE TRIGGER IF NOT EXISTS projects_generation_update AFTER UPDATE ON projects
+BEGIN
+    UPDATE table_generations SET generation = generation + 1 WHERE table_name = 'projects';
+END;
+CREATE TRIGGER IF NOT EXISTS projects_generation_delete AFTER DELETE ON projects
+BEGIN
+    UPDATE table_generations SET generation = generation + 1 WHERE table_name = 'projects';
+END;
+
+-- project_funding
+CREATE TRIGGER IF NOT EXISTS project_funding_generation_insert AFTER INSERT ON project_funding
+BEGIN
+    UPDATE table_generations SET generation = generation + 1 WHERE table_name = 'project_funding';
+END;
+CREATE TRIGGER IF NOT EXISTS project_funding_generation_update AFTER UPDATE ON project_funding
+BEGIN
+    UPDATE table_generations SET generation = generation + 1 WHERE table_name = 'project_funding';
+END;
+CREATE TRIGGER IF NOT EXISTS project_funding_generation_delete AFTER DELETE ON project_funding
+BEGIN
+    UPDATE table_generations SET generation = generation + 1 WHERE table_name = 'project_funding';
+END;
+
+-- workshops
+CREATE TRIGGER IF NOT EXISTS workshops_generation_insert AFTER INSERT ON workshops
+BEGIN
+    UPDATE table_generations SET generation = generation + 1 WHERE table_name = 'workshops';
+END;
+CREATE TRIGGER IF NOT EXISTS workshops_generation_update AFTER UPDATE ON workshops
+BEGIN
+    UPDATE table_generations SET generation = generation + 1 WHERE table_name = 'workshops';
+END;
+CREATE TRIGGER IF NOT EXISTS workshops_generation_delete AFTER DELETE ON workshops
+BEGIN
+    UPDATE table_generations SET generation = generation + 1 WHERE table_name = 'workshops';
+END;
+
+-- document_types
+CREATE TRIGGER IF NOT EXISTS document_types_generation_insert AFTER INSERT ON document_types
+BEGIN
+    UPDATE table_generations SET generation = generation + 1 WHERE table_name = 'document_types';
+END;
+CREATE TRIGGER IF NOT EXISTS document_types_generation_update AFTER UPDATE ON document_types
+BEGIN
+    UPDATE table_generations SET generation = generation + 1 WHERE table_name = 'document_types';
+END;
+CREATE TRIGGER IF NOT EXISTS document_types_generation_delete AFTER DELETE ON document_types
+BEGIN
+    UPDATE table_generations SET generation = generation + 1 WHERE table_name = 'document_types';
+END;
+
+-- media_documents
+CREATE TRIGGER IF NOT EXISTS media_documents_generation_insert AFTER INSERT ON media_documents
+BEGIN
+    UPDATE table_generations SET generation = generation + 1 WHERE table_name = 'media_documents';
+END;
+CREATE TRIGGER IF NOT EXISTS media_documents_generation_update AFTER UPDATE ON media_documents
+BEGIN
+    UPDATE table_generations SET generation = generation + 1 WHERE table_name = 'media_documents';
+END;
+CREATE TRIGGER IF NOT EXISTS media_documents_generation_delete AFTER DELETE ON media_documents
+BEGIN
+    UPDATE table_generations SET generation = generation + 1 WHERE table_name = 'media_documents';
+END;
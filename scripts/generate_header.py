@@ -64,6 +64,20 @@ def convert_params_to_c(params: str) -> str:
         param_type = re.sub(r'\*mut \*mut c_char', 'char**', param_type)
         param_type = re.sub(r'\*mut c_char', 'char*', param_type)
         param_type = re.sub(r'c_int', 'int32_t', param_type)
+        param_type = re.sub(r'\*mut c_void', 'void*', param_type)
+        param_type = re.sub(r'\*const \*const u8', 'const uint8_t* const*', param_type)
+        param_type = re.sub(r'\*mut \*mut u8', 'uint8_t**', param_type)
+        param_type = re.sub(r'\*mut \*const u8', 'const uint8_t**', param_type)
+        param_type = re.sub(r'\*const u8', 'const uint8_t*', param_type)
+        param_type = re.sub(r'\*mut u8', 'uint8_t*', param_type)
+        param_type = re.sub(r'\*const usize', 'const size_t*', param_type)
+        param_type = re.sub(r'\*mut usize', 'size_t*', param_type)
+        param_type = re.sub(r'\busize\b', 'size_t', param_type)
+        param_type = re.sub(r'\*mut u64', 'uint64_t*', param_type)
+        param_type = re.sub(r'\bu64\b', 'uint64_t', param_type)
+        param_type = re.sub(r'\bu32\b', 'uint32_t', param_type)
+        param_type = re.sub(r'FfiCompletionCallback', 'ffi_completion_callback_t', param_type)
+        param_type = re.sub(r'FfiSignpostCallback', 'ffi_signpost_callback_t', param_type)
         param_type = re.sub(r'bool', 'bool', param_type)
         
         if param_type:  # Only add non-empty types
@@ -103,6 +117,7 @@ def generate_header():
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -114,6 +129,15 @@ extern "C" {
 // DO NOT EDIT MANUALLY - regenerate using scripts/generate_header.py
 // ============================================================================
 
+// Completion callback for *_async entry points: (ctx, status, result).
+// On success `result` must be freed with the matching *_free function; on a
+// non-zero status it is the error message (or NULL), freed with free_string.
+typedef void (*ffi_completion_callback_t)(void*, int32_t, char*);
+
+// Signpost callback for core_set_signpost_callback: (name, is_begin, id).
+// The begin and end of one call carry the same id.
+typedef void (*ffi_signpost_callback_t)(const char*, bool, uint64_t);
+
 '''
 
     # Get all FFI files
@@ -2,6 +2,7 @@ pub mod context;
 pub mod service;
 mod repository;
 pub mod jwt;
+mod token_cache;
 
 // Re-export public items
 pub use context::AuthContext;
@@ -16,6 +16,7 @@ pub(crate) trait AuthRepository: Send + Sync {
     async fn add_revoked_token(&self, jti: &str, expiry: i64) -> DbResult<()>;
     async fn is_token_revoked(&self, jti: &str) -> DbResult<bool>;
     async fn delete_expired_revoked_tokens(&self) -> DbResult<u64>;
+    async fn list_active_revoked_tokens(&self) -> DbResult<Vec<(String, i64)>>;
 }
 
 pub(crate) struct SqliteAuthRepository {
@@ -140,4 +141,14 @@ impl AuthRepository for SqliteAuthRepository {
             .map_err(DbError::from)?;
         Ok(result.rows_affected())
     }
+
+    async fn list_active_revoked_tokens(&self) -> DbResult<Vec<(String, i64)>> {
+        let now = Utc::now().timestamp();
+        let rows: Vec<(String, i64)> = sqlx::query_as("SELECT jti, expiry FROM revoked_tokens WHERE expiry >= ?")
+            .bind(now)
+            .fetch_all(&self.pool)
+            .await
+            .map_err(DbError::from)?;
+        Ok(rows)
+    }
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 use crate::errors::{ServiceError, ServiceResult, DomainError};
 use crate::auth::{AuthContext, AuthRepository, jwt};
+use crate::auth::token_cache::{self, TokenCache};
 use crate::types::UserRole;
 use uuid::Uuid;
 use argon2::{Argon2, PasswordHash, PasswordVerifier, PasswordHasher, password_hash::SaltString};
@@ -26,6 +27,8 @@ pub struct AuthService {
     auth_repo: Arc<dyn AuthRepository>,
     device_id: String,
     offline_mode: bool,
+    /// Verified access tokens and the in-memory revoked-JTI set
+    token_cache: TokenCache,
 }
 
 impl AuthService {
@@ -41,8 +44,31 @@ impl AuthService {
             auth_repo,
             device_id,
             offline_mode,
+            token_cache: TokenCache::default(),
         }
     }
+
+    /// Load the persisted blocklist into memory so `verify_token` can check
+    /// revocation without a database round-trip. Called once at startup.
+    pub async fn load_revoked_tokens(&self) -> ServiceResult<usize> {
+        let removed = self.auth_repo.delete_expired_revoked_tokens()
+            .await.map_err(DomainError::Database)?;
+        let active = self.auth_repo.list_active_revoked_tokens()
+            .await.map_err(DomainError::Database)?;
+        let count = self.token_cache.load_revoked(active);
+        log::debug!("Loaded {} revoked token JTIs ({} expired entries purged)", count, removed);
+        Ok(count)
+    }
+
+    /// Add a JTI to the persisted blocklist and the in-memory set, dropping
+    /// in-memory entries whose tokens have expired so the set stays bounded
+    async fn revoke_jti(&self, jti: &str, expiry: i64) -> ServiceResult<()> {
+        self.token_cache.prune_revoked(Utc::now().timestamp());
+        self.token_cache.revoke(jti, expiry);
+        self.auth_repo.add_revoked_token(jti, expiry)
+            .await.map_err(DomainError::Database)?;
+        Ok(())
+    }
     
     /// Authenticate a user with email and password, returning access and refresh tokens
     pub async fn login(&self, email: &str, password: &str) -> ServiceResult<LoginResult> {
@@ -101,16 +127,21 @@ impl AuthService {
     }
     
     /// Verify an access token and create an auth context
+    ///
+    /// Tokens that already passed verification are served from an in-memory
+    /// LRU (keyed on the token's SHA-256) until their `exp`, skipping the HMAC
+    /// check and the blocklist query.
     pub async fn verify_token(&self, token: &str) -> ServiceResult<AuthContext> {
+        let key = token_cache::token_key(token);
+        if let Some(auth_context) = self.token_cache.get(&key, Utc::now().timestamp()) {
+            return Ok(auth_context);
+        }
+
         // Verify token signature and standard claims (like expiry)
         let claims = jwt::verify_token(token)?;
 
-        // Check blocklist
-        let is_revoked = self.auth_repo.is_token_revoked(&claims.jti)
-            .await
-            .map_err(|db_err| ServiceError::Domain(DomainError::Database(db_err)))?; // Map DbError to ServiceError
-
-        if is_revoked {
+        // Check blocklist (loaded into memory at startup and kept current by logout)
+        if self.token_cache.is_revoked(&claims.jti) {
             log::warn!("Attempted to use revoked token JTI: {}", claims.jti);
             return Err(ServiceError::Authentication("Token has been revoked".to_string()));
         }
@@ -134,6 +165,8 @@ impl AuthService {
             claims.device_id, // Use device ID from token
             self.offline_mode,
         );
+
+        self.token_cache.insert(key, auth_context.clone(), claims.jti, claims.exp);
         
         Ok(auth_context)
     }
@@ -182,7 +215,8 @@ impl AuthService {
         // If decode fails, we still log the user out but log an error.
         match jwt::decode_unverified(access_token) {
             Ok(claims) => {
-                if let Err(e) = self.auth_repo.add_revoked_token(&claims.jti, claims.exp).await {
+                self.token_cache.invalidate(&token_cache::token_key(access_token));
+                if let Err(e) = self.revoke_jti(&claims.jti, claims.exp).await {
                     log::error!("Failed to add access token JTI {} to blocklist: {}", claims.jti, e);
                 }
             },
@@ -198,7 +232,7 @@ impl AuthService {
                     if let Some(refresh_exp) = claims.refresh_exp {
                         // Use refresh_exp if available, otherwise fall back to exp (though refresh should always have refresh_exp)
                         let expiry = refresh_exp;
-                        if let Err(e) = self.auth_repo.add_revoked_token(&claims.jti, expiry).await {
+                        if let Err(e) = self.revoke_jti(&claims.jti, expiry).await {
                             log::error!("Failed to add refresh token JTI {} to blocklist: {}", claims.jti, e);
                         }
                     } else {
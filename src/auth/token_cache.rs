@@ -0,0 +1,200 @@
+use crate::auth::AuthContext;
+use sha2::{Digest, Sha256};
+use std::collections::{BTreeMap, HashMap};
+use std::sync::{Mutex, RwLock};
+
+/// Default number of verified tokens kept in memory
+pub const DEFAULT_TOKEN_CACHE_CAPACITY: usize = 256;
+
+/// SHA-256 of the raw token string; the token itself is never stored
+pub type TokenKey = [u8; 32];
+
+/// Hash a token for use as a cache key
+pub fn token_key(token: &str) -> TokenKey {
+    Sha256::digest(token.as_bytes()).into()
+}
+
+struct CachedToken {
+    auth_context: AuthContext,
+    jti: String,
+    exp: i64,
+    last_used: u64,
+}
+
+struct LruState {
+    entries: HashMap<TokenKey, CachedToken>,
+    /// Recency order: access tick -> key (oldest first)
+    order: BTreeMap<u64, TokenKey>,
+    tick: u64,
+}
+
+impl LruState {
+    fn remove(&mut self, key: &TokenKey) -> Option<CachedToken> {
+        let entry = self.entries.remove(key)?;
+        self.order.remove(&entry.last_used);
+        Some(entry)
+    }
+
+    fn next_tick(&mut self) -> u64 {
+        self.tick += 1;
+        self.tick
+    }
+}
+
+/// Bounded LRU of verified access tokens plus the in-memory revoked-JTI set.
+///
+/// A hit means the token already passed signature verification and the
+/// revocation check; it is only served while `exp` is in the future and the
+/// JTI has not been revoked since.
+pub struct TokenCache {
+    capacity: usize,
+    lru: Mutex<LruState>,
+    /// Revoked JTI -> expiry (unix seconds), mirrored from `revoked_tokens`
+    revoked: RwLock<HashMap<String, i64>>,
+}
+
+impl TokenCache {
+    pub fn new(capacity: usize) -> Self {
+        Self {
+            capacity: capacity.max(1),
+            lru: Mutex::new(LruState {
+                entries: HashMap::new(),
+                order: BTreeMap::new(),
+                tick: 0,
+            }),
+            revoked: RwLock::new(HashMap::new()),
+        }
+    }
+
+    /// Look up a verified token, dropping it if it expired or was revoked
+    pub fn get(&self, key: &TokenKey, now: i64) -> Option<AuthContext> {
+        let mut lru = self.lru.lock().unwrap();
+        let (exp, jti) = match lru.entries.get(key) {
+            Some(entry) => (entry.exp, entry.jti.clone()),
+            None => return None,
+        };
+
+        if exp <= now || self.is_revoked(&jti) {
+            lru.remove(key);
+            return None;
+        }
+
+        let tick = lru.next_tick();
+        let entry = lru.entries.get_mut(key)?;
+        let previous = std::mem::replace(&mut entry.last_used, tick);
+        let auth_context = entry.auth_context.clone();
+        lru.order.remove(&previous);
+        lru.order.insert(tick, *key);
+        Some(auth_context)
+    }
+
+    /// Cache a freshly verified token until `exp`
+    pub fn insert(&self, key: TokenKey, auth_context: AuthContext, jti: String, exp: i64) {
+        let mut lru = self.lru.lock().unwrap();
+        lru.remove(&key);
+
+        while lru.entries.len() >= self.capacity {
+            let oldest = match lru.order.iter().next() {
+                Some((_, k)) => *k,
+                None => break,
+            };
+            lru.remove(&oldest);
+        }
+
+        let tick = lru.next_tick();
+        lru.order.insert(tick, key);
+        lru.entries.insert(key, CachedToken { auth_context, jti, exp, last_used: tick });
+    }
+
+    /// Drop a single token from the cache
+    pub fn invalidate(&self, key: &TokenKey) {
+        self.lru.lock().unwrap().remove(key);
+    }
+
+    /// Whether the JTI is on the in-memory blocklist
+    pub fn is_revoked(&self, jti: &str) -> bool {
+        self.revoked.read().unwrap().contains_key(jti)
+    }
+
+    /// Add a JTI to the in-memory blocklist; cached entries carrying it are
+    /// rejected (and evicted) on their next lookup
+    pub fn revoke(&self, jti: &str, expiry: i64) {
+        self.revoked.write().unwrap().insert(jti.to_string(), expiry);
+    }
+
+    /// Replace the blocklist with the persisted set (called once at startup)
+    pub fn load_revoked<I: IntoIterator<Item = (String, i64)>>(&self, tokens: I) -> usize {
+        let mut revoked = self.revoked.write().unwrap();
+        revoked.clear();
+        revoked.extend(tokens);
+        revoked.len()
+    }
+
+    /// Forget blocklist entries whose tokens have expired anyway
+    pub fn prune_revoked(&self, now: i64) {
+        self.revoked.write().unwrap().retain(|_, expiry| *expiry >= now);
+    }
+
+    pub fn len(&self) -> usize {
+        self.lru.lock().unwrap().entries.len()
+    }
+}
+
+impl Default for TokenCache {
+    fn default() -> Self {
+        Self::new(DEFAULT_TOKEN_CACHE_CAPACITY)
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::types::UserRole;
+    use uuid::Uuid;
+
+    fn context() -> AuthContext {
+        AuthContext::new(Uuid::new_v4(), UserRole::FieldOfficer, "device".to_string(), false)
+    }
+
+    #[test]
+    fn expired_and_revoked_entries_are_not_served() {
+        let cache = TokenCache::new(4);
+        let a = token_key("token-a");
+        let b = token_key("token-b");
+        cache.insert(a, context(), "jti-a".to_string(), 100);
+        cache.insert(b, context(), "jti-b".to_string(), 200);
+
+        assert!(cache.get(&a, 50).is_some());
+        assert!(cache.get(&a, 100).is_none());
+
+        cache.revoke("jti-b", 200);
+        assert!(cache.get(&b, 50).is_none());
+        assert_eq!(cache.len(), 0);
+    }
+
+    #[test]
+    fn least_recently_used_entry_is_evicted() {
+        let cache = TokenCache::new(2);
+        let a = token_key("a");
+        let b = token_key("b");
+        let c = token_key("c");
+        cache.insert(a, context(), "a".to_string(), 1_000);
+        cache.insert(b, context(), "b".to_string(), 1_000);
+        assert!(cache.get(&a, 0).is_some());
+
+        cache.insert(c, context(), "c".to_string(), 1_000);
+        assert!(cache.get(&a, 0).is_some());
+        assert!(cache.get(&b, 0).is_none());
+        assert!(cache.get(&c, 0).is_some());
+    }
+
+    #[test]
+    fn pruning_drops_only_expired_revocations() {
+        let cache = TokenCache::new(2);
+        cache.revoke("old", 100);
+        cache.revoke("current", 300);
+        cache.prune_revoked(200);
+        assert!(!cache.is_revoked("old"));
+        assert!(cache.is_revoked("current"));
+    }
+}
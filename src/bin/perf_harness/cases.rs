@@ -0,0 +1,268 @@
+//! Timed cases of the perf harness.
+//!
+//! Each case goes through the same entry point Swift uses, with a warm-up call
+//! before the timed iterations. Sync has no push/pull FFI, so the sync cases
+//! drive `SyncServiceImpl` directly against `MockCloudStorageService`; push
+//! consumes the change log, so it is timed once.
+
+use crate::seed::{call_ffi, Fixture, PayloadFn};
+use crate::last_error;
+use ipad_rust_core::auth::AuthContext;
+use ipad_rust_core::domains::sync::cloud_storage::MockCloudStorageService;
+use ipad_rust_core::domains::sync::service::{SyncService, SyncServiceImpl};
+use ipad_rust_core::ffi::{block_on_async, compression, export, participant};
+use ipad_rust_core::globals;
+use ipad_rust_core::types::UserRole;
+use serde::{Deserialize, Serialize};
+use serde_json::json;
+use std::error::Error;
+use std::ffi::{CStr, CString};
+use std::os::raw::c_char;
+use std::path::Path;
+use std::sync::Arc;
+use std::time::Instant;
+
+pub const CASE_NAMES: [&str; 7] = [
+    "participant_filter",
+    "participant_filter_workshops",
+    "participant_search_like",
+    "participant_search_fts",
+    "export_unified",
+    "compress_image",
+    "sync_push_pull",
+];
+
+/// Timings of one case at one dataset size
+#[derive(Debug, Clone, Serialize, Deserialize)]
+pub struct CaseResult {
+    pub case: String,
+    pub size: usize,
+    pub iterations: usize,
+    pub min_ms: f64,
+    pub median_ms: f64,
+    pub p95_ms: f64,
+}
+
+impl CaseResult {
+    /// Baseline key: "size/case"
+    pub fn key(&self) -> String {
+        format!("{}/{}", self.size, self.case)
+    }
+
+    fn from_samples(case: &str, size: usize, mut samples: Vec<f64>) -> Self {
+        samples.sort_by(|a, b| a.total_cmp(b));
+        let at = |q: f64| samples[((samples.len() - 1) as f64 * q).round() as usize];
+        Self {
+            case: case.to_string(),
+            size,
+            iterations: samples.len(),
+            min_ms: samples[0],
+            median_ms: at(0.5),
+            p95_ms: at(0.95),
+        }
+    }
+}
+
+/// Time `iterations` runs of `run` after one untimed warm-up. `prepare`
+/// runs untimed before each call, with the iteration number.
+fn time_case(
+    case: &str,
+    size: usize,
+    iterations: usize,
+    mut prepare: impl FnMut(usize) -> Result<(), Box<dyn Error>>,
+    mut run: impl FnMut(usize) -> Result<(), Box<dyn Error>>,
+) -> Result<CaseResult, Box<dyn Error>> {
+    prepare(0)?;
+    run(0)?;
+    let mut samples = Vec::with_capacity(iterations);
+    for i in 1..=iterations {
+        prepare(i)?;
+        let started = Instant::now();
+        run(i)?;
+        samples.push(started.elapsed().as_secs_f64() * 1000.0);
+    }
+    Ok(CaseResult::from_samples(case, size, samples))
+}
+
+/// Run the selected cases (all when `only` is None)
+pub fn run_all(fixture: &Fixture, iterations: usize, only: Option<&[String]>) -> Result<Vec<CaseResult>, Box<dyn Error>> {
+    let selected = |case: &str| only.map_or(true, |names| names.iter().any(|n| n == case));
+    let mut results = Vec::new();
+    for case in CASE_NAMES {
+        if !selected(case) {
+            continue;
+        }
+        let result = match case {
+            "participant_filter" => participant_filter(fixture, iterations, false),
+            "participant_filter_workshops" => participant_filter(fixture, iterations, true),
+            "participant_search_like" => participant_search(fixture, iterations, "like"),
+            "participant_search_fts" => participant_search(fixture, iterations, "fts"),
+            "export_unified" => export_unified(fixture, iterations),
+            "compress_image" => compress_image(fixture, iterations),
+            "sync_push_pull" => sync_push_pull(fixture, iterations),
+            _ => unreachable!(),
+        }
+        .map_err(|e| format!("{}: {}", case, e))?;
+        for r in &result {
+            println!("   {:<32} median {:>9.2} ms", r.case, r.median_ms);
+        }
+        results.extend(result);
+    }
+    Ok(results)
+}
+
+fn payload_call(function: PayloadFn, payload: &serde_json::Value) -> Result<(), Box<dyn Error>> {
+    call_ffi(function, payload).map(|_| ())
+}
+
+fn participant_filter(fixture: &Fixture, iterations: usize, by_workshop: bool) -> Result<Vec<CaseResult>, Box<dyn Error>> {
+    let mut filter = json!({
+        "genders": ["female", "other"],
+        "age_groups": ["youth", "adult"],
+    });
+    if by_workshop {
+        let workshops: Vec<String> = fixture.workshop_ids.iter().take(10).map(|id| id.to_string()).collect();
+        filter["workshop_ids"] = json!(workshops);
+    }
+    let payload = json!({ "filter": filter, "auth": fixture.auth });
+    let case = if by_workshop { "participant_filter_workshops" } else { "participant_filter" };
+    let result = time_case(case, fixture.size, iterations, |_| Ok(()), |_| {
+        payload_call(participant::participant_find_ids_by_filter, &payload)
+    })?;
+    Ok(vec![result])
+}
+
+fn participant_search(fixture: &Fixture, iterations: usize, mode: &str) -> Result<Vec<CaseResult>, Box<dyn Error>> {
+    let payload = json!({
+        "search_text": "Thap",
+        "mode": mode,
+        "pagination": { "page": 1, "per_page": 50 },
+        "auth": fixture.auth,
+    });
+    let case = format!("participant_search_{}", mode);
+    let result = time_case(&case, fixture.size, iterations, |_| Ok(()), |_| {
+        payload_call(participant::participant_search_with_relationships, &payload)
+    })?;
+    Ok(vec![result])
+}
+
+type TokenFn = unsafe extern "C" fn(*const c_char, *const c_char, *mut *mut c_char) -> i32;
+
+/// Call a token-style FFI function (the export API), discarding its result
+fn token_call(function: TokenFn, request: &serde_json::Value, token: &str) -> Result<(), Box<dyn Error>> {
+    let request = CString::new(request.to_string())?;
+    let token = CString::new(token)?;
+    let mut result: *mut c_char = std::ptr::null_mut();
+    let code = unsafe { function(request.as_ptr(), token.as_ptr(), &mut result) };
+    if code != 0 {
+        return Err(last_error().into());
+    }
+    if !result.is_null() {
+        unsafe {
+            let status: serde_json::Value = serde_json::from_slice(CStr::from_ptr(result).to_bytes()).unwrap_or_default();
+            ipad_rust_core::ffi::core::free_string(result);
+            if status["status"].as_str().is_some_and(|s| s.eq_ignore_ascii_case("failed")) {
+                return Err(format!("export failed: {}", status).into());
+            }
+        }
+    }
+    Ok(())
+}
+
+/// Unified exports are JSON Lines only, whatever format is requested
+fn export_unified(fixture: &Fixture, iterations: usize) -> Result<Vec<CaseResult>, Box<dyn Error>> {
+    let exports = fixture.root.join("exports");
+    let target = |i: usize| exports.join(format!("run_{}", i));
+    let clear = |path: &Path| {
+        if path.exists() {
+            std::fs::remove_dir_all(path)?;
+        }
+        std::fs::create_dir_all(path)
+    };
+
+    let result = time_case(
+        "export_unified",
+        fixture.size,
+        iterations,
+        |i| {
+            // Drop the previous run's files so disk usage stays flat
+            if i > 0 {
+                let _ = std::fs::remove_dir_all(target(i - 1));
+            }
+            clear(&target(i)).map_err(Into::into)
+        },
+        |i| {
+            let request = json!({ "target_path": target(i).to_string_lossy(), "include_type_tags": true });
+            token_call(export::export_unified_all_domains, &request, &fixture.token)
+        },
+    )?;
+    let _ = std::fs::remove_dir_all(&exports);
+    Ok(vec![result])
+}
+
+fn compress_image(fixture: &Fixture, iterations: usize) -> Result<Vec<CaseResult>, Box<dyn Error>> {
+    let pool = globals::get_db_pool()?;
+    let corpus = &fixture.image_document_ids;
+    let document = |i: usize| corpus[i % corpus.len()];
+    let result = time_case(
+        "compress_image",
+        fixture.size,
+        iterations,
+        |i| {
+            // Compressing a completed document is refused: start every run from pending
+            block_on_async(
+                sqlx::query(
+                    "UPDATE media_documents SET compression_status = 'pending', compressed_file_path = NULL, compressed_size_bytes = NULL
+                     WHERE id = ?",
+                )
+                .bind(document(i).to_string())
+                .execute(&pool),
+            )?;
+            Ok(())
+        },
+        |i| payload_call(compression::compression_compress_document, &json!({ "document_id": document(i).to_string() })),
+    )?;
+    Ok(vec![result])
+}
+
+fn sync_push_pull(fixture: &Fixture, iterations: usize) -> Result<Vec<CaseResult>, Box<dyn Error>> {
+    let remote = fixture.root.join("remote");
+    std::fs::create_dir_all(&remote)?;
+    let service = SyncServiceImpl::new(
+        globals::get_sync_repo()?,
+        globals::get_change_log_repo()?,
+        globals::get_tombstone_repo()?,
+        globals::get_entity_merger()?,
+        globals::get_file_storage_service()?,
+        Arc::new(MockCloudStorageService::new(&remote.to_string_lossy())),
+        Some(globals::get_compression_service()?),
+        None,
+        None,
+    );
+    let auth = AuthContext::new(fixture.user_id, UserRole::Admin, crate::DEVICE_ID.to_string(), false);
+
+    // Push uploads every pending change-log entry once; a second push has nothing to send
+    let started = Instant::now();
+    block_on_async(service.push(fixture.user_id, &auth))?;
+    let push = CaseResult::from_samples("sync_push", fixture.size, vec![started.elapsed().as_secs_f64() * 1000.0]);
+
+    let pull = time_case("sync_pull", fixture.size, iterations, |_| Ok(()), |_| {
+        block_on_async(service.pull(fixture.user_id, &auth))?;
+        Ok(())
+    })?;
+    Ok(vec![push, pull])
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn percentiles_come_from_sorted_samples() {
+        let result = CaseResult::from_samples("c", 10, vec![5.0, 1.0, 3.0, 2.0, 4.0]);
+        assert_eq!(result.min_ms, 1.0);
+        assert_eq!(result.median_ms, 3.0);
+        assert_eq!(result.p95_ms, 5.0);
+        assert_eq!(result.key(), "10/c");
+    }
+}
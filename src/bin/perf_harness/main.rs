@@ -0,0 +1,249 @@
+//! Reproducible performance harness for the FFI hot paths.
+//!
+//! For every dataset size the harness starts a fresh child process (the
+//! library initializes once per process). The child creates a temporary
+//! database and storage directory, seeds them with synthetic data
+//! (`seed.rs`) and times each case through the C ABI (`cases.rs`). The
+//! parent prints the results and compares the medians with a stored
+//! baseline.
+//!
+//!   cargo run --release --features perf-harness --bin perf_harness -- \
+//!       --sizes 1000,10000,100000 --iterations 5 --baseline perf_baseline.json
+//!
+//! `--save-baseline` stores the results as the new baseline. Otherwise a case
+//! whose median is more than `--threshold` (default 0.20) above its baseline
+//! fails the run with exit code 2. `--only` runs the listed cases.
+
+mod cases;
+mod seed;
+
+use cases::CaseResult;
+use serde::{Deserialize, Serialize};
+use std::collections::BTreeMap;
+use std::error::Error;
+use std::ffi::{CStr, CString};
+use std::path::{Path, PathBuf};
+use std::process::{Command, ExitCode};
+
+/// Device id of the harness; a UUID because sync parses it as one
+pub const DEVICE_ID: &str = "00000000-0000-4000-8000-00000000fe01";
+const JWT_SECRET: &str = "perf-harness-secret";
+
+struct Options {
+    sizes: Vec<usize>,
+    iterations: usize,
+    baseline: PathBuf,
+    save_baseline: bool,
+    threshold: f64,
+    only: Option<Vec<String>>,
+    keep: bool,
+    /// Set in the child process: the one size it runs, and where its report goes
+    child: Option<(usize, PathBuf)>,
+}
+
+impl Options {
+    fn parse() -> Result<Self, String> {
+        let mut options = Options {
+            sizes: vec![1_000, 10_000],
+            iterations: 5,
+            baseline: PathBuf::from("perf_baseline.json"),
+            save_baseline: false,
+            threshold: 0.20,
+            only: None,
+            keep: false,
+            child: None,
+        };
+        let mut child_size = None;
+        let mut report = None;
+
+        let mut args = std::env::args().skip(1);
+        while let Some(arg) = args.next() {
+            let mut value = || args.next().ok_or_else(|| format!("{} needs a value", arg));
+            match arg.as_str() {
+                "--sizes" => {
+                    options.sizes = value()?
+                        .split(',')
+                        .map(|s| s.trim().replace('_', "").parse::<usize>().map_err(|e| format!("--sizes: {}", e)))
+                        .collect::<Result<_, _>>()?;
+                }
+                "--iterations" => options.iterations = value()?.parse().map_err(|e| format!("--iterations: {}", e))?,
+                "--baseline" => options.baseline = PathBuf::from(value()?),
+                "--save-baseline" => options.save_baseline = true,
+                "--threshold" => options.threshold = value()?.parse().map_err(|e| format!("--threshold: {}", e))?,
+                "--only" => options.only = Some(value()?.split(',').map(|s| s.trim().to_string()).collect()),
+                "--keep" => options.keep = true,
+                "--child-size" => child_size = Some(value()?.parse().map_err(|e| format!("--child-size: {}", e))?),
+                "--report" => report = Some(PathBuf::from(value()?)),
+                "--help" | "-h" => {
+                    println!(
+                        "perf_harness [--sizes 1000,10000,100000] [--iterations N] [--baseline FILE]\n\
+                         \x20            [--save-baseline] [--threshold 0.20] [--only case,...] [--keep]\n\
+                         cases: {}",
+                        cases::CASE_NAMES.join(", ")
+                    );
+                    std::process::exit(0);
+                }
+                other => return Err(format!("unknown argument {}", other)),
+            }
+        }
+
+        options.iterations = options.iterations.max(1);
+        if let (Some(size), Some(report)) = (child_size, report) {
+            options.child = Some((size, report));
+        }
+        Ok(options)
+    }
+}
+
+/// Medians of a run, keyed by "size/case"
+#[derive(Debug, Default, Serialize, Deserialize)]
+struct Baseline {
+    created_at: String,
+    iterations: usize,
+    medians_ms: BTreeMap<String, f64>,
+}
+
+fn main() -> ExitCode {
+    let options = match Options::parse() {
+        Ok(options) => options,
+        Err(e) => {
+            eprintln!("perf_harness: {}", e);
+            return ExitCode::FAILURE;
+        }
+    };
+
+    let outcome = match &options.child {
+        Some((size, report)) => run_child(*size, report, &options).map(|_| ExitCode::SUCCESS),
+        None => run_parent(&options),
+    };
+    outcome.unwrap_or_else(|e| {
+        eprintln!("perf_harness: {}", e);
+        ExitCode::FAILURE
+    })
+}
+
+/// Run every size in its own process and compare with the baseline
+fn run_parent(options: &Options) -> Result<ExitCode, Box<dyn Error>> {
+    let exe = std::env::current_exe()?;
+    let reports = tempfile::tempdir()?;
+    let mut results: Vec<CaseResult> = Vec::new();
+
+    for &size in &options.sizes {
+        println!("== {} participants", size);
+        let report = reports.path().join(format!("{}.json", size));
+        let mut command = Command::new(&exe);
+        command
+            .arg("--child-size").arg(size.to_string())
+            .arg("--report").arg(&report)
+            .arg("--iterations").arg(options.iterations.to_string());
+        if let Some(only) = &options.only {
+            command.arg("--only").arg(only.join(","));
+        }
+        if options.keep {
+            command.arg("--keep");
+        }
+        let status = command.status()?;
+        if !status.success() {
+            return Err(format!("run for {} participants failed ({})", size, status).into());
+        }
+        let size_results: Vec<CaseResult> = serde_json::from_slice(&std::fs::read(&report)?)?;
+        results.extend(size_results);
+    }
+
+    println!();
+    println!("{:<48} {:>10} {:>10} {:>10} {:>10}", "case", "min ms", "median ms", "p95 ms", "baseline");
+    let baseline = load_baseline(&options.baseline);
+    let mut regressions = Vec::new();
+    for result in &results {
+        let key = result.key();
+        let previous = baseline.as_ref().and_then(|b| b.medians_ms.get(&key).copied());
+        println!(
+            "{:<48} {:>10.2} {:>10.2} {:>10.2} {:>10}",
+            key,
+            result.min_ms,
+            result.median_ms,
+            result.p95_ms,
+            previous.map_or_else(|| "-".to_string(), |p| format!("{:.2}", p)),
+        );
+        if let Some(previous) = previous {
+            if result.median_ms > previous * (1.0 + options.threshold) {
+                regressions.push(format!("{}: {:.2} ms, baseline {:.2} ms", key, result.median_ms, previous));
+            }
+        }
+    }
+
+    if options.save_baseline {
+        let baseline = Baseline {
+            created_at: chrono::Utc::now().to_rfc3339(),
+            iterations: options.iterations,
+            medians_ms: results.iter().map(|r| (r.key(), r.median_ms)).collect(),
+        };
+        std::fs::write(&options.baseline, serde_json::to_string_pretty(&baseline)?)?;
+        println!("\nBaseline written to {}", options.baseline.display());
+        return Ok(ExitCode::SUCCESS);
+    }
+
+    if regressions.is_empty() {
+        Ok(ExitCode::SUCCESS)
+    } else {
+        eprintln!("\nRegressions over {:.0}%:", options.threshold * 100.0);
+        for regression in &regressions {
+            eprintln!("  {}", regression);
+        }
+        Ok(ExitCode::from(2))
+    }
+}
+
+fn load_baseline(path: &Path) -> Option<Baseline> {
+    let bytes = std::fs::read(path).ok()?;
+    match serde_json::from_slice(&bytes) {
+        Ok(baseline) => Some(baseline),
+        Err(e) => {
+            eprintln!("Ignoring unreadable baseline {}: {}", path.display(), e);
+            None
+        }
+    }
+}
+
+/// Initialize the library on a fresh database, seed it and run the cases
+fn run_child(size: usize, report: &Path, options: &Options) -> Result<(), Box<dyn Error>> {
+    let root = tempfile::Builder::new().prefix("perf_harness_").tempdir()?;
+    let storage = root.path().join("storage");
+    std::fs::create_dir_all(&storage)?;
+    std::env::set_var("IOS_DOCUMENTS_DIR", &storage);
+
+    let db_url = CString::new(format!("sqlite://{}?mode=rwc", root.path().join("perf.sqlite").display()))?;
+    let device_id = CString::new(DEVICE_ID)?;
+    let secret = CString::new(JWT_SECRET)?;
+    let code = unsafe {
+        ipad_rust_core::ffi::core::initialize_library(db_url.as_ptr(), device_id.as_ptr(), false, secret.as_ptr())
+    };
+    if code != 0 {
+        return Err(format!("initialize_library failed: {}", last_error()).into());
+    }
+
+    let started = std::time::Instant::now();
+    let fixture = seed::seed(size, root.path())?;
+    println!("   seeded in {:.1} s", started.elapsed().as_secs_f64());
+
+    let results = cases::run_all(&fixture, options.iterations, options.only.as_deref())?;
+    std::fs::write(report, serde_json::to_vec(&results)?)?;
+
+    if options.keep {
+        println!("   kept {}", root.into_path().display());
+    }
+    Ok(())
+}
+
+/// Message of the last FFI error on this thread
+pub fn last_error() -> String {
+    unsafe {
+        let ptr = ipad_rust_core::ffi::core::get_last_error();
+        if ptr.is_null() {
+            return "unknown error".to_string();
+        }
+        let message = CStr::from_ptr(ptr).to_string_lossy().into_owned();
+        ipad_rust_core::ffi::core::free_string(ptr);
+        message
+    }
+}
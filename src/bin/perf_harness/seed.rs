@@ -0,0 +1,449 @@
+//! Deterministic synthetic dataset for the perf harness.
+//!
+//! For `size` participants the seeder writes:
+//!
+//!   * one admin user (and a sync config with a server token),
+//!   * `size / 500` projects (at least two),
+//!   * `size` participants through `participant_bulk_create`, so they carry
+//!     change-log entries like real data does,
+//!   * `size / 20` workshops and `size / 2` workshop enrollments,
+//!   * `size / 10` livelihoods and `size / 10` document records,
+//!   * a small corpus of generated JPEG and PNG images stored through the file
+//!     storage service, for the compression cases.
+//!
+//! Everything but the participants is inserted directly with multi-row
+//! statements; the values come from a fixed-seed generator, so the same size
+//! always produces the same dataset.
+
+use crate::{last_error, DEVICE_ID};
+use image::{ImageOutputFormat, Rgb, RgbImage};
+use ipad_rust_core::auth::jwt::{self, TokenType};
+use ipad_rust_core::ffi::block_on_async;
+use ipad_rust_core::globals;
+use ipad_rust_core::types::UserRole;
+use serde_json::json;
+use sqlx::{QueryBuilder, Sqlite, SqlitePool};
+use std::error::Error;
+use std::ffi::{CStr, CString};
+use std::io::Cursor;
+use std::os::raw::c_char;
+use std::path::{Path, PathBuf};
+use uuid::Uuid;
+
+/// Rows per multi-row INSERT
+const INSERT_CHUNK: usize = 500;
+/// Participants per `participant_bulk_create` call
+const PARTICIPANT_CHUNK: usize = 5_000;
+/// Generated images per run
+const IMAGE_CORPUS: usize = 8;
+
+const GENDERS: [&str; 4] = ["male", "female", "other", "prefer_not_to_say"];
+const AGE_GROUPS: [&str; 4] = ["child", "youth", "adult", "elderly"];
+const DISABILITY_TYPES: [&str; 4] = ["visual", "hearing", "physical", "intellectual"];
+const LOCATIONS: [&str; 6] = ["Kathmandu", "Pokhara", "Lalitpur", "Biratnagar", "Dharan", "Butwal"];
+const FIRST_NAMES: [&str; 10] = ["Asha", "Bikash", "Chandra", "Deepa", "Gita", "Hari", "Kamal", "Maya", "Nabin", "Sita"];
+const LAST_NAMES: [&str; 8] = ["Sharma", "Thapa", "Gurung", "Rai", "Tamang", "Shrestha", "Karki", "Magar"];
+const LIVELIHOOD_TYPES: [&str; 4] = ["agriculture", "livestock", "tailoring", "retail"];
+
+/// splitmix64: small, fast and identical on every platform
+pub struct Rng(u64);
+
+impl Rng {
+    pub fn new(seed: u64) -> Self {
+        Self(seed)
+    }
+
+    pub fn next_u64(&mut self) -> u64 {
+        self.0 = self.0.wrapping_add(0x9E37_79B9_7F4A_7C15);
+        let mut z = self.0;
+        z = (z ^ (z >> 30)).wrapping_mul(0xBF58_476D_1CE4_E5B9);
+        z = (z ^ (z >> 27)).wrapping_mul(0x94D0_49BB_1331_11EB);
+        z ^ (z >> 31)
+    }
+
+    pub fn below(&mut self, n: usize) -> usize {
+        (self.next_u64() % n as u64) as usize
+    }
+
+    pub fn pick<'a>(&mut self, items: &[&'a str]) -> &'a str {
+        items[self.below(items.len())]
+    }
+
+    /// Version-4 shaped UUID from the generator
+    pub fn uuid(&mut self) -> Uuid {
+        let bytes = ((self.next_u64() as u128) << 64 | self.next_u64() as u128).to_be_bytes();
+        uuid::Builder::from_random_bytes(bytes).into_uuid()
+    }
+}
+
+/// What the cases need to know about the seeded data
+pub struct Fixture {
+    pub size: usize,
+    pub root: PathBuf,
+    pub user_id: Uuid,
+    /// `AuthCtxDto` JSON for payload-style calls
+    pub auth: serde_json::Value,
+    /// Access token for token-style calls (export)
+    pub token: String,
+    pub workshop_ids: Vec<Uuid>,
+    pub image_document_ids: Vec<Uuid>,
+}
+
+pub fn seed(size: usize, root: &Path) -> Result<Fixture, Box<dyn Error>> {
+    let pool = globals::get_db_pool()?;
+    let mut rng = Rng::new(0x5EED_0000 ^ size as u64);
+    let now = chrono::Utc::now().to_rfc3339();
+
+    let user_id = rng.uuid();
+    block_on_async(
+        sqlx::query(
+            "INSERT INTO users (id, email, password_hash, name, role, active, created_at, updated_at)
+             VALUES (?, ?, 'not-a-login', 'Perf Harness', 'admin', 1, ?, ?)",
+        )
+        .bind(user_id.to_string())
+        .bind(format!("perf+{}@example.org", size))
+        .bind(&now)
+        .bind(&now)
+        .execute(&pool),
+    )?;
+    let (token, _) = jwt::generate_token(&user_id, &UserRole::Admin, DEVICE_ID, TokenType::Access)?;
+    let auth = json!({
+        "user_id": user_id.to_string(),
+        "role": "admin",
+        "device_id": DEVICE_ID,
+        "offline_mode": false,
+    });
+
+    let project_ids = seed_projects(&pool, &mut rng, size, user_id, &now)?;
+    let participant_ids = seed_participants(&mut rng, size, &auth)?;
+    let workshop_ids = seed_workshops(&pool, &mut rng, size, &project_ids, &participant_ids, user_id, &now)?;
+    seed_livelihoods(&pool, &mut rng, size, &project_ids, &participant_ids, user_id, &now)?;
+    seed_documents(&pool, &mut rng, size, &participant_ids, user_id, &now)?;
+    let image_document_ids = seed_images(&pool, &mut rng, &participant_ids, user_id, &now)?;
+
+    block_on_async(
+        sqlx::query("INSERT INTO sync_configs (id, user_id, server_token, created_at, updated_at) VALUES (?, ?, ?, ?, ?)")
+            .bind(Uuid::new_v4().to_string())
+            .bind(user_id.to_string())
+            .bind(&token)
+            .bind(&now)
+            .bind(&now)
+            .execute(&pool),
+    )?;
+    block_on_async(sqlx::query("PRAGMA optimize").execute(&pool))?;
+
+    Ok(Fixture {
+        size,
+        root: root.to_path_buf(),
+        user_id,
+        auth,
+        token,
+        workshop_ids,
+        image_document_ids,
+    })
+}
+
+/// Insert `rows` in chunks, each chunk one multi-row statement, all in one transaction
+fn insert_rows<T>(
+    pool: &SqlitePool,
+    prefix: &str,
+    rows: &[T],
+    mut push: impl FnMut(sqlx::query_builder::Separated<'_, '_, Sqlite, &'static str>, &T),
+) -> Result<(), Box<dyn Error>> {
+    block_on_async(async {
+        let mut tx = pool.begin().await?;
+        for chunk in rows.chunks(INSERT_CHUNK) {
+            let mut builder: QueryBuilder<Sqlite> = QueryBuilder::new(prefix);
+            builder.push_values(chunk, |row, item| push(row, item));
+            builder.build().execute(&mut *tx).await?;
+        }
+        tx.commit().await
+    })?;
+    Ok(())
+}
+
+fn seed_projects(pool: &SqlitePool, rng: &mut Rng, size: usize, user_id: Uuid, now: &str) -> Result<Vec<Uuid>, Box<dyn Error>> {
+    let rows: Vec<(Uuid, String, i64)> = (0..(size / 500).max(2))
+        .map(|i| (rng.uuid(), format!("Project {}", i + 1), 1 + rng.below(4) as i64))
+        .collect();
+    insert_rows(
+        pool,
+        "INSERT INTO projects (id, name, status_id, created_at, updated_at, created_by_user_id) ",
+        &rows,
+        |mut row, (id, name, status)| {
+            row.push_bind(id.to_string())
+                .push_bind(name.clone())
+                .push_bind(*status)
+                .push_bind(now.to_string())
+                .push_bind(now.to_string())
+                .push_bind(user_id.to_string());
+        },
+    )?;
+    Ok(rows.into_iter().map(|(id, _, _)| id).collect())
+}
+
+fn seed_participants(rng: &mut Rng, size: usize, auth: &serde_json::Value) -> Result<Vec<Uuid>, Box<dyn Error>> {
+    let mut ids = Vec::with_capacity(size);
+    let mut remaining = size;
+    while remaining > 0 {
+        let batch = remaining.min(PARTICIPANT_CHUNK);
+        let participants: Vec<serde_json::Value> = (0..batch)
+            .map(|_| {
+                let disability = rng.below(10) == 0;
+                json!({
+                    "name": format!("{} {}", rng.pick(&FIRST_NAMES), rng.pick(&LAST_NAMES)),
+                    "gender": rng.pick(&GENDERS),
+                    "age_group": rng.pick(&AGE_GROUPS),
+                    "location": rng.pick(&LOCATIONS),
+                    "disability": disability,
+                    "disability_type": if disability { Some(rng.pick(&DISABILITY_TYPES)) } else { None },
+                })
+            })
+            .collect();
+        let payload = json!({ "participants": participants, "auth": auth });
+        let response = call_ffi(ipad_rust_core::ffi::participant::participant_bulk_create, &payload)?;
+        let created = response["created_ids"]
+            .as_array()
+            .ok_or("participant_bulk_create returned no created_ids")?;
+        if created.len() != batch {
+            return Err(format!("participant_bulk_create created {} of {}: {}", created.len(), batch, response["failed"]).into());
+        }
+        ids.extend(created.iter().filter_map(|id| id.as_str().and_then(|s| Uuid::parse_str(s).ok())));
+        remaining -= batch;
+    }
+    Ok(ids)
+}
+
+fn seed_workshops(
+    pool: &SqlitePool,
+    rng: &mut Rng,
+    size: usize,
+    project_ids: &[Uuid],
+    participant_ids: &[Uuid],
+    user_id: Uuid,
+    now: &str,
+) -> Result<Vec<Uuid>, Box<dyn Error>> {
+    let workshops: Vec<(Uuid, Uuid, String, String, i64)> = (0..(size / 20).max(1))
+        .map(|i| {
+            let date = format!("2025-{:02}-{:02}", 1 + rng.below(12), 1 + rng.below(28));
+            (rng.uuid(), project_ids[rng.below(project_ids.len())], format!("Workshop {}", i + 1), date, rng.below(40) as i64)
+        })
+        .collect();
+    insert_rows(
+        pool,
+        "INSERT INTO workshops (id, project_id, purpose, event_date, location, participant_count, created_at, updated_at, created_by_user_id) ",
+        &workshops,
+        |mut row, (id, project_id, purpose, date, count)| {
+            row.push_bind(id.to_string())
+                .push_bind(project_id.to_string())
+                .push_bind(purpose.clone())
+                .push_bind(date.clone())
+                .push_bind("Community hall")
+                .push_bind(*count)
+                .push_bind(now.to_string())
+                .push_bind(now.to_string())
+                .push_bind(user_id.to_string());
+        },
+    )?;
+
+    // (workshop, participant) is unique; stepping through participants avoids repeats
+    let enrollments: Vec<(Uuid, Uuid, Uuid)> = (0..size / 2)
+        .map(|i| (rng.uuid(), workshops[i % workshops.len()].0, participant_ids[i % participant_ids.len()]))
+        .collect();
+    insert_rows(
+        pool,
+        "INSERT INTO workshop_participants (id, workshop_id, participant_id, created_at, updated_at, created_by_user_id) ",
+        &enrollments,
+        |mut row, (id, workshop_id, participant_id)| {
+            row.push_bind(id.to_string())
+                .push_bind(workshop_id.to_string())
+                .push_bind(participant_id.to_string())
+                .push_bind(now.to_string())
+                .push_bind(now.to_string())
+                .push_bind(user_id.to_string());
+        },
+    )?;
+    Ok(workshops.into_iter().map(|w| w.0).collect())
+}
+
+fn seed_livelihoods(
+    pool: &SqlitePool,
+    rng: &mut Rng,
+    size: usize,
+    project_ids: &[Uuid],
+    participant_ids: &[Uuid],
+    user_id: Uuid,
+    now: &str,
+) -> Result<(), Box<dyn Error>> {
+    let rows: Vec<(Uuid, Uuid, Uuid, &str, i64)> = (0..size / 10)
+        .map(|_| {
+            (
+                rng.uuid(),
+                participant_ids[rng.below(participant_ids.len())],
+                project_ids[rng.below(project_ids.len())],
+                rng.pick(&LIVELIHOOD_TYPES),
+                1 + rng.below(4) as i64,
+            )
+        })
+        .collect();
+    insert_rows(
+        pool,
+        "INSERT INTO livelihoods (id, participant_id, project_id, type, description, status_id, created_at, updated_at, created_by_user_id) ",
+        &rows,
+        |mut row, (id, participant_id, project_id, kind, status)| {
+            row.push_bind(id.to_string())
+                .push_bind(participant_id.to_string())
+                .push_bind(project_id.to_string())
+                .push_bind(kind.to_string())
+                .push_bind(format!("Synthetic {} livelihood", kind))
+                .push_bind(*status)
+                .push_bind(now.to_string())
+                .push_bind(now.to_string())
+                .push_bind(user_id.to_string());
+        },
+    )
+}
+
+fn document_type_id(pool: &SqlitePool, name: &str) -> Result<String, Box<dyn Error>> {
+    let id: Option<String> = block_on_async(
+        sqlx::query_scalar("SELECT id FROM document_types WHERE name = ? AND deleted_at IS NULL LIMIT 1")
+            .bind(name)
+            .fetch_optional(pool),
+    )?;
+    id.ok_or_else(|| format!("document type {} is not seeded", name).into())
+}
+
+/// Document records without files: enough for counts, listings and exports
+fn seed_documents(
+    pool: &SqlitePool,
+    rng: &mut Rng,
+    size: usize,
+    participant_ids: &[Uuid],
+    user_id: Uuid,
+    now: &str,
+) -> Result<(), Box<dyn Error>> {
+    let type_id = document_type_id(pool, "Document")?;
+    let rows: Vec<(Uuid, Uuid, i64)> = (0..size / 10)
+        .map(|_| (rng.uuid(), participant_ids[rng.below(participant_ids.len())], 10_000 + rng.below(500_000) as i64))
+        .collect();
+    insert_rows(
+        pool,
+        "INSERT INTO media_documents (id, related_table, related_id, type_id, original_filename, file_path, mime_type, size_bytes, compression_status, created_at, updated_at, created_by_user_id) ",
+        &rows,
+        |mut row, (id, participant_id, bytes)| {
+            row.push_bind(id.to_string())
+                .push_bind("participants")
+                .push_bind(participant_id.to_string())
+                .push_bind(type_id.clone())
+                .push_bind(format!("consent_{}.pdf", &id.simple().to_string()[..8]))
+                .push_bind(format!("original/participants/{}/{}.pdf", participant_id, id))
+                .push_bind("application/pdf")
+                .push_bind(*bytes)
+                .push_bind("skipped")
+                .push_bind(now.to_string())
+                .push_bind(now.to_string())
+                .push_bind(user_id.to_string());
+        },
+    )
+}
+
+/// Noisy gradient image: compresses like a photo rather than a flat fill
+fn synthetic_image(rng: &mut Rng, width: u32, height: u32) -> RgbImage {
+    let tint = [rng.below(256) as u32, rng.below(256) as u32, rng.below(256) as u32];
+    let mut noise = Rng::new(rng.next_u64());
+    RgbImage::from_fn(width, height, |x, y| {
+        let n = (noise.next_u64() & 0x1F) as u32;
+        Rgb([
+            ((x * 255 / width + tint[0] + n) % 256) as u8,
+            ((y * 255 / height + tint[1] + n) % 256) as u8,
+            (((x + y) * 255 / (width + height) + tint[2]) % 256) as u8,
+        ])
+    })
+}
+
+fn seed_images(
+    pool: &SqlitePool,
+    rng: &mut Rng,
+    participant_ids: &[Uuid],
+    user_id: Uuid,
+    now: &str,
+) -> Result<Vec<Uuid>, Box<dyn Error>> {
+    let type_id = document_type_id(pool, "Image")?;
+    let storage = globals::get_file_storage_service()?;
+    let mut ids = Vec::with_capacity(IMAGE_CORPUS);
+
+    for i in 0..IMAGE_CORPUS {
+        let (width, height) = if i % 2 == 0 { (2048, 1536) } else { (1280, 960) };
+        let image = synthetic_image(rng, width, height);
+        let (format, extension, mime) = if i % 4 == 3 {
+            (ImageOutputFormat::Png, "png", "image/png")
+        } else {
+            (ImageOutputFormat::Jpeg(95), "jpg", "image/jpeg")
+        };
+        let mut bytes = Cursor::new(Vec::new());
+        image.write_to(&mut bytes, format)?;
+
+        let id = rng.uuid();
+        let participant_id = participant_ids[rng.below(participant_ids.len())];
+        let filename = format!("photo_{}.{}", i + 1, extension);
+        let participant = participant_id.to_string();
+        let (file_path, size_bytes) =
+            block_on_async(storage.save_file(bytes.into_inner(), "participants", &participant, &filename))?;
+
+        block_on_async(
+            sqlx::query(
+                "INSERT INTO media_documents (id, related_table, related_id, type_id, original_filename, file_path, mime_type, size_bytes, compression_status, created_at, updated_at, created_by_user_id)
+                 VALUES (?, 'participants', ?, ?, ?, ?, ?, ?, 'pending', ?, ?, ?)",
+            )
+            .bind(id.to_string())
+            .bind(&participant)
+            .bind(&type_id)
+            .bind(&filename)
+            .bind(&file_path)
+            .bind(mime)
+            .bind(size_bytes as i64)
+            .bind(now)
+            .bind(now)
+            .bind(user_id.to_string())
+            .execute(pool),
+        )?;
+        ids.push(id);
+    }
+    Ok(ids)
+}
+
+/// Signature shared by the payload-style FFI calls
+pub type PayloadFn = unsafe extern "C" fn(*const c_char, *mut *mut c_char) -> i32;
+
+/// Call a payload-style FFI function and parse its JSON result
+pub fn call_ffi(function: PayloadFn, payload: &serde_json::Value) -> Result<serde_json::Value, Box<dyn Error>> {
+    let payload = CString::new(payload.to_string())?;
+    let mut result: *mut c_char = std::ptr::null_mut();
+    let code = unsafe { function(payload.as_ptr(), &mut result) };
+    if code != 0 {
+        return Err(last_error().into());
+    }
+    if result.is_null() {
+        return Ok(serde_json::Value::Null);
+    }
+    let value = unsafe {
+        let parsed = serde_json::from_slice(CStr::from_ptr(result).to_bytes());
+        ipad_rust_core::ffi::core::free_string(result);
+        parsed?
+    };
+    Ok(value)
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn generator_is_deterministic() {
+        let mut a = Rng::new(42);
+        let mut b = Rng::new(42);
+        assert_eq!(a.uuid(), b.uuid());
+        assert_eq!(a.pick(&GENDERS), b.pick(&GENDERS));
+        assert_ne!(Rng::new(1).next_u64(), Rng::new(2).next_u64());
+    }
+}
@@ -5,6 +5,11 @@ use crate::globals;
 // Embed the consolidated migration SQL file at compile time
 const MIGRATION_CONSOLIDATED: &str = include_str!("../migrations/20240101000000_consolidated.sql");
 const MIGRATION_COMPRESSION_STATUS_FIX: &str = include_str!("../migrations/20241201000000_fix_compression_status_constraints.sql");
+const MIGRATION_FTS_SEARCH: &str = include_str!("../migrations/20250601000000_fts_search.sql");
+const MIGRATION_STAT_COUNTERS: &str = include_str!("../migrations/20250610000000_stat_counters.sql");
+const MIGRATION_CONTENT_BLOBS: &str = include_str!("../migrations/20250620000000_content_blobs.sql");
+const MIGRATION_EXPORT_MANIFESTS: &str = include_str!("../migrations/20250630000000_export_manifests.sql");
+const MIGRATION_TABLE_GENERATIONS: &str = include_str!("../migrations/20250710000000_table_generations.sql");
 
 // List of migrations with their names and SQL content.
 // This now starts with the consolidated schema.
@@ -12,6 +17,11 @@ const MIGRATION_COMPRESSION_STATUS_FIX: &str = include_str!("../migrations/20241
 const MIGRATIONS: &[(&str, &str)] = &[
     ("20240101000000_consolidated.sql", MIGRATION_CONSOLIDATED),
     ("20241201000000_fix_compression_status_constraints.sql", MIGRATION_COMPRESSION_STATUS_FIX),
+    ("20250601000000_fts_search.sql", MIGRATION_FTS_SEARCH),
+    ("20250610000000_stat_counters.sql", MIGRATION_STAT_COUNTERS),
+    ("20250620000000_content_blobs.sql", MIGRATION_CONTENT_BLOBS),
+    ("20250630000000_export_manifests.sql", MIGRATION_EXPORT_MANIFESTS),
+    ("20250710000000_table_generations.sql", MIGRATION_TABLE_GENERATIONS),
     // Add new migrations here in the future, for example:
     // ("20250601120000_new_feature.sql", include_str!("../migrations/20250601120000_new_feature.sql")),
 ];
@@ -28,6 +38,17 @@ pub async fn initialize_database() -> FFIResult<()> {
     
     println!("✅ [DB_MIGRATION] Database pool obtained");
     
+    // Nothing to do when the database was stamped by this exact migration set
+    let stamp = schema_stamp();
+    let current_stamp = sqlx::query_scalar::<_, i64>("PRAGMA user_version")
+        .fetch_one(&pool)
+        .await
+        .map_err(|e| FFIError::internal(format!("Failed to read schema stamp: {}", e)))?;
+    if current_stamp == stamp {
+        println!("✅ [DB_MIGRATION] Schema stamp matches, skipping migrations");
+        return Ok(());
+    }
+    
     // Create migrations table if it doesn't exist
     println!("🔧 [DB_MIGRATION] Creating migrations table...");
     create_migrations_table(&pool).await
@@ -57,10 +78,30 @@ pub async fn initialize_database() -> FFIResult<()> {
             e
         })?;
     
+    sqlx::query(&format!("PRAGMA user_version = {}", stamp))
+        .execute(&pool)
+        .await
+        .map_err(|e| FFIError::internal(format!("Failed to write schema stamp: {}", e)))?;
+    
     println!("🎉 [DB_MIGRATION] Database migration process completed successfully");
     Ok(())
 }
 
+/// Stamp of the embedded migration set (names and contents), stored in
+/// `PRAGMA user_version` once all of them are applied. Never 0, the value of
+/// a database that was never stamped.
+fn schema_stamp() -> i64 {
+    // FNV-1a
+    let mut hash: u32 = 0x811c_9dc5;
+    for (name, sql) in MIGRATIONS {
+        for byte in name.bytes().chain(sql.bytes()) {
+            hash ^= byte as u32;
+            hash = hash.wrapping_mul(0x0100_0193);
+        }
+    }
+    i64::from((hash & 0x7fff_ffff).max(1))
+}
+
 /// Create migrations table if it doesn't exist
 async fn create_migrations_table(pool: &SqlitePool) -> FFIResult<()> {
     sqlx::query(
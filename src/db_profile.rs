@@ -0,0 +1,123 @@
+// src/db_profile.rs
+// ============================================================================
+// SQLite connection tuning and pool construction.
+//
+// Two pools are built from one `StorageProfile`:
+//   •  the writer pool (`globals::get_db_pool`) – migrations, transactions and
+//      every INSERT/UPDATE/DELETE. `busy_timeout` makes competing writers wait
+//      for the lock instead of failing. `write_connections = 1` gives a strict
+//      single writer; the default keeps a few connections because some
+//      services run a lookup on the pool while holding a transaction, which
+//      would wait forever on a one-connection pool.
+//   •  the read pool (`globals::get_db_read_pool`) – read-only connections for
+//      list, lookup and dashboard queries. Under WAL readers never block the
+//      writer and never wait for it.
+//
+// Every connection of both pools gets the SQL profile hook of
+// `metrics::trace_connection`, so statement timings cover all queries.
+// ============================================================================
+
+use serde::Deserialize;
+use sqlx::sqlite::{
+    SqliteConnectOptions, SqliteJournalMode, SqlitePool, SqlitePoolOptions, SqliteSynchronous,
+};
+use std::str::FromStr;
+use std::time::Duration;
+
+/// Storage profile, deserialized from the `storage` key of the init config JSON
+#[derive(Debug, Clone, PartialEq, Eq, Deserialize)]
+#[serde(default)]
+pub struct StorageProfile {
+    /// Use write-ahead logging (strongly recommended; required for a useful read pool)
+    pub wal: bool,
+    /// `PRAGMA synchronous`: "off" | "normal" | "full" | "extra"
+    pub synchronous: String,
+    /// How long a connection waits on a lock before returning SQLITE_BUSY
+    pub busy_timeout_ms: u64,
+    /// `PRAGMA mmap_size` in MiB (0 disables memory-mapped I/O)
+    pub mmap_size_mb: u64,
+    /// Page cache per connection in KiB (`PRAGMA cache_size = -N`)
+    pub cache_size_kb: u64,
+    /// Connections in the writer pool
+    pub write_connections: u32,
+    /// Connections in the read-only pool
+    pub read_connections: u32,
+}
+
+impl Default for StorageProfile {
+    fn default() -> Self {
+        Self {
+            wal: true,
+            synchronous: "normal".to_string(),
+            busy_timeout_ms: 5_000,
+            mmap_size_mb: 64,
+            cache_size_kb: 8 * 1024,
+            write_connections: 4,
+            read_connections: 4,
+        }
+    }
+}
+
+impl StorageProfile {
+    fn synchronous_mode(&self) -> Result<SqliteSynchronous, String> {
+        match self.synchronous.to_ascii_lowercase().as_str() {
+            "off" => Ok(SqliteSynchronous::Off),
+            "normal" => Ok(SqliteSynchronous::Normal),
+            "full" => Ok(SqliteSynchronous::Full),
+            "extra" => Ok(SqliteSynchronous::Extra),
+            other => Err(format!("Unknown synchronous mode '{}'", other)),
+        }
+    }
+
+    /// Connection options for `db_url` with the pragmas of this profile applied.
+    /// The journal mode is persistent in the database file, so only the writer sets it.
+    fn connect_options(&self, db_url: &str, writer: bool) -> Result<SqliteConnectOptions, String> {
+        let mut options = SqliteConnectOptions::from_str(db_url)
+            .map_err(|e| format!("Invalid database URL: {}", e))?;
+        if writer {
+            let journal_mode = if self.wal { SqliteJournalMode::Wal } else { SqliteJournalMode::Delete };
+            options = options.journal_mode(journal_mode);
+        }
+        let options = options
+            .synchronous(self.synchronous_mode()?)
+            .busy_timeout(Duration::from_millis(self.busy_timeout_ms))
+            .pragma("mmap_size", (self.mmap_size_mb * 1024 * 1024).to_string())
+            .pragma("cache_size", format!("-{}", self.cache_size_kb))
+            .pragma("temp_store", "memory")
+            // Sync upserts use INSERT OR REPLACE; the implicit delete only fires
+            // DELETE triggers (which keep the FTS indexes in step) with this on
+            .pragma("recursive_triggers", "ON");
+        Ok(options)
+    }
+}
+
+/// Connect the writer pool. Establishes a connection eagerly so a bad URL or
+/// unreadable file fails initialization instead of the first query.
+pub async fn connect_write_pool(db_url: &str, profile: &StorageProfile) -> Result<SqlitePool, String> {
+    let options = profile.connect_options(db_url, true)?;
+    SqlitePoolOptions::new()
+        .max_connections(profile.write_connections.max(1))
+        .after_connect(|conn, _| Box::pin(crate::metrics::trace_connection(conn)))
+        .connect_with(options)
+        .await
+        .map_err(|e| format!("Database connection failed: {}", e))
+}
+
+/// Build the read-only pool. Connections are opened lazily, after migrations
+/// have created the schema. In-memory databases are private to a connection,
+/// so they share the writer pool instead.
+pub fn build_read_pool(
+    db_url: &str,
+    profile: &StorageProfile,
+    write_pool: &SqlitePool,
+) -> Result<SqlitePool, String> {
+    if db_url.contains(":memory:") || !profile.wal {
+        // Without WAL a read-only connection would still block the writer
+        return Ok(write_pool.clone());
+    }
+    let options = profile.connect_options(db_url, false)?.read_only(true);
+    Ok(SqlitePoolOptions::new()
+        .max_connections(profile.read_connections.max(1))
+        .after_connect(|conn, _| Box::pin(crate::metrics::trace_connection(conn)))
+        .connect_lazy_with(options))
+}
@@ -1,8 +1,10 @@
 use crate::auth::AuthContext;
 use sqlx::{Executor, Row, Sqlite, Transaction, SqlitePool, QueryBuilder};
+use crate::domains::core::stat_counters;
 use crate::domains::core::delete_service::DeleteServiceRepository;
 use crate::domains::core::repository::{FindById, HardDeletable, SoftDeletable};
 use crate::domains::core::document_linking::DocumentLinkable;
+use crate::domains::core::search::{fts_match_query, SearchMode};
 use crate::domains::activity::types::{NewActivity, Activity, ActivityRow, UpdateActivity, ActivityDocumentReference, ActivityFilter, ActivityStatistics, ActivityStatusBreakdown, ActivityMetadataCounts};
 use crate::errors::{DbError, DomainError, DomainResult, ValidationError};
 use crate::types::{PaginatedResult, PaginationParams, SyncPriority};
@@ -91,6 +93,7 @@ pub trait ActivityRepository: DeleteServiceRepository<Activity> + MergeableEntit
         &self,
         query: &str,
         params: PaginationParams,
+        mode: SearchMode,
     ) -> DomainResult<PaginatedResult<Activity>>;
 
     /// Find activity IDs that match complex filter criteria
@@ -128,12 +131,20 @@ pub trait ActivityRepository: DeleteServiceRepository<Activity> + MergeableEntit
 #[derive(Clone)]
 pub struct SqliteActivityRepository {
     pool: SqlitePool,
+    /// Read-only connections for queries; writes and transactions use `pool`
+    read_pool: SqlitePool,
     change_log_repo: Arc<dyn ChangeLogRepository + Send + Sync>,
 }
 
 impl SqliteActivityRepository {
     pub fn new(pool: SqlitePool, change_log_repo: Arc<dyn ChangeLogRepository + Send + Sync>) -> Self {
-        Self { pool, change_log_repo }
+        Self { read_pool: pool.clone(), pool, change_log_repo }
+    }
+
+    /// Serve queries from a separate read-only pool
+    pub fn with_read_pool(mut self, read_pool: SqlitePool) -> Self {
+        self.read_pool = read_pool;
+        self
     }
 
     fn map_row_to_entity(row: ActivityRow) -> DomainResult<Activity> {
@@ -178,7 +189,7 @@ impl FindById<Activity> for SqliteActivityRepository {
             "SELECT * FROM activities WHERE id = ? AND deleted_at IS NULL",
         )
         .bind(id.to_string())
-        .fetch_optional(&self.pool)
+        .fetch_optional(&self.read_pool)
         .await
         .map_err(DbError::from)?
         .ok_or_else(|| DomainError::EntityNotFound("Activity".to_string(), id))?;
@@ -591,19 +602,14 @@ impl ActivityRepository for SqliteActivityRepository {
     ) -> DomainResult<PaginatedResult<Activity>> {
         let offset = (params.page - 1) * params.per_page;
 
-        let total: i64 = query_scalar(
-             "SELECT COUNT(*) FROM activities WHERE deleted_at IS NULL"
-         )
-         .fetch_one(&self.pool)
-         .await
-         .map_err(DbError::from)?;
+        let total: i64 = stat_counters::row_count(&self.read_pool, "activities", stat_counters::ACTIVE).await?;
 
         let rows = query_as::<_, ActivityRow>(
             "SELECT * FROM activities WHERE deleted_at IS NULL ORDER BY created_at ASC LIMIT ? OFFSET ?",
         )
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -635,7 +641,7 @@ impl ActivityRepository for SqliteActivityRepository {
          .bind(end_date.to_rfc3339())
          .bind(start_date.to_rfc3339())
          .bind(end_date.to_rfc3339())
-         .fetch_one(&self.pool)
+         .fetch_one(&self.read_pool)
          .await
          .map_err(DbError::from)?;
 
@@ -648,7 +654,7 @@ impl ActivityRepository for SqliteActivityRepository {
         .bind(end_date.to_rfc3339())
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -690,7 +696,7 @@ impl ActivityRepository for SqliteActivityRepository {
 
         let total: i64 = count_builder
             .build_query_scalar()
-            .fetch_one(&self.pool)
+            .fetch_one(&self.read_pool)
             .await
             .map_err(DbError::from)?;
 
@@ -710,7 +716,7 @@ impl ActivityRepository for SqliteActivityRepository {
 
         let rows = select_builder
             .build_query_as::<ActivityRow>()
-            .fetch_all(&self.pool)
+            .fetch_all(&self.read_pool)
             .await
             .map_err(DbError::from)?;
 
@@ -738,7 +744,7 @@ impl ActivityRepository for SqliteActivityRepository {
              "SELECT COUNT(*) FROM activities WHERE project_id = ? AND deleted_at IS NULL"
          )
          .bind(&project_id_str)
-         .fetch_one(&self.pool)
+         .fetch_one(&self.read_pool)
          .await
          .map_err(DbError::from)?;
 
@@ -748,7 +754,7 @@ impl ActivityRepository for SqliteActivityRepository {
         .bind(project_id_str)
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -790,7 +796,7 @@ impl ActivityRepository for SqliteActivityRepository {
             
             let row = query(&query_str)
                 .bind(&activity_id_str)
-                .fetch_optional(&self.pool)
+                .fetch_optional(&self.read_pool)
                 .await
                 .map_err(DbError::from)?;
                 
@@ -841,7 +847,7 @@ impl ActivityRepository for SqliteActivityRepository {
             "SELECT COUNT(*) FROM activities WHERE status_id = ? AND deleted_at IS NULL"
         )
         .bind(status_id)
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -854,7 +860,7 @@ impl ActivityRepository for SqliteActivityRepository {
         .bind(status_id)
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -874,8 +880,43 @@ impl ActivityRepository for SqliteActivityRepository {
         &self,
         query: &str,
         params: PaginationParams,
+        mode: SearchMode,
     ) -> DomainResult<PaginatedResult<Activity>> {
         let offset = (params.page - 1) * params.per_page;
+
+        // FTS5 path: prefix match over the activities_fts index, ranked by bm25
+        if let Some(match_query) = fts_match_query(query).filter(|_| mode == SearchMode::Fts) {
+            let total: i64 = query_scalar(
+                "SELECT COUNT(*) FROM activities_fts 
+                 JOIN activities t ON t.rowid = activities_fts.rowid 
+                 WHERE activities_fts MATCH ? AND t.deleted_at IS NULL"
+            )
+            .bind(&match_query)
+            .fetch_one(&self.read_pool)
+            .await
+            .map_err(DbError::from)?;
+
+            let rows = query_as::<_, ActivityRow>(
+                "SELECT t.* FROM activities_fts 
+                 JOIN activities t ON t.rowid = activities_fts.rowid 
+                 WHERE activities_fts MATCH ? AND t.deleted_at IS NULL 
+                 ORDER BY bm25(activities_fts), t.created_at DESC LIMIT ? OFFSET ?"
+            )
+            .bind(&match_query)
+            .bind(params.per_page as i64)
+            .bind(offset as i64)
+            .fetch_all(&self.read_pool)
+            .await
+            .map_err(DbError::from)?;
+
+            let entities = rows
+                .into_iter()
+                .map(Self::map_row_to_entity)
+                .collect::<DomainResult<Vec<Activity>>>()?;
+
+            return Ok(PaginatedResult::new(entities, total as u64, params));
+        }
+
         let search_term = format!("%{}%", query);
 
         // Get total count - search in description and kpi fields
@@ -886,7 +927,7 @@ impl ActivityRepository for SqliteActivityRepository {
         )
         .bind(&search_term)
         .bind(&search_term)
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -901,7 +942,7 @@ impl ActivityRepository for SqliteActivityRepository {
         .bind(&search_term)
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -992,7 +1033,7 @@ impl ActivityRepository for SqliteActivityRepository {
         }
         
         let query = query_builder.build_query_as::<(String,)>();
-        let rows = query.fetch_all(&self.pool).await.map_err(DbError::from)?;
+        let rows = query.fetch_all(&self.read_pool).await.map_err(DbError::from)?;
         
         rows.into_iter()
             .map(|(id_str,)| Uuid::parse_str(&id_str).map_err(|e| DomainError::InvalidUuid(e.to_string())))
@@ -1073,44 +1114,23 @@ impl ActivityRepository for SqliteActivityRepository {
     }
 
     async fn count_by_status(&self) -> DomainResult<Vec<(Option<i64>, i64)>> {
-        let counts = query_as::<_, (Option<i64>, i64)>(
-            "SELECT status_id, COUNT(*) 
-             FROM activities 
-             WHERE deleted_at IS NULL 
-             GROUP BY status_id"
-        )
-        .fetch_all(&self.pool)
-        .await
-        .map_err(DbError::from)?;
-
-        Ok(counts)
+        stat_counters::integer_breakdown(&self.read_pool, "activities", "status_id").await
     }
     
     async fn count_by_project(&self) -> DomainResult<Vec<(Option<Uuid>, i64)>> {
-        let rows = query(
-            "SELECT project_id, COUNT(*) as count
-             FROM activities 
-             WHERE deleted_at IS NULL 
-             GROUP BY project_id"
-        )
-        .fetch_all(&self.pool)
-        .await
-        .map_err(DbError::from)?;
+        let counts = stat_counters::text_breakdown(&self.read_pool, "activities", "project_id").await?;
 
         // Manual mapping to handle Option<Uuid>
         let mut results = Vec::new();
-        for row in rows {
-            let project_id_str: Option<String> = row.get("project_id");
-            let count: i64 = row.get("count");
-            
-            let project_id = match project_id_str {
+        for (id_str, count) in counts {
+            let id = match id_str {
                 Some(id_str) => Some(Uuid::parse_str(&id_str).map_err(|_| 
                     DomainError::Internal(format!("Invalid UUID in project_id: {}", id_str))
                 )?),
                 None => None,
             };
             
-            results.push((project_id, count));
+            results.push((id, count));
         }
 
         Ok(results)
@@ -1118,12 +1138,7 @@ impl ActivityRepository for SqliteActivityRepository {
     
     async fn get_activity_statistics(&self) -> DomainResult<ActivityStatistics> {
         // Get total activity count
-        let total_activities: i64 = query_scalar(
-            "SELECT COUNT(*) FROM activities WHERE deleted_at IS NULL"
-        )
-        .fetch_one(&self.pool)
-        .await
-        .map_err(DbError::from)?;
+        let total_activities: i64 = stat_counters::row_count(&self.read_pool, "activities", stat_counters::ACTIVE).await?;
         
         // Get document count
         let document_count: i64 = query_scalar(
@@ -1132,7 +1147,7 @@ impl ActivityRepository for SqliteActivityRepository {
              WHERE related_table = 'activities'
              AND deleted_at IS NULL"
         )
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
         
@@ -1161,7 +1176,7 @@ impl ActivityRepository for SqliteActivityRepository {
                         "SELECT name FROM projects WHERE id = ? AND deleted_at IS NULL"
                     )
                     .bind(id.to_string())
-                    .fetch_optional(&self.pool)
+                    .fetch_optional(&self.read_pool)
                     .await
                     .map_err(DbError::from)? {
                         Some(name) => name,
@@ -1192,7 +1207,7 @@ impl ActivityRepository for SqliteActivityRepository {
              AND target_value IS NOT NULL 
              AND actual_value IS NOT NULL"
         )
-        .fetch_optional(&self.pool)
+        .fetch_optional(&self.read_pool)
         .await
         .map_err(DbError::from)?
         .flatten();
@@ -1259,7 +1274,7 @@ impl ActivityRepository for SqliteActivityRepository {
                         "SELECT name FROM projects WHERE id = ? AND deleted_at IS NULL"
                     )
                     .bind(id.to_string())
-                    .fetch_optional(&self.pool)
+                    .fetch_optional(&self.read_pool)
                     .await
                     .map_err(DbError::from)? {
                         Some(name) => name,
@@ -1290,7 +1305,7 @@ impl ActivityRepository for SqliteActivityRepository {
         let activities_with_targets: i64 = query_scalar(
             "SELECT COUNT(*) FROM activities WHERE target_value IS NOT NULL AND deleted_at IS NULL"
         )
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
         
@@ -1298,7 +1313,7 @@ impl ActivityRepository for SqliteActivityRepository {
         let activities_with_actuals: i64 = query_scalar(
             "SELECT COUNT(*) FROM activities WHERE actual_value IS NOT NULL AND deleted_at IS NULL"
         )
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
         
@@ -1312,7 +1327,7 @@ impl ActivityRepository for SqliteActivityRepository {
                     OR output_verification_ref IS NOT NULL)
              AND deleted_at IS NULL"
         )
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
         
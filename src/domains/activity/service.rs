@@ -1,10 +1,11 @@
 use crate::auth::AuthContext;
 use sqlx::{SqlitePool, Transaction, Sqlite};
-use crate::domains::user::UserRepository;
 use crate::domains::core::dependency_checker::DependencyChecker;
+use crate::domains::core::loader::RelationLoader;
 use crate::domains::core::delete_service::{BaseDeleteService, DeleteOptions, DeleteService, DeleteServiceRepository};
 use crate::domains::core::repository::{DeleteResult, FindById, HardDeletable, SoftDeletable};
 use crate::domains::core::document_linking::DocumentLinkable;
+use crate::domains::core::search::SearchMode;
 use crate::domains::permission::Permission;
 use crate::domains::activity::repository::ActivityRepository;
 use crate::domains::activity::types::{NewActivity, Activity, ActivityResponse, UpdateActivity, ActivityInclude, ActivityDocumentReference, ActivityFilter, ActivityStatistics, ActivityStatusBreakdown, ActivityMetadataCounts, ActivityProgressAnalysis};
@@ -128,6 +129,7 @@ pub trait ActivityService: DeleteService<Activity> + Send + Sync {
         &self,
         query: &str,
         params: PaginationParams,
+        mode: SearchMode,
         include: Option<&[ActivityInclude]>,
         auth: &AuthContext,
     ) -> ServiceResult<PaginatedResult<ActivityResponse>>;
@@ -196,7 +198,6 @@ pub struct ActivityServiceImpl {
     project_repo: Arc<dyn ProjectRepository + Send + Sync>,
     delete_service: Arc<BaseDeleteService<Activity>>,
     document_service: Arc<dyn DocumentService>,
-    user_repo: Arc<dyn UserRepository + Send + Sync>,
 }
 
 impl ActivityServiceImpl {
@@ -209,7 +210,6 @@ impl ActivityServiceImpl {
         dependency_checker: Arc<dyn DependencyChecker + Send + Sync>,
         document_service: Arc<dyn DocumentService>,
         deletion_manager: Arc<PendingDeletionManager>,
-        user_repo: Arc<dyn UserRepository + Send + Sync>,
     ) -> Self {
         // Local adapter struct
         struct RepoAdapter(Arc<dyn ActivityRepository + Send + Sync>);
@@ -275,7 +275,6 @@ impl ActivityServiceImpl {
             project_repo,
             delete_service,
             document_service,
-            user_repo,
         }
     }
 
@@ -299,56 +298,88 @@ impl ActivityServiceImpl {
     // Enhanced enrich_response helper following Project domain patterns
     async fn enrich_response(
         &self,
-        mut response: ActivityResponse,
+        response: ActivityResponse,
         include: Option<&[ActivityInclude]>,
         auth: &AuthContext,
     ) -> ServiceResult<ActivityResponse> {
-        if let Some(includes) = include {
+        let relations = RelationLoader::new(self.pool.clone());
+        let mut enriched = self.enrich_responses(vec![response], include, auth, &relations).await?;
+        Ok(enriched.pop().expect("one response in, one out"))
+    }
+
+    /// Enrich a page of activities. Usernames and project names are loaded
+    /// once for the page through the request's loader; document lists are
+    /// still fetched per activity.
+    async fn enrich_responses(
+        &self,
+        mut responses: Vec<ActivityResponse>,
+        include: Option<&[ActivityInclude]>,
+        auth: &AuthContext,
+        relations: &RelationLoader,
+    ) -> ServiceResult<Vec<ActivityResponse>> {
+        let Some(includes) = include else {
+            return Ok(responses);
+        };
+
+        let include_docs = includes.contains(&ActivityInclude::All) || includes.contains(&ActivityInclude::Documents);
+        let include_usernames = includes.contains(&ActivityInclude::All) || includes.contains(&ActivityInclude::CreatedBy);
+        let include_project = includes.contains(&ActivityInclude::All) || includes.contains(&ActivityInclude::Project);
+        let include_status = includes.contains(&ActivityInclude::All) || includes.contains(&ActivityInclude::Status);
+
+        // A failed batch lookup leaves its fields unset, as the per-activity lookups did
+        let user_names = if include_usernames {
+            let user_ids: Vec<Uuid> = responses
+                .iter()
+                .flat_map(|r| [r.created_by_user_id, r.updated_by_user_id])
+                .collect();
+            relations.user_names(&user_ids).await.ok()
+        } else {
+            None
+        };
+        let project_names = if include_project {
+            let project_ids: Vec<Uuid> = responses
+                .iter()
+                .filter(|r| r.project.is_none())
+                .filter_map(|r| r.project_id)
+                .collect();
+            relations.project_names(&project_ids).await.ok()
+        } else {
+            None
+        };
+
+        for response in responses.iter_mut() {
             // Document enrichment
-            let include_docs = includes.contains(&ActivityInclude::All) || includes.contains(&ActivityInclude::Documents);
             if include_docs {
-                let doc_params = PaginationParams::default();
                 let docs_result = self.document_service
                     .list_media_documents_by_related_entity(
                         auth,
                         "activities",
                         response.id,
-                        doc_params,
+                        PaginationParams::default(),
                         None,
                     ).await?;
                 response.documents = Some(docs_result.items);
                 response.document_count = Some(docs_result.total as i64);
             }
 
-            // Username enrichment - resolve user IDs to usernames
-            let include_usernames = includes.contains(&ActivityInclude::All) || includes.contains(&ActivityInclude::CreatedBy);
-            if include_usernames {
-                // Resolve created_by_user_id to username
-                if let Ok(user) = self.user_repo.find_by_id(response.created_by_user_id).await {
-                    response.created_by_username = Some(user.name.clone());
-                }
-                // Resolve updated_by_user_id to username
-                if let Ok(user) = self.user_repo.find_by_id(response.updated_by_user_id).await {
-                    response.updated_by_username = Some(user.name.clone());
-                }
+            if let Some(names) = &user_names {
+                response.created_by_username = names.get(&response.created_by_user_id).cloned();
+                response.updated_by_username = names.get(&response.updated_by_user_id).cloned();
             }
 
-            // Project enrichment
-            let include_project = includes.contains(&ActivityInclude::All) || includes.contains(&ActivityInclude::Project);
-            if include_project && response.project.is_none() {
-                if let Some(project_id) = response.project_id {
-                    if let Ok(project) = self.project_repo.find_by_id(project_id).await {
-                        response.project_name = Some(project.name.clone());
+            if response.project.is_none() {
+                if let (Some(project_id), Some(names)) = (response.project_id, &project_names) {
+                    if let Some(name) = names.get(&project_id) {
+                        response.project_name = Some(name.clone());
                         response.project = Some(crate::domains::activity::types::ProjectSummary {
-                            id: project.id,
-                            name: project.name,
+                            id: project_id,
+                            name: name.clone(),
                         });
                     }
                 }
             }
 
             // Status enrichment
-            let include_status = includes.contains(&ActivityInclude::All) || includes.contains(&ActivityInclude::Status);
             if include_status && response.status.is_none() {
                 if let Some(status_id) = response.status_id {
                     let status_name = match status_id {
@@ -365,26 +396,8 @@ impl ActivityServiceImpl {
                     });
                 }
             }
-
-            // Document count enrichment (if not already set by document enrichment)
-            if response.document_count.is_none() && (includes.contains(&ActivityInclude::All) || includes.contains(&ActivityInclude::Documents)) {
-                match self.document_service.list_media_documents_by_related_entity(
-                    auth,
-                    "activities",
-                    response.id,
-                    PaginationParams { page: 1, per_page: 1 }, // Just get count
-                    None,
-                ).await {
-                    Ok(docs_result) => {
-                        response.document_count = Some(docs_result.total as i64);
-                    }
-                    Err(_) => {
-                        response.document_count = Some(0);
-                    }
-                }
-            }
         }
-        Ok(response)
+        Ok(responses)
     }
     
     // Added upload_documents_for_entity helper
@@ -805,12 +818,9 @@ impl ActivityService for ActivityServiceImpl {
             .map_err(ServiceError::Domain)?;
 
         // 5. Convert to response DTOs and enrich
-        let mut enriched_items = Vec::new();
-        for activity in paginated_result.items {
-            let response = ActivityResponse::from(activity);
-            let enriched = self.enrich_response(response, include, auth).await?;
-            enriched_items.push(enriched);
-        }
+        let responses = paginated_result.items.into_iter().map(ActivityResponse::from).collect();
+        let relations = RelationLoader::new(self.pool.clone());
+        let enriched_items = self.enrich_responses(responses, include, auth, &relations).await?;
 
         // 6. Return paginated result
         Ok(PaginatedResult::new(
@@ -845,12 +855,9 @@ impl ActivityService for ActivityServiceImpl {
             .map_err(ServiceError::Domain)?;
 
         // Convert to response DTOs and enrich
-        let mut enriched_items = Vec::new();
-        for activity in paginated_result.items {
-            let response = ActivityResponse::from(activity);
-            let enriched = self.enrich_response(response, include, auth).await?;
-            enriched_items.push(enriched);
-        }
+        let responses = paginated_result.items.into_iter().map(ActivityResponse::from).collect();
+        let relations = RelationLoader::new(self.pool.clone());
+        let enriched_items = self.enrich_responses(responses, include, auth, &relations).await?;
 
         Ok(PaginatedResult::new(
             enriched_items,
@@ -863,6 +870,7 @@ impl ActivityService for ActivityServiceImpl {
         &self,
         query: &str,
         params: PaginationParams,
+        mode: SearchMode,
         include: Option<&[ActivityInclude]>,
         auth: &AuthContext,
     ) -> ServiceResult<PaginatedResult<ActivityResponse>> {
@@ -876,17 +884,14 @@ impl ActivityService for ActivityServiceImpl {
         }
 
         let paginated_result = self.repo
-            .search_activities(query, params)
+            .search_activities(query, params, mode)
             .await
             .map_err(ServiceError::Domain)?;
 
         // Convert to response DTOs and enrich
-        let mut enriched_items = Vec::new();
-        for activity in paginated_result.items {
-            let response = ActivityResponse::from(activity);
-            let enriched = self.enrich_response(response, include, auth).await?;
-            enriched_items.push(enriched);
-        }
+        let responses = paginated_result.items.into_iter().map(ActivityResponse::from).collect();
+        let relations = RelationLoader::new(self.pool.clone());
+        let enriched_items = self.enrich_responses(responses, include, auth, &relations).await?;
 
         Ok(PaginatedResult::new(
             enriched_items,
@@ -1021,12 +1026,9 @@ impl ActivityService for ActivityServiceImpl {
             .map_err(ServiceError::Domain)?;
             
         // Convert and enrich each activity
-        let mut enriched_items = Vec::new();
-        for activity in paginated_result.items {
-            let response = ActivityResponse::from(activity);
-            let enriched = self.enrich_response(response, include, auth).await?;
-            enriched_items.push(enriched);
-        }
+        let responses = paginated_result.items.into_iter().map(ActivityResponse::from).collect();
+        let relations = RelationLoader::new(self.pool.clone());
+        let enriched_items = self.enrich_responses(responses, include, auth, &relations).await?;
 
         Ok(PaginatedResult::new(
             enriched_items,
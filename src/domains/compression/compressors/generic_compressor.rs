@@ -4,11 +4,12 @@ use async_trait::async_trait;
 use flate2::write::GzEncoder;
 use flate2::Compression;
 use std::io::Write;
-use tokio::task;
 
 use crate::errors::{DomainError, DomainResult};
 use super::Compressor;
 use crate::domains::compression::types::CompressionMethod;
+use crate::domains::compression::cpu_pool::run_cpu;
+use crate::domains::export::ios::memory::buffer_pool;
 
 /// Generic compressor using flate2 for lossless compression
 pub struct GenericCompressor;
@@ -55,9 +56,9 @@ impl Compressor for GenericCompressor {
         println!("🗜️ [GENERIC_COMPRESSOR] Using compression level: {}", level);
         
         // Run compression in a blocking task
-        task::spawn_blocking(move || -> DomainResult<Vec<u8>> {
+        run_cpu(move || -> DomainResult<Vec<u8>> {
             println!("🗜️ [GENERIC_COMPRESSOR] Creating gzip encoder...");
-            let mut encoder = GzEncoder::new(Vec::new(), Compression::new(level));
+            let mut encoder = GzEncoder::new(buffer_pool().take(data.len() / 2), Compression::new(level));
             
             println!("🗜️ [GENERIC_COMPRESSOR] Writing data to encoder...");
             encoder.write_all(&data)
@@ -75,11 +76,10 @@ impl Compressor for GenericCompressor {
             
             println!("✅ [GENERIC_COMPRESSOR] Compression successful: {} bytes -> {} bytes", 
                      data.len(), compressed_data.len());
+            // The input is done with; let the next compression reuse its allocation
+            buffer_pool().release(data);
             
             Ok(compressed_data)
-        }).await.map_err(|e| {
-            println!("❌ [GENERIC_COMPRESSOR] Task join error: {}", e);
-            DomainError::Internal(format!("Task join error: {}", e))
-        })?
+        }).await
     }
 }
\ No newline at end of file
@@ -1,13 +1,16 @@
  //! Image compression implementation
 
 use async_trait::async_trait;
-use image::{ImageFormat, GenericImageView, DynamicImage, ImageEncoder, ColorType};
-use tokio::task;
+use image::{ImageFormat, GenericImageView, DynamicImage, ImageDecoder, ImageEncoder, ColorType};
+use image::codecs::jpeg::JpegDecoder;
+use image::imageops::FilterType;
 use std::io::Cursor;
 
 use crate::errors::{DomainError, DomainResult};
 use super::Compressor;
-use crate::domains::compression::types::CompressionMethod;
+use crate::domains::compression::types::{CompressionConfig, CompressionMethod};
+use crate::domains::compression::cpu_pool::run_cpu;
+use crate::domains::export::ios::memory::buffer_pool;
 
 /// Image compressor using the `image` crate for lossy/lossless compression
 /// Enhanced with HEIC, WebP, and additional format support
@@ -36,6 +39,28 @@ impl Compressor for ImageCompressor {
         data: Vec<u8>,
         method: CompressionMethod,
         quality_level: i32,
+    ) -> DomainResult<Vec<u8>> {
+        self.compress_bounded(data, method, quality_level, None).await
+    }
+    
+    async fn compress_with_config(
+        &self,
+        data: Vec<u8>,
+        config: &CompressionConfig,
+    ) -> DomainResult<Vec<u8>> {
+        self.compress_bounded(data, config.method, config.quality_level, config.max_dimension).await
+    }
+}
+
+impl ImageCompressor {
+    /// Compress an image, downscaling it while decoding so that neither side
+    /// exceeds `max_dimension` (when set)
+    async fn compress_bounded(
+        &self,
+        data: Vec<u8>,
+        method: CompressionMethod,
+        quality_level: i32,
+        max_dimension: Option<u32>,
     ) -> DomainResult<Vec<u8>> {
         // Force quality_level into valid range
         let quality = quality_level.clamp(1, 100) as u8;
@@ -47,33 +72,38 @@ impl Compressor for ImageCompressor {
         let original_len = data.len();
         
         // 🔧 FIX: Handle image orientation properly for HEIC and other formats
-        let compressed_data = task::spawn_blocking(move || -> DomainResult<Vec<u8>> {
-            // Try to load the image, with special handling for HEIC
-            let mut img = load_image_with_heic_support(&data)?;
+        let compressed_data = run_cpu(move || -> DomainResult<Vec<u8>> {
+            // Decode (with special handling for HEIC) straight to the target size,
+            // so the full-resolution bitmap never has to be held when a bound is set
+            let mut img = decode_bounded(&data, max_dimension)?;
             
             // 🔧 FIX: Apply EXIF orientation correction to prevent upside-down images
+            // (after downscaling, so the rotation works on the small buffer)
             img = apply_exif_orientation(img, &data)?;
             
             // Determine optimal output format based on input and compression method
             let output_format = determine_optimal_format(&data, method, quality)?;
+            // The encoded input is not needed past this point
+            let output = buffer_pool().take(data.len() / 2);
+            buffer_pool().release(data);
             
             match method {
                 CompressionMethod::Lossy => {
-                    compress_lossy_improved(img, output_format, quality)
+                    compress_lossy_improved(img, output_format, quality, output)
                 },
                 CompressionMethod::Lossless => {
                     // For lossless, use PNG with high compression
-                    compress_lossless_improved(img, ImageFormat::Png, quality.clamp(1, 9))
+                    compress_lossless_improved(img, ImageFormat::Png, quality.clamp(1, 9), output)
                 },
                 _ => {
                     // No compression, just re-encode in optimal format
-                    let mut output = Vec::new();
+                    let mut output = output;
                     img.write_to(&mut Cursor::new(&mut output), output_format)
                         .map_err(|e| DomainError::Internal(format!("Failed to encode image: {}", e)))?;
                     Ok(output)
                 }
             }
-        }).await.map_err(|e| DomainError::Internal(format!("Compression task failed: {}", e)))??;
+        }).await?;
         
         println!("✅ [IMAGE_COMPRESSOR] Compression completed: {} -> {} bytes", 
                  original_len, compressed_data.len());
@@ -82,9 +112,7 @@ impl Compressor for ImageCompressor {
     }
 }
 
-fn compress_lossy_improved(img: DynamicImage, format: ImageFormat, quality: u8) -> DomainResult<Vec<u8>> {
-    let mut output = Vec::new();
-    
+fn compress_lossy_improved(img: DynamicImage, format: ImageFormat, quality: u8, mut output: Vec<u8>) -> DomainResult<Vec<u8>> {
     match format {
         ImageFormat::Jpeg => {
             // For JPEG, use the specified quality
@@ -133,9 +161,7 @@ fn compress_lossy_improved(img: DynamicImage, format: ImageFormat, quality: u8)
     Ok(output)
 }
 
-fn compress_lossless_improved(img: DynamicImage, format: ImageFormat, quality: u8) -> DomainResult<Vec<u8>> {
-    let mut output = Vec::new();
-    
+fn compress_lossless_improved(img: DynamicImage, format: ImageFormat, quality: u8, mut output: Vec<u8>) -> DomainResult<Vec<u8>> {
     match format {
         ImageFormat::Png => {
             // For PNG, use best compression with optimized color type
@@ -233,6 +259,48 @@ fn load_image_with_heic_support(data: &[u8]) -> DomainResult<DynamicImage> {
     }
 }
 
+/// Decode an image so that neither side exceeds `max_dimension`.
+///
+/// JPEGs are decoded with DCT scaling (1/2, 1/4 or 1/8 of full size), which
+/// never materializes the full-resolution bitmap. Other formats are decoded at
+/// full size and downscaled immediately, before any further processing.
+fn decode_bounded(data: &[u8], max_dimension: Option<u32>) -> DomainResult<DynamicImage> {
+    let Some(max_dimension) = max_dimension.filter(|max| *max > 0) else {
+        return load_image_with_heic_support(data);
+    };
+    
+    let img = match image::guess_format(data) {
+        Ok(ImageFormat::Jpeg) => decode_jpeg_scaled(data, max_dimension)?,
+        _ => load_image_with_heic_support(data)?,
+    };
+    
+    let (width, height) = img.dimensions();
+    if width.max(height) > max_dimension {
+        println!("📐 [IMAGE_COMPRESSOR] Downscaling {}x{} to fit {}px", width, height, max_dimension);
+        Ok(img.resize(max_dimension, max_dimension, FilterType::Triangle))
+    } else {
+        Ok(img)
+    }
+}
+
+/// Decode a JPEG at the smallest DCT scale that still covers `max_dimension`
+fn decode_jpeg_scaled(data: &[u8], max_dimension: u32) -> DomainResult<DynamicImage> {
+    let mut decoder = JpegDecoder::new(Cursor::new(data))
+        .map_err(|e| DomainError::Internal(format!("Failed to read JPEG: {}", e)))?;
+    
+    let (width, height) = decoder.dimensions();
+    let longest = width.max(height);
+    if longest > max_dimension {
+        let ratio = max_dimension as f64 / longest as f64;
+        let requested = |side: u32| ((side as f64 * ratio).ceil() as u32).clamp(1, u16::MAX as u32) as u16;
+        decoder.scale(requested(width), requested(height))
+            .map_err(|e| DomainError::Internal(format!("Failed to scale JPEG: {}", e)))?;
+    }
+    
+    DynamicImage::from_decoder(decoder)
+        .map_err(|e| DomainError::Internal(format!("Failed to decode JPEG: {}", e)))
+}
+
 /// Check if data appears to be HEIC format
 fn is_heic_data(data: &[u8]) -> bool {
     if data.len() < 12 {
@@ -365,4 +433,24 @@ pub fn detect_image_format(data: &[u8]) -> Option<&'static str> {
     } else {
         None
     }
-}
\ No newline at end of file
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn sample_jpeg(width: u32, height: u32) -> Vec<u8> {
+        let img = DynamicImage::ImageRgb8(image::RgbImage::from_pixel(width, height, image::Rgb([120, 80, 40])));
+        let mut out = Vec::new();
+        img.write_to(&mut Cursor::new(&mut out), ImageFormat::Jpeg).unwrap();
+        out
+    }
+
+    #[test]
+    fn decode_bounded_fits_longest_side() {
+        let jpeg = sample_jpeg(640, 320);
+        assert_eq!(decode_bounded(&jpeg, Some(100)).unwrap().dimensions(), (100, 50));
+        assert_eq!(decode_bounded(&jpeg, Some(1000)).unwrap().dimensions(), (640, 320));
+        assert_eq!(decode_bounded(&jpeg, None).unwrap().dimensions(), (640, 320));
+    }
+}
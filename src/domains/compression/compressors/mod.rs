@@ -9,7 +9,7 @@ pub mod generic_compressor;
 use async_trait::async_trait;
 use std::path::Path;
 use crate::errors::DomainResult;
-use super::types::CompressionMethod;
+use super::types::{CompressionConfig, CompressionMethod};
 
 /// Common trait for all compressors
 #[async_trait]
@@ -25,6 +25,16 @@ pub trait Compressor: Send + Sync {
         quality_level: i32,
     ) -> DomainResult<Vec<u8>>;
     
+    /// Compress file data using the full config. Compressors that honour
+    /// settings beyond method and quality (e.g. `max_dimension`) override this.
+    async fn compress_with_config(
+        &self,
+        data: Vec<u8>,
+        config: &CompressionConfig,
+    ) -> DomainResult<Vec<u8>> {
+        self.compress(data, config.method, config.quality_level).await
+    }
+    
     /// Get the compressor type name for extension determination
     fn compressor_name(&self) -> &'static str;
 }
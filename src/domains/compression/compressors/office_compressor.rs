@@ -1,14 +1,48 @@
- //! Office document compression implementation
+//! Office document compression implementation
+//!
+//! DOCX/XLSX/PPTX files are ZIP archives. The archive is rewritten entry by
+//! entry in its original order: everything except embedded images is copied
+//! raw (still compressed, never inflated), and the images are recompressed
+//! concurrently on the compression CPU pool while at most
+//! `MAX_IN_FLIGHT_IMAGE_BYTES` of them are held decoded at once.
 
 use async_trait::async_trait;
+use futures::stream::{self, StreamExt};
+use std::collections::HashMap;
 use std::io::{Cursor, Read, Write};
-use tokio::task;
+use std::sync::Arc;
+use tokio::sync::Semaphore;
 use zip::{ZipArchive, ZipWriter, write::FileOptions};
-use std::collections::HashMap;
 
 use crate::errors::{DomainError, DomainResult};
 use super::{Compressor, get_extension};
 use crate::domains::compression::types::CompressionMethod;
+use crate::domains::compression::cpu_pool::{cpu_pool, run_cpu};
+
+/// Embedded images worth recompressing
+const IMAGE_EXTENSIONS: [&str; 5] = ["png", "jpg", "jpeg", "gif", "bmp"];
+
+/// Upper bound on the inflated size of images being recompressed at once
+const MAX_IN_FLIGHT_IMAGE_BYTES: usize = 64 * 1024 * 1024;
+
+/// The original document, shared by the tasks that read entries from it
+#[derive(Clone)]
+struct SharedBytes(Arc<Vec<u8>>);
+
+impl AsRef<[u8]> for SharedBytes {
+    fn as_ref(&self) -> &[u8] {
+        &self.0
+    }
+}
+
+type OfficeArchive = ZipArchive<Cursor<SharedBytes>>;
+
+/// An image entry to recompress
+struct ImageEntry {
+    index: usize,
+    name: String,
+    size: usize,
+}
 
 /// Office document compressor for DOCX, XLSX, PPTX files
 pub struct OfficeCompressor {
@@ -49,100 +83,153 @@ impl Compressor for OfficeCompressor {
         method: CompressionMethod,
         quality_level: i32,
     ) -> DomainResult<Vec<u8>> {
-        let image_compressor = self.image_compressor.clone();
-        
-        // 🔧 FIX: Extract ALL data first to avoid Send issues with ZipArchive
-        let mut image_files: Vec<(String, Vec<u8>)> = Vec::new();
-        let mut other_files: Vec<(String, Vec<u8>)> = Vec::new();
-        
-        // Extract all files from ZIP first (synchronous, no Send issues)
-        {
-            let mut archive = ZipArchive::new(Cursor::new(&data))
+        if method == CompressionMethod::None {
+            return Err(DomainError::Validation(crate::errors::ValidationError::custom("Office document contains no compressible images")));
+        }
+        let input_len = data.len();
+        let shared = SharedBytes(Arc::new(data));
+
+        // Reading the central directory is cheap; entries are inflated later, one image at a time
+        let (archive, images) = run_cpu(move || -> DomainResult<(OfficeArchive, Vec<ImageEntry>)> {
+            let mut archive = ZipArchive::new(Cursor::new(shared))
                 .map_err(|e| DomainError::Internal(format!("Failed to read Office document as ZIP: {}", e)))?;
-            
-            let image_extensions = ["png", "jpg", "jpeg", "gif", "bmp"];
-            
-            for i in 0..archive.len() {
-                let mut file = archive.by_index(i)
+            let mut images = Vec::new();
+            for index in 0..archive.len() {
+                let file = archive.by_index_raw(index)
                     .map_err(|e| DomainError::Internal(format!("Failed to read file in ZIP: {}", e)))?;
-                
-                let name = file.name().to_string();
-                let mut file_data = Vec::new();
-                file.read_to_end(&mut file_data)
-                    .map_err(|e| DomainError::Internal(format!("Failed to read file data: {}", e)))?;
-                
-                let ext = get_extension(&name).map(|e| e.to_lowercase());
-                let is_image = ext.map(|e| image_extensions.contains(&e.as_str())).unwrap_or(false);
-                
-                if is_image && method != CompressionMethod::None {
-                    image_files.push((name, file_data));
-                } else {
-                    other_files.push((name, file_data));
+                let is_image = get_extension(file.name())
+                    .map(|e| IMAGE_EXTENSIONS.contains(&e.to_lowercase().as_str()))
+                    .unwrap_or(false);
+                if is_image && !file.is_dir() {
+                    images.push(ImageEntry { index, name: file.name().to_string(), size: file.size() as usize });
                 }
             }
-        } // ZipArchive is dropped here
-        
+            Ok((archive, images))
+        }).await?;
+
         // Check if there are any images to compress
-        if image_files.is_empty() {
+        if images.is_empty() {
             println!("📄 [OFFICE_COMPRESSOR] No images found in document, skipping compression");
             return Err(DomainError::Validation(crate::errors::ValidationError::custom("Office document contains no compressible images")));
         }
-        
-        // Now compress images asynchronously (no Send issues)
-        let mut compressed_images: HashMap<String, Vec<u8>> = HashMap::new();
-        for (name, image_data) in image_files {
-            println!("📷 [OFFICE_COMPRESSOR] Compressing embedded image: {}", name);
-            let compressed_image = image_compressor.compress(
-                image_data, 
-                CompressionMethod::Lossy, 
-                quality_level
-            ).await?;
-            compressed_images.insert(name, compressed_image);
-        }
-        
-        // Finally, reconstruct ZIP in blocking task
-        task::spawn_blocking(move || -> DomainResult<Vec<u8>> {
-            // 🔧 FIX: Use Vec<u8> directly instead of Cursor for better control
-            let mut compressed_data = Vec::new();
+
+        // Recompress images concurrently; the semaphore (in KiB) bounds decoded bytes in flight
+        let budget_kib = (MAX_IN_FLIGHT_IMAGE_BYTES / 1024) as u32;
+        let in_flight = Arc::new(Semaphore::new(budget_kib as usize));
+        let compressed_images: HashMap<usize, Vec<u8>> = stream::iter(images)
+            .map(|entry| {
+                let archive = archive.clone();
+                let in_flight = in_flight.clone();
+                let image_compressor = self.image_compressor.clone();
+                async move {
+                    let kib = ((entry.size / 1024) as u32).clamp(1, budget_kib);
+                    let _permit = in_flight.acquire_many_owned(kib).await
+                        .map_err(|e| DomainError::Internal(format!("Image budget closed: {}", e)))?;
+
+                    let index = entry.index;
+                    let image_data = run_cpu(move || -> DomainResult<Vec<u8>> {
+                        let mut archive = archive;
+                        let mut file = archive.by_index(index)
+                            .map_err(|e| DomainError::Internal(format!("Failed to read file in ZIP: {}", e)))?;
+                        let mut image_data = Vec::with_capacity(file.size() as usize);
+                        file.read_to_end(&mut image_data)
+                            .map_err(|e| DomainError::Internal(format!("Failed to read file data: {}", e)))?;
+                        Ok(image_data)
+                    }).await?;
+
+                    println!("📷 [OFFICE_COMPRESSOR] Compressing embedded image: {}", entry.name);
+                    let original_len = image_data.len();
+                    match image_compressor.compress(image_data, CompressionMethod::Lossy, quality_level).await {
+                        Ok(compressed) if compressed.len() < original_len => Ok(Some((index, compressed))),
+                        Ok(_) => Ok(None),
+                        Err(e) => {
+                            // Keep the original bytes rather than failing the whole document
+                            log::warn!("Keeping embedded image {} uncompressed: {}", entry.name, e);
+                            Ok(None)
+                        }
+                    }
+                }
+            })
+            .buffer_unordered(cpu_pool().limit())
+            .filter_map(|result: DomainResult<Option<(usize, Vec<u8>)>>| async move { result.transpose() })
+            .collect::<Vec<_>>()
+            .await
+            .into_iter()
+            .collect::<DomainResult<_>>()?;
+
+        // Rebuild the archive in the original entry order
+        run_cpu(move || -> DomainResult<Vec<u8>> {
+            let mut archive = archive;
+            let mut compressed_data = Vec::with_capacity(input_len);
             {
                 let mut zip_writer = ZipWriter::new(Cursor::new(&mut compressed_data));
-                
+
+                // Recompressed images do not shrink further under deflate
                 let options = FileOptions::default()
-                    .compression_method(zip::CompressionMethod::Deflated)
-                    .compression_level(Some(9));
-                
-                // Add compressed images
-                for (name, image_data) in compressed_images {
-                    println!("📷 [OFFICE_COMPRESSOR] Adding compressed image: {} ({} bytes)", name, image_data.len());
-                    zip_writer.start_file(&name, options)
-                        .map_err(|e| DomainError::Internal(format!("Failed to create file in ZIP: {}", e)))?;
-                    zip_writer.write_all(&image_data)
-                        .map_err(|e| DomainError::Internal(format!("Failed to write image to ZIP: {}", e)))?;
-                }
-                
-                // Add other files
-                for (name, file_data) in other_files {
-                    println!("📄 [OFFICE_COMPRESSOR] Adding file: {} ({} bytes)", name, file_data.len());
-                    zip_writer.start_file(&name, options)
-                        .map_err(|e| DomainError::Internal(format!("Failed to create file in ZIP: {}", e)))?;
-                    zip_writer.write_all(&file_data)
-                        .map_err(|e| DomainError::Internal(format!("Failed to write file to ZIP: {}", e)))?;
+                    .compression_method(zip::CompressionMethod::Stored);
+
+                for index in 0..archive.len() {
+                    let file = archive.by_index_raw(index)
+                        .map_err(|e| DomainError::Internal(format!("Failed to read file in ZIP: {}", e)))?;
+                    match compressed_images.get(&index) {
+                        Some(image_data) => {
+                            println!("📷 [OFFICE_COMPRESSOR] Adding compressed image: {} ({} bytes)", file.name(), image_data.len());
+                            let name = file.name().to_string();
+                            drop(file);
+                            zip_writer.start_file(name, options)
+                                .map_err(|e| DomainError::Internal(format!("Failed to create file in ZIP: {}", e)))?;
+                            zip_writer.write_all(image_data)
+                                .map_err(|e| DomainError::Internal(format!("Failed to write image to ZIP: {}", e)))?;
+                        }
+                        None => {
+                            zip_writer.raw_copy_file(file)
+                                .map_err(|e| DomainError::Internal(format!("Failed to copy file in ZIP: {}", e)))?;
+                        }
+                    }
                 }
-                
-                // 🔧 FIX: Properly finish the ZIP writer
+
                 zip_writer.finish()
                     .map_err(|e| DomainError::Internal(format!("Failed to finalize ZIP: {}", e)))?;
-                
             } // ZipWriter is dropped here, data is written to compressed_data
-            
+
             println!("✅ [OFFICE_COMPRESSOR] Successfully compressed office document: {} bytes output", compressed_data.len());
-            
-            // 🔧 FIX: Validate output size
+
             if compressed_data.is_empty() {
                 return Err(DomainError::Internal("Office compression produced empty output".to_string()));
             }
-            
+
             Ok(compressed_data)
-        }).await.map_err(|e| DomainError::Internal(format!("Task join error: {}", e)))?
+        }).await
     }
-}
\ No newline at end of file
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[tokio::test]
+    async fn non_image_entries_are_copied_unchanged() {
+        let mut source = Vec::new();
+        {
+            let mut writer = ZipWriter::new(Cursor::new(&mut source));
+            let options = FileOptions::default().compression_method(zip::CompressionMethod::Deflated);
+            writer.start_file("[Content_Types].xml", options).unwrap();
+            writer.write_all(b"<Types/>").unwrap();
+            writer.start_file("ppt/media/image1.png", options).unwrap();
+            writer.write_all(b"not really a png").unwrap();
+            writer.finish().unwrap();
+        }
+
+        let output = OfficeCompressor::new()
+            .compress(source, CompressionMethod::Lossy, 80)
+            .await
+            .unwrap();
+
+        let mut archive = ZipArchive::new(Cursor::new(output)).unwrap();
+        assert_eq!(archive.len(), 2);
+        let mut xml = String::new();
+        archive.by_index(0).unwrap().read_to_string(&mut xml).unwrap();
+        assert_eq!(xml, "<Types/>");
+        assert_eq!(archive.by_index(1).unwrap().name(), "ppt/media/image1.png");
+    }
+}
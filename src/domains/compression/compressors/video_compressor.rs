@@ -1,7 +1,6 @@
 //! Video compression implementation for training and evidence videos
 
 use async_trait::async_trait;
-use tokio::task;
 use std::io::{Cursor, Read, Write};
 use flate2::write::GzEncoder;
 use flate2::Compression;
@@ -9,6 +8,8 @@ use flate2::Compression;
 use crate::errors::{DomainError, DomainResult};
 use super::Compressor;
 use crate::domains::compression::types::CompressionMethod;
+use crate::domains::compression::cpu_pool::run_cpu;
+use crate::domains::export::ios::memory::buffer_pool;
 
 /// Video compressor with intelligent handling for different video types
 /// - Training videos: More aggressive compression
@@ -101,7 +102,7 @@ impl VideoCompressor {
         println!("🎥 [VIDEO_COMPRESSOR] Optimizing video container");
         
         // Run in blocking task
-        task::spawn_blocking(move || -> DomainResult<Vec<u8>> {
+        run_cpu(move || -> DomainResult<Vec<u8>> {
             // Container-level optimizations:
             // 1. Remove metadata that might not be essential
             // 2. Optimize header structure
@@ -120,7 +121,7 @@ impl VideoCompressor {
                 println!("🎥 [VIDEO_COMPRESSOR] Container optimization saved {:.1}% ({} bytes)", savings_percent, space_saved);
                 Ok(optimized)
             }
-        }).await.map_err(|e| DomainError::Internal(format!("Video optimization task failed: {}", e)))?
+        }).await
     }
     
     /// Generic compression for video files (when specific optimization isn't available)
@@ -134,8 +135,8 @@ impl VideoCompressor {
             _ => Compression::best(),
         };
         
-        task::spawn_blocking(move || -> DomainResult<Vec<u8>> {
-            let mut encoder = GzEncoder::new(Vec::new(), compression_level);
+        run_cpu(move || -> DomainResult<Vec<u8>> {
+            let mut encoder = GzEncoder::new(buffer_pool().take(data.len() / 2), compression_level);
             encoder.write_all(&data)
                 .map_err(|e| DomainError::Internal(format!("Video compression write error: {}", e)))?;
             
@@ -144,12 +145,14 @@ impl VideoCompressor {
             
             // Only return compressed version if it's meaningfully smaller
             if compressed.len() < (data.len() * 90 / 100) {
+                buffer_pool().release(data);
                 Ok(compressed)
             } else {
                 println!("🎥 [VIDEO_COMPRESSOR] Generic compression not effective, returning original");
+                buffer_pool().release(compressed);
                 Ok(data)
             }
-        }).await.map_err(|e| DomainError::Internal(format!("Video compression task failed: {}", e)))?
+        }).await
     }
 }
 
@@ -0,0 +1,129 @@
+//! Bounded pool for the CPU-heavy stages of compression (decode, resize, encode)
+//!
+//! Compressors hand their synchronous work to `run_cpu`, which runs it on the
+//! Tokio blocking pool but never lets more than `limit()` closures run at once.
+//! The compression worker keeps the limit in step with
+//! `calculate_effective_max_jobs`, so thermal, battery and background state
+//! throttle CPU use the same way they throttle job admission.
+
+use std::sync::atomic::{AtomicUsize, Ordering};
+use std::sync::{Mutex, OnceLock};
+use tokio::sync::Notify;
+
+use crate::errors::{DomainError, DomainResult};
+
+/// Concurrency limiter shared by every compressor in the process
+pub struct CpuPool {
+    limit: AtomicUsize,
+    active: Mutex<usize>,
+    released: Notify,
+}
+
+/// Releases its slot in the pool when dropped
+struct CpuSlot<'a> {
+    pool: &'a CpuPool,
+}
+
+impl Drop for CpuSlot<'_> {
+    fn drop(&mut self) {
+        *self.pool.active.lock().unwrap() -= 1;
+        self.pool.released.notify_waiters();
+    }
+}
+
+impl CpuPool {
+    fn new(limit: usize) -> Self {
+        Self {
+            limit: AtomicUsize::new(limit.max(1)),
+            active: Mutex::new(0),
+            released: Notify::new(),
+        }
+    }
+
+    /// Maximum number of CPU stages running at once
+    pub fn limit(&self) -> usize {
+        self.limit.load(Ordering::Relaxed)
+    }
+
+    /// Change the limit. Lowering it never interrupts running stages; new
+    /// stages wait until enough of them finished. At least one slot is kept so
+    /// jobs that are already admitted can always finish.
+    pub fn set_limit(&self, limit: usize) {
+        let limit = limit.clamp(1, max_cpu_threads());
+        if self.limit.swap(limit, Ordering::Relaxed) != limit {
+            log::debug!("Compression CPU pool limit set to {}", limit);
+            self.released.notify_waiters();
+        }
+    }
+
+    /// Number of CPU stages currently running
+    pub fn active(&self) -> usize {
+        *self.active.lock().unwrap()
+    }
+
+    async fn acquire(&self) -> CpuSlot<'_> {
+        loop {
+            // Register for wakeups before checking, so a release in between is not missed
+            let released = self.released.notified();
+            {
+                let mut active = self.active.lock().unwrap();
+                if *active < self.limit() {
+                    *active += 1;
+                    return CpuSlot { pool: self };
+                }
+            }
+            released.await;
+        }
+    }
+}
+
+/// Upper bound for the pool: one stage per core
+fn max_cpu_threads() -> usize {
+    std::thread::available_parallelism().map(|n| n.get()).unwrap_or(2)
+}
+
+/// The process-wide compression CPU pool
+pub fn cpu_pool() -> &'static CpuPool {
+    static POOL: OnceLock<CpuPool> = OnceLock::new();
+    POOL.get_or_init(|| CpuPool::new(max_cpu_threads().min(2)))
+}
+
+/// Run a CPU-bound compression stage on the blocking pool, waiting for a free
+/// slot first.
+pub async fn run_cpu<F, R>(work: F) -> DomainResult<R>
+where
+    F: FnOnce() -> DomainResult<R> + Send + 'static,
+    R: Send + 'static,
+{
+    let pool = cpu_pool();
+    let _slot = pool.acquire().await;
+    tokio::task::spawn_blocking(work)
+        .await
+        .map_err(|e| DomainError::Internal(format!("Compression task failed: {}", e)))?
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use std::sync::Arc;
+
+    #[tokio::test]
+    async fn limit_bounds_concurrent_stages() {
+        let pool = Arc::new(CpuPool::new(1));
+        let first = pool.acquire().await;
+        assert_eq!(pool.active(), 1);
+
+        let waiter = {
+            let pool = pool.clone();
+            tokio::spawn(async move {
+                let _slot = pool.acquire().await;
+            })
+        };
+        tokio::task::yield_now().await;
+        assert!(!waiter.is_finished());
+
+        drop(first);
+        waiter.await.unwrap();
+        assert_eq!(pool.active(), 0);
+    }
+}
@@ -4,6 +4,7 @@ pub mod repository;
 pub mod service;
 pub mod worker;
 pub mod compressors;
+pub mod cpu_pool;
 pub mod manager;
 
 // Re-export key types including iOS-enhanced types
@@ -18,4 +19,4 @@ pub use types::{
 pub use service::CompressionService;
 pub use repository::CompressionRepository;
 pub use manager::CompressionManager;
-pub use worker::{CompressionWorker, CompressionWorkerMessage, WorkerStatus}; 
\ No newline at end of file
+pub use worker::{CompressionWorker, CompressionWorkerMessage, WorkerStatus, notify_queue_changed}; 
\ No newline at end of file
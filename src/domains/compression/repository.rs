@@ -71,7 +71,9 @@ pub trait CompressionRepository: Send + Sync {
         priority: i32,
     ) -> DomainResult<CompressionQueueEntry>;
     
-    /// Queue a document for compression within an existing transaction
+    /// Queue a document for compression within an existing transaction.
+    /// The entry is invisible to the worker until `tx` commits, so callers
+    /// should call `worker::notify_queue_changed` after committing.
     async fn queue_document_with_tx(
         &self,
         document_id: Uuid,
@@ -204,6 +206,7 @@ impl CompressionRepository for SqliteCompressionRepository {
                 
             let entry = self.get_queue_entry_internal(queue_id, &mut tx).await?;
             tx.commit().await.map_err(DbError::from)?;
+            super::worker::notify_queue_changed();
             return Ok(entry);
         }
         
@@ -243,6 +246,9 @@ impl CompressionRepository for SqliteCompressionRepository {
         let entry = self.get_queue_entry_internal(queue_id, &mut tx).await?;
         tx.commit().await.map_err(DbError::from)?;
         
+        // Wake the worker now instead of waiting for its fallback sweep
+        super::worker::notify_queue_changed();
+        
         Ok(entry)
     }
     
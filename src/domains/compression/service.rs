@@ -9,6 +9,7 @@ use chrono::Utc;
 use std::str::FromStr;
 
 use crate::domains::core::file_storage_service::FileStorageService;
+use crate::domains::core::content_blobs;
 use crate::domains::document::repository::MediaDocumentRepository;
 use crate::domains::document::types::{CompressionStatus, MediaDocument, SourceOfChange};
 use crate::errors::{DbError, DomainError, ServiceError, ServiceResult};
@@ -38,6 +39,65 @@ fn max_in_memory_bytes() -> i64 {
         .unwrap_or(2048 * 1024 * 1024) // 2GB
 }
 
+// Longest side (pixels) images are downscaled to while decoding when the
+// config comes from the document type, i.e. for every queued job.
+// Default: 4096, can be overridden by env var `COMPRESSION_MAX_IMAGE_DIMENSION`;
+// 0 keeps the original resolution.
+fn default_max_image_dimension() -> Option<u32> {
+    env::var("COMPRESSION_MAX_IMAGE_DIMENSION")
+        .ok()
+        .and_then(|val| val.parse::<u32>().ok())
+        .map_or(Some(4096), |max| Some(max).filter(|max| *max > 0))
+}
+
+/// Config of a document type row; images are bounded by `max_dimension`
+fn document_type_config(
+    method: Option<String>,
+    quality_level: i64,
+    min_size_bytes: Option<i64>,
+    max_dimension: Option<u32>,
+) -> Result<CompressionConfig, DomainError> {
+    let method = method.unwrap_or_else(|| "lossless".to_string());
+    Ok(CompressionConfig {
+        method: CompressionMethod::from_str(&method)?,
+        quality_level: quality_level as i32,
+        min_size_bytes: min_size_bytes.unwrap_or(10240),
+        max_dimension,
+    })
+}
+
+/// Format-specific config used when the document type cannot be read
+fn fallback_config(mime_type: &str, max_dimension: Option<u32>) -> CompressionConfig {
+    match mime_type {
+        "image/jpeg" | "image/jpg" => CompressionConfig {
+            method: CompressionMethod::Lossy,
+            quality_level: 80, // Good balance for JPEG
+            min_size_bytes: 5120, // 5KB minimum for images
+            max_dimension,
+        },
+        "image/png" => CompressionConfig {
+            method: CompressionMethod::Lossless,
+            quality_level: 9, // Best compression for PNG
+            min_size_bytes: 10240, // 10KB minimum for PNG
+            max_dimension,
+        },
+        "application/pdf" => CompressionConfig {
+            method: CompressionMethod::None, // 🔧 FIX: PDFs should not be compressed
+            quality_level: 0,
+            min_size_bytes: 0,
+            max_dimension: None,
+        },
+        // 🔧 FIX: Don't compress text files - they become unreadable gibberish when gzipped
+        mime_type if mime_type.starts_with("text/") => CompressionConfig {
+            method: CompressionMethod::None,
+            quality_level: 0,
+            min_size_bytes: 0,
+            max_dimension: None,
+        },
+        _ => CompressionConfig { max_dimension, ..CompressionConfig::default() }
+    }
+}
+
 #[async_trait]
 pub trait CompressionService: Send + Sync {
     /// Compress a document and update its status
@@ -120,6 +180,8 @@ pub struct CompressionServiceImpl {
     file_storage_service: Arc<dyn FileStorageService>,
     media_doc_repo: Arc<dyn MediaDocumentRepository>,
     compressors: Vec<Box<dyn Compressor>>,
+    /// Applied to configs loaded for queued jobs (see `default_max_image_dimension`)
+    max_image_dimension: Option<u32>,
 }
 
 impl CompressionServiceImpl {
@@ -148,8 +210,15 @@ impl CompressionServiceImpl {
             file_storage_service,
             media_doc_repo,
             compressors,
+            max_image_dimension: default_max_image_dimension(),
         }
     }
+
+    /// Override the image bound of queued jobs; `None` keeps full resolution
+    pub fn with_max_image_dimension(mut self, max_dimension: Option<u32>) -> Self {
+        self.max_image_dimension = max_dimension.filter(|max| *max > 0);
+        self
+    }
     
     /// Find the appropriate compressor for a file
     async fn find_compressor(
@@ -245,6 +314,68 @@ impl CompressionServiceImpl {
         Ok(())
     }
     
+    /// Complete a document's compression with its blob's existing compressed
+    /// file, if there is one. Returns `None` when the document has to be
+    /// compressed normally.
+    async fn reuse_blob_compression(
+        &self,
+        document: &MediaDocument,
+        blob: Option<&content_blobs::ContentBlob>,
+        config: &CompressionConfig,
+        start_time: Instant,
+    ) -> ServiceResult<Option<CompressionResult>> {
+        let Some(blob) = blob else { return Ok(None) };
+        let (Some(shared_path), Some(shared_size)) = (blob.compressed_file_path.clone(), blob.compressed_size_bytes) else {
+            return Ok(None);
+        };
+        
+        // The shared file may have been removed once nothing referenced it
+        match self.file_storage_service.get_file_size(&shared_path).await {
+            Ok(size) if size > 0 => {},
+            _ => return Ok(None),
+        }
+        
+        let document_id = document.id;
+        println!("♻️ [COMPRESSION_SERVICE] Content of document {} already compressed at {}, reusing it", document_id, shared_path);
+        
+        self.media_doc_repo.update_compression_status(
+            document_id,
+            CompressionStatus::Completed,
+            Some(&shared_path),
+            Some(shared_size)
+        ).await.map_err(ServiceError::Domain)?;
+        
+        if let Some(queue_entry) = self.compression_repo.get_queue_entry_by_document_id(document_id).await
+            .map_err(ServiceError::Domain)?
+        {
+            self.compression_repo.update_queue_entry_status(queue_entry.id, "completed", None)
+                .await.map_err(ServiceError::Domain)?;
+        }
+        
+        // The blob original may have been stored again by this upload
+        if let Err(e) = self.queue_original_for_safe_deletion(document_id, &shared_path).await {
+            log::warn!("Failed to queue original file for deletion for document {}: {:?}", document_id, e);
+        }
+        
+        let original_size = document.size_bytes;
+        let space_saved_bytes = original_size - shared_size;
+        Ok(Some(CompressionResult {
+            document_id,
+            original_size,
+            compressed_size: shared_size,
+            compressed_file_path: shared_path,
+            space_saved_bytes,
+            space_saved_percentage: if original_size > 0 {
+                (space_saved_bytes as f64 / original_size as f64) * 100.0
+            } else {
+                0.0
+            },
+            method_used: config.method,
+            quality_level: config.quality_level,
+            duration_ms: start_time.elapsed().as_millis() as i64,
+        }))
+    }
+    
     /// Load compression configuration from document type in database
     async fn load_compression_config_from_db(&self, type_id: Uuid) -> Result<CompressionConfig, ServiceError> {
         let type_id_str = type_id.to_string();
@@ -264,22 +395,16 @@ impl CompressionServiceImpl {
         .await;
         
         match result {
-            Ok(Some(row)) => {
-                let method = row.compression_method
-                    .unwrap_or_else(|| "lossless".to_string());
-                
-                let compression_method = CompressionMethod::from_str(&method)
-                    .map_err(|e| ServiceError::Domain(e))?;
-                
-                Ok(CompressionConfig {
-                    method: compression_method,
-                    quality_level: row.compression_level as i32,
-                    min_size_bytes: row.min_size_for_compression.unwrap_or(10240),
-                })
-            },
+            Ok(Some(row)) => document_type_config(
+                row.compression_method,
+                row.compression_level,
+                row.min_size_for_compression,
+                self.max_image_dimension,
+            )
+            .map_err(ServiceError::Domain),
             Ok(None) => {
                 log::warn!("Document type {} not found, using default compression config", type_id);
-                Ok(CompressionConfig::default())
+                Ok(CompressionConfig { max_dimension: self.max_image_dimension, ..CompressionConfig::default() })
             },
             Err(e) => {
                 log::error!("Database error loading compression config for type {}: {:?}", type_id, e);
@@ -287,11 +412,9 @@ impl CompressionServiceImpl {
             }
         }
     }
-}
 
-#[async_trait]
-impl CompressionService for CompressionServiceImpl {
-    async fn compress_document(
+    /// Body of `compress_document`, which times it
+    async fn run_compression(
         &self,
         document_id: Uuid,
         config: Option<CompressionConfig>,
@@ -371,37 +494,14 @@ impl CompressionService for CompressionServiceImpl {
                 // Load compression settings from document type in database
                 match self.load_compression_config_from_db(document.type_id).await {
                     Ok(db_config) => {
-                        log::info!("Loaded compression config from database for document {}: method={:?}, quality={}, min_size={}", 
-                                 document_id, db_config.method, db_config.quality_level, db_config.min_size_bytes);
+                        log::info!("Loaded compression config from database for document {}: method={:?}, quality={}, min_size={}, max_dimension={:?}", 
+                                 document_id, db_config.method, db_config.quality_level, db_config.min_size_bytes, db_config.max_dimension);
                         db_config
                     },
                     Err(e) => {
                         log::warn!("Failed to load compression config from database for document {}: {:?}, using defaults", document_id, e);
                         // Fallback to format-specific default config based on MIME type
-                        match document.mime_type.as_str() {
-                            "image/jpeg" | "image/jpg" => CompressionConfig {
-                                method: CompressionMethod::Lossy,
-                                quality_level: 80, // Good balance for JPEG
-                                min_size_bytes: 5120, // 5KB minimum for images
-                            },
-                            "image/png" => CompressionConfig {
-                                method: CompressionMethod::Lossless,
-                                quality_level: 9, // Best compression for PNG
-                                min_size_bytes: 10240, // 10KB minimum for PNG
-                            },
-                            "application/pdf" => CompressionConfig {
-                                method: CompressionMethod::None, // 🔧 FIX: PDFs should not be compressed
-                                quality_level: 0,
-                                min_size_bytes: 0,
-                            },
-                            // 🔧 FIX: Don't compress text files - they become unreadable gibberish when gzipped
-                            mime_type if mime_type.starts_with("text/") => CompressionConfig {
-                                method: CompressionMethod::None,
-                                quality_level: 0,
-                                min_size_bytes: 0,
-                            },
-                            _ => CompressionConfig::default()
-                        }
+                        fallback_config(&document.mime_type, self.max_image_dimension)
                     }
                 }
             }
@@ -452,6 +552,14 @@ impl CompressionService for CompressionServiceImpl {
             });
         }
 
+        // Documents stored content-addressed share their blob's compressed file:
+        // if the same bytes were already compressed for another document, reuse it
+        let blob = content_blobs::blob_for_document(&self.pool, document_id).await
+            .map_err(ServiceError::Domain)?;
+        if let Some(result) = self.reuse_blob_compression(&document, blob.as_ref(), &config, start_time).await? {
+            return Ok(result);
+        }
+        
         // BEFORE loading the entire file, check its size to avoid RAM spikes
         println!("📏 [COMPRESSION_SERVICE] Checking file size for document {}", document_id);
         let original_size_on_disk = match self.file_storage_service.get_file_size(&document.file_path).await {
@@ -554,11 +662,7 @@ impl CompressionService for CompressionServiceImpl {
         
         // 10. Compress the file
         log::info!("Starting compression for document {}", document_id);
-        let compressed_data = match compressor.compress(
-            file_data, 
-            config.method,
-            config.quality_level
-        ).await {
+        let compressed_data = match compressor.compress_with_config(file_data, &config).await {
             Ok(data) => {
                 // Validate compression output to prevent zero-byte files
                 let compressed_size = data.len() as i64;
@@ -852,6 +956,13 @@ impl CompressionService for CompressionServiceImpl {
             }
         }
         
+        // Let later documents with the same content reuse this file
+        if let Some(blob) = &blob {
+            if let Err(e) = content_blobs::record_compressed(&self.pool, &blob.content_hash, &compressed_path, compressed_size).await {
+                log::warn!("Failed to record compressed file for blob {}: {:?}", blob.content_hash, e);
+            }
+        }
+        
         // 14. Update queue entry if exists (separate operation)
         if let Some(queue_entry) = self.compression_repo.get_queue_entry_by_document_id(document_id).await
             .map_err(|e| ServiceError::Domain(e))? 
@@ -984,6 +1095,23 @@ impl CompressionService for CompressionServiceImpl {
             duration_ms,
         })
     }
+}
+
+#[async_trait]
+impl CompressionService for CompressionServiceImpl {
+    async fn compress_document(
+        &self,
+        document_id: Uuid,
+        config: Option<CompressionConfig>,
+    ) -> ServiceResult<CompressionResult> {
+        let started = Instant::now();
+        let result = self.run_compression(document_id, config).await;
+        crate::metrics::record_compression(
+            started.elapsed(),
+            result.as_ref().ok().map(|r| (r.original_size, r.compressed_size)),
+        );
+        result
+    }
     
     async fn get_compression_queue_status(&self) -> ServiceResult<CompressionQueueStatus> {
         self.compression_repo.get_queue_status().await
@@ -1500,4 +1628,32 @@ impl CompressionService for CompressionServiceImpl {
 
         Ok(total_reset)
     }
-}
\ No newline at end of file
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use image::{DynamicImage, GenericImageView, ImageFormat};
+    use std::io::Cursor;
+
+    fn sample_jpeg(width: u32, height: u32) -> Vec<u8> {
+        let img = DynamicImage::ImageRgb8(image::RgbImage::from_pixel(width, height, image::Rgb([120, 80, 40])));
+        let mut out = Vec::new();
+        img.write_to(&mut Cursor::new(&mut out), ImageFormat::Jpeg).unwrap();
+        out
+    }
+
+    #[tokio::test]
+    async fn queued_jobs_downscale_images_while_decoding() {
+        // The worker passes no config, so the document type row decides it
+        let config = document_type_config(Some("lossy".to_string()), 80, None, Some(100)).unwrap();
+        assert_eq!(config.max_dimension, Some(100));
+
+        let compressed = ImageCompressor.compress_with_config(sample_jpeg(640, 320), &config).await.unwrap();
+        assert_eq!(image::load_from_memory(&compressed).unwrap().dimensions(), (100, 50));
+
+        // The fallback for unreadable types keeps the bound for images only
+        assert_eq!(fallback_config("image/jpeg", Some(100)).max_dimension, Some(100));
+        assert_eq!(fallback_config("application/pdf", Some(100)).max_dimension, None);
+    }
+}
@@ -148,6 +148,10 @@ pub struct CompressionConfig {
     pub method: CompressionMethod,
     pub quality_level: i32, // 0-100 for lossy, 0-9 for lossless
     pub min_size_bytes: i64, // Minimum file size to compress
+    /// Longest side, in pixels, images are downscaled to while decoding.
+    /// `None` keeps the original resolution.
+    #[serde(default)]
+    pub max_dimension: Option<u32>,
 }
 
 impl Default for CompressionConfig {
@@ -156,6 +160,7 @@ impl Default for CompressionConfig {
             method: CompressionMethod::Lossless,
             quality_level: 75, // Default quality level
             min_size_bytes: 10240, // 10KB minimum
+            max_dimension: None,
         }
     }
 }
@@ -10,11 +10,13 @@ use chrono::{Timelike, Utc};
 use uuid::Uuid;
 use std::sync::{OnceLock, Mutex};
 use std::time::Instant;
+use tokio::sync::Notify;
 
 use crate::errors::{DomainError, ServiceError, ServiceResult, DomainResult};
 use crate::errors::DbError;
 use crate::domains::compression::service::CompressionService;
 use crate::domains::compression::repository::CompressionRepository;
+use crate::domains::compression::cpu_pool::cpu_pool;
 use crate::domains::compression::types::{
     CompressionConfig, CompressionPriority, CompressionQueueEntry,
     IOSDeviceState, IOSThermalState, IOSAppState, IOSOptimizations, IOSWorkerStatus, IOSDeviceCapabilities
@@ -97,6 +99,37 @@ pub enum CompressionWorkerMessage {
     },
 }
 
+/// Signal raised whenever the compression queue may have work the worker has
+/// not seen yet (a document was queued, a job finished, the worker resumed)
+fn queue_signal() -> &'static Notify {
+    static SIGNAL: OnceLock<Notify> = OnceLock::new();
+    SIGNAL.get_or_init(Notify::new)
+}
+
+/// Wake the compression worker so it schedules queued documents right away.
+/// Cheap and safe to call from anywhere; wakeups coalesce while the worker is busy.
+pub fn notify_queue_changed() {
+    queue_signal().notify_one();
+}
+
+/// Reports a compression job as finished when dropped, however the job ends
+/// (completion, early return, timeout or abort), and wakes the worker.
+/// The task's `JoinHandle` is not yet `is_finished()` while this runs, so the
+/// worker relies on `finished_jobs` to free the slot.
+struct JobFinishedSignal {
+    document_id: Uuid,
+    finished_jobs: Arc<Mutex<Vec<Uuid>>>,
+}
+
+impl Drop for JobFinishedSignal {
+    fn drop(&mut self) {
+        if let Ok(mut finished) = self.finished_jobs.lock() {
+            finished.push(self.document_id);
+        }
+        notify_queue_changed();
+    }
+}
+
 /// Worker status information
 #[derive(Debug, Clone)]
 pub struct WorkerStatus {
@@ -116,6 +149,8 @@ pub struct CompressionWorker {
     message_receiver: Option<mpsc::Receiver<CompressionWorkerMessage>>,
     message_sender: mpsc::Sender<CompressionWorkerMessage>,
     active_jobs: tokio::sync::Mutex<HashMap<Uuid, JoinHandle<()>>>,
+    /// Jobs that ended since the last `cleanup_completed_jobs`
+    finished_jobs: Arc<Mutex<Vec<Uuid>>>,
     
     // iOS-specific state
     ios_state: Arc<tokio::sync::RwLock<IOSDeviceState>>,
@@ -157,11 +192,12 @@ impl CompressionWorker {
             compression_service,
             compression_repo,
             pool,
-            interval_ms: interval_ms.unwrap_or(2000), // Reduced from 5000ms for faster response
+            interval_ms: interval_ms.unwrap_or(30_000), // Fallback sweep only; queue changes are signalled
             max_concurrent_jobs: max_concurrent_jobs.unwrap_or(device_capabilities.get_safe_concurrency()),
             message_receiver: Some(receiver),
             message_sender: sender,
             active_jobs: tokio::sync::Mutex::new(HashMap::new()),
+            finished_jobs: Arc::new(Mutex::new(Vec::new())),
             
             // iOS-specific state initialization
             ios_state: Arc::new(tokio::sync::RwLock::new(default_ios_state)),
@@ -188,6 +224,25 @@ impl CompressionWorker {
         self
     }
 
+    /// Start the worker on a dedicated OS thread with its own single-threaded
+    /// runtime. Used when the FFI runtime is current-thread: a task spawned there
+    /// only makes progress while some FFI call is blocked in `block_on`.
+    /// CPU stages still run in parallel on the blocking pool via `cpu_pool`.
+    pub fn start_on_dedicated_thread(mut self) -> std::io::Result<std::thread::JoinHandle<()>> {
+        let mut receiver = self.message_receiver.take().expect("Receiver should be available");
+        let runtime = tokio::runtime::Builder::new_current_thread()
+            .enable_all()
+            .thread_name("compression-blocking")
+            .build()?;
+        
+        std::thread::Builder::new()
+            .name("compression-worker".to_string())
+            .spawn(move || {
+                runtime.block_on(self.run_enhanced_worker(&mut receiver));
+                println!("✅ [COMPRESSION_WORKER] Enhanced compression worker shut down gracefully");
+            })
+    }
+    
     /// Start the worker process with superior message-based architecture
     pub fn start(mut self) -> (JoinHandle<()>, mpsc::Sender<CompressionWorkerMessage>) {
         let sender = self.message_sender.clone();
@@ -208,13 +263,16 @@ impl CompressionWorker {
         
         log::info!("Starting enhanced compression worker");
         log::info!("Max concurrent jobs: {}", self.max_concurrent_jobs);
-        log::info!("Poll interval: {}ms", self.interval_ms);
+        log::info!("Fallback sweep interval: {}ms (queue changes wake the worker directly)", self.interval_ms);
         log::debug!("Message-based control enabled");
         log::debug!("Active job tracking enabled");
         log::debug!("iOS integration enabled");
         
-        // Create interval timer for polling, but prioritize messages
+        // Queue changes arrive through `queue_signal`; the interval is only a
+        // fallback sweep (entries queued inside foreign transactions, jobs reset
+        // by maintenance) and drives periodic maintenance
         let mut interval = tokio::time::interval(Duration::from_millis(self.interval_ms));
+        interval.set_missed_tick_behavior(tokio::time::MissedTickBehavior::Delay);
         
         loop {
             // Check if shutdown requested
@@ -251,6 +309,7 @@ impl CompressionWorker {
                                 CompressionWorkerMessage::SetMaxConcurrency { max_jobs, response } => {
                                     self.max_concurrent_jobs = max_jobs;
                                     log::info!("Updated max concurrency to {}", max_jobs);
+                                    notify_queue_changed();
                                     let _ = response.send(());
                                 },
                                 CompressionWorkerMessage::UpdateIOSState { 
@@ -301,7 +360,12 @@ impl CompressionWorker {
                     }
                 },
                 
-                // Priority 2: Process queue on interval
+                // Priority 2: Queue changed (document queued, job finished, resumed)
+                _ = queue_signal().notified() => {
+                    self.fill_capacity().await;
+                }
+                
+                // Priority 3: Fallback sweep and maintenance
                 _ = interval.tick() => {
                     self.process_queue_tick().await;
                 }
@@ -403,20 +467,32 @@ impl CompressionWorker {
         }
         
         // Start new jobs if we have capacity
-        if self.has_capacity().await {
-            if self.start_next_job_if_available().await {
-                // Successfully started a job, try to start more immediately
-                for _ in 0..2 { // Try up to 2 more jobs
-                    if !self.has_capacity().await || !self.start_next_job_if_available().await {
-                        break;
-                    }
-                }
-            } else {
-                // No jobs in queue, less frequent logging
-                let active_count = self.get_active_job_count().await;
-                log_idle_if_needed(active_count);
-            }
+        if self.fill_capacity().await == 0 {
+            // Nothing started, less frequent logging
+            let active_count = self.get_active_job_count().await;
+            log_idle_if_needed(active_count);
+        }
+    }
+    
+    /// Start queued jobs until the queue is empty or the effective job limit is
+    /// reached. Returns the number of jobs started.
+    async fn fill_capacity(&self) -> usize {
+        self.cleanup_completed_jobs().await;
+        self.sync_cpu_limit().await;
+        
+        let mut jobs_started = 0;
+        while self.has_capacity().await && self.start_next_job_if_available().await {
+            jobs_started += 1;
         }
+        jobs_started
+    }
+    
+    /// Keep the shared compression CPU pool in step with the effective job
+    /// limit, so thermal, battery and background throttling also bounds the
+    /// number of decode/encode stages running at once
+    async fn sync_cpu_limit(&self) {
+        let effective_max_jobs = self.calculate_effective_max_jobs().await;
+        cpu_pool().set_limit(effective_max_jobs.max(1));
     }
     
     /// Check if worker has capacity for more jobs (iOS-aware)
@@ -461,7 +537,10 @@ impl CompressionWorker {
     async fn cleanup_completed_jobs(&self) {
         let mut jobs = self.active_jobs.lock().await;
         let initial_count = jobs.len();
-        jobs.retain(|_, handle| !handle.is_finished());
+        let finished: Vec<Uuid> = self.finished_jobs.lock()
+            .map(|mut finished| std::mem::take(&mut *finished))
+            .unwrap_or_default();
+        jobs.retain(|document_id, handle| !handle.is_finished() && !finished.contains(document_id));
         let completed_count = initial_count - jobs.len();
         
         if completed_count > 0 {
@@ -532,8 +611,13 @@ impl CompressionWorker {
         let compression_repo = self.compression_repo.clone();
         let pool = self.pool.clone();
         let device_capabilities = self.device_capabilities.clone();
+        let finished_signal = JobFinishedSignal {
+            document_id,
+            finished_jobs: self.finished_jobs.clone(),
+        };
         
         tokio::spawn(async move {
+            let _finished = finished_signal;
             println!("🔄 [COMPRESSION_JOB] Processing document {}", document_id);
             
             // Process the document with timeout to prevent infinite hangs
@@ -818,6 +902,7 @@ impl CompressionWorker {
         
         // Auto-adjust worker behavior based on new state
         self.auto_adjust_for_ios_state().await;
+        self.sync_cpu_limit().await;
     }
     
     /// Handle iOS memory pressure
@@ -885,6 +970,7 @@ impl CompressionWorker {
             }
         } else {
             println!("▶️ [COMPRESSION_WORKER] Resumed");
+            notify_queue_changed();
         }
     }
     
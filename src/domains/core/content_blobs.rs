@@ -0,0 +1,194 @@
+//! Content-addressed blob bookkeeping for media document files.
+//!
+//! `FileStorageService::save_blob` stores each distinct file once under a path
+//! derived from its SHA-256; this module records those blobs in
+//! `content_blobs` (created by `20250620000000_content_blobs.sql`) and links
+//! documents to them through `media_documents.content_hash`. Triggers keep
+//! `ref_count` equal to the number of active documents using a blob.
+//!
+//! Per blob we also remember the compressed file and the remote blob key, so
+//! compression and upload happen once per content rather than once per
+//! document, and `FileDeletionWorker` asks `is_blob_path_needed` before it
+//! removes a file another document may still use.
+
+use crate::errors::{DbError, DomainResult};
+use sha2::{Digest, Sha256};
+use sqlx::{query, query_as, query_scalar, Sqlite, SqlitePool, Transaction};
+use uuid::Uuid;
+
+/// Shared file data recorded for one content hash
+#[derive(Debug, Clone, sqlx::FromRow)]
+pub struct ContentBlob {
+    pub content_hash: String,
+    pub file_path: String,
+    pub size_bytes: i64,
+    pub ref_count: i64,
+    pub compressed_file_path: Option<String>,
+    pub compressed_size_bytes: Option<i64>,
+    pub remote_blob_key: Option<String>,
+}
+
+/// Incremental SHA-256 over data that arrives in chunks
+#[derive(Default)]
+pub struct ContentHasher(Sha256);
+
+impl ContentHasher {
+    pub fn update(&mut self, chunk: &[u8]) {
+        self.0.update(chunk);
+    }
+
+    /// Lowercase hex digest
+    pub fn finish(self) -> String {
+        hex::encode(self.0.finalize())
+    }
+}
+
+/// SHA-256 of `data` as lowercase hex
+pub fn content_hash(data: &[u8]) -> String {
+    let mut hasher = ContentHasher::default();
+    hasher.update(data);
+    hasher.finish()
+}
+
+/// Record a stored blob. Idempotent: saving the same content again keeps the
+/// existing row (and its compressed file / remote key).
+pub async fn register_blob_with_tx(
+    tx: &mut Transaction<'_, Sqlite>,
+    hash: &str,
+    file_path: &str,
+    size_bytes: i64,
+) -> DomainResult<()> {
+    query(
+        "INSERT INTO content_blobs (content_hash, file_path, size_bytes)
+         VALUES (?, ?, ?)
+         ON CONFLICT (content_hash) DO NOTHING",
+    )
+    .bind(hash)
+    .bind(file_path)
+    .bind(size_bytes)
+    .execute(&mut **tx)
+    .await
+    .map_err(DbError::from)?;
+    Ok(())
+}
+
+/// Link a document to a registered blob (bumps `ref_count` through the
+/// trigger); run in the transaction that inserts the document
+pub async fn attach_document_with_tx(tx: &mut Transaction<'_, Sqlite>, document_id: Uuid, hash: &str) -> DomainResult<()> {
+    query("UPDATE media_documents SET content_hash = ? WHERE id = ?")
+        .bind(hash)
+        .bind(document_id.to_string())
+        .execute(&mut **tx)
+        .await
+        .map_err(DbError::from)?;
+    Ok(())
+}
+
+/// Blob a document's file belongs to, if it was stored content-addressed
+pub async fn blob_for_document(pool: &SqlitePool, document_id: Uuid) -> DomainResult<Option<ContentBlob>> {
+    query_as::<_, ContentBlob>(
+        "SELECT b.content_hash, b.file_path, b.size_bytes, b.ref_count,
+                b.compressed_file_path, b.compressed_size_bytes, b.remote_blob_key
+         FROM content_blobs b
+         JOIN media_documents d ON d.content_hash = b.content_hash
+         WHERE d.id = ?",
+    )
+    .bind(document_id.to_string())
+    .fetch_optional(pool)
+    .await
+    .map_err(|e| DbError::from(e).into())
+}
+
+/// Remember the compressed file produced for a blob
+pub async fn record_compressed(pool: &SqlitePool, hash: &str, compressed_file_path: &str, compressed_size_bytes: i64) -> DomainResult<()> {
+    query(
+        "UPDATE content_blobs
+         SET compressed_file_path = ?, compressed_size_bytes = ?,
+             updated_at = strftime('%Y-%m-%dT%H:%M:%fZ', 'now')
+         WHERE content_hash = ?",
+    )
+    .bind(compressed_file_path)
+    .bind(compressed_size_bytes)
+    .bind(hash)
+    .execute(pool)
+    .await
+    .map_err(DbError::from)?;
+    Ok(())
+}
+
+/// Remember the key the server stored a blob under
+pub async fn record_remote_blob_key(pool: &SqlitePool, hash: &str, blob_key: &str) -> DomainResult<()> {
+    query(
+        "UPDATE content_blobs
+         SET remote_blob_key = ?, updated_at = strftime('%Y-%m-%dT%H:%M:%fZ', 'now')
+         WHERE content_hash = ?",
+    )
+    .bind(blob_key)
+    .bind(hash)
+    .execute(pool)
+    .await
+    .map_err(DbError::from)?;
+    Ok(())
+}
+
+/// Whether an active document still needs the file at `path`.
+///
+/// A blob's original is needed while some active document using the blob has
+/// no compressed copy yet; its compressed file is needed while the blob has
+/// any active reference. Paths that belong to no blob are never "needed" here,
+/// which keeps the historical one-file-per-document behaviour.
+pub async fn is_blob_path_needed(pool: &SqlitePool, path: &str) -> DomainResult<bool> {
+    let needed: i64 = query_scalar(
+        "SELECT EXISTS(
+             SELECT 1 FROM content_blobs b
+             WHERE (b.compressed_file_path = ?1 AND b.ref_count > 0)
+                OR (b.file_path = ?1 AND EXISTS(
+                        SELECT 1 FROM media_documents d
+                        WHERE d.content_hash = b.content_hash
+                          AND d.deleted_at IS NULL
+                          AND d.compressed_file_path IS NULL))
+         )",
+    )
+    .bind(path)
+    .fetch_one(pool)
+    .await
+    .map_err(DbError::from)?;
+    Ok(needed == 1)
+}
+
+/// Drop the rows of unreferenced blobs whose files were just deleted.
+/// Returns the number of rows removed.
+pub async fn forget_unreferenced_blobs(pool: &SqlitePool, deleted_paths: &[&str]) -> DomainResult<u64> {
+    let mut removed = 0;
+    for path in deleted_paths {
+        removed += query(
+            "DELETE FROM content_blobs
+             WHERE ref_count <= 0 AND (file_path = ?1 OR compressed_file_path = ?1)",
+        )
+        .bind(path)
+        .execute(pool)
+        .await
+        .map_err(DbError::from)?
+        .rows_affected();
+    }
+    Ok(removed)
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn chunked_hash_matches_one_shot() {
+        let data = b"the same receipt attached three times";
+        let mut hasher = ContentHasher::default();
+        for chunk in data.chunks(7) {
+            hasher.update(chunk);
+        }
+        assert_eq!(hasher.finish(), content_hash(data));
+        assert_eq!(
+            content_hash(b""),
+            "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855"
+        );
+    }
+}
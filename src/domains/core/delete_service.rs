@@ -9,7 +9,7 @@ use crate::domains::document::repository::MediaDocumentRepository;
 use uuid::Uuid;
 use chrono::Utc;
 use async_trait::async_trait;
-use sqlx::{SqlitePool, Transaction, Sqlite};
+use sqlx::{Acquire, SqlitePool, Transaction, Sqlite};
 use std::sync::Arc;
 use std::collections::HashMap;
 use serde::{Serialize, Deserialize};
@@ -466,6 +466,60 @@ where
         
         Ok(())
     }
+
+    /// Delete one entity of a batch and cascade to its documents inside a
+    /// savepoint of `tx`; on error only this entity's changes are undone.
+    /// Tombstones and change log entries are written by the caller.
+    async fn delete_in_savepoint<'t>(
+        &self,
+        id: Uuid,
+        hard_delete: bool,
+        auth: &AuthContext,
+        tx: &mut Transaction<'t, Sqlite>,
+        pending_delete_operation_id: Uuid,
+    ) -> DomainResult<()> {
+        let table_name = self.repo.entity_name();
+        let mut savepoint = Acquire::begin(&mut *tx).await.map_err(DbError::from)?;
+        let outcome = async {
+            if hard_delete {
+                self.repo.hard_delete_with_tx(id, auth, &mut savepoint).await?;
+            } else {
+                self.repo.soft_delete_with_tx(id, auth, &mut savepoint).await?;
+            }
+            self.cascade_delete_documents::<E>(table_name, id, hard_delete, auth, &mut savepoint, pending_delete_operation_id).await
+        }.await;
+
+        match outcome {
+            Ok(()) => savepoint.commit().await.map_err(|e| DbError::from(e).into()),
+            Err(e) => {
+                let _ = savepoint.rollback().await;
+                Err(e)
+            }
+        }
+    }
+}
+
+/// What a delete does with one entity
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+enum DeleteAction {
+    Hard,
+    Soft,
+    Prevented,
+}
+
+/// The rules `delete` applies, as used by `batch_delete`
+fn plan_delete_action(has_blocking_dependencies: bool, options: &DeleteOptions, is_admin: bool) -> DeleteAction {
+    if options.allow_hard_delete && is_admin && (!has_blocking_dependencies || options.force) {
+        return DeleteAction::Hard;
+    }
+    let should_soft_delete = options.fallback_to_soft_delete || !options.allow_hard_delete;
+    if should_soft_delete && has_blocking_dependencies && !options.force {
+        DeleteAction::Soft
+    } else if should_soft_delete && !has_blocking_dependencies && !options.allow_hard_delete {
+        DeleteAction::Soft
+    } else {
+        DeleteAction::Prevented
+    }
 }
 
 #[async_trait]
@@ -663,38 +717,140 @@ where
         }
         
         let mut result = BatchDeleteResult::default();
-        
-        // Process each ID
+        if ids.is_empty() {
+            return Ok(result);
+        }
+
+        // 1. One bulk dependency check for all ids, then the same decision as `delete`
+        let table_name = self.repo.entity_name();
+        let all_dependencies = self.dependency_checker.check_dependencies_bulk(table_name, ids).await?;
+        let is_admin = auth.role == UserRole::Admin;
+
+        let mut hard_ids = Vec::new();
+        let mut soft_ids = Vec::new();
         for &id in ids {
-            let id_str = id.to_string();
-            match self.delete(id, auth, options.clone()).await {
-                Ok(DeleteResult::HardDeleted) => {
-                    result.hard_deleted.push(id_str);
-                },
-                
-                Ok(DeleteResult::SoftDeleted { dependencies }) => {
-                    result.soft_deleted.push(id_str.clone());
-                    if !dependencies.is_empty() {
-                        result.dependencies.insert(id_str, dependencies);
-                    }
-                },
-                
-                Ok(DeleteResult::DependenciesPrevented { dependencies }) => {
-                    result.failed.push(id_str.clone());
-                    result.dependencies.insert(id_str, dependencies);
-                },
-                
-                Err(e @ DomainError::AuthorizationFailed(_)) => {
-                    result.failed.push(id_str.clone());
-                    result.errors.insert(id_str, e.to_string());
-                },
-                Err(e @ DomainError::EntityNotFound(_, _)) => {
+            let blocking_dependencies: Vec<String> = all_dependencies
+                .get(&id)
+                .into_iter()
+                .flatten()
+                .filter(|dep| !dep.is_cascadable && dep.count > 0)
+                .map(|dep| dep.table_name.clone())
+                .collect();
+            match plan_delete_action(!blocking_dependencies.is_empty(), &options, is_admin) {
+                DeleteAction::Hard => hard_ids.push(id),
+                DeleteAction::Soft => soft_ids.push((id, blocking_dependencies)),
+                DeleteAction::Prevented => {
+                    let id_str = id.to_string();
                     result.failed.push(id_str.clone());
-                    result.errors.insert(id_str, e.to_string());
-                },
+                    result.dependencies.insert(id_str, blocking_dependencies);
+                }
+            }
+        }
+
+        // 2. Hard deletes: one transaction, a savepoint per entity so one failure
+        //    does not undo the others, tombstones and change log written in bulk
+        if !hard_ids.is_empty() {
+            let mut tx = self.pool.begin().await.map_err(DbError::from)?;
+            let mut deleted: Vec<(Uuid, Uuid)> = Vec::with_capacity(hard_ids.len()); // (id, pending deletion operation)
+            for &id in &hard_ids {
+                let pending_delete_operation_id = Uuid::new_v4();
+                match self.delete_in_savepoint(id, true, auth, &mut tx, pending_delete_operation_id).await {
+                    Ok(()) => deleted.push((id, pending_delete_operation_id)),
+                    Err(e) => {
+                        self.deletion_manager.discard_deletions(pending_delete_operation_id).await;
+                        let id_str = id.to_string();
+                        result.failed.push(id_str.clone());
+                        result.errors.insert(id_str, e.to_string());
+                    }
+                }
+            }
+
+            let finish = async {
+                let device_id = parse_device_id(&auth.device_id);
+                let tombstones: Vec<Tombstone> = deleted
+                    .iter()
+                    .map(|(id, _)| Tombstone::new(*id, table_name, auth.user_id, device_id))
+                    .collect();
+                let change_logs: Vec<ChangeLogEntry> = tombstones
+                    .iter()
+                    .map(|tombstone| ChangeLogEntry {
+                        operation_id: tombstone.operation_id, // Same ID as the tombstone
+                        entity_table: table_name.to_string(),
+                        entity_id: tombstone.entity_id,
+                        operation_type: ChangeOperationType::HardDelete,
+                        field_name: None,
+                        old_value: None,
+                        new_value: None,
+                        document_metadata: None,
+                        timestamp: Utc::now(),
+                        user_id: auth.user_id,
+                        device_id,
+                        sync_batch_id: None,
+                        processed_at: None,
+                        sync_error: None,
+                    })
+                    .collect();
+                self.tombstone_repo.create_tombstones_with_tx(&tombstones, &mut tx).await?;
+                self.change_log_repo.create_change_logs_with_tx(&change_logs, &mut tx).await?;
+                tx.commit().await.map_err(DbError::from)?;
+                Ok::<_, DomainError>(())
+            }.await;
+
+            match finish {
+                Ok(()) => {
+                    for (id, pending_delete_operation_id) in deleted {
+                        self.deletion_manager.commit_deletions(pending_delete_operation_id, auth.user_id, &auth.device_id).await?;
+                        result.hard_deleted.push(id.to_string());
+                    }
+                }
                 Err(e) => {
-                    result.failed.push(id_str.clone());
-                    result.errors.insert(id_str, e.to_string());
+                    // The transaction rolled back as a whole
+                    for (id, pending_delete_operation_id) in deleted {
+                        self.deletion_manager.discard_deletions(pending_delete_operation_id).await;
+                        let id_str = id.to_string();
+                        result.failed.push(id_str.clone());
+                        result.errors.insert(id_str, e.to_string());
+                    }
+                }
+            }
+        }
+
+        // 3. Soft deletes: one transaction, a savepoint per entity
+        if !soft_ids.is_empty() {
+            let mut tx = self.pool.begin().await.map_err(DbError::from)?;
+            let mut deleted = Vec::with_capacity(soft_ids.len());
+            for (id, blocking_dependencies) in soft_ids {
+                let pending_delete_operation_id = Uuid::new_v4();
+                let outcome = self.delete_in_savepoint(id, false, auth, &mut tx, pending_delete_operation_id).await;
+                // Files are kept for soft-deleted records
+                self.deletion_manager.discard_deletions(pending_delete_operation_id).await;
+                match outcome {
+                    Ok(()) => deleted.push((id, blocking_dependencies)),
+                    Err(e) => {
+                        let id_str = id.to_string();
+                        result.failed.push(id_str.clone());
+                        result.errors.insert(id_str, e.to_string());
+                    }
+                }
+            }
+
+            match tx.commit().await {
+                Ok(()) => {
+                    for (id, blocking_dependencies) in deleted {
+                        let id_str = id.to_string();
+                        result.soft_deleted.push(id_str.clone());
+                        if !blocking_dependencies.is_empty() {
+                            result.dependencies.insert(id_str, blocking_dependencies);
+                        }
+                    }
+                }
+                Err(e) => {
+                    let error = DomainError::from(DbError::from(e)).to_string();
+                    for (id, _) in deleted {
+                        let id_str = id.to_string();
+                        result.failed.push(id_str.clone());
+                        result.errors.insert(id_str, error.clone());
+                    }
                 }
             }
         }
@@ -812,4 +968,26 @@ where
 
         Ok(details)
     }
-}
\ No newline at end of file
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn batch_plan_follows_single_delete_rules() {
+        let soft_only = DeleteOptions::default();
+        assert_eq!(plan_delete_action(false, &soft_only, false), DeleteAction::Soft);
+        assert_eq!(plan_delete_action(true, &soft_only, false), DeleteAction::Soft);
+
+        let hard = DeleteOptions { allow_hard_delete: true, fallback_to_soft_delete: true, force: false };
+        assert_eq!(plan_delete_action(false, &hard, true), DeleteAction::Hard);
+        assert_eq!(plan_delete_action(true, &hard, true), DeleteAction::Soft);
+
+        let strict = DeleteOptions { allow_hard_delete: true, fallback_to_soft_delete: false, force: false };
+        assert_eq!(plan_delete_action(true, &strict, true), DeleteAction::Prevented);
+
+        let forced = DeleteOptions { force: true, ..strict };
+        assert_eq!(plan_delete_action(true, &forced, true), DeleteAction::Hard);
+    }
+}
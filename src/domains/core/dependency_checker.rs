@@ -5,6 +5,7 @@ use uuid::Uuid;
 use std::collections::HashMap;
 use crate::errors::DbError;
 use crate::errors::DomainError;
+use crate::domains::core::loader::{parse_keyed_rows, uuid_list_json};
 
 /// Dependency information
 #[derive(Debug, Clone)]
@@ -28,6 +29,16 @@ pub trait DependencyChecker: Send + Sync {
     /// Check for dependencies for an entity
     async fn check_dependencies(&self, table_name: &str, id: Uuid) -> DomainResult<Vec<Dependency>>;
     
+    /// Check dependencies for many entities of one table. Every id is in the
+    /// result, with the same dependencies `check_dependencies` would report.
+    async fn check_dependencies_bulk(&self, table_name: &str, ids: &[Uuid]) -> DomainResult<HashMap<Uuid, Vec<Dependency>>> {
+        let mut result = HashMap::with_capacity(ids.len());
+        for &id in ids {
+            result.insert(id, self.check_dependencies(table_name, id).await?);
+        }
+        Ok(result)
+    }
+    
     /// Get a simplified list of dependency tables
     async fn get_dependency_tables(&self, table_name: &str, id: Uuid) -> DomainResult<Vec<String>> {
         let dependencies = self.check_dependencies(table_name, id).await?;
@@ -126,6 +137,22 @@ struct DependencyCount {
     count: i64,
 }
 
+impl SqliteDependencyChecker {
+    /// Live rows per parent id, for the parents listed in `ids_json`
+    async fn count_grouped(&self, query: &str, bind_table: Option<&str>, ids_json: &str) -> DomainResult<HashMap<Uuid, i64>> {
+        let mut q = query_as::<_, (String, i64)>(query);
+        if let Some(table) = bind_table {
+            q = q.bind(table);
+        }
+        let rows = q
+            .bind(ids_json)
+            .fetch_all(&self.pool)
+            .await
+            .map_err(|e| DomainError::Database(DbError::from(e)))?;
+        Ok(parse_keyed_rows(rows))
+    }
+}
+
 #[async_trait]
 impl DependencyChecker for SqliteDependencyChecker {
     async fn check_dependencies(&self, table_name: &str, id: Uuid) -> DomainResult<Vec<Dependency>> {
@@ -195,4 +222,51 @@ impl DependencyChecker for SqliteDependencyChecker {
         
         Ok(dependencies)
     }
+
+    /// One grouped query per dependent table (plus one for documents) for
+    /// all ids, instead of one query per table and id
+    async fn check_dependencies_bulk(&self, table_name: &str, ids: &[Uuid]) -> DomainResult<HashMap<Uuid, Vec<Dependency>>> {
+        let mut result: HashMap<Uuid, Vec<Dependency>> = ids.iter().map(|&id| (id, Vec::new())).collect();
+        if ids.is_empty() {
+            return Ok(result);
+        }
+        let ids_json = uuid_list_json(ids);
+
+        if let Some(dependent_tables) = self.dependency_map.get(table_name) {
+            for (dependent_table, foreign_key, is_cascadable) in dependent_tables {
+                let query = format!(
+                    "SELECT {fk}, COUNT(*) FROM {table} WHERE {fk} IN (SELECT value FROM json_each(?)) AND deleted_at IS NULL GROUP BY {fk}",
+                    table = dependent_table,
+                    fk = foreign_key
+                );
+                for (id, count) in self.count_grouped(&query, None, &ids_json).await? {
+                    if let Some(dependencies) = result.get_mut(&id) {
+                        dependencies.push(Dependency {
+                            table_name: dependent_table.clone(),
+                            count,
+                            foreign_key_column: foreign_key.clone(),
+                            is_cascadable: *is_cascadable,
+                        });
+                    }
+                }
+            }
+        }
+
+        // Documents: non-blocking, cascaded by the service layer (see check_dependencies)
+        if table_name != "document_types" {
+            let query = "SELECT related_id, COUNT(*) FROM media_documents WHERE related_table = ? AND related_id IN (SELECT value FROM json_each(?)) AND deleted_at IS NULL GROUP BY related_id";
+            for (id, count) in self.count_grouped(query, Some(table_name), &ids_json).await? {
+                if let Some(dependencies) = result.get_mut(&id) {
+                    dependencies.push(Dependency {
+                        table_name: "media_documents".to_string(),
+                        count,
+                        foreign_key_column: "related_id".to_string(),
+                        is_cascadable: true,
+                    });
+                }
+            }
+        }
+
+        Ok(result)
+    }
 }
\ No newline at end of file
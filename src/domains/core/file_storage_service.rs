@@ -6,6 +6,8 @@ use uuid::Uuid;
 use std::io;
 use urlencoding;
 
+use crate::domains::core::content_blobs::content_hash;
+
 #[derive(Debug, Error)]
 pub enum FileStorageError {
     #[error("I/O error: {0}")]
@@ -48,6 +50,10 @@ pub trait FileStorageService: Send + Sync {
         suggested_filename: &str,
     ) -> FileStorageResult<(String, u64)>;
 
+    /// Save file data content-addressed: identical bytes are stored once, at a
+    /// path derived from their SHA-256. Returns (relative_path, size_bytes, content_hash).
+    async fn save_blob(&self, data: Vec<u8>) -> FileStorageResult<(String, u64, String)>;
+
     /// iOS Optimized: Save file from path (no memory copy!)
     async fn save_file_from_path(
         &self,
@@ -77,6 +83,7 @@ pub struct LocalFileStorageService {
     base_path: PathBuf,
     original_subdir: String,
     compressed_subdir: String,
+    blob_subdir: String,
 }
 
 impl LocalFileStorageService {
@@ -86,18 +93,22 @@ impl LocalFileStorageService {
         let base_path = PathBuf::from(base_path_str);
         let original_subdir = "original".to_string();
         let compressed_subdir = "compressed".to_string();
+        let blob_subdir = "blobs".to_string();
 
         let original_path = base_path.join(&original_subdir);
         let compressed_path = base_path.join(&compressed_subdir);
+        let blob_path = base_path.join(&blob_subdir);
 
         // Create directories synchronously during setup
         std::fs::create_dir_all(&original_path)?;
         std::fs::create_dir_all(&compressed_path)?;
+        std::fs::create_dir_all(&blob_path)?;
 
         Ok(Self {
             base_path,
             original_subdir,
             compressed_subdir,
+            blob_subdir,
         })
     }
 
@@ -275,6 +286,39 @@ impl FileStorageService for LocalFileStorageService {
         }
     }
 
+    async fn save_blob(&self, data: Vec<u8>) -> FileStorageResult<(String, u64, String)> {
+        let hash = content_hash(&data);
+        let file_size = data.len() as u64;
+
+        // Construct relative path: blobs/<first two hex digits>/<hash>
+        let relative_path = Path::new(&self.blob_subdir).join(&hash[..2]).join(&hash);
+        let relative_path_str = relative_path.to_str().ok_or_else(|| FileStorageError::Other("Failed to convert relative path to string".to_string()))?;
+        let absolute_path = self.get_absolute_path(relative_path_str);
+
+        // Same bytes, same path: an existing file of the right size is this content
+        if let Ok(meta) = fs::metadata(&absolute_path).await {
+            if meta.len() == file_size {
+                println!("♻️ [FILE_STORAGE] Blob {} already stored, reusing {}", hash, relative_path_str);
+                return Ok((relative_path_str.to_string(), file_size, hash));
+            }
+        }
+
+        let parent_dir = absolute_path.parent().ok_or_else(|| FileStorageError::Other("Invalid path generated, no parent directory".to_string()))?;
+        fs::create_dir_all(parent_dir).await?;
+
+        // Write to a temporary name and rename, so a concurrent reader never
+        // sees a partially written blob under its final name
+        let temp_path = absolute_path.with_extension(format!("{}.tmp", Uuid::new_v4()));
+        fs::write(&temp_path, data).await?;
+        if let Err(e) = fs::rename(&temp_path, &absolute_path).await {
+            let _ = fs::remove_file(&temp_path).await;
+            return Err(FileStorageError::Io(e));
+        }
+
+        println!("✅ [FILE_STORAGE] Blob {} saved: {} bytes at {}", hash, file_size, relative_path_str);
+        Ok((relative_path_str.to_string(), file_size, hash))
+    }
+
     /// iOS Optimized: Save file from path (no memory copy!)
     async fn save_file_from_path(
         &self,
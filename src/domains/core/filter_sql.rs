@@ -0,0 +1,76 @@
+//! Helpers for filter queries built with `QueryBuilder`.
+//!
+//! sqlx caches prepared statements per connection, keyed on the SQL text. A
+//! filter that expands `IN (?, ?, ...)` to one placeholder per value produces
+//! new SQL text for every list length, so the cache almost never hits. With
+//! these helpers a list binds as a single JSON array read through `json_each`,
+//! and the SQL text depends only on which filters are present (the filter
+//! "shape"). Each shape is prepared once and then reused.
+
+use sqlx::{QueryBuilder, Sqlite};
+
+/// Encode a list as a JSON array of strings so it binds as one parameter
+pub fn json_array<T: ToString>(values: &[T]) -> String {
+    serde_json::Value::Array(
+        values
+            .iter()
+            .map(|v| serde_json::Value::String(v.to_string()))
+            .collect(),
+    )
+    .to_string()
+}
+
+/// Shape-stable building blocks for `QueryBuilder<Sqlite>`
+pub trait FilterQueryExt {
+    /// Append ` WHERE ` before the first condition and ` AND ` before later ones
+    fn push_condition(&mut self, has_conditions: &mut bool) -> &mut Self;
+
+    /// Append `<expr> IN (SELECT value FROM json_each(?))`, binding `values` as
+    /// one JSON array regardless of its length
+    fn push_in_json<T: ToString>(&mut self, expr: &str, values: &[T]) -> &mut Self;
+}
+
+impl<'args> FilterQueryExt for QueryBuilder<'args, Sqlite> {
+    fn push_condition(&mut self, has_conditions: &mut bool) -> &mut Self {
+        self.push(if *has_conditions { " AND " } else { " WHERE " });
+        *has_conditions = true;
+        self
+    }
+
+    fn push_in_json<T: ToString>(&mut self, expr: &str, values: &[T]) -> &mut Self {
+        self.push(expr);
+        self.push(" IN (SELECT value FROM json_each(");
+        self.push_bind(json_array(values));
+        self.push("))");
+        self
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn sql_text_does_not_depend_on_list_length() {
+        let build = |values: &[&str]| {
+            let mut qb = QueryBuilder::<Sqlite>::new("SELECT id FROM participants");
+            let mut has_conditions = false;
+            qb.push_condition(&mut has_conditions).push_in_json("gender", values);
+            qb.push_condition(&mut has_conditions).push("deleted_at IS NULL");
+            qb.into_sql()
+        };
+
+        let one = build(&["female"]);
+        let three = build(&["female", "male", "other"]);
+        assert_eq!(one, three);
+        assert_eq!(
+            one,
+            "SELECT id FROM participants WHERE gender IN (SELECT value FROM json_each(?)) AND deleted_at IS NULL"
+        );
+    }
+
+    #[test]
+    fn json_array_escapes_values() {
+        assert_eq!(json_array(&["a\"b", "c"]), r#"["a\"b","c"]"#);
+    }
+}
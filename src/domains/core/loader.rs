@@ -0,0 +1,262 @@
+//! Request-scoped batch loading of related data.
+//!
+//! Enriching a page of entities one by one costs a query per entity and per
+//! relation, so latency grows with the page size. A loader is created for one
+//! request (a list call, a detail call): the service hands it every key it is
+//! about to need, the keys not seen before in this request are fetched in a
+//! single `json_each` query, and each entity is then enriched from the cache.
+//! Lookups that found nothing are cached too, so they are not repeated.
+//!
+//! `BatchLoader` is the generic cache; `RelationLoader` carries the lookups
+//! every domain shares (user and project names, child row and document
+//! counts). Domain-specific aggregates come from batched repository methods
+//! taking a slice of ids. A service builds one `RelationLoader` per request
+//! and passes it down to its enrichment helpers.
+
+use crate::errors::{DbError, DomainResult};
+use sqlx::{query_as, SqlitePool};
+use std::collections::{HashMap, HashSet};
+use std::future::Future;
+use std::hash::Hash;
+use std::sync::Mutex;
+use uuid::Uuid;
+
+/// Cache of one relation for the duration of a request
+pub struct BatchLoader<K, V> {
+    cache: Mutex<HashMap<K, Option<V>>>,
+}
+
+impl<K, V> Default for BatchLoader<K, V> {
+    fn default() -> Self {
+        Self { cache: Mutex::new(HashMap::new()) }
+    }
+}
+
+impl<K, V> BatchLoader<K, V>
+where
+    K: Eq + Hash + Clone,
+    V: Clone,
+{
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    /// Values for `keys`, calling `fetch` once with the keys not cached yet.
+    /// Keys `fetch` returns nothing for are absent from the result.
+    pub async fn load_many<F, Fut>(&self, keys: &[K], fetch: F) -> DomainResult<HashMap<K, V>>
+    where
+        F: FnOnce(Vec<K>) -> Fut,
+        Fut: Future<Output = DomainResult<HashMap<K, V>>>,
+    {
+        let missing: Vec<K> = {
+            let cache = self.cache.lock().unwrap();
+            let mut seen = HashSet::new();
+            keys.iter()
+                .filter(|k| !cache.contains_key(k) && seen.insert(*k))
+                .cloned()
+                .collect()
+        };
+
+        if !missing.is_empty() {
+            let mut found = fetch(missing.clone()).await?;
+            let mut cache = self.cache.lock().unwrap();
+            for key in missing {
+                let value = found.remove(&key);
+                cache.insert(key, value);
+            }
+        }
+
+        let cache = self.cache.lock().unwrap();
+        Ok(keys
+            .iter()
+            .filter_map(|k| cache.get(k).cloned().flatten().map(|v| (k.clone(), v)))
+            .collect())
+    }
+
+    /// Value for one key, batched like `load_many`
+    pub async fn load<F, Fut>(&self, key: K, fetch: F) -> DomainResult<Option<V>>
+    where
+        F: FnOnce(Vec<K>) -> Fut,
+        Fut: Future<Output = DomainResult<HashMap<K, V>>>,
+    {
+        let mut found = self.load_many(std::slice::from_ref(&key), fetch).await?;
+        Ok(found.remove(&key))
+    }
+}
+
+/// Cross-domain lookups shared by every enrichment path
+pub struct RelationLoader {
+    pool: SqlitePool,
+    column_values: BatchLoader<(&'static str, &'static str, Uuid), String>,
+    child_counts: BatchLoader<(&'static str, &'static str, Uuid), i64>,
+    document_counts: BatchLoader<(&'static str, Uuid), i64>,
+}
+
+impl RelationLoader {
+    pub fn new(pool: SqlitePool) -> Self {
+        Self {
+            pool,
+            column_values: BatchLoader::new(),
+            child_counts: BatchLoader::new(),
+            document_counts: BatchLoader::new(),
+        }
+    }
+
+    /// Names of the (non-deleted) users among `ids`
+    pub async fn user_names(&self, ids: &[Uuid]) -> DomainResult<HashMap<Uuid, String>> {
+        self.column_values("users", "name", ids).await
+    }
+
+    /// Names of the (non-deleted) projects among `ids`
+    pub async fn project_names(&self, ids: &[Uuid]) -> DomainResult<HashMap<Uuid, String>> {
+        self.column_values("projects", "name", ids).await
+    }
+
+    /// Non-NULL `column` of the live rows of `table` among `ids`. Table and
+    /// column are code constants and go into the SQL text.
+    pub async fn column_values(
+        &self,
+        table: &'static str,
+        column: &'static str,
+        ids: &[Uuid],
+    ) -> DomainResult<HashMap<Uuid, String>> {
+        let pool = &self.pool;
+        let keys: Vec<_> = ids.iter().map(|&id| (table, column, id)).collect();
+        let values = self
+            .column_values
+            .load_many(&keys, |missing| async move {
+                let missing_ids: Vec<Uuid> = missing.iter().map(|(_, _, id)| *id).collect();
+                let rows = query_as::<_, (String, String)>(&format!(
+                    "SELECT id, {column} FROM {table}
+                     WHERE id IN (SELECT value FROM json_each(?)) AND {column} IS NOT NULL AND deleted_at IS NULL"
+                ))
+                .bind(uuid_list_json(&missing_ids))
+                .fetch_all(pool)
+                .await
+                .map_err(DbError::from)?;
+                Ok(parse_keyed_rows(rows)
+                    .into_iter()
+                    .map(|(id, value)| ((table, column, id), value))
+                    .collect())
+            })
+            .await?;
+        Ok(values.into_iter().map(|((_, _, id), value)| (id, value)).collect())
+    }
+
+    /// Live rows of `table` whose `fk_column` is each of `ids`; every id is
+    /// present in the result, with 0 when it has none
+    pub async fn child_counts(
+        &self,
+        table: &'static str,
+        fk_column: &'static str,
+        ids: &[Uuid],
+    ) -> DomainResult<HashMap<Uuid, i64>> {
+        let pool = &self.pool;
+        let keys: Vec<_> = ids.iter().map(|&id| (table, fk_column, id)).collect();
+        let counts = self
+            .child_counts
+            .load_many(&keys, |missing| async move {
+                let missing_ids: Vec<Uuid> = missing.iter().map(|(_, _, id)| *id).collect();
+                let rows = query_as::<_, (String, i64)>(&format!(
+                    "SELECT {fk_column}, COUNT(*) FROM {table}
+                     WHERE {fk_column} IN (SELECT value FROM json_each(?)) AND deleted_at IS NULL
+                     GROUP BY {fk_column}"
+                ))
+                .bind(uuid_list_json(&missing_ids))
+                .fetch_all(pool)
+                .await
+                .map_err(DbError::from)?;
+                let counts = parse_keyed_rows(rows);
+                Ok(missing
+                    .into_iter()
+                    .map(|key| {
+                        let count = counts.get(&key.2).copied().unwrap_or(0);
+                        (key, count)
+                    })
+                    .collect())
+            })
+            .await?;
+        Ok(counts.into_iter().map(|((_, _, id), count)| (id, count)).collect())
+    }
+
+    /// Live documents attached to each of `ids` in `related_table`; every id
+    /// is present in the result, with 0 when it has none
+    pub async fn document_counts(&self, related_table: &'static str, ids: &[Uuid]) -> DomainResult<HashMap<Uuid, i64>> {
+        let pool = &self.pool;
+        let keys: Vec<(&'static str, Uuid)> = ids.iter().map(|&id| (related_table, id)).collect();
+        let counts = self
+            .document_counts
+            .load_many(&keys, |missing| async move {
+                let missing_ids: Vec<Uuid> = missing.iter().map(|(_, id)| *id).collect();
+                let counts = count_documents_by_related_entity(pool, related_table, &missing_ids).await?;
+                // Zero counts are values too: keep them in the cache
+                Ok(missing
+                    .into_iter()
+                    .map(|key| {
+                        let count = counts.get(&key.1).copied().unwrap_or(0);
+                        (key, count)
+                    })
+                    .collect())
+            })
+            .await?;
+        Ok(counts.into_iter().map(|((_, id), count)| (id, count)).collect())
+    }
+}
+
+/// Live documents per related entity, in one query. Entities without
+/// documents are absent from the result.
+pub async fn count_documents_by_related_entity(
+    pool: &SqlitePool,
+    related_table: &str,
+    ids: &[Uuid],
+) -> DomainResult<HashMap<Uuid, i64>> {
+    if ids.is_empty() {
+        return Ok(HashMap::new());
+    }
+    let rows = query_as::<_, (String, i64)>(
+        "SELECT related_id, COUNT(*) FROM media_documents
+         WHERE related_table = ? AND related_id IN (SELECT value FROM json_each(?)) AND deleted_at IS NULL
+         GROUP BY related_id",
+    )
+    .bind(related_table)
+    .bind(uuid_list_json(ids))
+    .fetch_all(pool)
+    .await
+    .map_err(DbError::from)?;
+    Ok(parse_keyed_rows(rows))
+}
+
+/// Ids as a JSON array, for `json_each(?)`
+pub fn uuid_list_json(ids: &[Uuid]) -> String {
+    serde_json::to_string(&ids.iter().map(Uuid::to_string).collect::<Vec<_>>()).unwrap_or_else(|_| "[]".to_string())
+}
+
+/// Rows keyed by a TEXT id; rows whose id is not a UUID are skipped
+pub fn parse_keyed_rows<V>(rows: Vec<(String, V)>) -> HashMap<Uuid, V> {
+    rows.into_iter()
+        .filter_map(|(id, value)| Uuid::parse_str(&id).ok().map(|id| (id, value)))
+        .collect()
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use std::sync::atomic::{AtomicUsize, Ordering};
+
+    #[tokio::test]
+    async fn only_unseen_keys_are_fetched() {
+        let loader: BatchLoader<u32, String> = BatchLoader::new();
+        let fetched = AtomicUsize::new(0);
+        let fetch = |keys: Vec<u32>| {
+            fetched.fetch_add(keys.len(), Ordering::Relaxed);
+            async move { Ok(keys.into_iter().filter(|k| k % 2 == 0).map(|k| (k, k.to_string())).collect()) }
+        };
+
+        let first = loader.load_many(&[1, 2, 3, 4], fetch).await.unwrap();
+        assert_eq!(first.len(), 2);
+        let second = loader.load_many(&[2, 3, 4, 6], fetch).await.unwrap();
+        assert_eq!(second.get(&6).map(String::as_str), Some("6"));
+        assert!(!second.contains_key(&3));
+        assert_eq!(fetched.load(Ordering::Relaxed), 5);
+    }
+}
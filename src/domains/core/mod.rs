@@ -3,6 +3,11 @@ pub mod repository;
 pub mod dependency_checker;
 pub mod file_storage_service;
 pub mod document_linking;
+pub mod filter_sql;
+pub mod search;
+pub mod stat_counters;
+pub mod content_blobs;
+pub mod loader;
 
 // Re-export the TRAITS and core types, not specific implementations usually
 pub use delete_service::DeleteService;
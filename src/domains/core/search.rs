@@ -0,0 +1,53 @@
+//! Text search modes shared by the `*_search` repositories.
+//!
+//! `Like` is the historical `LIKE '%term%'` scan. `Fts` goes through the FTS5
+//! indexes created by `20250601000000_fts_search.sql` (one `<table>_fts`
+//! external-content table per searchable table, kept current by triggers):
+//! every word of the input is matched as a prefix, all words must match, and
+//! results are ranked by bm25.
+
+use serde::Deserialize;
+
+/// Search mode selected by the optional `"mode"` key of a search payload
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Default, Deserialize)]
+#[serde(rename_all = "lowercase")]
+pub enum SearchMode {
+    /// Substring match with `LIKE '%term%'` (full scan)
+    #[default]
+    Like,
+    /// Prefix match through the FTS5 index, ranked by relevance
+    Fts,
+}
+
+/// Turn free text typed by a user into an FTS5 MATCH expression.
+///
+/// Each whitespace-separated word becomes a quoted prefix query (`"word"*`),
+/// so FTS5 operators and punctuation in the input are treated as text rather
+/// than query syntax. Returns `None` when the input holds no words, in which
+/// case callers fall back to the `Like` path.
+pub fn fts_match_query(input: &str) -> Option<String> {
+    let terms: Vec<String> = input
+        .split_whitespace()
+        .map(|word| word.replace('"', ""))
+        .filter(|word| !word.is_empty())
+        .map(|word| format!("\"{}\"*", word))
+        .collect();
+
+    if terms.is_empty() {
+        None
+    } else {
+        Some(terms.join(" "))
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn words_become_quoted_prefix_terms() {
+        assert_eq!(fts_match_query("  ama  kamp "), Some("\"ama\"* \"kamp\"*".to_string()));
+        assert_eq!(fts_match_query("NOT \"x\" OR"), Some("\"NOT\"* \"x\"* \"OR\"*".to_string()));
+        assert_eq!(fts_match_query(" \"\" "), None);
+    }
+}
@@ -0,0 +1,155 @@
+//! Materialized counters behind the dashboard `count_by_*` statistics.
+//!
+//! `stat_counters` (created by `20250610000000_stat_counters.sql`) holds one
+//! row per (table, dimension, bucket) with the number of active rows carrying
+//! that value. Triggers on each counted table keep it current inside the same
+//! transaction as the write, so reads are a primary-key range scan instead of
+//! a GROUP BY over the whole table.
+//!
+//! `STAT_DIMENSIONS` must list exactly what the migration's triggers maintain;
+//! `rebuild_stat_counters` uses it to recompute everything from scratch.
+
+use crate::errors::{DbError, DomainResult};
+use sqlx::{query, query_as, query_scalar, SqlitePool};
+
+/// Dimension holding the number of active (not soft-deleted) rows of a table
+pub const ACTIVE: &str = "_active";
+/// Dimension holding the number of rows of a table, soft-deleted included
+pub const TOTAL: &str = "_total";
+
+/// One counted breakdown: `table.column` grouped over active rows
+pub struct StatDimension {
+    pub table: &'static str,
+    pub column: &'static str,
+    /// Extra predicate a row must satisfy to be counted
+    pub condition: Option<&'static str>,
+}
+
+const fn dim(table: &'static str, column: &'static str) -> StatDimension {
+    StatDimension { table, column, condition: None }
+}
+
+pub const STAT_DIMENSIONS: &[StatDimension] = &[
+    dim("participants", "gender"),
+    dim("participants", "age_group"),
+    dim("participants", "location"),
+    dim("participants", "disability"),
+    StatDimension { table: "participants", column: "disability_type", condition: Some("disability = 1") },
+    dim("projects", "status_id"),
+    dim("projects", "strategic_goal_id"),
+    dim("projects", "responsible_team"),
+    dim("activities", "status_id"),
+    dim("activities", "project_id"),
+    dim("workshops", "location"),
+    dim("workshops", "project_id"),
+    dim("donors", "type"),
+    dim("donors", "country"),
+    dim("strategic_goals", "status_id"),
+    dim("strategic_goals", "responsible_team"),
+];
+
+/// Active-row counts per value of `table.dimension` (text values)
+pub async fn text_breakdown(
+    pool: &SqlitePool,
+    table: &str,
+    dimension: &str,
+) -> DomainResult<Vec<(Option<String>, i64)>> {
+    query_as::<_, (Option<String>, i64)>(
+        "SELECT CASE WHEN is_null = 1 THEN NULL ELSE bucket END, row_count
+         FROM stat_counters
+         WHERE table_name = ? AND dimension = ? AND row_count > 0",
+    )
+    .bind(table)
+    .bind(dimension)
+    .fetch_all(pool)
+    .await
+    .map_err(|e| DbError::from(e).into())
+}
+
+/// Active-row counts per value of `table.dimension` (integer values)
+pub async fn integer_breakdown(
+    pool: &SqlitePool,
+    table: &str,
+    dimension: &str,
+) -> DomainResult<Vec<(Option<i64>, i64)>> {
+    query_as::<_, (Option<i64>, i64)>(
+        "SELECT CASE WHEN is_null = 1 THEN NULL ELSE CAST(bucket AS INTEGER) END, row_count
+         FROM stat_counters
+         WHERE table_name = ? AND dimension = ? AND row_count > 0",
+    )
+    .bind(table)
+    .bind(dimension)
+    .fetch_all(pool)
+    .await
+    .map_err(|e| DbError::from(e).into())
+}
+
+/// Row count of `table` for `ACTIVE` or `TOTAL`
+pub async fn row_count(pool: &SqlitePool, table: &str, which: &str) -> DomainResult<i64> {
+    let count: Option<i64> = query_scalar(
+        "SELECT row_count FROM stat_counters
+         WHERE table_name = ? AND dimension = ? AND is_null = 0 AND bucket = ''",
+    )
+    .bind(table)
+    .bind(which)
+    .fetch_optional(pool)
+    .await
+    .map_err(DbError::from)?;
+    Ok(count.unwrap_or(0))
+}
+
+/// Recompute every counter from the base tables in one transaction.
+/// Returns the number of counter rows written.
+pub async fn rebuild_stat_counters(pool: &SqlitePool) -> DomainResult<u64> {
+    let mut tx = pool.begin().await.map_err(DbError::from)?;
+    query("DELETE FROM stat_counters")
+        .execute(&mut *tx)
+        .await
+        .map_err(DbError::from)?;
+
+    let mut tables: Vec<&str> = STAT_DIMENSIONS.iter().map(|d| d.table).collect();
+    tables.dedup();
+
+    let mut written = 0u64;
+    for table in tables {
+        let sql = format!(
+            "INSERT INTO stat_counters (table_name, dimension, row_count)
+             SELECT '{table}', '{TOTAL}', COUNT(*) FROM {table}
+             UNION ALL
+             SELECT '{table}', '{ACTIVE}', COUNT(*) FROM {table} WHERE deleted_at IS NULL"
+        );
+        written += query(&sql).execute(&mut *tx).await.map_err(DbError::from)?.rows_affected();
+    }
+
+    for d in STAT_DIMENSIONS {
+        let condition = d.condition.map(|c| format!(" AND {c}")).unwrap_or_default();
+        let sql = format!(
+            "INSERT INTO stat_counters (table_name, dimension, is_null, bucket, row_count)
+             SELECT '{table}', '{column}', {column} IS NULL, COALESCE(CAST({column} AS TEXT), ''), COUNT(*)
+             FROM {table} WHERE deleted_at IS NULL{condition} GROUP BY {column}",
+            table = d.table,
+            column = d.column,
+        );
+        written += query(&sql).execute(&mut *tx).await.map_err(DbError::from)?.rows_affected();
+    }
+
+    tx.commit().await.map_err(DbError::from)?;
+    Ok(written)
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn dimensions_are_grouped_by_table() {
+        // rebuild_stat_counters relies on dedup() to visit each table once
+        let mut seen: Vec<&str> = Vec::new();
+        for d in STAT_DIMENSIONS {
+            if seen.last() != Some(&d.table) {
+                assert!(!seen.contains(&d.table), "{} listed in two groups", d.table);
+                seen.push(d.table);
+            }
+        }
+    }
+}
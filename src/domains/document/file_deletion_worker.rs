@@ -1,4 +1,5 @@
 use crate::domains::core::file_storage_service::{FileStorageService, FileStorageError};
+use crate::domains::core::content_blobs;
 use crate::errors::{DomainError, DomainResult, ServiceError, ServiceResult, DbError};
 use sqlx::{SqlitePool, Row};
 use uuid::Uuid;
@@ -123,20 +124,27 @@ impl FileDeletionWorker {
                 continue;
             }
             
+            // Content-addressed files can be shared with other documents; keep
+            // them while any active document still needs them
+            let original_needed = self.is_shared_path_needed(deletion.file_path.as_deref()).await?;
+            let compressed_needed = self.is_shared_path_needed(deletion.compressed_file_path.as_deref()).await?;
+            
             // Try to delete the original file
-            let original_result = if let Some(path) = &deletion.file_path {
-                log::info!("Deleting original file: {} for document {}", path, deletion.document_id);
-                self.file_storage_service.delete_file(path).await
-            } else {
-                Ok(()) // No path, so "success"
+            let original_result = match &deletion.file_path {
+                Some(path) if !original_needed => {
+                    log::info!("Deleting original file: {} for document {}", path, deletion.document_id);
+                    self.file_storage_service.delete_file(path).await
+                },
+                _ => Ok(()), // No path (or still shared), so "success"
             };
             
             // Try to delete the compressed file if it exists
-            let compressed_result = if let Some(path) = &deletion.compressed_file_path {
-                log::info!("Deleting compressed file: {} for document {}", path, deletion.document_id);
-                self.file_storage_service.delete_file(path).await
-            } else {
-                Ok(()) // No compressed path, so "success"
+            let compressed_result = match &deletion.compressed_file_path {
+                Some(path) if !compressed_needed => {
+                    log::info!("Deleting compressed file: {} for document {}", path, deletion.document_id);
+                    self.file_storage_service.delete_file(path).await
+                },
+                _ => Ok(()), // No compressed path (or still shared), so "success"
             };
             
             // Check results and update database
@@ -159,6 +167,19 @@ impl FileDeletionWorker {
                 }
             }
             
+            if original_result.is_ok() && compressed_result.is_ok() && (original_needed || compressed_needed) {
+                // Leave the entry pending; it completes once the other documents
+                // sharing the file are compressed or deleted
+                log::info!("Keeping shared file(s) for document {} still used by other documents", deletion.document_id);
+                let now_str = Utc::now().to_rfc3339();
+                sqlx::query("UPDATE file_deletion_queue SET last_attempt_at = ?, attempts = attempts + 1 WHERE id = ?")
+                    .bind(&now_str)
+                    .bind(&deletion.id)
+                    .execute(&self.pool)
+                    .await.map_err(|e| ServiceError::Domain(DomainError::Database(DbError::from(e))))?;
+                continue;
+            }
+            
             // Update database - mark as completed if both successfully deleted or not found
             if original_result.is_ok() && compressed_result.is_ok() {
                 let now_str = Utc::now().to_rfc3339();
@@ -179,6 +200,14 @@ impl FileDeletionWorker {
                 .execute(&self.pool)
                 .await.map_err(|e| ServiceError::Domain(DomainError::Database(DbError::from(e))))?;
                 
+                let deleted_paths: Vec<&str> = deletion.file_path.iter()
+                    .chain(deletion.compressed_file_path.iter())
+                    .map(String::as_str)
+                    .collect();
+                if let Err(e) = content_blobs::forget_unreferenced_blobs(&self.pool, &deleted_paths).await {
+                    log::warn!("Failed to drop blob records for document {}: {:?}", deletion.document_id, e);
+                }
+                
                 log::info!("Successfully deleted files for document: {} (type: {})", deletion.document_id, deletion_type);
                 if deletion_type == "compression-cleanup" {
                     log::info!("✅ Compression cleanup completed: Original file removed, compressed file preserved");
@@ -253,6 +282,16 @@ impl FileDeletionWorker {
         Ok(result)
     }
     
+    /// Whether `path` is a shared blob file some active document still needs
+    async fn is_shared_path_needed(&self, path: Option<&str>) -> Result<bool, ServiceError> {
+        match path {
+            Some(path) => content_blobs::is_blob_path_needed(&self.pool, path)
+                .await
+                .map_err(ServiceError::Domain),
+            None => Ok(false),
+        }
+    }
+    
     /// Check if file is currently in use
     async fn is_file_in_use(&self, document_id: &str) -> Result<bool, ServiceError> {
         // Check active_file_usage table
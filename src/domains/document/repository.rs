@@ -3,6 +3,7 @@ use crate::domains::sync::types::{ChangeLogEntry, ChangeOperationType, MergeOutc
 use crate::domains::sync::repository::{ChangeLogRepository, MergeableEntityRepository};
 use crate::domains::core::repository::{FindById, HardDeletable, SoftDeletable};
 use crate::domains::core::delete_service::DeleteServiceRepository;
+use crate::domains::core::loader::count_documents_by_related_entity;
 use crate::errors::{DbError, DomainError, DomainResult, ValidationError};
 use crate::types::{PaginationParams, PaginatedResult};
 use crate::validation::Validate;
@@ -1648,19 +1649,11 @@ impl MediaDocumentRepository for SqliteMediaDocumentRepository {
         related_entity_ids: &[Uuid],
         related_table: &str,
     ) -> DomainResult<HashMap<Uuid, i64>> {
-        let mut counts = HashMap::new();
-        for &entity_id in related_entity_ids {
-            let count: i64 = query_scalar::<_, i64>(
-                "SELECT COUNT(*) FROM media_documents WHERE related_table = ? AND related_id = ? AND deleted_at IS NULL",
-            )
-            .bind(related_table)
-            .bind(entity_id.to_string())
-            .fetch_one(&self.pool)
-            .await
-            .map_err(DbError::from)?;
-            counts.insert(entity_id, count);
-        }
-        Ok(counts)
+        let found = count_documents_by_related_entity(&self.pool, related_table, related_entity_ids).await?;
+        Ok(related_entity_ids
+            .iter()
+            .map(|id| (*id, found.get(id).copied().unwrap_or(0)))
+            .collect())
     }
 
     async fn find_by_date_range(
@@ -3,6 +3,7 @@ use crate::types::UserRole;
 use crate::domains::core::dependency_checker::DependencyChecker;
 use crate::domains::core::delete_service::{BaseDeleteService, DeleteOptions, DeleteService, DeleteServiceRepository};
 use crate::domains::core::file_storage_service::FileStorageService;
+use crate::domains::core::content_blobs;
 use crate::domains::core::repository::{DeleteResult, FindById, HardDeletable, SoftDeletable};
 use crate::domains::sync::repository::{TombstoneRepository, ChangeLogRepository};
 use crate::domains::sync::types::{Tombstone, ChangeLogEntry, ChangeOperationType, SyncPriority};
@@ -793,22 +794,13 @@ impl DocumentService for DocumentServiceImpl {
         println!("📄 [DOC_SERVICE] Document type found: {} (compression: {}, method: {:?})", 
                 doc_type.name, doc_type.compression_level, doc_type.compression_method);
         
-        let entity_or_temp_id_str = if let Some(temp_id) = temp_related_id {
-            temp_id.to_string()
-        } else {
-            related_entity_id.to_string()
-        };
-        
-        println!("📄 [DOC_SERVICE] Calling file_storage_service.save_file...");
-        let file_save_result = self.file_storage_service.save_file(
-            file_data.clone(),
-            &if temp_related_id.is_some() { "temp" } else { &related_entity_type },
-            &entity_or_temp_id_str,
-            &original_filename,
-        ).await;
+        // Files are stored content-addressed, so the same photo or receipt
+        // attached to several entities is kept (and compressed, and uploaded) once
+        println!("📄 [DOC_SERVICE] Calling file_storage_service.save_blob...");
+        let file_save_result = self.file_storage_service.save_blob(file_data).await;
         
         match file_save_result {
-            Ok((relative_path, size_bytes)) => {
+            Ok((relative_path, size_bytes, content_hash)) => {
                 println!("📄 [DOC_SERVICE] File save successful!");
                 println!("   🔗 Relative path: '{}'", relative_path);
                 println!("   📊 Size: {} bytes", size_bytes);
@@ -849,8 +841,19 @@ impl DocumentService for DocumentServiceImpl {
                 new_doc_metadata.validate()?;
                 
                 // *** HYBRID APPROACH: Individual Document Creation ***
-                // Create document individually (resilient - if this fails, only this document fails)
-                let created_doc = self.media_doc_repo.create(&new_doc_metadata).await?;
+                // Create document individually (resilient - if this fails, only this document fails).
+                // The blob row and the document's reference to it commit with the
+                // document, so the deletion worker never sees the shared file unreferenced.
+                let created_doc = Self::retry_db_operation(|| async {
+                    let mut tx = self.pool.begin().await
+                        .map_err(|e| ServiceError::Domain(DomainError::Database(DbError::from(e))))?;
+                    content_blobs::register_blob_with_tx(&mut tx, &content_hash, &relative_path, size_bytes as i64).await?;
+                    let doc = self.media_doc_repo.create_with_tx(&new_doc_metadata, &mut tx).await?;
+                    content_blobs::attach_document_with_tx(&mut tx, doc.id, &content_hash).await?;
+                    tx.commit().await
+                        .map_err(|e| ServiceError::Domain(DomainError::Database(DbError::from(e))))?;
+                    Ok(doc)
+                }, 3).await?;
                 println!("📄 [DOC_SERVICE] Document record created successfully!");
                 
                 let final_compression_priority = compression_priority
@@ -1352,8 +1355,19 @@ impl DocumentService for DocumentServiceImpl {
             let mut original_deleted = false;
             let mut compressed_deleted = false;
     
+            // Content-addressed files can be shared with other documents. Leave a
+            // file that is still needed (or whose status is unknown) to the
+            // queued entry: FileDeletionWorker deletes it once it is unused.
+            let original_needed = content_blobs::is_blob_path_needed(&self.pool, &doc_to_delete.file_path).await.unwrap_or(true);
+            let compressed_needed = match &doc_to_delete.compressed_file_path {
+                Some(path) => content_blobs::is_blob_path_needed(&self.pool, path).await.unwrap_or(true),
+                None => false,
+            };
+    
             // Try to delete original file
-                if let Err(e) = self.file_storage_service.delete_file(&doc_to_delete.file_path).await {
+                if original_needed {
+                    // Stays pending in the deletion queue
+                } else if let Err(e) = self.file_storage_service.delete_file(&doc_to_delete.file_path).await {
                  // Only log if it's not a NotFound error, as that's expected if already deleted
                  if !matches!(e, crate::domains::core::file_storage_service::FileStorageError::NotFound(_)) {
                     eprintln!("Warning: Could not immediately delete file {}: {:?}", doc_to_delete.file_path, e);
@@ -1366,7 +1380,9 @@ impl DocumentService for DocumentServiceImpl {
 
             // Try to delete compressed file if it exists
                 if let Some(compressed_path) = &doc_to_delete.compressed_file_path {
-                    if let Err(e) = self.file_storage_service.delete_file(compressed_path).await {
+                    if compressed_needed {
+                        // Stays pending in the deletion queue
+                    } else if let Err(e) = self.file_storage_service.delete_file(compressed_path).await {
                     if !matches!(e, crate::domains::core::file_storage_service::FileStorageError::NotFound(_)) {
                         eprintln!("Warning: Could not immediately delete compressed file {}: {:?}", compressed_path, e);
                     }
@@ -1401,6 +1417,13 @@ impl DocumentService for DocumentServiceImpl {
                     // Log but don't fail the overall operation if this update fails
                     eprintln!("Warning: Could not update file deletion queue entry after successful immediate delete for doc {}: {:?}", doc_id_str, e);
         }
+                
+                let deleted_paths: Vec<&str> = std::iter::once(doc_to_delete.file_path.as_str())
+                    .chain(doc_to_delete.compressed_file_path.as_deref())
+                    .collect();
+                if let Err(e) = content_blobs::forget_unreferenced_blobs(&self.pool, &deleted_paths).await {
+                    eprintln!("Warning: Could not drop blob records for doc {}: {:?}", doc_id_str, e);
+                }
             }
         }
         Ok(DeleteResult::HardDeleted)
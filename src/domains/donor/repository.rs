@@ -1,7 +1,9 @@
 use crate::auth::AuthContext;
+use crate::domains::core::stat_counters;
 use crate::domains::core::repository::{FindById, HardDeletable, SoftDeletable};
 use crate::domains::core::delete_service::DeleteServiceRepository;
 use crate::domains::core::document_linking::DocumentLinkable;
+use crate::domains::core::loader::uuid_list_json;
 use crate::domains::donor::types::{
     Donor, NewDonor, UpdateDonor, DonorRow, UserDonorRole, DonorStatsSummary,
     DonorFilter, DonorBulkOperationResult, DonorEngagementMetrics, 
@@ -220,12 +222,20 @@ pub trait DonorRepository:
 #[derive(Clone)]
 pub struct SqliteDonorRepository {
     pool: Pool<Sqlite>,
+    /// Read-only connections for queries; writes and transactions use `pool`
+    read_pool: Pool<Sqlite>,
     change_log_repo: Arc<dyn ChangeLogRepository + Send + Sync>,
 }
 
 impl SqliteDonorRepository {
     pub fn new(pool: Pool<Sqlite>, change_log_repo: Arc<dyn ChangeLogRepository + Send + Sync>) -> Self {
-        Self { pool, change_log_repo }
+        Self { read_pool: pool.clone(), pool, change_log_repo }
+    }
+
+    /// Serve queries from a separate read-only pool
+    pub fn with_read_pool(mut self, read_pool: Pool<Sqlite>) -> Self {
+        self.read_pool = read_pool;
+        self
     }
 
     fn map_row_to_entity(row: DonorRow) -> DomainResult<Donor> {
@@ -342,7 +352,7 @@ impl FindById<Donor> for SqliteDonorRepository {
             "SELECT id, name, name_updated_at, name_updated_by, name_updated_by_device_id, type_ AS type, type_updated_at, type_updated_by, type_updated_by_device_id, contact_person, contact_person_updated_at, contact_person_updated_by, contact_person_updated_by_device_id, email, email_updated_at, email_updated_by, email_updated_by_device_id, phone, phone_updated_at, phone_updated_by, phone_updated_by_device_id, country, country_updated_at, country_updated_by, country_updated_by_device_id, first_donation_date, first_donation_date_updated_at, first_donation_date_updated_by, first_donation_date_updated_by_device_id, notes, notes_updated_at, notes_updated_by, notes_updated_by_device_id, created_at, updated_at, created_by_user_id, created_by_device_id, updated_by_user_id, updated_by_device_id, deleted_at, deleted_by_user_id, deleted_by_device_id FROM donors WHERE id = ? AND deleted_at IS NULL",
         )
         .bind(id.to_string())
-        .fetch_optional(&self.pool)
+        .fetch_optional(&self.read_pool)
         .await
         .map_err(DbError::from)?
         .ok_or_else(|| DomainError::EntityNotFound("Donor".to_string(), id))?;
@@ -775,17 +785,14 @@ impl DonorRepository for SqliteDonorRepository {
     ) -> DomainResult<PaginatedResult<Donor>> {
         let offset = (params.page - 1) * params.per_page;
 
-        let total: i64 = query_scalar("SELECT COUNT(*) FROM donors WHERE deleted_at IS NULL")
-            .fetch_one(&self.pool)
-            .await
-            .map_err(DbError::from)?;
+        let total: i64 = stat_counters::row_count(&self.read_pool, "donors", stat_counters::ACTIVE).await?;
 
         let rows = query_as::<_, DonorRow>(
             "SELECT id, name, name_updated_at, name_updated_by, name_updated_by_device_id, type_ AS type, type_updated_at, type_updated_by, type_updated_by_device_id, contact_person, contact_person_updated_at, contact_person_updated_by, contact_person_updated_by_device_id, email, email_updated_at, email_updated_by, email_updated_by_device_id, phone, phone_updated_at, phone_updated_by, phone_updated_by_device_id, country, country_updated_at, country_updated_by, country_updated_by_device_id, first_donation_date, first_donation_date_updated_at, first_donation_date_updated_by, first_donation_date_updated_by_device_id, notes, notes_updated_at, notes_updated_by, notes_updated_by_device_id, created_at, updated_at, created_by_user_id, created_by_device_id, updated_by_user_id, updated_by_device_id, deleted_at, deleted_by_user_id, deleted_by_device_id FROM donors WHERE deleted_at IS NULL ORDER BY name ASC LIMIT ? OFFSET ?"
         )
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -798,40 +805,15 @@ impl DonorRepository for SqliteDonorRepository {
     }
 
     async fn count_by_type(&self) -> DomainResult<Vec<(Option<String>, i64)>> {
-        let counts = query_as::<_, (Option<String>, i64)>(
-            "SELECT type_, COUNT(*) 
-             FROM donors 
-             WHERE deleted_at IS NULL 
-             GROUP BY type_"
-        )
-        .fetch_all(&self.pool)
-        .await
-        .map_err(DbError::from)?;
-
-        Ok(counts)
+        stat_counters::text_breakdown(&self.read_pool, "donors", "type").await
     }
 
     async fn count_by_country(&self) -> DomainResult<Vec<(Option<String>, i64)>> {
-        let counts = query_as::<_, (Option<String>, i64)>(
-            "SELECT country, COUNT(*) 
-             FROM donors 
-             WHERE deleted_at IS NULL 
-             GROUP BY country"
-        )
-        .fetch_all(&self.pool)
-        .await
-        .map_err(DbError::from)?;
-
-        Ok(counts)
+        stat_counters::text_breakdown(&self.read_pool, "donors", "country").await
     }
 
     async fn get_donation_stats(&self) -> DomainResult<DonorStatsSummary> {
-        let total_donors: i64 = query_scalar(
-            "SELECT COUNT(*) FROM donors WHERE deleted_at IS NULL"
-        )
-        .fetch_one(&self.pool)
-        .await
-        .map_err(DbError::from)?;
+        let total_donors: i64 = stat_counters::row_count(&self.read_pool, "donors", stat_counters::ACTIVE).await?;
 
         let active_donors: i64 = query_scalar(
             "SELECT COUNT(DISTINCT d.id) 
@@ -841,7 +823,7 @@ impl DonorRepository for SqliteDonorRepository {
              AND pf.deleted_at IS NULL
              AND (pf.status = 'Committed' OR pf.status = 'Received')"
         )
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -851,7 +833,7 @@ impl DonorRepository for SqliteDonorRepository {
              WHERE deleted_at IS NULL
              AND donor_id IN (SELECT id FROM donors WHERE deleted_at IS NULL)"
         )
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -897,7 +879,7 @@ impl DonorRepository for SqliteDonorRepository {
             "SELECT COUNT(*) FROM donors WHERE type_ = ? AND deleted_at IS NULL"
         )
         .bind(donor_type)
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -908,7 +890,7 @@ impl DonorRepository for SqliteDonorRepository {
         .bind(donor_type)
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -935,7 +917,7 @@ impl DonorRepository for SqliteDonorRepository {
             "SELECT COUNT(*) FROM donors WHERE country = ? AND deleted_at IS NULL"
         )
         .bind(country)
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -946,7 +928,7 @@ impl DonorRepository for SqliteDonorRepository {
         .bind(country)
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -978,7 +960,7 @@ impl DonorRepository for SqliteDonorRepository {
              AND pf.start_date >= ?"
         )
         .bind(since_date)
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -995,7 +977,7 @@ impl DonorRepository for SqliteDonorRepository {
         .bind(since_date)
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1023,14 +1005,14 @@ impl DonorRepository for SqliteDonorRepository {
                 "SELECT id FROM donors WHERE created_by_user_id = ? AND deleted_at IS NULL"
             )
             .bind(&user_id_str)
-            .fetch_all(&self.pool)
+            .fetch_all(&self.read_pool)
             .await
             .map_err(DbError::from)?,
             UserDonorRole::Updated => query_scalar(
                 "SELECT id FROM donors WHERE updated_by_user_id = ? AND deleted_at IS NULL"
             )
             .bind(&user_id_str)
-            .fetch_all(&self.pool)
+            .fetch_all(&self.read_pool)
             .await
             .map_err(DbError::from)?,
             UserDonorRole::Communicated | UserDonorRole::Assigned => Vec::new(),
@@ -1064,7 +1046,7 @@ impl DonorRepository for SqliteDonorRepository {
         .bind(start_date.to_rfc3339())
         .bind(end_date.to_rfc3339())
         .bind(end_date.to_rfc3339())
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1083,7 +1065,7 @@ impl DonorRepository for SqliteDonorRepository {
         .bind(end_date.to_rfc3339())
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1110,44 +1092,29 @@ impl DonorRepository for SqliteDonorRepository {
         }
 
         let offset = (params.page - 1) * params.per_page;
+        let ids_json = uuid_list_json(ids);
 
-        // Build COUNT query with dynamic placeholders
-        let count_placeholders = vec!["?"; ids.len()].join(", ");
-        let count_query = format!(
-            "SELECT COUNT(*) FROM donors WHERE id IN ({}) AND deleted_at IS NULL",
-            count_placeholders
-        );
-
-        let mut count_builder = QueryBuilder::new(&count_query);
-        for id in ids {
-            count_builder.push_bind(id.to_string());
-        }
-
-        let total: i64 = count_builder
-            .build_query_scalar()
-            .fetch_one(&self.pool)
-            .await
-            .map_err(DbError::from)?;
-
-        // Build SELECT query with dynamic placeholders
-        let select_placeholders = vec!["?"; ids.len()].join(", ");
-        let select_query = format!(
-            "SELECT id, name, name_updated_at, name_updated_by, name_updated_by_device_id, type_ AS type, type_updated_at, type_updated_by, type_updated_by_device_id, contact_person, contact_person_updated_at, contact_person_updated_by, contact_person_updated_by_device_id, email, email_updated_at, email_updated_by, email_updated_by_device_id, phone, phone_updated_at, phone_updated_by, phone_updated_by_device_id, country, country_updated_at, country_updated_by, country_updated_by_device_id, first_donation_date, first_donation_date_updated_at, first_donation_date_updated_by, first_donation_date_updated_by_device_id, notes, notes_updated_at, notes_updated_by, notes_updated_by_device_id, created_at, updated_at, created_by_user_id, created_by_device_id, updated_by_user_id, updated_by_device_id, deleted_at, deleted_by_user_id, deleted_by_device_id FROM donors WHERE id IN ({}) AND deleted_at IS NULL ORDER BY name ASC LIMIT ? OFFSET ?",
-            select_placeholders
-        );
-
-        let mut select_builder = QueryBuilder::new(&select_query);
-        for id in ids {
-            select_builder.push_bind(id.to_string());
-        }
-        select_builder.push_bind(params.per_page as i64);
-        select_builder.push_bind(offset as i64);
+        let total: i64 = query_scalar(
+            "SELECT COUNT(*) FROM donors WHERE id IN (SELECT value FROM json_each(?)) AND deleted_at IS NULL",
+        )
+        .bind(&ids_json)
+        .fetch_one(&self.read_pool)
+        .await
+        .map_err(DbError::from)?;
 
-        let rows = select_builder
-            .build_query_as::<DonorRow>()
-            .fetch_all(&self.pool)
-            .await
-            .map_err(DbError::from)?;
+        // `DonorRow` names the `type` column `type_` and carries sync fields the table lacks
+        let rows = query_as::<_, DonorRow>(
+            "SELECT *, type AS type_, NULL AS sync_priority_updated_at, NULL AS sync_priority_updated_by, \
+                    NULL AS sync_priority_updated_by_device_id, NULL AS last_sync_at \
+             FROM donors WHERE id IN (SELECT value FROM json_each(?)) AND deleted_at IS NULL \
+             ORDER BY name ASC LIMIT ? OFFSET ?",
+        )
+        .bind(&ids_json)
+        .bind(params.per_page as i64)
+        .bind(offset as i64)
+        .fetch_all(&self.read_pool)
+        .await
+        .map_err(DbError::from)?;
 
         let entities = rows
             .into_iter()
@@ -1204,7 +1171,7 @@ impl DonorRepository for SqliteDonorRepository {
         // Filter by types
         if let Some(ref types) = filter.types {
             if !types.is_empty() {
-                query_builder.push(" AND d.type_ IN (");
+                query_builder.push(" AND d.type IN (");
                 let mut separated = query_builder.separated(", ");
                 for donor_type in types {
                     separated.push_bind(donor_type.as_str());
@@ -1227,18 +1194,23 @@ impl DonorRepository for SqliteDonorRepository {
 
         // Search text filter
         if let Some(ref search_text) = filter.search_text {
-            query_builder.push(" AND (d.name LIKE ? OR d.contact_person LIKE ? OR d.email LIKE ?)");
             let search_pattern = format!("%{}%", search_text);
-            query_builder.push_bind(search_pattern.clone());
-            query_builder.push_bind(search_pattern.clone());
-            query_builder.push_bind(search_pattern);
+            query_builder.push(" AND (d.name LIKE ")
+                .push_bind(search_pattern.clone())
+                .push(" OR d.contact_person LIKE ")
+                .push_bind(search_pattern.clone())
+                .push(" OR d.email LIKE ")
+                .push_bind(search_pattern)
+                .push(")");
         }
 
         // Date range filter
         if let Some((ref start_date, ref end_date)) = filter.date_range {
-            query_builder.push(" AND (d.created_at >= ? AND d.created_at <= ?)");
-            query_builder.push_bind(start_date);
-            query_builder.push_bind(end_date);
+            query_builder.push(" AND (d.created_at >= ")
+                .push_bind(start_date)
+                .push(" AND d.created_at <= ")
+                .push_bind(end_date)
+                .push(")");
         }
 
         // Created by user filter
@@ -1267,13 +1239,11 @@ impl DonorRepository for SqliteDonorRepository {
 
         // Funding amount filters
         if let Some(min_amount) = filter.min_funding_amount {
-            query_builder.push(" AND pf.amount >= ?");
-            query_builder.push_bind(min_amount);
+            query_builder.push(" AND pf.amount >= ").push_bind(min_amount);
         }
 
         if let Some(max_amount) = filter.max_funding_amount {
-            query_builder.push(" AND pf.amount <= ?");
-            query_builder.push_bind(max_amount);
+            query_builder.push(" AND pf.amount <= ").push_bind(max_amount);
         }
 
         // Project IDs filter
@@ -1290,7 +1260,7 @@ impl DonorRepository for SqliteDonorRepository {
 
         let id_strings: Vec<String> = query_builder
             .build_query_scalar()
-            .fetch_all(&self.pool)
+            .fetch_all(&self.read_pool)
             .await
             .map_err(DbError::from)?;
 
@@ -381,32 +381,53 @@ impl DonorServiceImpl {
     /// Helper to enrich DonorResponse with included data
     async fn enrich_response(
         &self,
-        mut response: DonorResponse,
+        response: DonorResponse,
         include: Option<&[DonorInclude]>,
         auth: &AuthContext,
     ) -> ServiceResult<DonorResponse> {
-        if let Some(includes) = include {
-            // Check if we need to include funding stats
-            let include_funding_stats = includes.contains(&DonorInclude::All) || 
-                                      includes.contains(&DonorInclude::FundingStats);
-                                
-            // Include funding stats if requested
-            if include_funding_stats && response.active_fundings_count.is_none() {
-                match self.funding_repo.get_donor_funding_stats(response.id).await {
-                    Ok((active_count, total_amount)) => {
-                        response = response.with_funding_stats(active_count, total_amount, 0, 0.0, None);
-                    },
-                    Err(_) => {
-                        // Stats calculation failed, but we shouldn't fail the overall response
-                        // Just leave stats as None
-                    }
-                }
-            }
-            
-            // Add more includes in the future as needed...
+        let mut enriched = self.enrich_responses(vec![response], include, auth).await?;
+        Ok(enriched.pop().expect("one response in, one out"))
+    }
+
+    /// Enrich a page of donors; funding stats for the page come from one query
+    async fn enrich_responses(
+        &self,
+        responses: Vec<DonorResponse>,
+        include: Option<&[DonorInclude]>,
+        _auth: &AuthContext,
+    ) -> ServiceResult<Vec<DonorResponse>> {
+        let Some(includes) = include else {
+            return Ok(responses);
+        };
+
+        // Check if we need to include funding stats
+        let include_funding_stats = includes.contains(&DonorInclude::All) || 
+                                  includes.contains(&DonorInclude::FundingStats);
+        if !include_funding_stats {
+            return Ok(responses);
         }
-        
-        Ok(response)
+
+        let ids: Vec<Uuid> = responses
+            .iter()
+            .filter(|r| r.active_fundings_count.is_none())
+            .map(|r| r.id)
+            .collect();
+        // Stats calculation failed, but we shouldn't fail the overall response.
+        // Just leave stats as None
+        let Ok(stats) = self.funding_repo.get_funding_stats_for_donors(&ids).await else {
+            return Ok(responses);
+        };
+
+        Ok(responses
+            .into_iter()
+            .map(|response| {
+                if response.active_fundings_count.is_some() {
+                    return response;
+                }
+                let (active_count, total_amount) = stats.get(&response.id).copied().unwrap_or((0, 0.0));
+                response.with_funding_stats(active_count, total_amount, 0, 0.0, None)
+            })
+            .collect())
     }
     
     /// Helper method to upload documents for entity and handle errors individually
@@ -782,11 +803,8 @@ impl DonorService for DonorServiceImpl {
         
         let paginated_result = self.repo.find_all(params).await?;
         
-        let mut enriched_items = Vec::with_capacity(paginated_result.items.len());
-        for donor in paginated_result.items {
-            let enriched = self.enrich_response(donor.into(), include, auth).await?;
-            enriched_items.push(enriched);
-        }
+        let responses = paginated_result.items.into_iter().map(Into::into).collect();
+        let enriched_items = self.enrich_responses(responses, include, auth).await?;
         
         // Calculate total_pages
         let total_pages = if paginated_result.per_page > 0 {
@@ -1086,12 +1104,8 @@ impl DonorService for DonorServiceImpl {
         let paginated_result = self.repo.find_by_type(donor_type, params).await?;
 
         // 3. Convert and enrich each donor
-        let mut enriched_items = Vec::new();
-        for donor in paginated_result.items {
-            let response = DonorResponse::from(donor);
-            let enriched = self.enrich_response(response, include, auth).await?;
-            enriched_items.push(enriched);
-        }
+        let responses = paginated_result.items.into_iter().map(DonorResponse::from).collect();
+        let enriched_items = self.enrich_responses(responses, include, auth).await?;
 
         // 4. Return the paginated result with enriched donors
         Ok(PaginatedResult::new(
@@ -1115,12 +1129,8 @@ impl DonorService for DonorServiceImpl {
         let paginated_result = self.repo.find_by_country(country, params).await?;
 
         // 3. Convert and enrich each donor
-        let mut enriched_items = Vec::new();
-        for donor in paginated_result.items {
-            let response = DonorResponse::from(donor);
-            let enriched = self.enrich_response(response, include, auth).await?;
-            enriched_items.push(enriched);
-        }
+        let responses = paginated_result.items.into_iter().map(DonorResponse::from).collect();
+        let enriched_items = self.enrich_responses(responses, include, auth).await?;
 
         // 4. Return the paginated result with enriched donors
         Ok(PaginatedResult::new(
@@ -1147,12 +1157,8 @@ impl DonorService for DonorServiceImpl {
         let paginated_result = self.repo.find_with_recent_donations(&cutoff_date, params).await?;
 
         // 4. Convert and enrich each donor
-        let mut enriched_items = Vec::new();
-        for donor in paginated_result.items {
-            let response = DonorResponse::from(donor);
-            let enriched = self.enrich_response(response, include, auth).await?;
-            enriched_items.push(enriched);
-        }
+        let responses = paginated_result.items.into_iter().map(DonorResponse::from).collect();
+        let enriched_items = self.enrich_responses(responses, include, auth).await?;
 
         // 5. Return the paginated result with enriched donors
         Ok(PaginatedResult::new(
@@ -1373,12 +1379,8 @@ impl DonorService for DonorServiceImpl {
             .map_err(ServiceError::Domain)?;
 
         // 5. Convert to response DTOs and enrich
-        let mut enriched_items = Vec::new();
-        for donor in paginated_result.items {
-            let response = DonorResponse::from(donor);
-            let enriched = self.enrich_response(response, include, auth).await?;
-            enriched_items.push(enriched);
-        }
+        let responses = paginated_result.items.into_iter().map(DonorResponse::from).collect();
+        let enriched_items = self.enrich_responses(responses, include, auth).await?;
 
         // 6. Return paginated result
         Ok(PaginatedResult::new(
@@ -1410,13 +1412,8 @@ impl DonorService for DonorServiceImpl {
         filter.validate().map_err(ServiceError::Domain)?;
         
         let paginated_result = self.repo.find_by_filter(&filter, params).await.map_err(ServiceError::Domain)?;
-        let mut enriched_items = Vec::with_capacity(paginated_result.items.len());
-        
-        for item in paginated_result.items {
-            let response = DonorResponse::from(item);
-            let enriched = self.enrich_response(response, include, auth).await?;
-            enriched_items.push(enriched);
-        }
+        let responses = paginated_result.items.into_iter().map(DonorResponse::from).collect();
+        let enriched_items = self.enrich_responses(responses, include, auth).await?;
         
         Ok(PaginatedResult::new(
             enriched_items,
@@ -548,6 +548,7 @@ impl CheckpointStorage for KeychainCheckpointStorage {
 }
 
 // Safe FFI declarations for iOS integration
+#[cfg(target_os = "ios")]
 extern "C" {
     fn ios_begin_background_task_safe(
         identifier: *const c_char,
@@ -564,6 +565,42 @@ extern "C" {
     fn ios_keychain_free(data: *mut u8);
 }
 
+// Host fallbacks so the crate links outside the app: the process is never
+// suspended, so background time is unlimited; there is no keychain to hold
+// checkpoints
+#[cfg(not(target_os = "ios"))]
+mod host {
+    use std::ffi::{c_char, c_void};
+
+    pub unsafe fn ios_begin_background_task_safe(
+        _identifier: *const c_char,
+        _expiration_handler: extern "C" fn(*mut c_void),
+        _context: *mut c_void,
+    ) -> i32 {
+        0
+    }
+
+    pub unsafe fn ios_end_background_task_safe(_task_id: i32) {}
+
+    pub unsafe fn ios_background_time_remaining() -> f64 {
+        f64::INFINITY
+    }
+
+    pub unsafe fn ios_keychain_save(_key: *const c_char, _data: *const u8, _len: usize) -> i32 {
+        -1
+    }
+
+    pub unsafe fn ios_keychain_load(_key: *const c_char, _data: *mut *mut u8, _len: *mut usize) -> i32 {
+        -1
+    }
+
+    pub unsafe fn ios_keychain_delete(_key: *const c_char) {}
+
+    pub unsafe fn ios_keychain_free(_data: *mut u8) {}
+}
+#[cfg(not(target_os = "ios"))]
+use host::*;
+
 extern "C" fn background_time_callback(context: *mut c_void) {
     // Handle background time expiration - safer implementation
     unsafe {
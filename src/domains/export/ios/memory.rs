@@ -1,8 +1,11 @@
-use std::sync::atomic::{AtomicU32, AtomicI32, Ordering};
+use std::sync::atomic::{AtomicI32, AtomicU32, AtomicU64, AtomicUsize, Ordering};
 use std::sync::Arc;
 use tokio::sync::watch;
 use crate::domains::export::types::*;
 
+/// Context handed to the pressure handler: the observer's level and subscribers
+type PressureContext = (Arc<AtomicI32>, Arc<watch::Sender<MemoryPressureLevel>>);
+
 /// iOS Memory Pressure Observer
 pub struct MemoryPressureObserver {
     level: Arc<AtomicI32>,
@@ -28,7 +31,7 @@ impl MemoryPressureObserver {
         
         // iOS memory pressure callback
         unsafe {
-            let ctx = Box::into_raw(Box::new((level, subscribers)));
+            let ctx = Box::into_raw(Box::new((level, subscribers) as PressureContext));
             ios_register_memory_pressure_handler(
                 memory_pressure_callback,
                 ctx as *mut _,
@@ -59,7 +62,7 @@ extern "C" fn memory_pressure_callback(
     ctx: *mut std::ffi::c_void,
 ) {
     unsafe {
-        let (level_atomic, subscribers) = &*(ctx as *mut (Arc<AtomicI32>, Arc<watch::Sender<MemoryPressureLevel>>));
+        let (level_atomic, subscribers) = &*(ctx as *mut PressureContext);
         level_atomic.store(level, Ordering::Relaxed);
         
         let pressure_level = match level {
@@ -118,6 +121,7 @@ impl AdaptiveBuffer {
         }
     }
     
+    /// Empty buffer from the shared pool, sized for the thermal state
     pub async fn get_buffer(&self) -> Vec<u8> {
         let size = match self.thermal_monitor.current_state() {
             ThermalState::Nominal => 4_194_304,
@@ -127,11 +131,12 @@ impl AdaptiveBuffer {
         };
         
         self.size.store(size, Ordering::Relaxed);
-        Vec::with_capacity(size as usize)
+        buffer_pool().take(size as usize)
     }
     
-    pub fn release(&self, _buffer: Vec<u8>) {
-        // Return buffer to pool if needed
+    /// Hand a buffer from `get_buffer` back to the shared pool
+    pub fn release(&self, buffer: Vec<u8>) {
+        buffer_pool().release(buffer);
     }
 }
 
@@ -158,7 +163,8 @@ impl ThermalMonitor {
     }
 }
 
-// FFI declarations
+// FFI declarations (implemented in Swift, FFICoreDeclarations.swift)
+#[cfg(target_os = "ios")]
 extern "C" {
     fn ios_register_memory_pressure_handler(
         callback: extern "C" fn(i32, *mut std::ffi::c_void),
@@ -170,6 +176,37 @@ extern "C" {
     fn ios_trim_memory(level: i32);
 }
 
+// Host fallbacks so the crate links outside the app (unit tests, perf harness):
+// no pressure notifications, nominal thermal state, nothing to trim
+#[cfg(not(target_os = "ios"))]
+#[allow(dead_code)]
+mod host {
+    pub unsafe fn ios_register_memory_pressure_handler(
+        _callback: extern "C" fn(i32, *mut std::ffi::c_void),
+        context: *mut std::ffi::c_void,
+    ) {
+        // Nobody will call back with the context; reclaim it
+        drop(unsafe { Box::from_raw(context as *mut super::PressureContext) });
+    }
+
+    pub unsafe fn ios_get_thermal_state() -> i32 {
+        0
+    }
+
+    pub unsafe fn ios_request_critical_memory_release() {}
+
+    pub unsafe fn ios_trim_memory(_level: i32) {}
+
+    pub unsafe fn ios_begin_background_task(_name: *const i8) -> i32 {
+        -1
+    }
+
+    pub unsafe fn ios_end_background_task(_task_id: i32) {}
+}
+#[cfg(not(target_os = "ios"))]
+#[allow(unused_imports)]
+use host::*;
+
 // Helper functions
 pub fn ios_memory_available() -> usize {
     // Implementation would call iOS APIs
@@ -230,42 +267,240 @@ impl Drop for BackgroundTaskManager {
 }
 
 // Additional FFI declarations for background tasks
+#[cfg(target_os = "ios")]
 extern "C" {
     fn ios_begin_background_task(name: *const i8) -> i32;
     fn ios_end_background_task(task_id: i32);
 }
 
-/// Memory pool for efficient buffer reuse
+/// Capacities the pool hands out. A request is rounded up to the next class,
+/// so buffers are interchangeable within a class and long exports settle on
+/// a handful of allocations instead of a new one per batch.
+const SIZE_CLASSES: [usize; 6] = [
+    4 * 1024,
+    16 * 1024,
+    64 * 1024,
+    256 * 1024,
+    1024 * 1024,
+    4 * 1024 * 1024,
+];
+
+/// Size-classed pool of byte buffers shared by the export writers, the
+/// compressors and the FFI JSON serializer.
+///
+/// Idle buffers are kept up to a byte budget. The budget shrinks with memory
+/// pressure: a quarter under Warning, nothing under Critical. When the
+/// pressure observer reports a higher level than the pool last saw, idle
+/// buffers beyond the new budget are freed at once.
 pub struct MemoryPool {
-    buffers: Arc<tokio::sync::Mutex<Vec<Vec<u8>>>>,
-    max_buffers: usize,
-    buffer_size: usize,
+    classes: Vec<std::sync::Mutex<Vec<Vec<u8>>>>,
+    budget_bytes: usize,
+    retained_bytes: AtomicUsize,
+    last_level: AtomicI32,
+    memory_observer: Option<MemoryPressureObserver>,
+    hits: AtomicU64,
+    misses: AtomicU64,
+}
+
+/// Counters of the buffer pool
+#[derive(Debug, Clone, Copy, serde::Serialize)]
+pub struct MemoryPoolStats {
+    pub retained_buffers: usize,
+    pub retained_bytes: usize,
+    pub budget_bytes: usize,
+    pub hits: u64,
+    pub misses: u64,
 }
 
 impl MemoryPool {
-    pub fn new(max_buffers: usize, buffer_size: usize) -> Self {
+    /// Pool keeping at most `budget_bytes` of idle buffers, without a pressure observer
+    pub fn new(budget_bytes: usize) -> Self {
         Self {
-            buffers: Arc::new(tokio::sync::Mutex::new(Vec::with_capacity(max_buffers))),
-            max_buffers,
-            buffer_size,
+            classes: SIZE_CLASSES.iter().map(|_| std::sync::Mutex::new(Vec::new())).collect(),
+            budget_bytes,
+            retained_bytes: AtomicUsize::new(0),
+            last_level: AtomicI32::new(0),
+            memory_observer: None,
+            hits: AtomicU64::new(0),
+            misses: AtomicU64::new(0),
         }
     }
     
-    pub async fn get_buffer(&self) -> Vec<u8> {
-        let mut buffers = self.buffers.lock().await;
-        buffers.pop().unwrap_or_else(|| Vec::with_capacity(self.buffer_size))
+    /// Pool that trims itself when `observer` reports memory pressure
+    pub fn with_observer(budget_bytes: usize, observer: MemoryPressureObserver) -> Self {
+        Self { memory_observer: Some(observer), ..Self::new(budget_bytes) }
+    }
+    
+    /// Empty buffer with at least `min_capacity` bytes of capacity
+    pub fn take(&self, min_capacity: usize) -> Vec<u8> {
+        self.observe_pressure();
+        let Some(class) = SIZE_CLASSES.iter().position(|&c| c >= min_capacity) else {
+            // Larger than any class: not pooled
+            return Vec::with_capacity(min_capacity);
+        };
+        
+        if let Some(buffer) = self.classes[class].lock().unwrap().pop() {
+            self.retained_bytes.fetch_sub(buffer.capacity(), Ordering::Relaxed);
+            self.hits.fetch_add(1, Ordering::Relaxed);
+            return buffer;
+        }
+        self.misses.fetch_add(1, Ordering::Relaxed);
+        Vec::with_capacity(SIZE_CLASSES[class])
     }
     
-    pub async fn return_buffer(&self, mut buffer: Vec<u8>) {
-        let mut buffers = self.buffers.lock().await;
-        if buffers.len() < self.max_buffers {
-            buffer.clear();
-            buffers.push(buffer);
+    /// Like `take`, returning the buffer to the pool when the guard drops
+    pub fn get(&self, min_capacity: usize) -> PooledBuffer<'_> {
+        PooledBuffer { pool: self, buffer: Some(self.take(min_capacity)) }
+    }
+    
+    /// Keep `buffer` for reuse if it fits a class and the budget allows it
+    pub fn release(&self, mut buffer: Vec<u8>) {
+        let level = self.observe_pressure();
+        let capacity = buffer.capacity();
+        // The largest class the buffer can serve; buffers that grew far past
+        // the largest class are not worth keeping
+        let Some(class) = SIZE_CLASSES.iter().rposition(|&c| c <= capacity) else {
+            return;
+        };
+        if capacity > SIZE_CLASSES[SIZE_CLASSES.len() - 1] * 2 {
+            return;
+        }
+        
+        let budget = self.budget_for(level);
+        if self.retained_bytes.fetch_add(capacity, Ordering::Relaxed) + capacity > budget {
+            self.retained_bytes.fetch_sub(capacity, Ordering::Relaxed);
+            return;
         }
+        buffer.clear();
+        self.classes[class].lock().unwrap().push(buffer);
     }
     
-    pub async fn clear(&self) {
-        let mut buffers = self.buffers.lock().await;
-        buffers.clear();
+    /// Free idle buffers until the retained bytes fit the budget of `level`,
+    /// largest classes first
+    pub fn trim(&self, level: MemoryPressureLevel) {
+        let budget = self.budget_for(level);
+        for class in self.classes.iter().rev() {
+            let mut free = class.lock().unwrap();
+            while self.retained_bytes.load(Ordering::Relaxed) > budget {
+                match free.pop() {
+                    Some(buffer) => {
+                        self.retained_bytes.fetch_sub(buffer.capacity(), Ordering::Relaxed);
+                    }
+                    None => break,
+                }
+            }
+        }
+    }
+    
+    /// Free every idle buffer
+    pub fn clear(&self) {
+        self.trim(MemoryPressureLevel::Critical);
     }
-}
\ No newline at end of file
+    
+    pub fn stats(&self) -> MemoryPoolStats {
+        MemoryPoolStats {
+            retained_buffers: self.classes.iter().map(|c| c.lock().unwrap().len()).sum(),
+            retained_bytes: self.retained_bytes.load(Ordering::Relaxed),
+            budget_bytes: self.budget_bytes,
+            hits: self.hits.load(Ordering::Relaxed),
+            misses: self.misses.load(Ordering::Relaxed),
+        }
+    }
+    
+    fn budget_for(&self, level: MemoryPressureLevel) -> usize {
+        match level {
+            MemoryPressureLevel::Normal => self.budget_bytes,
+            MemoryPressureLevel::Warning => self.budget_bytes / 4,
+            MemoryPressureLevel::Critical => 0,
+        }
+    }
+    
+    /// Current pressure level; trims when it rose since the last call
+    fn observe_pressure(&self) -> MemoryPressureLevel {
+        let Some(observer) = &self.memory_observer else {
+            return MemoryPressureLevel::Normal;
+        };
+        let level = observer.current_level();
+        let raw = level as i32;
+        if self.last_level.swap(raw, Ordering::Relaxed) < raw {
+            log::debug!("Buffer pool trimming for memory pressure {:?}", level);
+            self.trim(level);
+        }
+        level
+    }
+}
+
+/// Buffer on loan from a `MemoryPool`, returned to it on drop
+pub struct PooledBuffer<'a> {
+    pool: &'a MemoryPool,
+    buffer: Option<Vec<u8>>,
+}
+
+impl PooledBuffer<'_> {
+    /// Keep the buffer instead of returning it to the pool
+    pub fn into_vec(mut self) -> Vec<u8> {
+        self.buffer.take().unwrap_or_default()
+    }
+}
+
+impl std::ops::Deref for PooledBuffer<'_> {
+    type Target = Vec<u8>;
+    
+    fn deref(&self) -> &Vec<u8> {
+        self.buffer.as_ref().expect("pooled buffer already taken")
+    }
+}
+
+impl std::ops::DerefMut for PooledBuffer<'_> {
+    fn deref_mut(&mut self) -> &mut Vec<u8> {
+        self.buffer.as_mut().expect("pooled buffer already taken")
+    }
+}
+
+impl Drop for PooledBuffer<'_> {
+    fn drop(&mut self) {
+        if let Some(buffer) = self.buffer.take() {
+            self.pool.release(buffer);
+        }
+    }
+}
+
+/// The process-wide buffer pool, with an idle budget by device tier
+pub fn buffer_pool() -> &'static MemoryPool {
+    static POOL: std::sync::OnceLock<MemoryPool> = std::sync::OnceLock::new();
+    POOL.get_or_init(|| {
+        let budget_mb = match ios_device_tier() {
+            DeviceTier::Max => 64,
+            DeviceTier::Pro => 32,
+            DeviceTier::Standard => 16,
+            DeviceTier::Basic => 8,
+        };
+        MemoryPool::with_observer(budget_mb * 1024 * 1024, MemoryPressureObserver::new())
+    })
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn buffers_are_reused_by_class_and_trimmed_under_pressure() {
+        let pool = MemoryPool::new(2 * 1024 * 1024);
+        let mut buffer = pool.take(10_000);
+        assert_eq!(buffer.capacity(), 16 * 1024);
+        buffer.extend_from_slice(b"row");
+        pool.release(buffer);
+
+        let reused = pool.take(5_000);
+        assert!(reused.is_empty() && reused.capacity() >= 16 * 1024);
+        assert_eq!(pool.stats().hits, 1);
+        pool.release(reused);
+        drop(pool.get(1024 * 1024));
+        assert_eq!(pool.stats().retained_buffers, 2);
+
+        pool.trim(MemoryPressureLevel::Warning);
+        assert_eq!(pool.stats().retained_bytes, 16 * 1024);
+        pool.trim(MemoryPressureLevel::Critical);
+        assert_eq!(pool.stats().retained_buffers, 0);
+    }
+}
@@ -8,6 +8,9 @@ pub use memory::{
     ThermalMonitor,
     BackgroundTaskManager,
     MemoryPool,
+    MemoryPoolStats,
+    PooledBuffer,
+    buffer_pool,
     ios_memory_available,
     ios_device_tier,
     ios_active_processor_count,
@@ -9,9 +9,11 @@ pub mod writer;
 pub mod repository;
 pub mod service;
 pub mod queue_manager;
+pub mod unified;
+pub mod incremental;
 
 pub use service_v2::{ExportServiceV2, ExportProgress, JobProcessor};
 pub use repository_v2::{StreamingExportRepository, SqliteStreamingRepository, ExportEntity};
 pub use writers::{StreamingCsvWriter, CompressedCsvWriter, CsvConfig, IOSParquetWriter, RecordBatchBuilder};
-pub use types::{ExportFormat, ExportError, ExportStats, ExportMetadata};
+pub use types::{ExportFormat, ExportMode, ExportError, ExportStats, ExportMetadata};
 pub use csv_record::CsvRecord;
\ No newline at end of file
@@ -3,6 +3,7 @@ use crate::errors::{ServiceError, ServiceResult};
 use async_trait::async_trait;
 use futures::stream::{Stream, StreamExt};
 use sqlx::{SqlitePool, Row, QueryBuilder, Execute};
+use crate::domains::core::filter_sql::FilterQueryExt;
 use std::pin::Pin;
 use uuid::Uuid;
 use tokio_stream::wrappers::ReceiverStream;
@@ -126,14 +127,10 @@ impl SqliteStreamingRepository {
         let mut query_builder = QueryBuilder::new(
             "SELECT id, objective_code, outcome, kpi, target_value, actual_value, status_id, responsible_team, 
                     sync_priority, created_at, updated_at, created_by_user_id, updated_by_user_id, deleted_at 
-             FROM strategic_goals WHERE id IN ("
+             FROM strategic_goals WHERE "
         );
         
-        let mut separated = query_builder.separated(", ");
-        for id in limited_ids {
-            separated.push_bind(id.to_string());
-        }
-        separated.push_unseparated(")");
+        query_builder.push_in_json("id", limited_ids);
 
         if let Some(cursor_id) = cursor {
             query_builder.push(" AND id > ");
@@ -233,15 +230,10 @@ impl SqliteStreamingRepository {
         let mut query_builder = QueryBuilder::new(
             "SELECT id, name, objective, outcome, status_id, timeline, responsible_team, strategic_goal_id,
                     sync_priority, created_at, updated_at, created_by_user_id, updated_by_user_id, deleted_at 
-             FROM projects WHERE id IN ("
+             FROM projects WHERE "
         );
         
-        let mut separated = query_builder.separated(", ");
-        for (idx, id) in limited_ids.iter().enumerate() {
-            log::debug!("[PROJECT_STREAM_BY_IDS] Adding ID {} to query: {}", idx, id);
-            separated.push_bind(id.to_string());
-        }
-        separated.push_unseparated(")");
+        query_builder.push_in_json("id", limited_ids);
 
         if let Some(cursor_id) = cursor {
             log::debug!("[PROJECT_STREAM_BY_IDS] Adding cursor filter: {}", cursor_id);
@@ -507,14 +499,10 @@ impl SqliteStreamingRepository {
              0 as workshop_count, 0 as completed_workshop_count, 0 as upcoming_workshop_count, \
              0 as livelihood_count, 0 as active_livelihood_count, 0 as document_count, \
              NULL as created_by_username, NULL as updated_by_username \
-             FROM participants WHERE deleted_at IS NULL AND id IN ("
+             FROM participants WHERE deleted_at IS NULL AND "
         );
         
-        let mut separated = query.separated(", ");
-        for id in &ids {
-            separated.push_bind(id.to_string());
-        }
-        separated.push_unseparated(")");
+        query.push_in_json("id", &ids);
         
         if let Some(cursor_id) = cursor {
             query.push(" AND id > ");
@@ -652,14 +640,10 @@ impl SqliteStreamingRepository {
              LEFT JOIN media_documents md ON md.related_id = a.id AND md.related_table = 'activities' AND md.deleted_at IS NULL \
              LEFT JOIN users cu ON cu.id = a.created_by_user_id \
              LEFT JOIN users uu ON uu.id = a.updated_by_user_id \
-             WHERE a.deleted_at IS NULL AND a.id IN ("
+             WHERE a.deleted_at IS NULL AND "
         );
         
-        let mut separated = query.separated(", ");
-        for id in &ids {
-            separated.push_bind(id.to_string());
-        }
-        separated.push_unseparated(")");
+        query.push_in_json("a.id", &ids);
         
         if let Some(cursor_id) = cursor {
             query.push(" AND a.id > ");
@@ -742,14 +726,11 @@ impl SqliteStreamingRepository {
             "SELECT id, name, type_, contact_person, email, phone, country, first_donation_date, notes, \
              created_at, updated_at, created_by_user_id, created_by_device_id, \
              updated_by_user_id, updated_by_device_id, deleted_at, deleted_by_user_id, deleted_by_device_id \
-             FROM donors WHERE deleted_at IS NULL AND id IN ("
+             FROM donors WHERE deleted_at IS NULL AND "
         );
         
-        let mut separated = query.separated(", ");
-        for id in ids {
-            separated.push_bind(id.to_string());
-        }
-        separated.push_unseparated(") ORDER BY id ASC");
+        query.push_in_json("id", ids);
+        query.push(" ORDER BY id ASC");
 
         let rows = query.build()
             .fetch_all(&self.pool)
@@ -813,14 +794,11 @@ impl SqliteStreamingRepository {
             "SELECT id, project_id, donor_id, grant_id, amount, currency, start_date, end_date, status, \
              reporting_requirements, notes, created_at, updated_at, created_by_user_id, created_by_device_id, \
              updated_by_user_id, updated_by_device_id, deleted_at, deleted_by_user_id, deleted_by_device_id \
-             FROM project_funding WHERE deleted_at IS NULL AND id IN ("
+             FROM project_funding WHERE deleted_at IS NULL AND "
         );
         
-        let mut separated = query.separated(", ");
-        for id in ids {
-            separated.push_bind(id.to_string());
-        }
-        separated.push_unseparated(") ORDER BY id ASC");
+        query.push_in_json("id", ids);
+        query.push(" ORDER BY id ASC");
 
         let rows = query.build()
             .fetch_all(&self.pool)
@@ -884,14 +862,11 @@ impl SqliteStreamingRepository {
             "SELECT id, participant_id, project_id, type_, description, status_id, initial_grant_date, \
              initial_grant_amount, sync_priority, created_at, updated_at, created_by_user_id, created_by_device_id, \
              updated_by_user_id, updated_by_device_id, deleted_at, deleted_by_user_id, deleted_by_device_id \
-             FROM livelihoods WHERE deleted_at IS NULL AND id IN ("
+             FROM livelihoods WHERE deleted_at IS NULL AND "
         );
         
-        let mut separated = query.separated(", ");
-        for id in ids {
-            separated.push_bind(id.to_string());
-        }
-        separated.push_unseparated(") ORDER BY id ASC");
+        query.push_in_json("id", ids);
+        query.push(" ORDER BY id ASC");
 
         let rows = query.build()
             .fetch_all(&self.pool)
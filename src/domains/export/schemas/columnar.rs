@@ -0,0 +1,301 @@
+//! Typed column appenders compiled from an export schema.
+//!
+//! `BatchAppender::compile` turns each field of an Arrow schema into a
+//! concrete builder once, so appending a cell is a plain match on the
+//! column's type instead of a `downcast_mut` per cell. Values go in by their
+//! SQLite storage class (`append_sqlite_row`) or their JSON type
+//! (`append_json`); numbers are never formatted to text and parsed back.
+//! Builders are pre-sized for the batch the caller is about to fill.
+
+use arrow::array::*;
+use arrow::datatypes::{DataType, SchemaRef, TimeUnit};
+use arrow::record_batch::RecordBatch;
+use chrono::{DateTime, NaiveDate};
+use sqlx::sqlite::SqliteRow;
+use sqlx::{Row, TypeInfo, ValueRef};
+use std::sync::Arc;
+
+use crate::domains::export::types::ExportError;
+
+/// Average bytes reserved per text cell when pre-sizing string columns
+const TEXT_BYTES_PER_CELL: usize = 32;
+
+/// A cell as it arrives from the source, before conversion to the column type
+enum Cell<'a> {
+    Null,
+    Int(i64),
+    Real(f64),
+    Text(&'a str),
+    Bool(bool),
+}
+
+/// One compiled column: the builder matching the field's Arrow type
+enum ColumnAppender {
+    Utf8(StringBuilder),
+    Int64(Int64Builder),
+    Int32(Int32Builder),
+    Float64(Float64Builder),
+    Boolean(BooleanBuilder),
+    TimestampMs(TimestampMillisecondBuilder),
+    Date32(Date32Builder),
+    /// Types the export schemas do not fill from rows (lists, structs): written as nulls
+    Unsupported { data_type: DataType, len: usize },
+}
+
+impl ColumnAppender {
+    fn new(data_type: &DataType, capacity: usize) -> Self {
+        match data_type {
+            DataType::Utf8 => Self::Utf8(StringBuilder::with_capacity(capacity, capacity * TEXT_BYTES_PER_CELL)),
+            DataType::Int64 => Self::Int64(Int64Builder::with_capacity(capacity)),
+            DataType::Int32 => Self::Int32(Int32Builder::with_capacity(capacity)),
+            DataType::Float64 => Self::Float64(Float64Builder::with_capacity(capacity)),
+            DataType::Boolean => Self::Boolean(BooleanBuilder::with_capacity(capacity)),
+            DataType::Timestamp(TimeUnit::Millisecond, tz) => {
+                Self::TimestampMs(TimestampMillisecondBuilder::with_capacity(capacity).with_timezone_opt(tz.clone()))
+            }
+            DataType::Date32 => Self::Date32(Date32Builder::with_capacity(capacity)),
+            other => Self::Unsupported { data_type: other.clone(), len: 0 },
+        }
+    }
+
+    fn len(&self) -> usize {
+        match self {
+            Self::Utf8(b) => b.len(),
+            Self::Int64(b) => b.len(),
+            Self::Int32(b) => b.len(),
+            Self::Float64(b) => b.len(),
+            Self::Boolean(b) => b.len(),
+            Self::TimestampMs(b) => b.len(),
+            Self::Date32(b) => b.len(),
+            Self::Unsupported { len, .. } => *len,
+        }
+    }
+
+    /// Append a cell, converting it to the column type. Values that cannot be
+    /// represented in the column become null, as the JSON conversion always did.
+    fn append(&mut self, cell: Cell<'_>) {
+        match self {
+            Self::Utf8(b) => match cell {
+                Cell::Null => b.append_null(),
+                Cell::Text(s) => b.append_value(s),
+                Cell::Int(i) => b.append_value(i.to_string()),
+                Cell::Real(f) => b.append_value(f.to_string()),
+                Cell::Bool(v) => b.append_value(if v { "true" } else { "false" }),
+            },
+            Self::Int64(b) => b.append_option(cell_to_i64(cell)),
+            Self::Int32(b) => b.append_option(cell_to_i64(cell).and_then(|i| i32::try_from(i).ok())),
+            Self::Float64(b) => b.append_option(match cell {
+                Cell::Int(i) => Some(i as f64),
+                Cell::Real(f) => Some(f),
+                Cell::Text(s) => s.trim().parse().ok(),
+                Cell::Null | Cell::Bool(_) => None,
+            }),
+            Self::Boolean(b) => b.append_option(match cell {
+                Cell::Bool(v) => Some(v),
+                Cell::Int(i) => Some(i != 0),
+                Cell::Text(s) => match s.trim() {
+                    "true" | "1" => Some(true),
+                    "false" | "0" => Some(false),
+                    _ => None,
+                },
+                Cell::Null | Cell::Real(_) => None,
+            }),
+            Self::TimestampMs(b) => b.append_option(match cell {
+                Cell::Int(ms) => Some(ms),
+                Cell::Text(s) => DateTime::parse_from_rfc3339(s).ok().map(|dt| dt.timestamp_millis()),
+                Cell::Null | Cell::Real(_) | Cell::Bool(_) => None,
+            }),
+            Self::Date32(b) => b.append_option(match cell {
+                Cell::Text(s) => parse_date32(s),
+                _ => None,
+            }),
+            Self::Unsupported { len, .. } => *len += 1,
+        }
+    }
+
+    fn finish(&mut self) -> ArrayRef {
+        match self {
+            Self::Utf8(b) => Arc::new(b.finish()),
+            Self::Int64(b) => Arc::new(b.finish()),
+            Self::Int32(b) => Arc::new(b.finish()),
+            Self::Float64(b) => Arc::new(b.finish()),
+            Self::Boolean(b) => Arc::new(b.finish()),
+            Self::TimestampMs(b) => Arc::new(b.finish()),
+            Self::Date32(b) => Arc::new(b.finish()),
+            Self::Unsupported { data_type, len } => {
+                let array = new_null_array(data_type, *len);
+                *len = 0;
+                array
+            }
+        }
+    }
+}
+
+fn cell_to_i64(cell: Cell<'_>) -> Option<i64> {
+    match cell {
+        Cell::Int(i) => Some(i),
+        Cell::Bool(v) => Some(v as i64),
+        Cell::Text(s) => s.trim().parse().ok(),
+        Cell::Null | Cell::Real(_) => None,
+    }
+}
+
+/// Days since the epoch for `YYYY-MM-DD`, or for the date part of an RFC 3339 timestamp
+fn parse_date32(s: &str) -> Option<i32> {
+    let date = NaiveDate::parse_from_str(s.get(..10)?, "%Y-%m-%d").ok()?;
+    let epoch = NaiveDate::from_ymd_opt(1970, 1, 1)?;
+    i32::try_from(date.signed_duration_since(epoch).num_days()).ok()
+}
+
+/// The schema's columns as a SELECT list, in schema order, as
+/// `append_sqlite_row` expects them
+pub fn select_columns(schema: &SchemaRef) -> String {
+    schema
+        .fields()
+        .iter()
+        .map(|f| f.name().as_str())
+        .collect::<Vec<_>>()
+        .join(", ")
+}
+
+/// Row appender compiled for one export schema
+pub struct BatchAppender {
+    schema: SchemaRef,
+    columns: Vec<ColumnAppender>,
+    capacity: usize,
+}
+
+impl BatchAppender {
+    /// Compile `schema`, with builders sized for `capacity` rows per batch
+    pub fn compile(schema: SchemaRef, capacity: usize) -> Self {
+        let capacity = capacity.max(1);
+        let columns = Self::create_columns(&schema, capacity);
+        Self { schema, columns, capacity }
+    }
+
+    fn create_columns(schema: &SchemaRef, capacity: usize) -> Vec<ColumnAppender> {
+        schema
+            .fields()
+            .iter()
+            .map(|field| ColumnAppender::new(field.data_type(), capacity))
+            .collect()
+    }
+
+    pub fn schema(&self) -> &SchemaRef {
+        &self.schema
+    }
+
+    /// Rows appended since the last `finish`
+    pub fn len(&self) -> usize {
+        self.columns.first().map_or(0, ColumnAppender::len)
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+
+    /// Whether the batch reached the capacity it was sized for
+    pub fn is_full(&self) -> bool {
+        self.len() >= self.capacity
+    }
+
+    /// Append a row whose columns are the schema's, in schema order (see
+    /// `select_columns`). Values are read by their storage class.
+    pub fn append_sqlite_row(&mut self, row: &SqliteRow) -> Result<(), ExportError> {
+        if row.len() < self.columns.len() {
+            return Err(ExportError::Schema(format!(
+                "Row has {} columns, schema expects {}",
+                row.len(),
+                self.columns.len()
+            )));
+        }
+
+        for (i, column) in self.columns.iter_mut().enumerate() {
+            let raw = row.try_get_raw(i).map_err(|e| ExportError::Database(e.to_string()))?;
+            if raw.is_null() {
+                column.append(Cell::Null);
+                continue;
+            }
+            let decoded = match raw.type_info().name() {
+                "INTEGER" => row.try_get_unchecked::<i64, _>(i).map(|v| column.append(Cell::Int(v))),
+                "REAL" => row.try_get_unchecked::<f64, _>(i).map(|v| column.append(Cell::Real(v))),
+                "BLOB" => row
+                    .try_get_unchecked::<&[u8], _>(i)
+                    .map(|v| column.append(Cell::Text(&hex::encode(v)))),
+                _ => row.try_get_unchecked::<&str, _>(i).map(|v| column.append(Cell::Text(v))),
+            };
+            decoded.map_err(|e| ExportError::Database(e.to_string()))?;
+        }
+        Ok(())
+    }
+
+    /// Append a JSON object, looking each schema field up by name. Missing
+    /// fields are null; nested values are written as their JSON text.
+    pub fn append_json(&mut self, entity: &serde_json::Value) {
+        use serde_json::Value;
+
+        for (field, column) in self.schema.fields().iter().zip(self.columns.iter_mut()) {
+            match entity.get(field.name()) {
+                None | Some(Value::Null) => column.append(Cell::Null),
+                Some(Value::String(s)) => column.append(Cell::Text(s)),
+                Some(Value::Bool(b)) => column.append(Cell::Bool(*b)),
+                Some(Value::Number(n)) => match n.as_i64() {
+                    Some(i) => column.append(Cell::Int(i)),
+                    None => column.append(n.as_f64().map_or(Cell::Null, Cell::Real)),
+                },
+                Some(other) => column.append(Cell::Text(&other.to_string())),
+            }
+        }
+    }
+
+    /// Append one textual cell to a single column (the legacy per-cell interface)
+    pub fn append_text(&mut self, column_index: usize, value: &str) -> Result<(), ExportError> {
+        let column = self
+            .columns
+            .get_mut(column_index)
+            .ok_or_else(|| ExportError::Schema("Column index out of bounds".to_string()))?;
+        column.append(Cell::Text(value));
+        Ok(())
+    }
+
+    /// Build the batch from everything appended so far and start a new one
+    /// with builders of the same capacity
+    pub fn finish(&mut self) -> Result<RecordBatch, ExportError> {
+        let arrays: Vec<ArrayRef> = self.columns.iter_mut().map(ColumnAppender::finish).collect();
+        self.columns = Self::create_columns(&self.schema, self.capacity);
+        RecordBatch::try_new(self.schema.clone(), arrays).map_err(|e| ExportError::Schema(e.to_string()))
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use arrow::datatypes::{Field, Schema};
+
+    #[test]
+    fn json_values_land_in_typed_columns() {
+        let schema = Arc::new(Schema::new(vec![
+            Field::new("id", DataType::Utf8, true),
+            Field::new("status_id", DataType::Int64, true),
+            Field::new("target_value", DataType::Float64, true),
+            Field::new("disability", DataType::Boolean, true),
+            Field::new("start_date", DataType::Date32, true),
+        ]));
+        let mut appender = BatchAppender::compile(schema, 4);
+        appender.append_json(&serde_json::json!({
+            "id": "a", "status_id": 2, "target_value": 3, "disability": true, "start_date": "1970-01-11"
+        }));
+        appender.append_json(&serde_json::json!({ "id": "b", "target_value": 1.5 }));
+
+        let batch = appender.finish().unwrap();
+        assert_eq!(batch.num_rows(), 2);
+        let status = batch.column(1).as_any().downcast_ref::<Int64Array>().unwrap();
+        assert_eq!(status.value(0), 2);
+        assert!(status.is_null(1));
+        let target = batch.column(2).as_any().downcast_ref::<Float64Array>().unwrap();
+        assert_eq!((target.value(0), target.value(1)), (3.0, 1.5));
+        let date = batch.column(4).as_any().downcast_ref::<Date32Array>().unwrap();
+        assert_eq!(date.value(0), 10);
+        assert!(appender.is_empty());
+    }
+}
@@ -1,4 +1,5 @@
 pub mod parquet;
+pub mod columnar;
 
 pub use parquet::{
     get_cached_schema,
@@ -16,4 +17,5 @@ pub use parquet::{
     SchemaBuilder,
     create_minimal_schema,
     create_entity_schema_with_metadata,
-}; 
\ No newline at end of file
+};
+pub use columnar::{BatchAppender, select_columns}; 
\ No newline at end of file
@@ -2,11 +2,16 @@ use crate::domains::export::types::*;
 use crate::domains::export::writer::*;
 use crate::domains::export::writers::{csv_writer::*, parquet_writer::*};
 use crate::domains::export::schemas::parquet::get_cached_schema;
+use crate::domains::export::schemas::columnar::{BatchAppender, select_columns};
 use crate::domains::export::repository::{ExportJobRepository, TransactionalJobRepository};
 use crate::domains::export::repository_v2::{StreamingExportRepository, ExportEntity, SqliteStreamingRepository};
 use crate::domains::export::queue_manager::{ExportQueueManager, ExportJob as QueueJob, JobPriority};
 use crate::domains::export::ios::background_v2::ModernBackgroundExporter;
 use crate::domains::export::service::{export_strategic_goals_by_ids, create_zip_from_dir};
+use crate::domains::export::incremental::{export_incremental, incremental_domains, record_manifest};
+use crate::domains::export::unified::{
+    export_unified_parallel, unified_progress, UnifiedExportOptions, UnifiedExportStats, UNIFIED_FILE_NAME,
+};
 use crate::globals;
 use tempfile::TempDir;
 use crate::auth::AuthContext;
@@ -21,7 +26,7 @@ use std::sync::{Arc, Weak};
 use tokio::fs::File;
 use tokio::io::{AsyncWriteExt, BufWriter};
 use uuid::Uuid;
-use chrono::Utc;
+use chrono::{DateTime, Utc};
 use serde_json;
 use sqlx::{Transaction, Sqlite};
 use log;
@@ -29,6 +34,9 @@ use log;
 // Type alias for enhanced CSV writer that includes document metadata columns
 type EnhancedCsvWriterWithDocuments<W> = StreamingCsvWriter<W>;
 
+/// Record batches read directly from SQLite rows
+type RowBatchStream = std::pin::Pin<Box<dyn Stream<Item = Result<arrow::record_batch::RecordBatch, ExportError>> + Send>>;
+
 /// Trait for processing export jobs
 #[async_trait]
 pub trait JobProcessor: Send + Sync {
@@ -86,6 +94,40 @@ impl ExportServiceV2 {
         // Permission check
         auth.authorize(crate::types::Permission::ExportData)?;
 
+        let started = std::time::Instant::now();
+        let result = self.dispatch_export(request, auth).await;
+        let outcome = match &result {
+            Ok(summary) if summary.job.status == ExportStatus::Completed => crate::metrics::ExportOutcome::Completed(
+                summary.job.total_entities.unwrap_or(0).max(0) as u64,
+                summary.job.total_bytes.unwrap_or(0).max(0) as u64,
+            ),
+            Ok(summary) if summary.job.status == ExportStatus::Failed => crate::metrics::ExportOutcome::Failed,
+            Ok(_) => crate::metrics::ExportOutcome::Queued,
+            Err(_) => crate::metrics::ExportOutcome::Failed,
+        };
+        crate::metrics::record_export(started.elapsed(), outcome);
+        result
+    }
+
+    /// Run an authorized export directly, or queue it when it is large
+    async fn dispatch_export(
+        &self,
+        request: ExportRequest,
+        auth: &AuthContext,
+    ) -> ServiceResult<ExportSummary> {
+        // Delta exports read from the recorded high-water marks, whatever the filters
+        if request.mode == ExportMode::Incremental {
+            return self.export_incremental(request, auth).await;
+        }
+
+        // All-domain exports fan out over the domains themselves
+        if let Some(options) = unified_options(&request) {
+            if !matches!(request.format, None | Some(ExportFormat::JsonLines)) {
+                return Err(ServiceError::ValidationError("Unified exports are only available as JSON Lines".to_string()));
+            }
+            return self.export_unified(request, options, auth).await;
+        }
+
         // For simple exports (single filter, small data), execute directly
         // This avoids the complex queue system that's causing hangs
         if self.should_execute_directly(&request) {
@@ -129,6 +171,236 @@ impl ExportServiceV2 {
         })
     }
 
+    /// Run a unified export directly, reading domains in parallel. A job row is
+    /// created first so `get_export_status` can report progress while it runs.
+    async fn export_unified(
+        &self,
+        request: ExportRequest,
+        options: UnifiedExportOptions,
+        auth: &AuthContext,
+    ) -> ServiceResult<ExportSummary> {
+        let mut job = ExportJob {
+            id: Uuid::new_v4(),
+            requested_by_user_id: Some(auth.user_id),
+            requested_at: Utc::now(),
+            include_blobs: request.include_blobs,
+            status: ExportStatus::Running,
+            local_path: None,
+            total_entities: None,
+            total_bytes: None,
+            error_message: None,
+        };
+        self.job_repo.create_job(&job).await
+            .map_err(|e| ServiceError::InternalError(e.to_string()))?;
+
+        match self.run_unified_export(job.id, &request, options).await {
+            Ok((path, stats)) => {
+                let local_path = path.to_string_lossy().to_string();
+                self.job_repo.update_status(
+                    job.id,
+                    ExportStatus::Completed,
+                    None,
+                    Some(local_path.clone()),
+                    Some(stats.entities_written as i64),
+                    Some(stats.bytes_written as i64),
+                ).await.map_err(ServiceError::Domain)?;
+
+                job.status = ExportStatus::Completed;
+                job.local_path = Some(local_path);
+                job.total_entities = Some(stats.entities_written as i64);
+                job.total_bytes = Some(stats.bytes_written as i64);
+                log::info!("Unified export completed: {} entities, {} bytes", stats.entities_written, stats.bytes_written);
+                Ok(ExportSummary { job })
+            }
+            Err(e) => {
+                if let Err(update_err) = self.job_repo.update_status(
+                    job.id, ExportStatus::Failed, Some(e.to_string()), None, None, None,
+                ).await {
+                    log::error!("Failed to record unified export failure for {}: {}", job.id, update_err);
+                }
+                Err(e)
+            }
+        }
+    }
+
+    /// Run an incremental export: the changes since the last successful one
+    /// as JSON Lines plus deletions and a manifest, packed into a ZIP. The
+    /// requested format is not used, and document files are never included.
+    /// The high-water marks only advance once the ZIP is written.
+    async fn export_incremental(
+        &self,
+        request: ExportRequest,
+        auth: &AuthContext,
+    ) -> ServiceResult<ExportSummary> {
+        let domains = incremental_domains(&request.filters)?;
+        if request.include_blobs {
+            log::warn!("Incremental exports do not include document files; include_blobs ignored");
+        }
+
+        let mut job = ExportJob {
+            id: Uuid::new_v4(),
+            requested_by_user_id: Some(auth.user_id),
+            requested_at: Utc::now(),
+            include_blobs: false,
+            status: ExportStatus::Running,
+            local_path: None,
+            total_entities: None,
+            total_bytes: None,
+            error_message: None,
+        };
+        self.job_repo.create_job(&job).await
+            .map_err(|e| ServiceError::InternalError(e.to_string()))?;
+
+        match self.run_incremental_export(job.id, &request, &domains).await {
+            Ok((path, records, bytes)) => {
+                let local_path = path.to_string_lossy().to_string();
+                self.job_repo.update_status(
+                    job.id,
+                    ExportStatus::Completed,
+                    None,
+                    Some(local_path.clone()),
+                    Some(records as i64),
+                    Some(bytes as i64),
+                ).await.map_err(ServiceError::Domain)?;
+
+                job.status = ExportStatus::Completed;
+                job.local_path = Some(local_path);
+                job.total_entities = Some(records as i64);
+                job.total_bytes = Some(bytes as i64);
+                log::info!("Incremental export completed: {} records over {} domains, {} bytes", records, domains.len(), bytes);
+                Ok(ExportSummary { job })
+            }
+            Err(e) => {
+                if let Err(update_err) = self.job_repo.update_status(
+                    job.id, ExportStatus::Failed, Some(e.to_string()), None, None, None,
+                ).await {
+                    log::error!("Failed to record incremental export failure for {}: {}", job.id, update_err);
+                }
+                Err(e)
+            }
+        }
+    }
+
+    /// Write the delta files, zip them and record the new marks.
+    /// Returns the ZIP path, the records written and the ZIP size.
+    async fn run_incremental_export(
+        &self,
+        job_id: Uuid,
+        request: &ExportRequest,
+        domains: &[&'static str],
+    ) -> ServiceResult<(PathBuf, u64, u64)> {
+        let read_pool = globals::get_db_read_pool()
+            .map_err(|e| ServiceError::InternalError(format!("Failed to get database read pool: {}", e)))?;
+        let tombstones = globals::get_tombstone_repo()
+            .map_err(|e| ServiceError::InternalError(format!("Failed to get tombstone repository: {}", e)))?;
+        let temp_dir = TempDir::new()
+            .map_err(|e| ServiceError::InternalError(format!("Failed to create temp directory: {}", e)))?;
+
+        let manifest = export_incremental(&read_pool, tombstones.as_ref(), job_id, temp_dir.path(), domains).await?;
+
+        let zip_name = format!("incremental_export_{}.zip", job_id);
+        let output_path = match &request.target_path {
+            Some(path) if path.is_dir() => path.join(&zip_name),
+            Some(path) => path.clone(),
+            None => PathBuf::from(&zip_name),
+        };
+        create_zip_from_dir(temp_dir.path(), &output_path)
+            .map_err(|e| ServiceError::InternalError(format!("Failed to create zip: {}", e)))?;
+        let bytes = tokio::fs::metadata(&output_path).await.map(|m| m.len()).unwrap_or(0);
+
+        let pool = globals::get_db_pool()
+            .map_err(|e| ServiceError::InternalError(format!("Failed to get database pool: {}", e)))?;
+        record_manifest(&pool, &manifest).await?;
+        Ok((output_path, manifest.total_records(), bytes))
+    }
+
+    /// Write the unified export; with `include_blobs` the JSONL and the
+    /// document files are packed into a ZIP.
+    async fn run_unified_export(
+        &self,
+        job_id: Uuid,
+        request: &ExportRequest,
+        options: UnifiedExportOptions,
+    ) -> ServiceResult<(PathBuf, UnifiedExportStats)> {
+        let pool = globals::get_db_read_pool()
+            .map_err(|e| ServiceError::InternalError(format!("Failed to get database read pool: {}", e)))?;
+        let temp_dir = TempDir::new()
+            .map_err(|e| ServiceError::InternalError(format!("Failed to create temp directory: {}", e)))?;
+
+        let stats = export_unified_parallel(&pool, job_id, temp_dir.path(), options).await?;
+
+        if !request.include_blobs {
+            let output_path = match &request.target_path {
+                Some(path) if path.is_dir() => path.join(format!("unified_export_{}.jsonl", job_id)),
+                Some(path) => path.clone(),
+                None => self.generate_export_path(&ExportRequest { format: Some(ExportFormat::JsonLines), ..request.clone() }),
+            };
+            let unified = temp_dir.path().join(UNIFIED_FILE_NAME);
+            if tokio::fs::rename(&unified, &output_path).await.is_err() {
+                // Different volume: copy instead
+                tokio::fs::copy(&unified, &output_path).await
+                    .map_err(|e| ServiceError::InternalError(format!("Failed to write export file: {}", e)))?;
+            }
+            return Ok((output_path, stats));
+        }
+
+        self.copy_all_document_files(&pool, &temp_dir.path().join("blobs"), options.date_range).await?;
+
+        let zip_name = format!("{}.zip", job_id);
+        let output_path = match &request.target_path {
+            Some(path) if path.is_dir() => path.join(&zip_name),
+            Some(path) => path.clone(),
+            None => PathBuf::from(&zip_name),
+        };
+        create_zip_from_dir(temp_dir.path(), &output_path)
+            .map_err(|e| ServiceError::InternalError(format!("Failed to create zip: {}", e)))?;
+        Ok((output_path, stats))
+    }
+
+    /// Copy the best available file (compressed when done) of every active
+    /// document into `dest_dir`; with a date range, only of the documents the
+    /// export's rows include
+    async fn copy_all_document_files(
+        &self,
+        pool: &sqlx::SqlitePool,
+        dest_dir: &Path,
+        date_range: Option<(DateTime<Utc>, DateTime<Utc>)>,
+    ) -> ServiceResult<u64> {
+        tokio::fs::create_dir_all(dest_dir).await
+            .map_err(|e| ServiceError::InternalError(format!("Failed to create blobs directory: {}", e)))?;
+
+        let date_clause = if date_range.is_some() { " AND updated_at >= ? AND updated_at <= ?" } else { "" };
+        let sql = format!(
+            "SELECT id, file_path, compressed_file_path, compression_status, original_filename
+             FROM media_documents WHERE deleted_at IS NULL{}",
+            date_clause
+        );
+        let mut query = sqlx::query_as::<_, (String, String, Option<String>, Option<String>, String)>(&sql);
+        if let Some((start, end)) = date_range {
+            query = query.bind(start.to_rfc3339()).bind(end.to_rfc3339());
+        }
+        let rows = query
+            .fetch_all(pool)
+            .await
+            .map_err(|e| ServiceError::DatabaseError(e.to_string()))?;
+
+        let mut copied = 0u64;
+        for (id, file_path, compressed_file_path, compression_status, original_filename) in rows {
+            let compressed = compressed_file_path
+                .filter(|_| compression_status.as_deref() == Some("completed"))
+                .map(|p| self.file_storage.get_absolute_path(&p))
+                .filter(|p| p.exists());
+            let source = compressed.unwrap_or_else(|| self.file_storage.get_absolute_path(&file_path));
+            // Prefix with the id so equal file names from different documents do not collide
+            let target = dest_dir.join(format!("{}_{}", id, original_filename));
+            match tokio::fs::copy(&source, &target).await {
+                Ok(_) => copied += 1,
+                Err(e) => log::error!("Failed to copy document {} ({}): {}", id, source.display(), e),
+            }
+        }
+        Ok(copied)
+    }
+
     /// Determine if we should execute export directly instead of queuing
     fn should_execute_directly(&self, request: &ExportRequest) -> bool {
         // Set strict limits for performance and stability
@@ -573,11 +845,15 @@ impl ExportServiceV2 {
         // Get schema for the primary domain being exported
         let schema = self.get_schema_for_filters(&request.filters)?;
         
-        let mut writer = IOSParquetWriter::new_ios_optimized(&output_path, schema).await
+        let mut writer = IOSParquetWriter::new_ios_optimized(&output_path, schema.clone()).await
             .map_err(|e| ServiceError::InternalError(e.to_string()))?;
 
-        // Create Arrow RecordBatch stream for Parquet writer
-        let arrow_stream = self.create_arrow_stream(&request.filters, progress_tx).await?;
+        // Create Arrow RecordBatch stream for Parquet writer: straight from
+        // SQLite rows where the schema is a projection of the table
+        let arrow_stream = match Self::create_row_arrow_stream(&request.filters, schema.clone(), progress_tx.clone())? {
+            Some(rows) => rows.left_stream(),
+            None => self.create_arrow_stream(&request.filters, progress_tx).await?.right_stream(),
+        };
         
         // Use the streaming interface to write Arrow batches
         let stats = writer.write_batch_stream(Box::new(arrow_stream)).await
@@ -1433,147 +1709,104 @@ impl ExportServiceV2 {
         Ok(arrow_stream)
     }
     
+    /// Arrow RecordBatch stream read directly from SQLite rows, for domains
+    /// whose Parquet schema only holds table columns. Rows are appended by
+    /// storage class into builders sized for the device's Parquet batch size.
+    /// Returns `None` for filters that need the JSON entity stream.
+    fn create_row_arrow_stream(
+        filters: &[EntityFilter],
+        schema: Arc<arrow::datatypes::Schema>,
+        progress_tx: mpsc::Sender<ExportProgress>,
+    ) -> ServiceResult<Option<RowBatchStream>> {
+        let (table, ids) = match filters.first() {
+            Some(EntityFilter::ParticipantsAll) => ("participants", None),
+            Some(EntityFilter::ParticipantsByIds { ids }) => ("participants", Some(ids)),
+            Some(EntityFilter::ActivitiesAll) => ("activities", None),
+            Some(EntityFilter::ActivitiesByIds { ids }) => ("activities", Some(ids)),
+            _ => return Ok(None),
+        };
+        let pool = globals::get_db_read_pool()
+            .map_err(|e| ServiceError::InternalError(format!("Failed to get database read pool: {}", e)))?;
+
+        let ids_json = match ids {
+            Some(ids) => Some(serde_json::to_string(&ids.iter().map(Uuid::to_string).collect::<Vec<_>>())
+                .map_err(|e| ServiceError::InternalError(e.to_string()))?),
+            None => None,
+        };
+        let sql = format!(
+            "SELECT {} FROM {} WHERE deleted_at IS NULL{} AND id > ? ORDER BY id LIMIT ?",
+            select_columns(&schema),
+            table,
+            if ids_json.is_some() { " AND id IN (SELECT value FROM json_each(?))" } else { "" },
+        );
+        let batch_size = default_parquet_batch_size().max(1);
+        let job_id = Uuid::new_v4();
+        let id_column = schema.index_of("id")
+            .map_err(|e| ServiceError::InternalError(format!("Row export schema has no id column: {}", e)))?;
+
+        let state = (String::new(), 0u64, false, BatchAppender::compile(schema, batch_size));
+        let batches = futures::stream::try_unfold(state, move |(mut cursor, mut processed, done, mut appender)| {
+            let pool = pool.clone();
+            let sql = sql.clone();
+            let ids_json = ids_json.clone();
+            let progress_tx = progress_tx.clone();
+            async move {
+                if done {
+                    return Ok(None);
+                }
+                let mut query = sqlx::query(&sql);
+                if let Some(ids_json) = &ids_json {
+                    query = query.bind(ids_json);
+                }
+                let rows = query
+                    .bind(&cursor)
+                    .bind(batch_size as i64)
+                    .fetch_all(&pool)
+                    .await
+                    .map_err(|e| ExportError::Database(e.to_string()))?;
+                let Some(last) = rows.last() else {
+                    return Ok(None);
+                };
+                cursor = sqlx::Row::try_get::<String, _>(last, id_column)
+                    .map_err(|e| ExportError::Database(e.to_string()))?;
+                for row in &rows {
+                    appender.append_sqlite_row(row)?;
+                }
+                let batch = appender.finish()?;
+
+                processed += rows.len() as u64;
+                let _ = progress_tx.try_send(ExportProgress {
+                    job_id,
+                    completed_bytes: 0,
+                    total_bytes: 0,
+                    entities_processed: processed,
+                    current_domain: table.to_string(),
+                    estimated_time_remaining: 0.0,
+                    status: ExportStatus::Running,
+                });
+
+                let done = rows.len() < batch_size;
+                Ok(Some((batch, (cursor, processed, done, appender))))
+            }
+        });
+
+        Ok(Some(Box::pin(batches)))
+    }
+    
     /// Convert JSON entities to Arrow RecordBatch
     fn json_entities_to_record_batch(
         entities: &[serde_json::Value],
         schema: Arc<arrow::datatypes::Schema>,
     ) -> Result<arrow::record_batch::RecordBatch, Box<dyn std::error::Error + Send + Sync>> {
-        use arrow::array::*;
-        use arrow::datatypes::DataType;
-        use arrow::record_batch::RecordBatch;
-        
         if entities.is_empty() {
             return Err("No entities to convert".into());
         }
         
-        let mut arrays: Vec<ArrayRef> = Vec::new();
-        
-        // Build arrays for each field in the schema
-        for field in schema.fields() {
-            let field_name = field.name();
-            
-            match field.data_type() {
-                DataType::Utf8 => {
-                    let mut builder = StringBuilder::new();
-                    for entity in entities {
-                        if let Some(value) = entity.get(field_name) {
-                            match value {
-                                serde_json::Value::String(s) => builder.append_value(s),
-                                serde_json::Value::Null => builder.append_null(),
-                                _ => builder.append_value(&value.to_string()),
-                            }
-                        } else {
-                            builder.append_null();
-                        }
-                    }
-                    arrays.push(Arc::new(builder.finish()));
-                }
-                DataType::Int64 => {
-                    let mut builder = Int64Builder::new();
-                    for entity in entities {
-                        if let Some(value) = entity.get(field_name) {
-                            match value {
-                                serde_json::Value::Number(n) => {
-                                    if let Some(i) = n.as_i64() {
-                                        builder.append_value(i);
-                                    } else {
-                                        builder.append_null();
-                                    }
-                                }
-                                serde_json::Value::Null => builder.append_null(),
-                                _ => builder.append_null(),
-                            }
-                        } else {
-                            builder.append_null();
-                        }
-                    }
-                    arrays.push(Arc::new(builder.finish()));
-                }
-                DataType::Float64 => {
-                    let mut builder = Float64Builder::new();
-                    for entity in entities {
-                        if let Some(value) = entity.get(field_name) {
-                            match value {
-                                serde_json::Value::Number(n) => {
-                                    if let Some(f) = n.as_f64() {
-                                        builder.append_value(f);
-                                    } else {
-                                        builder.append_null();
-                                    }
-                                }
-                                serde_json::Value::Null => builder.append_null(),
-                                _ => builder.append_null(),
-                            }
-                        } else {
-                            builder.append_null();
-                        }
-                    }
-                    arrays.push(Arc::new(builder.finish()));
-                }
-                DataType::Boolean => {
-                    let mut builder = BooleanBuilder::new();
-                    for entity in entities {
-                        if let Some(value) = entity.get(field_name) {
-                            match value {
-                                serde_json::Value::Bool(b) => builder.append_value(*b),
-                                serde_json::Value::Null => builder.append_null(),
-                                _ => builder.append_null(),
-                            }
-                        } else {
-                            builder.append_null();
-                        }
-                    }
-                    arrays.push(Arc::new(builder.finish()));
-                }
-                DataType::Timestamp(arrow::datatypes::TimeUnit::Millisecond, _) => {
-                    let mut builder = TimestampMillisecondBuilder::new();
-                    for entity in entities {
-                        if let Some(value) = entity.get(field_name) {
-                            match value {
-                                serde_json::Value::String(s) => {
-                                    // Try to parse ISO 8601 timestamp
-                                    if let Ok(dt) = chrono::DateTime::parse_from_rfc3339(s) {
-                                        builder.append_value(dt.timestamp_millis());
-                                    } else {
-                                        builder.append_null();
-                                    }
-                                }
-                                serde_json::Value::Number(n) => {
-                                    // Assume it's already a timestamp in milliseconds
-                                    if let Some(ts) = n.as_i64() {
-                                        builder.append_value(ts);
-                                    } else {
-                                        builder.append_null();
-                                    }
-                                }
-                                serde_json::Value::Null => builder.append_null(),
-                                _ => builder.append_null(),
-                            }
-                        } else {
-                            builder.append_null();
-                        }
-                    }
-                    arrays.push(Arc::new(builder.finish()));
-                }
-                _ => {
-                    // Fallback to string for unknown types
-                    let mut builder = StringBuilder::new();
-                    for entity in entities {
-                        if let Some(value) = entity.get(field_name) {
-                            match value {
-                                serde_json::Value::Null => builder.append_null(),
-                                _ => builder.append_value(&value.to_string()),
-                            }
-                        } else {
-                            builder.append_null();
-                        }
-                    }
-                    arrays.push(Arc::new(builder.finish()));
-                }
-            }
+        let mut appender = BatchAppender::compile(schema, entities.len());
+        for entity in entities {
+            appender.append_json(entity);
         }
-        
-        RecordBatch::try_new(schema, arrays).map_err(|e| e.into())
+        appender.finish().map_err(|e| e.to_string().into())
     }
     
     /// Create enhanced Arrow stream with document metadata for Parquet ZIP exports
@@ -1680,9 +1913,14 @@ impl ExportServiceV2 {
             .map_err(|e| ServiceError::InternalError(e.to_string()))
     }
     
-    /// Get the status of an export job by ID
+    /// Get the status of an export job by ID. While a unified export runs, the
+    /// totals reflect what its domains have written so far.
     pub async fn get_export_status(&self, export_id: Uuid) -> ServiceResult<ExportSummary> {
-        let job = self.job_repo.find_by_id(export_id).await.map_err(ServiceError::Domain)?;
+        let mut job = self.job_repo.find_by_id(export_id).await.map_err(ServiceError::Domain)?;
+        if let Some(progress) = unified_progress(export_id) {
+            job.total_entities = Some(progress.entities_written as i64);
+            job.total_bytes = Some(progress.bytes_written as i64);
+        }
         Ok(ExportSummary { job })
     }
     
@@ -1702,6 +1940,9 @@ impl ExportServiceV2 {
                 EntityFilter::ParticipantsAll | EntityFilter::ParticipantsByIds { .. } => {
                     return self.create_dynamic_participants_schema();
                 }
+                EntityFilter::ActivitiesAll | EntityFilter::ActivitiesByIds { .. } => {
+                    return self.create_dynamic_activities_schema();
+                }
                 EntityFilter::WorkshopsAll { .. } => {
                     return self.create_dynamic_workshops_schema();
                 }
@@ -1822,6 +2063,33 @@ impl ExportServiceV2 {
         Ok(Arc::new(Schema::new(fields)))
     }
     
+    /// Create dynamic schema for activities
+    fn create_dynamic_activities_schema(&self) -> ServiceResult<Arc<arrow::datatypes::Schema>> {
+        use arrow::datatypes::{DataType, Field, Schema};
+        
+        let fields = vec![
+            Arc::new(Field::new("id", DataType::Utf8, true)),
+            Arc::new(Field::new("project_id", DataType::Utf8, true)),
+            Arc::new(Field::new("description", DataType::Utf8, true)),
+            Arc::new(Field::new("kpi", DataType::Utf8, true)),
+            Arc::new(Field::new("target_value", DataType::Float64, true)),
+            Arc::new(Field::new("actual_value", DataType::Float64, true)),
+            Arc::new(Field::new("status_id", DataType::Int64, true)),
+            Arc::new(Field::new("sync_priority", DataType::Utf8, true)),
+            Arc::new(Field::new("created_at", DataType::Utf8, true)),
+            Arc::new(Field::new("updated_at", DataType::Utf8, true)),
+            Arc::new(Field::new("created_by_user_id", DataType::Utf8, true)),
+            Arc::new(Field::new("created_by_device_id", DataType::Utf8, true)),
+            Arc::new(Field::new("updated_by_user_id", DataType::Utf8, true)),
+            Arc::new(Field::new("updated_by_device_id", DataType::Utf8, true)),
+            Arc::new(Field::new("deleted_at", DataType::Utf8, true)),
+            Arc::new(Field::new("deleted_by_user_id", DataType::Utf8, true)),
+            Arc::new(Field::new("deleted_by_device_id", DataType::Utf8, true)),
+        ];
+        
+        Ok(Arc::new(Schema::new(fields)))
+    }
+    
     /// Get entity count for progress estimation
     async fn get_entity_count(&self, filters: &[EntityFilter]) -> ServiceResult<usize> {
         if let Some(filter) = filters.first() {
@@ -2220,6 +2488,21 @@ impl ExportServiceV2 {
     }
 }
 
+/// The unified export options of a request consisting of one unified filter
+fn unified_options(request: &ExportRequest) -> Option<UnifiedExportOptions> {
+    match request.filters.as_slice() {
+        [EntityFilter::UnifiedAllDomains { include_type_tags }] => Some(UnifiedExportOptions {
+            date_range: None,
+            include_type_tags: *include_type_tags,
+        }),
+        [EntityFilter::UnifiedByDateRange { start_date, end_date, include_type_tags }] => Some(UnifiedExportOptions {
+            date_range: Some((*start_date, *end_date)),
+            include_type_tags: *include_type_tags,
+        }),
+        _ => None,
+    }
+}
+
 /// Export progress information
 #[derive(Debug, Clone)]
 pub struct ExportProgress {
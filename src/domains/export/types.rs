@@ -139,6 +139,20 @@ impl ExportFormat {
     }
 }
 
+/// Whether an export covers whole tables or only their changes
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Default, Serialize, Deserialize)]
+#[serde(rename_all = "camelCase")]
+pub enum ExportMode {
+    /// Every active row of the selected domains
+    #[default]
+    #[serde(alias = "Full")]
+    Full,
+    /// Rows changed since the last successful incremental export of each
+    /// domain, plus the deletions since then (see `export::incremental`)
+    #[serde(alias = "Incremental")]
+    Incremental,
+}
+
 /// Parquet compression options
 #[derive(Debug, Clone, PartialEq, Eq, Serialize, Deserialize)]
 pub enum ParquetCompression {
@@ -304,6 +318,9 @@ pub struct ExportRequest {
     pub format: Option<ExportFormat>, // New field for format selection
     pub use_compression: bool,
     pub use_background: bool,
+    /// Full or incremental; JSON without this field means a full export
+    #[serde(default)]
+    pub mode: ExportMode,
 }
 
 /// Summary returned to the caller after `create_export` or `get_export_status`.
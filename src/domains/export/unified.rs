@@ -0,0 +1,402 @@
+//! Unified (all-domain) export.
+//!
+//! Every domain table is read with its own keyset-paged cursor on the read
+//! pool and streamed into its own part file; several domains run at once, as
+//! many as the device tier allows and the thermal state permits. Rows go
+//! through the domain's row type and entity, so records serialize exactly as
+//! the domain APIs return them. The part files are then concatenated in a
+//! fixed domain order into `unified_export.jsonl`, so the output does not
+//! depend on which domain finished first. Unified exports are JSON Lines
+//! only; the records of different domains share no column layout.
+//!
+//! Progress of running exports is kept in a process-wide registry keyed by
+//! export job id, which `ExportServiceV2::get_export_status` reads.
+
+use crate::domains::activity::types::{Activity, ActivityRow};
+use crate::domains::document::types::{MediaDocument, MediaDocumentRow};
+use crate::domains::donor::types::{Donor, DonorRow};
+use crate::domains::export::ios::memory::{DeviceCapabilities, ThermalMonitor};
+use crate::domains::export::types::{DeviceTier, ThermalState};
+use crate::domains::funding::types::{ProjectFunding, ProjectFundingRow};
+use crate::domains::livelihood::types::{Livelihood, LivelihoodRow};
+use crate::domains::participant::types::{Participant, ParticipantRow};
+use crate::domains::project::types::{Project, ProjectRow};
+use crate::domains::strategic_goal::types::{StrategicGoal, StrategicGoalRow};
+use crate::domains::workshop::types::{Workshop, WorkshopRow};
+use crate::errors::{DomainResult, ServiceError, ServiceResult};
+use chrono::{DateTime, Utc};
+use futures::stream::{self, StreamExt, TryStreamExt};
+use serde::Serialize;
+use sqlx::sqlite::SqliteRow;
+use sqlx::{Column, FromRow, Row, SqlitePool, TypeInfo, ValueRef};
+use std::collections::HashMap;
+use std::path::{Path, PathBuf};
+use std::sync::{Arc, Mutex, OnceLock};
+use tokio::fs::File;
+use tokio::io::{AsyncWriteExt, BufWriter};
+use uuid::Uuid;
+
+/// Rows fetched per page and domain
+const UNIFIED_PAGE_SIZE: i64 = 500;
+
+/// Name of the combined output inside the export directory
+pub const UNIFIED_FILE_NAME: &str = "unified_export.jsonl";
+
+/// A domain's row type and the entity it converts into
+trait UnifiedRow: for<'r> FromRow<'r, SqliteRow> {
+    type Entity: Serialize;
+    fn entity(self) -> DomainResult<Self::Entity>;
+}
+
+macro_rules! unified_rows {
+    ($($row:ty => $entity:ty),* $(,)?) => {
+        $(impl UnifiedRow for $row {
+            type Entity = $entity;
+            fn entity(self) -> DomainResult<$entity> {
+                self.into_entity()
+            }
+        })*
+    };
+}
+
+unified_rows! {
+    StrategicGoalRow => StrategicGoal,
+    ProjectRow => Project,
+    ActivityRow => Activity,
+    DonorRow => Donor,
+    ProjectFundingRow => ProjectFunding,
+    LivelihoodRow => Livelihood,
+    ParticipantRow => Participant,
+    WorkshopRow => Workshop,
+    MediaDocumentRow => MediaDocument,
+}
+
+/// Serializes one row as a JSONL record, with or without a type tag
+type EncodeFn = fn(&SqliteRow, Option<&str>) -> ServiceResult<String>;
+
+/// One exported domain: type tag written with each record, its table, the
+/// columns its row type reads, and how a row becomes a record
+struct UnifiedDomain {
+    tag: &'static str,
+    table: &'static str,
+    columns: &'static str,
+    encode: EncodeFn,
+}
+
+/// Export order of the combined file (same as the legacy sequential export)
+const UNIFIED_DOMAINS: &[UnifiedDomain] = &[
+    UnifiedDomain { tag: "strategic_goal", table: "strategic_goals", columns: "*", encode: encode_row::<StrategicGoalRow> },
+    UnifiedDomain { tag: "project", table: "projects", columns: "*", encode: encode_row::<ProjectRow> },
+    UnifiedDomain { tag: "activity", table: "activities", columns: "*", encode: encode_row::<ActivityRow> },
+    // DonorRow and LivelihoodRow name the `type` column `type_`; donors have
+    // no per-field sync_priority metadata or last_sync_at column
+    UnifiedDomain {
+        tag: "donor",
+        table: "donors",
+        columns: "*, type AS type_, NULL AS sync_priority_updated_at, NULL AS sync_priority_updated_by, \
+                  NULL AS sync_priority_updated_by_device_id, NULL AS last_sync_at",
+        encode: encode_row::<DonorRow>,
+    },
+    UnifiedDomain { tag: "funding", table: "project_funding", columns: "*", encode: encode_row::<ProjectFundingRow> },
+    UnifiedDomain { tag: "livelihood", table: "livelihoods", columns: "*, type AS type_", encode: encode_row::<LivelihoodRow> },
+    UnifiedDomain { tag: "participant", table: "participants", columns: "*", encode: encode_row::<ParticipantRow> },
+    UnifiedDomain { tag: "workshop", table: "workshops", columns: "*", encode: encode_row::<WorkshopRow> },
+    UnifiedDomain { tag: "media_document", table: "media_documents", columns: "*", encode: encode_row::<MediaDocumentRow> },
+];
+
+/// A type-tagged record: `{"data": <entity>, "type": <tag>}`
+#[derive(Serialize)]
+struct TaggedRecord<'a, T> {
+    data: &'a T,
+    #[serde(rename = "type")]
+    kind: &'a str,
+}
+
+/// Decode `row` as `R` and serialize the entity it converts into
+fn encode_row<R: UnifiedRow>(row: &SqliteRow, tag: Option<&str>) -> ServiceResult<String> {
+    let entity = R::from_row(row)
+        .map_err(|e| ServiceError::DatabaseError(e.to_string()))?
+        .entity()
+        .map_err(ServiceError::Domain)?;
+    match tag {
+        Some(kind) => serde_json::to_string(&TaggedRecord { data: &entity, kind }),
+        None => serde_json::to_string(&entity),
+    }
+    .map_err(|e| ServiceError::InternalError(format!("Failed to serialize export record: {}", e)))
+}
+
+/// Tables of the unified export, in export order
+pub(crate) fn unified_tables() -> impl Iterator<Item = &'static str> {
+    UNIFIED_DOMAINS.iter().map(|d| d.table)
+}
+
+/// What to export
+#[derive(Debug, Clone, Copy)]
+pub struct UnifiedExportOptions {
+    pub date_range: Option<(DateTime<Utc>, DateTime<Utc>)>,
+    pub include_type_tags: bool,
+}
+
+/// Per-domain progress of a unified export
+#[derive(Debug, Clone, Serialize)]
+pub struct DomainProgress {
+    pub domain: &'static str,
+    pub entities_written: u64,
+    pub completed: bool,
+}
+
+/// Progress of a running unified export, as reported by `export_get_status`
+#[derive(Debug, Clone, Serialize)]
+pub struct UnifiedExportProgress {
+    pub entities_written: u64,
+    pub bytes_written: u64,
+    pub max_parallel_domains: usize,
+    pub domains: Vec<DomainProgress>,
+}
+
+/// Totals of a finished unified export
+#[derive(Debug, Clone, Copy, Default)]
+pub struct UnifiedExportStats {
+    pub entities_written: u64,
+    pub bytes_written: u64,
+}
+
+type SharedProgress = Arc<Mutex<UnifiedExportProgress>>;
+
+fn registry() -> &'static Mutex<HashMap<Uuid, SharedProgress>> {
+    static REGISTRY: OnceLock<Mutex<HashMap<Uuid, SharedProgress>>> = OnceLock::new();
+    REGISTRY.get_or_init(|| Mutex::new(HashMap::new()))
+}
+
+/// Snapshot of a running unified export's progress
+pub fn unified_progress(job_id: Uuid) -> Option<UnifiedExportProgress> {
+    let progress = registry().lock().unwrap().get(&job_id).cloned()?;
+    let snapshot = progress.lock().unwrap().clone();
+    Some(snapshot)
+}
+
+/// Removes the registry entry when the export ends, however it ends
+struct ProgressRegistration(Uuid);
+
+impl Drop for ProgressRegistration {
+    fn drop(&mut self) {
+        registry().lock().unwrap().remove(&self.0);
+    }
+}
+
+/// How many domains to read at once: by device tier, reduced under thermal pressure
+pub fn unified_domain_concurrency() -> usize {
+    let by_tier = match DeviceCapabilities::device_tier() {
+        DeviceTier::Basic => 1,
+        DeviceTier::Standard => 2,
+        DeviceTier::Pro => 3,
+        DeviceTier::Max => 4,
+    };
+    let limit = match ThermalMonitor::new().current_state() {
+        ThermalState::Nominal => by_tier,
+        ThermalState::Fair => by_tier / 2,
+        ThermalState::Serious | ThermalState::Critical => 1,
+    };
+    limit.clamp(1, UNIFIED_DOMAINS.len())
+}
+
+/// Export every domain into `dest_dir/unified_export.jsonl`
+pub async fn export_unified_parallel(
+    pool: &SqlitePool,
+    job_id: Uuid,
+    dest_dir: &Path,
+    options: UnifiedExportOptions,
+) -> ServiceResult<UnifiedExportStats> {
+    let concurrency = unified_domain_concurrency();
+    let progress: SharedProgress = Arc::new(Mutex::new(UnifiedExportProgress {
+        entities_written: 0,
+        bytes_written: 0,
+        max_parallel_domains: concurrency,
+        domains: UNIFIED_DOMAINS
+            .iter()
+            .map(|d| DomainProgress { domain: d.tag, entities_written: 0, completed: false })
+            .collect(),
+    }));
+    registry().lock().unwrap().insert(job_id, progress.clone());
+    let _registration = ProgressRegistration(job_id);
+
+    log::info!("Unified export {} reading {} domains, {} at a time", job_id, UNIFIED_DOMAINS.len(), concurrency);
+
+    let parts: Vec<PathBuf> = stream::iter(UNIFIED_DOMAINS.iter().enumerate())
+        .map(|(index, domain)| {
+            let progress = progress.clone();
+            async move {
+                let part = dest_dir.join(format!(".unified_{}.part", domain.table));
+                export_domain(pool, domain, index, &part, options, &progress).await?;
+                Ok::<_, ServiceError>(part)
+            }
+        })
+        .buffered(concurrency)
+        .try_collect()
+        .await?;
+
+    // Concatenate in domain order
+    let output = dest_dir.join(UNIFIED_FILE_NAME);
+    let mut writer = BufWriter::new(File::create(&output).await.map_err(io_error)?);
+    for part in &parts {
+        let mut reader = File::open(part).await.map_err(io_error)?;
+        tokio::io::copy(&mut reader, &mut writer).await.map_err(io_error)?;
+        let _ = tokio::fs::remove_file(part).await;
+    }
+    writer.flush().await.map_err(io_error)?;
+
+    let snapshot = progress.lock().unwrap().clone();
+    Ok(UnifiedExportStats {
+        entities_written: snapshot.entities_written,
+        bytes_written: snapshot.bytes_written,
+    })
+}
+
+/// Stream one domain into `part`, page by page in id order
+async fn export_domain(
+    pool: &SqlitePool,
+    domain: &UnifiedDomain,
+    index: usize,
+    part: &Path,
+    options: UnifiedExportOptions,
+    progress: &SharedProgress,
+) -> ServiceResult<()> {
+    let mut writer = BufWriter::new(File::create(part).await.map_err(io_error)?);
+    let date_clause = if options.date_range.is_some() { " AND updated_at >= ? AND updated_at <= ?" } else { "" };
+    let sql = format!(
+        "SELECT {} FROM {} WHERE deleted_at IS NULL{} AND id > ? ORDER BY id LIMIT ?",
+        domain.columns, domain.table, date_clause
+    );
+
+    let mut cursor = String::new();
+    loop {
+        let mut query = sqlx::query(&sql);
+        if let Some((start, end)) = options.date_range {
+            query = query.bind(start.to_rfc3339()).bind(end.to_rfc3339());
+        }
+        let rows = query
+            .bind(&cursor)
+            .bind(UNIFIED_PAGE_SIZE)
+            .fetch_all(pool)
+            .await
+            .map_err(|e| ServiceError::DatabaseError(e.to_string()))?;
+
+        let mut page_bytes = 0u64;
+        for row in &rows {
+            cursor = row.try_get("id").map_err(|e| ServiceError::DatabaseError(e.to_string()))?;
+            let mut line = (domain.encode)(row, options.include_type_tags.then_some(domain.tag))?;
+            line.push('\n');
+            writer.write_all(line.as_bytes()).await.map_err(io_error)?;
+            page_bytes += line.len() as u64;
+        }
+
+        {
+            let mut p = progress.lock().unwrap();
+            p.entities_written += rows.len() as u64;
+            p.bytes_written += page_bytes;
+            p.domains[index].entities_written += rows.len() as u64;
+        }
+
+        if (rows.len() as i64) < UNIFIED_PAGE_SIZE {
+            break;
+        }
+    }
+
+    writer.flush().await.map_err(io_error)?;
+    progress.lock().unwrap().domains[index].completed = true;
+    Ok(())
+}
+
+/// A row as a JSON object, by the storage class of each value
+pub(crate) fn row_to_json(row: &SqliteRow) -> serde_json::Map<String, serde_json::Value> {
+    use serde_json::Value;
+
+    let mut object = serde_json::Map::with_capacity(row.columns().len());
+    for column in row.columns() {
+        let i = column.ordinal();
+        let value = match row.try_get_raw(i) {
+            Ok(raw) if raw.is_null() => Value::Null,
+            Ok(raw) => match raw.type_info().name() {
+                "INTEGER" => row.try_get::<i64, _>(i).map(Value::from).unwrap_or(Value::Null),
+                "REAL" => row.try_get::<f64, _>(i).map(Value::from).unwrap_or(Value::Null),
+                "BLOB" => row.try_get::<Vec<u8>, _>(i).map(|b| Value::from(hex::encode(b))).unwrap_or(Value::Null),
+                _ => row.try_get::<String, _>(i).map(Value::from).unwrap_or(Value::Null),
+            },
+            Err(_) => Value::Null,
+        };
+        object.insert(column.name().to_string(), value);
+    }
+    object
+}
+
+fn io_error(e: std::io::Error) -> ServiceError {
+    ServiceError::InternalError(format!("Unified export I/O failed: {}", e))
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn concurrency_stays_within_domain_count() {
+        let n = unified_domain_concurrency();
+        assert!(n >= 1 && n <= UNIFIED_DOMAINS.len());
+    }
+
+    #[tokio::test]
+    async fn unified_file_holds_typed_records_in_domain_order() {
+        let pool = sqlx::sqlite::SqlitePoolOptions::new()
+            .max_connections(1)
+            .connect("sqlite::memory:")
+            .await
+            .unwrap();
+        sqlx::query(include_str!("../../../migrations/20240101000000_consolidated.sql"))
+            .execute(&pool)
+            .await
+            .unwrap();
+        let goal_id = Uuid::new_v4();
+        let donor_id = Uuid::new_v4();
+        sqlx::query(
+            "INSERT INTO donors (id, name, type, created_at, updated_at)
+             VALUES (?, 'Donor', 'individual', '2026-03-01T00:00:00Z', '2026-03-01T00:00:00Z')",
+        )
+        .bind(donor_id.to_string())
+        .execute(&pool)
+        .await
+        .unwrap();
+        sqlx::query(
+            "INSERT INTO strategic_goals (id, objective_code, created_at, updated_at)
+             VALUES (?, 'SG-1', '2026-01-01T00:00:00Z', '2026-01-01T00:00:00Z')",
+        )
+        .bind(goal_id.to_string())
+        .execute(&pool)
+        .await
+        .unwrap();
+
+        let dir = tempfile::tempdir().unwrap();
+        let options = UnifiedExportOptions { date_range: None, include_type_tags: true };
+        let stats = export_unified_parallel(&pool, Uuid::new_v4(), dir.path(), options).await.unwrap();
+        assert_eq!(stats.entities_written, 2);
+
+        let output = std::fs::read_to_string(dir.path().join(UNIFIED_FILE_NAME)).unwrap();
+        let records: Vec<serde_json::Value> = output.lines().map(|l| serde_json::from_str(l).unwrap()).collect();
+        assert_eq!(records.len(), 2);
+        // Strategic goals come before donors, whichever finished first
+        assert_eq!(records[0]["type"], "strategic_goal");
+        assert_eq!(records[0]["data"]["id"], goal_id.to_string());
+        assert_eq!(records[0]["data"]["objective_code"], "SG-1");
+        assert_eq!(records[1]["type"], "donor");
+        assert_eq!(records[1]["data"]["type_"], "individual");
+        assert!(!dir.path().join(".unified_donors.part").exists());
+
+        // Only the goal was updated in January
+        let start = "2026-01-01T00:00:00Z".parse().unwrap();
+        let end = "2026-01-31T00:00:00Z".parse().unwrap();
+        let options = UnifiedExportOptions { date_range: Some((start, end)), include_type_tags: false };
+        export_unified_parallel(&pool, Uuid::new_v4(), dir.path(), options).await.unwrap();
+        let output = std::fs::read_to_string(dir.path().join(UNIFIED_FILE_NAME)).unwrap();
+        let records: Vec<serde_json::Value> = output.lines().map(|l| serde_json::from_str(l).unwrap()).collect();
+        assert_eq!(records.len(), 1);
+        assert_eq!(records[0]["id"], goal_id.to_string());
+    }
+}
@@ -1,14 +1,15 @@
 use crate::domains::export::types::*;
 use crate::domains::export::writer::*;
 use crate::domains::export::ios::memory::*;
+use crate::domains::export::schemas::columnar::BatchAppender;
 use async_trait::async_trait;
 use futures::stream::{Stream, StreamExt};
-use arrow::array::*;
-use arrow::datatypes::{Schema, SchemaRef, DataType, Field};
+use arrow::datatypes::SchemaRef;
 use arrow::record_batch::RecordBatch;
 use parquet::arrow::AsyncArrowWriter;
 use parquet::file::properties::{WriterProperties, WriterVersion};
 use parquet::basic::{Compression, Encoding};
+use sqlx::sqlite::SqliteRow;
 use std::sync::Arc;
 use std::time::Instant;
 use tokio::fs::File;
@@ -87,8 +88,10 @@ impl IOSParquetWriter {
     
     /// Write RecordBatch with iOS memory management
     pub async fn write_batch(&mut self, batch: RecordBatch) -> Result<(), ExportError> {
-        // Check iOS memory pressure
+        // Check iOS memory pressure. Arrow builders own their memory, so the
+        // pooled scratch buffers are what we can hand back before flushing.
         if self.memory_observer.is_critical() {
+            buffer_pool().trim(MemoryPressureLevel::Critical);
             self.writer.lock().await.flush().await
                 .map_err(|e| ExportError::Io(e.to_string()))?;
             tokio::time::sleep(tokio::time::Duration::from_millis(100)).await;
@@ -118,14 +121,7 @@ impl StreamingExportWriter for IOSParquetWriter {
             let batch = result?;
             row_count += batch.num_rows();
             
-            // iOS memory pressure check
-            if self.memory_observer.is_critical() {
-                self.writer.lock().await.flush().await
-                    .map_err(|e| ExportError::Io(e.to_string()))?;
-                tokio::time::sleep(tokio::time::Duration::from_millis(100)).await;
-            }
-            
-            // Write batch
+            // Write batch (checks memory pressure itself)
             self.write_batch(batch).await?;
             
             // Yield for iOS background processing
@@ -200,96 +196,57 @@ impl IOSParquetWriter {
     }
 }
 
-/// Record batch builder for accumulating rows
+/// Record batch builder for accumulating rows.
+///
+/// Backed by a `BatchAppender` compiled from the schema, so rows from SQLite
+/// or JSON are appended by type; `append_value` remains for textual cells.
 pub struct RecordBatchBuilder {
-    schema: SchemaRef,
-    builders: Vec<Box<dyn ArrayBuilder>>,
-    current_rows: usize,
+    appender: BatchAppender,
 }
 
 impl RecordBatchBuilder {
+    /// Builder sized for the Parquet batch size of the current device state
     pub fn new(schema: SchemaRef) -> Self {
-        let builders = schema
-            .fields()
-            .iter()
-            .map(|field| Self::create_builder(field))
-            .collect();
-        
-        Self {
-            schema,
-            builders,
-            current_rows: 0,
-        }
+        Self::with_capacity(schema, default_parquet_batch_size())
     }
     
-    fn create_builder(field: &Field) -> Box<dyn ArrayBuilder> {
-        match field.data_type() {
-            DataType::Utf8 => Box::new(StringBuilder::new()),
-            DataType::Int64 => Box::new(Int64Builder::new()),
-            DataType::Float64 => Box::new(Float64Builder::new()),
-            DataType::Boolean => Box::new(BooleanBuilder::new()),
-            DataType::Timestamp(_, _) => Box::new(TimestampMillisecondBuilder::new()),
-            _ => Box::new(StringBuilder::new()), // Fallback
+    pub fn with_capacity(schema: SchemaRef, capacity: usize) -> Self {
+        Self {
+            appender: BatchAppender::compile(schema, capacity),
         }
     }
     
     pub fn append_value(&mut self, column_index: usize, value: &str) -> Result<(), ExportError> {
-        if column_index >= self.builders.len() {
-            return Err(ExportError::Schema("Column index out of bounds".to_string()));
-        }
-        
-        let field = &self.schema.fields()[column_index];
-        match field.data_type() {
-            DataType::Utf8 => {
-                if let Some(builder) = self.builders[column_index].as_any_mut().downcast_mut::<StringBuilder>() {
-                    builder.append_value(value);
-                }
-            },
-            DataType::Int64 => {
-                if let Some(builder) = self.builders[column_index].as_any_mut().downcast_mut::<Int64Builder>() {
-                    let parsed: i64 = value.parse().map_err(|_| ExportError::Serialization("Invalid int64".to_string()))?;
-                    builder.append_value(parsed);
-                }
-            },
-            DataType::Float64 => {
-                if let Some(builder) = self.builders[column_index].as_any_mut().downcast_mut::<Float64Builder>() {
-                    let parsed: f64 = value.parse().map_err(|_| ExportError::Serialization("Invalid float64".to_string()))?;
-                    builder.append_value(parsed);
-                }
-            },
-            DataType::Boolean => {
-                if let Some(builder) = self.builders[column_index].as_any_mut().downcast_mut::<BooleanBuilder>() {
-                    let parsed: bool = value.parse().map_err(|_| ExportError::Serialization("Invalid boolean".to_string()))?;
-                    builder.append_value(parsed);
-                }
-            },
-            _ => {
-                // Fallback to string
-                if let Some(builder) = self.builders[column_index].as_any_mut().downcast_mut::<StringBuilder>() {
-                    builder.append_value(value);
-                }
-            }
-        }
-        
-        Ok(())
+        self.appender.append_text(column_index, value)
+    }
+    
+    /// Append a row selected with the schema's columns in schema order
+    pub fn append_row(&mut self, row: &SqliteRow) -> Result<(), ExportError> {
+        self.appender.append_sqlite_row(row)
+    }
+    
+    pub fn append_json(&mut self, entity: &serde_json::Value) {
+        self.appender.append_json(entity)
+    }
+    
+    pub fn num_rows(&self) -> usize {
+        self.appender.len()
+    }
+    
+    pub fn is_full(&self) -> bool {
+        self.appender.is_full()
     }
     
     pub fn finish(&mut self) -> Result<RecordBatch, ExportError> {
-        let arrays: Vec<ArrayRef> = self.builders
-            .iter_mut()
-            .map(|builder| builder.finish())
-            .collect();
-        
-        self.current_rows = 0;
-        
-        // Recreate builders for next batch
-        self.builders = self.schema
-            .fields()
-            .iter()
-            .map(|field| Self::create_builder(field))
-            .collect();
-        
-        RecordBatch::try_new(self.schema.clone(), arrays)
-            .map_err(|e| ExportError::Schema(e.to_string()))
+        self.appender.finish()
     }
-} 
\ No newline at end of file
+}
+
+/// Rows per Parquet batch for the current memory pressure
+pub fn default_parquet_batch_size() -> usize {
+    crate::domains::export::ios::memory::DeviceCapabilities::optimal_batch_size(ExportFormat::Parquet {
+        compression: ParquetCompression::Snappy,
+        row_group_size: 10_000,
+        enable_statistics: true,
+    })
+}
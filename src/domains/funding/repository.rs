@@ -2,6 +2,7 @@ use crate::auth::AuthContext;
 use crate::domains::core::repository::{FindById, HardDeletable, SoftDeletable};
 use crate::domains::core::delete_service::DeleteServiceRepository;
 use crate::domains::core::document_linking::DocumentLinkable;
+use crate::domains::core::loader::{parse_keyed_rows, uuid_list_json};
 use crate::domains::funding::types::{ProjectFunding, NewProjectFunding, UpdateProjectFunding, ProjectFundingRow, ProjectFundingSummary};
 use crate::errors::{DbError, DomainError, DomainResult, ValidationError};
 use crate::types::{PaginatedResult, PaginationParams};
@@ -78,6 +79,13 @@ pub trait ProjectFundingRepository:
         donor_id: Uuid,
     ) -> DomainResult<(i64, f64)>; // Returns (active_count, total_amount)
 
+    /// `get_donor_funding_stats` for several donors in one query; donors
+    /// without fundings are absent from the map
+    async fn get_funding_stats_for_donors(
+        &self,
+        donor_ids: &[Uuid],
+    ) -> DomainResult<HashMap<Uuid, (i64, f64)>>;
+
     /// Count fundings by status
     async fn count_by_status(&self) -> DomainResult<Vec<(Option<String>, i64)>>;
 
@@ -145,12 +153,20 @@ pub trait ProjectFundingRepository:
 #[derive(Clone)]
 pub struct SqliteProjectFundingRepository {
     pool: Pool<Sqlite>,
+    /// Read-only connections for queries; writes and transactions use `pool`
+    read_pool: Pool<Sqlite>,
     change_log_repo: Arc<dyn ChangeLogRepository + Send + Sync>,
 }
 
 impl SqliteProjectFundingRepository {
     pub fn new(pool: Pool<Sqlite>, change_log_repo: Arc<dyn ChangeLogRepository + Send + Sync>) -> Self {
-        Self { pool, change_log_repo }
+        Self { read_pool: pool.clone(), pool, change_log_repo }
+    }
+
+    /// Serve queries from a separate read-only pool
+    pub fn with_read_pool(mut self, read_pool: Pool<Sqlite>) -> Self {
+        self.read_pool = read_pool;
+        self
     }
 
     fn map_row_to_entity(row: ProjectFundingRow) -> DomainResult<ProjectFunding> {
@@ -196,7 +212,7 @@ impl FindById<ProjectFunding> for SqliteProjectFundingRepository {
             "SELECT * FROM project_funding WHERE id = ? AND deleted_at IS NULL",
         )
         .bind(id.to_string())
-        .fetch_optional(&self.pool)
+        .fetch_optional(&self.read_pool)
         .await
         .map_err(DbError::from)?
         .ok_or_else(|| DomainError::EntityNotFound("Project Funding".to_string(), id))?;
@@ -524,7 +540,7 @@ impl ProjectFundingRepository for SqliteProjectFundingRepository {
         let offset = (params.page - 1) * params.per_page;
 
         let total: i64 = query_scalar("SELECT COUNT(*) FROM project_funding WHERE deleted_at IS NULL")
-            .fetch_one(&self.pool)
+            .fetch_one(&self.read_pool)
             .await
             .map_err(DbError::from)?;
 
@@ -533,7 +549,7 @@ impl ProjectFundingRepository for SqliteProjectFundingRepository {
         )
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -557,7 +573,7 @@ impl ProjectFundingRepository for SqliteProjectFundingRepository {
              "SELECT COUNT(*) FROM project_funding WHERE project_id = ? AND deleted_at IS NULL"
          )
          .bind(&project_id_str)
-         .fetch_one(&self.pool)
+         .fetch_one(&self.read_pool)
          .await
          .map_err(DbError::from)?;
 
@@ -568,7 +584,7 @@ impl ProjectFundingRepository for SqliteProjectFundingRepository {
         .bind(project_id_str)
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -592,7 +608,7 @@ impl ProjectFundingRepository for SqliteProjectFundingRepository {
              "SELECT COUNT(*) FROM project_funding WHERE donor_id = ? AND deleted_at IS NULL"
          )
          .bind(&donor_id_str)
-         .fetch_one(&self.pool)
+         .fetch_one(&self.read_pool)
          .await
          .map_err(DbError::from)?;
 
@@ -603,7 +619,7 @@ impl ProjectFundingRepository for SqliteProjectFundingRepository {
         .bind(donor_id_str)
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -625,7 +641,7 @@ impl ProjectFundingRepository for SqliteProjectFundingRepository {
              WHERE project_id = ? AND deleted_at IS NULL"
         )
         .bind(project_id.to_string())
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
         
@@ -659,7 +675,7 @@ impl ProjectFundingRepository for SqliteProjectFundingRepository {
         .bind(&today)
         .bind(&today)
         .bind(donor_id.to_string())
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
         
@@ -669,6 +685,45 @@ impl ProjectFundingRepository for SqliteProjectFundingRepository {
         Ok((active_count, total_amount))
     }
 
+    async fn get_funding_stats_for_donors(
+        &self,
+        donor_ids: &[Uuid],
+    ) -> DomainResult<HashMap<Uuid, (i64, f64)>> {
+        if donor_ids.is_empty() {
+            return Ok(HashMap::new());
+        }
+        let today = Local::now().format("%Y-%m-%d").to_string();
+        let rows = query_as::<_, (String, Option<i64>, Option<f64>)>(
+            r#"
+            SELECT 
+                donor_id,
+                COUNT(CASE 
+                    WHEN (status IS NULL OR status NOT IN ('completed', 'cancelled'))
+                         AND (start_date IS NULL OR DATE(start_date) <= ?)
+                         AND (end_date IS NULL OR DATE(end_date) >= ?) 
+                    THEN 1 
+                    ELSE NULL 
+                END) as active_count, 
+                SUM(amount) as total_amount
+            FROM project_funding 
+            WHERE donor_id IN (SELECT value FROM json_each(?)) AND deleted_at IS NULL
+            GROUP BY donor_id
+            "#
+        )
+        .bind(&today)
+        .bind(&today)
+        .bind(uuid_list_json(donor_ids))
+        .fetch_all(&self.read_pool)
+        .await
+        .map_err(DbError::from)?;
+
+        Ok(parse_keyed_rows(
+            rows.into_iter()
+                .map(|(id, active, total)| (id, (active.unwrap_or(0), total.unwrap_or(0.0))))
+                .collect(),
+        ))
+    }
+
     async fn count_by_status(&self) -> DomainResult<Vec<(Option<String>, i64)>> {
         let counts = query_as::<_, (Option<String>, i64)>(
             "SELECT status, COUNT(*) 
@@ -676,7 +731,7 @@ impl ProjectFundingRepository for SqliteProjectFundingRepository {
              WHERE deleted_at IS NULL 
              GROUP BY status"
         )
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -690,7 +745,7 @@ impl ProjectFundingRepository for SqliteProjectFundingRepository {
              WHERE deleted_at IS NULL 
              GROUP BY currency"
         )
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -718,7 +773,7 @@ impl ProjectFundingRepository for SqliteProjectFundingRepository {
         )
         .bind(&today)
         .bind(&today)
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?; 
 
@@ -734,7 +789,7 @@ impl ProjectFundingRepository for SqliteProjectFundingRepository {
             GROUP BY currency
             "#
         )
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -758,7 +813,7 @@ impl ProjectFundingRepository for SqliteProjectFundingRepository {
             "SELECT COUNT(*) FROM project_funding WHERE status = ? AND deleted_at IS NULL"
         )
         .bind(status)
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -771,7 +826,7 @@ impl ProjectFundingRepository for SqliteProjectFundingRepository {
         .bind(status)
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -802,7 +857,7 @@ impl ProjectFundingRepository for SqliteProjectFundingRepository {
              AND start_date > ?"
         )
         .bind(&today)
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -817,7 +872,7 @@ impl ProjectFundingRepository for SqliteProjectFundingRepository {
         .bind(&today)
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -848,7 +903,7 @@ impl ProjectFundingRepository for SqliteProjectFundingRepository {
              AND end_date < ?"
         )
         .bind(&today)
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -863,7 +918,7 @@ impl ProjectFundingRepository for SqliteProjectFundingRepository {
         .bind(&today)
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -926,7 +981,7 @@ impl ProjectFundingRepository for SqliteProjectFundingRepository {
             .bind(&today)
             .bind(&today)
             .bind(&donor_id_str)
-            .fetch_one(&self.pool)
+            .fetch_one(&self.read_pool)
             .await
             .map_err(DbError::from)?;
 
@@ -944,7 +999,7 @@ impl ProjectFundingRepository for SqliteProjectFundingRepository {
             "#
         )
         .bind(&donor_id_str)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -998,7 +1053,7 @@ impl ProjectFundingRepository for SqliteProjectFundingRepository {
         )
         .bind(&donor_id_str)
         .bind(limit)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1075,7 +1130,7 @@ impl ProjectFundingRepository for SqliteProjectFundingRepository {
              "SELECT COUNT(*) FROM project_funding WHERE project_id = ? AND deleted_at IS NULL"
          )
          .bind(&project_id_str)
-         .fetch_one(&self.pool)
+         .fetch_one(&self.read_pool)
          .await
          .map_err(DbError::from)?;
 
@@ -1086,7 +1141,7 @@ impl ProjectFundingRepository for SqliteProjectFundingRepository {
         .bind(project_id_str)
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1113,7 +1168,7 @@ impl ProjectFundingRepository for SqliteProjectFundingRepository {
         )
         .bind(start_date.to_rfc3339())
         .bind(end_date.to_rfc3339())
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1125,7 +1180,7 @@ impl ProjectFundingRepository for SqliteProjectFundingRepository {
         .bind(end_date.to_rfc3339())
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1163,7 +1218,7 @@ impl ProjectFundingRepository for SqliteProjectFundingRepository {
 
         let total: i64 = count_builder
             .build_query_scalar()
-            .fetch_one(&self.pool)
+            .fetch_one(&self.read_pool)
             .await
             .map_err(DbError::from)?;
 
@@ -1183,7 +1238,7 @@ impl ProjectFundingRepository for SqliteProjectFundingRepository {
 
         let rows = select_builder
             .build_query_as::<ProjectFundingRow>()
-            .fetch_all(&self.pool)
+            .fetch_all(&self.read_pool)
             .await
             .map_err(DbError::from)?;
 
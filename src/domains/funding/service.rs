@@ -1,6 +1,7 @@
 use crate::auth::AuthContext;
 use sqlx::{SqlitePool, Transaction, Sqlite, query_scalar, query_as};
 use crate::domains::core::dependency_checker::DependencyChecker;
+use crate::domains::core::loader::RelationLoader;
 use crate::domains::core::delete_service::{BaseDeleteService, DeleteOptions, DeleteService, DeleteServiceRepository};
 use crate::domains::core::repository::{DeleteResult, FindById, HardDeletable, SoftDeletable};
 use crate::domains::permission::Permission;
@@ -273,58 +274,81 @@ impl ProjectFundingServiceImpl {
     /// Helper to enrich ProjectFundingResponse with included data
     async fn enrich_response(
         &self,
-        mut response: ProjectFundingResponse,
+        response: ProjectFundingResponse,
         include: Option<&[FundingInclude]>,
         auth: &AuthContext,
     ) -> ServiceResult<ProjectFundingResponse> {
-        if let Some(includes) = include {
-            // Check if we need to include project details
-            let include_project = includes.contains(&FundingInclude::All) || 
-                                includes.contains(&FundingInclude::Project);
-                                
-            // Check if we need to include donor details
-            let include_donor = includes.contains(&FundingInclude::All) || 
-                              includes.contains(&FundingInclude::Donor);
-            
-            // Include project if requested
-            if include_project && response.project.is_none() {
-                match self.project_repo.find_by_id(response.project_id).await {
-                    Ok(project) => {
-                        response.project = Some(ProjectSummary {
-                            id: project.id,
-                            name: project.name,
-                        });
-                    },
-                    Err(_) => {
-                        // Project not found, but we shouldn't fail the overall response
-                        // Just leave project as None
-                    }
-                }
+        let relations = RelationLoader::new(self.pool.clone());
+        let mut enriched = self.enrich_responses(vec![response], include, auth, &relations).await?;
+        Ok(enriched.pop().expect("one response in, one out"))
+    }
+
+    /// Enrich a page of fundings; project names come through the request's
+    /// loader and donors from one `find_by_ids` call
+    async fn enrich_responses(
+        &self,
+        mut responses: Vec<ProjectFundingResponse>,
+        include: Option<&[FundingInclude]>,
+        _auth: &AuthContext,
+        relations: &RelationLoader,
+    ) -> ServiceResult<Vec<ProjectFundingResponse>> {
+        let Some(includes) = include else {
+            return Ok(responses);
+        };
+
+        // Check if we need to include project details
+        let include_project = includes.contains(&FundingInclude::All) || 
+                            includes.contains(&FundingInclude::Project);
+                            
+        // Check if we need to include donor details
+        let include_donor = includes.contains(&FundingInclude::All) || 
+                          includes.contains(&FundingInclude::Donor);
+
+        // A project or donor that cannot be loaded shouldn't fail the overall
+        // response; its summary is just left as None
+        let project_names = if include_project {
+            let project_ids: Vec<Uuid> = responses
+                .iter()
+                .filter(|r| r.project.is_none())
+                .map(|r| r.project_id)
+                .collect();
+            relations.project_names(&project_ids).await.unwrap_or_default()
+        } else {
+            HashMap::new()
+        };
+
+        let donors: HashMap<Uuid, DonorSummary> = if include_donor {
+            let mut donor_ids: Vec<Uuid> = responses
+                .iter()
+                .filter(|r| r.donor.is_none())
+                .map(|r| r.donor_id)
+                .collect();
+            donor_ids.sort();
+            donor_ids.dedup();
+            let params = PaginationParams { page: 1, per_page: donor_ids.len().max(1) as u32 };
+            match self.donor_repo.find_by_ids(&donor_ids, params).await {
+                Ok(found) => found.items.into_iter().map(|donor| (donor.id, DonorSummary::from(donor))).collect(),
+                Err(_) => HashMap::new(),
             }
-            
-            // Include donor if requested
-            if include_donor && response.donor.is_none() {
-                match self.donor_repo.find_by_id(response.donor_id).await {
-                    Ok(donor) => {
-                        let completeness = donor.data_completeness();
-                        response.donor = Some(DonorSummary {
-                            id: donor.id,
-                            name: donor.name,
-                            type_: donor.type_,
-                            country: donor.country,
-                            data_completeness: Some(completeness),
-                            engagement_score: None,
-                        });
-                    },
-                    Err(_) => {
-                        // Donor not found, but we shouldn't fail the overall response
-                        // Just leave donor as None
-                    }
+        } else {
+            HashMap::new()
+        };
+
+        for response in responses.iter_mut() {
+            if response.project.is_none() {
+                if let Some(name) = project_names.get(&response.project_id) {
+                    response.project = Some(ProjectSummary {
+                        id: response.project_id,
+                        name: name.clone(),
+                    });
                 }
             }
+            if response.donor.is_none() {
+                response.donor = donors.get(&response.donor_id).cloned();
+            }
         }
-        
-        Ok(response)
+
+        Ok(responses)
     }
     
     /// Helper to validate existence of related entities
@@ -417,12 +441,9 @@ impl ProjectFundingService for ProjectFundingServiceImpl {
             .map_err(ServiceError::Domain)?;
             
         // Convert and enrich items
-        let mut enriched_items = Vec::new();
-        for item in paginated_result.items {
-            let response = ProjectFundingResponse::from(item);
-            let enriched = self.enrich_response(response, include, auth).await?;
-            enriched_items.push(enriched);
-        }
+        let responses = paginated_result.items.into_iter().map(ProjectFundingResponse::from).collect();
+        let relations = RelationLoader::new(self.pool.clone());
+        let enriched_items = self.enrich_responses(responses, include, auth, &relations).await?;
         
         Ok(PaginatedResult::new(
             enriched_items,
@@ -449,12 +470,9 @@ impl ProjectFundingService for ProjectFundingServiceImpl {
             .map_err(ServiceError::Domain)?;
             
         // Convert and enrich items
-        let mut enriched_items = Vec::new();
-        for item in paginated_result.items {
-            let response = ProjectFundingResponse::from(item);
-            let enriched = self.enrich_response(response, include, auth).await?;
-            enriched_items.push(enriched);
-        }
+        let responses = paginated_result.items.into_iter().map(ProjectFundingResponse::from).collect();
+        let relations = RelationLoader::new(self.pool.clone());
+        let enriched_items = self.enrich_responses(responses, include, auth, &relations).await?;
         
         Ok(PaginatedResult::new(
             enriched_items,
@@ -481,12 +499,9 @@ impl ProjectFundingService for ProjectFundingServiceImpl {
             .map_err(ServiceError::Domain)?;
             
         // Convert and enrich items
-        let mut enriched_items = Vec::new();
-        for item in paginated_result.items {
-            let response = ProjectFundingResponse::from(item);
-            let enriched = self.enrich_response(response, include, auth).await?;
-            enriched_items.push(enriched);
-        }
+        let responses = paginated_result.items.into_iter().map(ProjectFundingResponse::from).collect();
+        let relations = RelationLoader::new(self.pool.clone());
+        let enriched_items = self.enrich_responses(responses, include, auth, &relations).await?;
         
         Ok(PaginatedResult::new(
             enriched_items,
@@ -833,12 +848,9 @@ impl ProjectFundingService for ProjectFundingServiceImpl {
         let paginated_result = self.repo.find_by_status(status, params).await?;
 
         // 3. Convert and enrich each funding
-        let mut enriched_items = Vec::new();
-        for funding in paginated_result.items {
-            let response = ProjectFundingResponse::from(funding);
-            let enriched = self.enrich_response(response, include, auth).await?;
-            enriched_items.push(enriched);
-        }
+        let responses = paginated_result.items.into_iter().map(ProjectFundingResponse::from).collect();
+        let relations = RelationLoader::new(self.pool.clone());
+        let enriched_items = self.enrich_responses(responses, include, auth, &relations).await?;
 
         // 4. Return paginated result
         Ok(PaginatedResult::new(
@@ -861,12 +873,9 @@ impl ProjectFundingService for ProjectFundingServiceImpl {
         let paginated_result = self.repo.find_upcoming_fundings(params).await?;
 
         // 3. Convert and enrich each funding
-        let mut enriched_items = Vec::new();
-        for funding in paginated_result.items {
-            let response = ProjectFundingResponse::from(funding);
-            let enriched = self.enrich_response(response, include, auth).await?;
-            enriched_items.push(enriched);
-        }
+        let responses = paginated_result.items.into_iter().map(ProjectFundingResponse::from).collect();
+        let relations = RelationLoader::new(self.pool.clone());
+        let enriched_items = self.enrich_responses(responses, include, auth, &relations).await?;
 
         // 4. Return paginated result
         Ok(PaginatedResult::new(
@@ -889,12 +898,9 @@ impl ProjectFundingService for ProjectFundingServiceImpl {
         let paginated_result = self.repo.find_overdue_fundings(params).await?;
 
         // 3. Convert and enrich each funding
-        let mut enriched_items = Vec::new();
-        for funding in paginated_result.items {
-            let response = ProjectFundingResponse::from(funding);
-            let enriched = self.enrich_response(response, include, auth).await?;
-            enriched_items.push(enriched);
-        }
+        let responses = paginated_result.items.into_iter().map(ProjectFundingResponse::from).collect();
+        let relations = RelationLoader::new(self.pool.clone());
+        let enriched_items = self.enrich_responses(responses, include, auth, &relations).await?;
 
         // 4. Return paginated result
         Ok(PaginatedResult::new(
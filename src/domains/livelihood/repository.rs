@@ -232,13 +232,21 @@ pub trait SubsequentGrantRepository: Send + Sync + MergeableEntityRepository<Sub
 /// SQLite implementation of the livelihood repository
 pub struct SqliteLivelihoodRepository {
     pool: Pool<Sqlite>,
+    /// Read-only connections for queries; writes and transactions use `pool`
+    read_pool: Pool<Sqlite>,
     change_log_repo: Arc<dyn ChangeLogRepository + Send + Sync>,
 }
 
 impl SqliteLivelihoodRepository {
     /// Create a new SQLite livelihood repository
     pub fn new(pool: Pool<Sqlite>, change_log_repo: Arc<dyn ChangeLogRepository + Send + Sync>) -> Self {
-        Self { pool, change_log_repo }
+        Self { read_pool: pool.clone(), pool, change_log_repo }
+    }
+
+    /// Serve queries from a separate read-only pool
+    pub fn with_read_pool(mut self, read_pool: Pool<Sqlite>) -> Self {
+        self.read_pool = read_pool;
+        self
     }
     
     /// Map a database row to a domain entity
@@ -277,7 +285,7 @@ impl FindById<Livelihood> for SqliteLivelihoodRepository {
             "SELECT * FROM livelihoods WHERE id = ? AND deleted_at IS NULL"
         )
         .bind(id.to_string())
-        .fetch_optional(&self.pool)
+        .fetch_optional(&self.read_pool)
         .await
         .map_err(DbError::from)?
         .ok_or_else(|| DomainError::EntityNotFound(self.entity_name().to_string(), id))?;
@@ -731,7 +739,7 @@ impl LivehoodRepository for SqliteLivelihoodRepository {
         let count_query = count_builder.build(); // Build the final count query
         
         let total: i64 = count_query
-            .fetch_one(&self.pool)
+            .fetch_one(&self.read_pool)
             .await
             .map_err(DbError::from)?
             .try_get("count")
@@ -748,7 +756,7 @@ impl LivehoodRepository for SqliteLivelihoodRepository {
         
         // Build and execute the query_as directly
         let rows = query_builder.build_query_as::<LivelihoodRow>()
-            .fetch_all(&self.pool)
+            .fetch_all(&self.read_pool)
             .await
             .map_err(DbError::from)?;
             
@@ -797,7 +805,7 @@ impl LivehoodRepository for SqliteLivelihoodRepository {
              AND deleted_at IS NULL"
         )
         .bind(min_amount)
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -816,7 +824,7 @@ impl LivehoodRepository for SqliteLivelihoodRepository {
             WHERE deleted_at IS NULL
             "#;
         let (total_livelihoods, total_initial_amount, avg_initial_amount) = query_as::<_, (i64, f64, f64)>(basic_stats_query)
-            .fetch_one(&self.pool)
+            .fetch_one(&self.read_pool)
             .await
             .map_err(DbError::from)?;
 
@@ -831,7 +839,7 @@ impl LivehoodRepository for SqliteLivelihoodRepository {
             GROUP BY l.project_id
             "#;
         let project_distribution_rows = query(project_distribution_query)
-            .fetch_all(&self.pool)
+            .fetch_all(&self.read_pool)
             .await
             .map_err(DbError::from)?;
             
@@ -855,7 +863,7 @@ impl LivehoodRepository for SqliteLivelihoodRepository {
             WHERE deleted_at IS NULL
             "#;
         let (total_subsequent_grants, total_subsequent_amount) = query_as::<_, (i64, f64)>(subsequent_stats_query)
-            .fetch_one(&self.pool)
+            .fetch_one(&self.read_pool)
             .await
             .map_err(DbError::from)?;
             
@@ -867,7 +875,7 @@ impl LivehoodRepository for SqliteLivelihoodRepository {
             GROUP BY type
         "#;
         let type_rows = query(type_distribution_query)
-             .fetch_all(&self.pool)
+             .fetch_all(&self.read_pool)
              .await
              .map_err(DbError::from)?;
         let livelihoods_by_type: HashMap<String, i64> = type_rows.into_iter()
@@ -901,7 +909,7 @@ impl LivehoodRepository for SqliteLivelihoodRepository {
              WHERE outcome IS NOT NULL AND outcome != '' 
              AND deleted_at IS NULL"
         )
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -914,7 +922,7 @@ impl LivehoodRepository for SqliteLivelihoodRepository {
         )
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -943,7 +951,7 @@ impl LivehoodRepository for SqliteLivelihoodRepository {
              WHERE (outcome IS NULL OR outcome = '') 
              AND deleted_at IS NULL"
         )
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -956,7 +964,7 @@ impl LivehoodRepository for SqliteLivelihoodRepository {
         )
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -994,7 +1002,7 @@ impl LivehoodRepository for SqliteLivelihoodRepository {
             WHERE l.deleted_at IS NULL
             "#
         )
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1016,7 +1024,7 @@ impl LivehoodRepository for SqliteLivelihoodRepository {
         )
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1072,7 +1080,7 @@ impl LivehoodRepository for SqliteLivelihoodRepository {
         }
 
         let rows = query
-            .fetch_all(&self.pool)
+            .fetch_all(&self.read_pool)
             .await
             .map_err(DbError::from)?;
 
@@ -1099,7 +1107,7 @@ impl LivehoodRepository for SqliteLivelihoodRepository {
             "SELECT COALESCE(grant_amount, 0) FROM livelihoods WHERE id = ? AND deleted_at IS NULL"
         )
         .bind(id.to_string())
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1109,7 +1117,7 @@ impl LivehoodRepository for SqliteLivelihoodRepository {
              WHERE livelihood_id = ? AND deleted_at IS NULL"
         )
         .bind(id.to_string())
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1125,7 +1133,7 @@ impl LivehoodRepository for SqliteLivelihoodRepository {
              WHERE (outcome IS NULL OR outcome = '') 
              AND deleted_at IS NULL"
         )
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
         
@@ -1136,7 +1144,7 @@ impl LivehoodRepository for SqliteLivelihoodRepository {
              AND (outcome IS NULL OR outcome = '')
              AND deleted_at IS NULL"
         )
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
         
@@ -1146,7 +1154,7 @@ impl LivehoodRepository for SqliteLivelihoodRepository {
              WHERE outcome IS NOT NULL AND outcome != '' 
              AND deleted_at IS NULL"
         )
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
         
@@ -1175,7 +1183,7 @@ impl LivehoodRepository for SqliteLivelihoodRepository {
         .bind(start_date.to_rfc3339()) // Convert to string
         .bind(end_date.to_rfc3339())   // Convert to string
         .bind(end_date.to_rfc3339())   // Convert to string
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1197,7 +1205,7 @@ impl LivehoodRepository for SqliteLivelihoodRepository {
         query_builder.push_bind(offset as i64);
         
         let rows = query_builder.build_query_as::<LivelihoodRow>()
-            .fetch_all(&self.pool)
+            .fetch_all(&self.read_pool)
             .await
             .map_err(DbError::from)?;
 
@@ -1235,7 +1243,7 @@ impl LivehoodRepository for SqliteLivelihoodRepository {
 
         let total: i64 = count_builder
             .build_query_scalar()
-            .fetch_one(&self.pool)
+            .fetch_one(&self.read_pool)
             .await
             .map_err(DbError::from)?;
 
@@ -1255,7 +1263,7 @@ impl LivehoodRepository for SqliteLivelihoodRepository {
 
         let rows = select_builder
             .build_query_as::<LivelihoodRow>()
-            .fetch_all(&self.pool)
+            .fetch_all(&self.read_pool)
             .await
             .map_err(DbError::from)?;
 
@@ -1467,12 +1475,20 @@ INSERT OR REPLACE INTO livelihoods (
 /// SQLite implementation of the subsequent grant repository
 pub struct SqliteSubsequentGrantRepository {
     pool: Pool<Sqlite>,
+    /// Read-only connections for queries; writes and transactions use `pool`
+    read_pool: Pool<Sqlite>,
 }
 
 impl SqliteSubsequentGrantRepository {
     /// Create a new SQLite subsequent grant repository
     pub fn new(pool: Pool<Sqlite>) -> Self {
-        Self { pool }
+        Self { read_pool: pool.clone(), pool }
+    }
+
+    /// Serve queries from a separate read-only pool
+    pub fn with_read_pool(mut self, read_pool: Pool<Sqlite>) -> Self {
+        self.read_pool = read_pool;
+        self
     }
     
     /// Map a database row to a domain entity
@@ -1673,7 +1689,7 @@ impl SubsequentGrantRepository for SqliteSubsequentGrantRepository {
             "SELECT id, livelihood_id, amount, amount_updated_at, amount_updated_by, amount_updated_by_device_id, purpose, purpose_updated_at, purpose_updated_by, purpose_updated_by_device_id, grant_date, grant_date_updated_at, grant_date_updated_by, grant_date_updated_by_device_id, sync_priority, created_at, updated_at, created_by_user_id, created_by_device_id, updated_by_user_id, updated_by_device_id, deleted_at, deleted_by_user_id, deleted_by_device_id FROM subsequent_grants WHERE id = ? AND deleted_at IS NULL"
         )
         .bind(id.to_string())
-        .fetch_optional(&self.pool)
+        .fetch_optional(&self.read_pool)
         .await
         .map_err(DbError::from)?
         .ok_or_else(|| DomainError::EntityNotFound(self.entity_name().to_string(), id))?;
@@ -1689,7 +1705,7 @@ impl SubsequentGrantRepository for SqliteSubsequentGrantRepository {
             "SELECT id, livelihood_id, amount, amount_updated_at, amount_updated_by, amount_updated_by_device_id, purpose, purpose_updated_at, purpose_updated_by, purpose_updated_by_device_id, grant_date, grant_date_updated_at, grant_date_updated_by, grant_date_updated_by_device_id, sync_priority, created_at, updated_at, created_by_user_id, created_by_device_id, updated_by_user_id, updated_by_device_id, deleted_at, deleted_by_user_id, deleted_by_device_id FROM subsequent_grants WHERE livelihood_id = ? AND deleted_at IS NULL ORDER BY created_at ASC"
         )
         .bind(livelihood_id.to_string())
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
         
@@ -1830,7 +1846,7 @@ impl SubsequentGrantRepository for SqliteSubsequentGrantRepository {
              WHERE livelihood_id = ? AND deleted_at IS NULL"
         )
         .bind(livelihood_id.to_string())
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1875,7 +1891,7 @@ impl SubsequentGrantRepository for SqliteSubsequentGrantRepository {
         }
 
         let rows = query
-            .fetch_all(&self.pool)
+            .fetch_all(&self.read_pool)
             .await
             .map_err(DbError::from)?;
 
@@ -1912,7 +1928,7 @@ impl SubsequentGrantRepository for SqliteSubsequentGrantRepository {
         .bind(start_date.to_rfc3339()) // Convert to string
         .bind(end_date.to_rfc3339())   // Convert to string
         .bind(end_date.to_rfc3339())   // Convert to string
-            .fetch_all(&self.pool)
+            .fetch_all(&self.read_pool)
             .await
             .map_err(DbError::from)?;
 
@@ -1953,7 +1969,7 @@ impl SubsequentGrantRepository for SqliteSubsequentGrantRepository {
         );
 
         let rows = sqlx::query(&query_str)
-            .fetch_all(&self.pool)
+            .fetch_all(&self.read_pool)
             .await
             .map_err(DbError::from)?;
 
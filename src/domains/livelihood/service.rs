@@ -2,12 +2,12 @@ use crate::auth::AuthContext;
 use crate::domains::core::delete_service::{BaseDeleteService, DeleteOptions, DeleteService};
 use crate::domains::core::repository::{DeleteResult, FindById};
 use crate::domains::core::dependency_checker::DependencyChecker;
+use crate::domains::core::loader::RelationLoader;
 use crate::domains::core::document_linking::DocumentLinkable;
 use crate::domains::livelihood::repository::{LivehoodRepository, SubsequentGrantRepository, SqliteLivelihoodRepository, SqliteSubsequentGrantRepository};
 use crate::domains::livelihood::types::{Livelihood, LivelihoodInclude, LivelihoodResponse, NewLivelihood, NewSubsequentGrant, ParticipantSummary, ProjectSummary, SubsequentGrantResponse, SubsequentGrantSummary, UpdateLivelihood, UpdateSubsequentGrant, LivelioodStatsSummary, LivelioodWithParticipantDetails, ParticipantDetails, LivelioodWithDocumentTimeline, ParticipantOutcomeMetrics, LivelihoodDashboardMetrics};
 use crate::domains::participant::repository::ParticipantRepository;
 use crate::domains::permission::Permission;
-use crate::domains::project::repository::ProjectRepository;
 use crate::domains::sync::repository::{ChangeLogRepository, TombstoneRepository};
 use crate::errors::{DomainError, DomainResult, ServiceError, ServiceResult, DbError, ValidationError};
 use crate::types::{PaginatedResult, PaginationParams};
@@ -216,7 +216,6 @@ pub struct LivehoodServiceImpl {
     repo: Arc<SqliteLivelihoodRepository>,
     delete_service: Arc<BaseDeleteService<Livelihood>>,
     subsequent_grant_repo: Arc<SqliteSubsequentGrantRepository>,
-    project_repo: Arc<dyn ProjectRepository>,
     participant_repo: Arc<dyn ParticipantRepository>,
     document_service: Arc<dyn DocumentService>,
     pool: Pool<Sqlite>,
@@ -231,7 +230,6 @@ impl LivehoodServiceImpl {
         tombstone_repo: Arc<dyn TombstoneRepository + Send + Sync>,
         change_log_repo: Arc<dyn ChangeLogRepository + Send + Sync>,
         dependency_checker: Arc<dyn DependencyChecker + Send + Sync>,
-        project_repo: Arc<dyn ProjectRepository>,
         participant_repo: Arc<dyn ParticipantRepository>,
         document_service: Arc<dyn DocumentService>,
         media_doc_repo: Arc<dyn MediaDocumentRepository>,
@@ -251,7 +249,6 @@ impl LivehoodServiceImpl {
             repo: livelihood_repo,
             delete_service,
             subsequent_grant_repo,
-            project_repo,
             participant_repo,
             document_service,
             pool,
@@ -261,90 +258,110 @@ impl LivehoodServiceImpl {
     /// Enrich a livelihood response with related entities
     async fn enrich_response(
         &self,
-        mut response: LivelihoodResponse,
+        response: LivelihoodResponse,
         include: Option<&[LivelihoodInclude]>,
         auth: &AuthContext,
     ) -> ServiceResult<LivelihoodResponse> {
+        let relations = RelationLoader::new(self.pool.clone());
+        let mut enriched = self.enrich_responses(vec![response], include, auth, &relations).await?;
+        Ok(enriched.pop().expect("one response in, one out"))
+    }
+
+    /// Enrich a page of livelihoods. Projects and participants are loaded once
+    /// for the page; subsequent grants and documents are still fetched per
+    /// livelihood.
+    async fn enrich_responses(
+        &self,
+        responses: Vec<LivelihoodResponse>,
+        include: Option<&[LivelihoodInclude]>,
+        auth: &AuthContext,
+        relations: &RelationLoader,
+    ) -> ServiceResult<Vec<LivelihoodResponse>> {
         let includes = match include {
             Some(includes) => includes,
-            None => return Ok(response),
+            None => return Ok(responses),
         };
         
         // Check if we need to include all relations
         let include_all = includes.contains(&LivelihoodInclude::All);
-        
-        // Include project if requested
-        if include_all || includes.contains(&LivelihoodInclude::Project) {
-            if let Some(project_id) = response.project_id {
-                match self.project_repo.find_by_id(project_id).await {
-                    Ok(project) => {
-                        response = response.with_project(ProjectSummary {
-                            id: project.id,
-                            name: project.name,
-                        });
-                    }
-                    Err(DomainError::EntityNotFound(_, _)) => {
-                        // Project not found, but this is not a critical error
-                    }
-                    Err(e) => return Err(ServiceError::Domain(e)),
-                }
+        let include_project = include_all || includes.contains(&LivelihoodInclude::Project);
+        let include_participant = include_all || includes.contains(&LivelihoodInclude::Participant);
+
+        // Missing projects and participants are not a critical error; they are
+        // just absent from the maps
+        let project_names = if include_project {
+            let project_ids: Vec<Uuid> = responses.iter().filter_map(|r| r.project_id).collect();
+            relations.project_names(&project_ids).await.map_err(ServiceError::Domain)?
+        } else {
+            HashMap::new()
+        };
+
+        let participants: HashMap<Uuid, ParticipantSummary> = if include_participant {
+            let mut participant_ids: Vec<Uuid> = responses.iter().filter_map(|r| r.participant_id).collect();
+            participant_ids.sort();
+            participant_ids.dedup();
+            let params = PaginationParams { page: 1, per_page: participant_ids.len().max(1) as u32 };
+            self.participant_repo
+                .find_by_ids(&participant_ids, params)
+                .await
+                .map_err(ServiceError::Domain)?
+                .items
+                .into_iter()
+                .map(|participant| {
+                    (participant.id, ParticipantSummary {
+                        id: participant.id,
+                        name: participant.name,
+                        gender: participant.gender,
+                        age_group: participant.age_group,
+                        disability: participant.disability,
+                    })
+                })
+                .collect()
+        } else {
+            HashMap::new()
+        };
+
+        let mut enriched = Vec::with_capacity(responses.len());
+        for mut response in responses {
+            let project = response.project_id
+                .and_then(|id| project_names.get(&id).map(|name| ProjectSummary { id, name: name.clone() }));
+            if let Some(project) = project {
+                response = response.with_project(project);
             }
-        }
-        
-        // Include participant if requested
-        if include_all || includes.contains(&LivelihoodInclude::Participant) {
-            if let Some(participant_id) = response.participant_id {
-                match self.participant_repo.find_by_id(participant_id).await {
-                    Ok(participant) => {
-                        response = response.with_participant(ParticipantSummary {
-                            id: participant.id,
-                            name: participant.name,
-                            gender: participant.gender,
-                            age_group: participant.age_group,
-                            disability: participant.disability,
-                        });
-                    }
-                    Err(DomainError::EntityNotFound(_, _)) => {
-                        // Participant not found, but this is not a critical error
-                    }
-                    Err(e) => return Err(ServiceError::Domain(e)),
-                }
+
+            if let Some(participant) = response.participant_id.and_then(|id| participants.get(&id)) {
+                response = response.with_participant(participant.clone());
             }
-        }
-        
-        // Include subsequent grants if requested
-        if include_all || includes.contains(&LivelihoodInclude::SubsequentGrants) {
-            match self.subsequent_grant_repo.find_by_livelihood_id(response.id).await {
-                Ok(grants) => {
-                    let grant_summaries = grants
-                        .into_iter()
-                        .map(SubsequentGrantSummary::from)
-                        .collect::<Vec<_>>();
-                    
-                    response = response.with_subsequent_grants(grant_summaries);
-                }
-                Err(e) => return Err(ServiceError::Domain(e)),
+
+            // Include subsequent grants if requested
+            if include_all || includes.contains(&LivelihoodInclude::SubsequentGrants) {
+                let grants = self.subsequent_grant_repo
+                    .find_by_livelihood_id(response.id)
+                    .await
+                    .map_err(ServiceError::Domain)?;
+                let grant_summaries = grants
+                    .into_iter()
+                    .map(SubsequentGrantSummary::from)
+                    .collect::<Vec<_>>();
+                response = response.with_subsequent_grants(grant_summaries);
             }
-        }
 
-        // Include documents if requested
-        if include_all || includes.contains(&LivelihoodInclude::Documents) {
-            let doc_params = PaginationParams::default();
-            match self.document_service.list_media_documents_by_related_entity(
-                auth,
-                "livelihoods", // Entity type
-                response.id,
-                doc_params,
-                None, // No nested includes for documents
-            ).await {
-                Ok(docs_result) => {
-                    response.documents = Some(docs_result.items);
-                }
-                Err(e) => return Err(e),
+            // Include documents if requested
+            if include_all || includes.contains(&LivelihoodInclude::Documents) {
+                let docs_result = self.document_service.list_media_documents_by_related_entity(
+                    auth,
+                    "livelihoods", // Entity type
+                    response.id,
+                    PaginationParams::default(),
+                    None, // No nested includes for documents
+                ).await?;
+                response.documents = Some(docs_result.items);
             }
+
+            enriched.push(response);
         }
         
-        Ok(response)
+        Ok(enriched)
     }
 
     /// Helper method to upload documents for a livelihood and handle errors individually
@@ -572,12 +589,9 @@ impl LivehoodService for LivehoodServiceImpl {
             .map_err(ServiceError::Domain)?;
         
         // Map items to responses and enrich - now passing auth for document enrichment
-        let mut responses = Vec::new();
-        for livelihood in result.items {
-            let response = LivelihoodResponse::from(livelihood);
-            let enriched = self.enrich_response(response, include, auth).await?;
-            responses.push(enriched);
-        }
+        let responses = result.items.into_iter().map(LivelihoodResponse::from).collect();
+        let relations = RelationLoader::new(self.pool.clone());
+        let responses = self.enrich_responses(responses, include, auth, &relations).await?;
         
         // Return paginated result with enriched responses
         Ok(PaginatedResult {
@@ -975,12 +989,9 @@ impl LivehoodService for LivehoodServiceImpl {
             .map_err(ServiceError::Domain)?;
 
         // 3. Convert to response DTOs and enrich
-        let mut enriched_items = Vec::new();
-        for livelihood in paginated_result.items {
-            let response = LivelihoodResponse::from(livelihood);
-            let enriched = self.enrich_response(response, include, auth).await?;
-            enriched_items.push(enriched);
-        }
+        let responses = paginated_result.items.into_iter().map(LivelihoodResponse::from).collect();
+        let relations = RelationLoader::new(self.pool.clone());
+        let enriched_items = self.enrich_responses(responses, include, auth, &relations).await?;
 
         // 4. Return paginated result
         Ok(PaginatedResult::new(
@@ -1010,12 +1021,9 @@ impl LivehoodService for LivehoodServiceImpl {
             .map_err(ServiceError::Domain)?;
 
         // 3. Convert to response DTOs and enrich
-        let mut enriched_items = Vec::new();
-        for livelihood in paginated_result.items {
-            let response = LivelihoodResponse::from(livelihood);
-            let enriched = self.enrich_response(response, include, auth).await?;
-            enriched_items.push(enriched);
-        }
+        let responses = paginated_result.items.into_iter().map(LivelihoodResponse::from).collect();
+        let relations = RelationLoader::new(self.pool.clone());
+        let enriched_items = self.enrich_responses(responses, include, auth, &relations).await?;
 
         // 4. Return paginated result
         Ok(PaginatedResult::new(
@@ -1045,12 +1053,9 @@ impl LivehoodService for LivehoodServiceImpl {
             .map_err(ServiceError::Domain)?;
 
         // 3. Convert to response DTOs and enrich
-        let mut enriched_items = Vec::new();
-        for livelihood in paginated_result.items {
-            let response = LivelihoodResponse::from(livelihood);
-            let enriched = self.enrich_response(response, include, auth).await?;
-            enriched_items.push(enriched);
-        }
+        let responses = paginated_result.items.into_iter().map(LivelihoodResponse::from).collect();
+        let relations = RelationLoader::new(self.pool.clone());
+        let enriched_items = self.enrich_responses(responses, include, auth, &relations).await?;
 
         // 4. Return paginated result
         Ok(PaginatedResult::new(
@@ -1518,12 +1523,9 @@ impl LivehoodService for LivehoodServiceImpl {
             .map_err(ServiceError::Domain)?;
 
         // 3. Convert to response DTOs and enrich
-        let mut enriched_items = Vec::new();
-        for livelihood in paginated_result.items {
-            let response = LivelihoodResponse::from(livelihood);
-            let enriched = self.enrich_response(response, include, auth).await?;
-            enriched_items.push(enriched);
-        }
+        let responses = paginated_result.items.into_iter().map(LivelihoodResponse::from).collect();
+        let relations = RelationLoader::new(self.pool.clone());
+        let enriched_items = self.enrich_responses(responses, include, auth, &relations).await?;
 
         // 4. Return paginated result
         Ok(PaginatedResult::new(
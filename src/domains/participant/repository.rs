@@ -1,8 +1,12 @@
 use crate::auth::AuthContext;
 use sqlx::{Executor, Row, Sqlite, Transaction, SqlitePool, QueryBuilder};
+use crate::domains::core::stat_counters;
 use crate::domains::core::delete_service::DeleteServiceRepository;
 use crate::domains::core::repository::{FindById, HardDeletable, SoftDeletable};
 use crate::domains::core::document_linking::DocumentLinkable;
+use crate::domains::core::filter_sql::FilterQueryExt;
+use crate::domains::core::search::{fts_match_query, SearchMode};
+use crate::domains::core::loader::{parse_keyed_rows, uuid_list_json};
 use crate::domains::participant::types::{
     NewParticipant, Participant, ParticipantRow, UpdateParticipant, ParticipantDemographics, 
     WorkshopSummary, LivelihoodSummary, ParticipantFilter, ParticipantDocumentReference, ParticipantWithEnrichment
@@ -22,6 +26,9 @@ use std::sync::Arc;
 use serde_json;
 use std::str::FromStr;
 use crate::domains::user::repository::MergeableEntityRepository;
+/// Participants per multi-row INSERT in `bulk_create` (32 bound values each)
+const PARTICIPANT_INSERT_CHUNK: usize = 200;
+
 /// Trait defining participant repository operations
 #[async_trait]
 pub trait ParticipantRepository: DeleteServiceRepository<Participant> + MergeableEntityRepository<Participant> + Send + Sync {
@@ -37,6 +44,15 @@ pub trait ParticipantRepository: DeleteServiceRepository<Participant> + Mergeabl
         tx: &mut Transaction<'t, Sqlite>,
     ) -> DomainResult<Participant>;
 
+    /// Insert many (already validated) participants in one transaction, with
+    /// multi-row INSERTs and bulk change-log writes. Returns the new ids in
+    /// input order; nothing is inserted if any row fails.
+    async fn bulk_create(
+        &self,
+        new_participants: &[NewParticipant],
+        auth: &AuthContext,
+    ) -> DomainResult<Vec<Uuid>>;
+
     async fn update(
         &self,
         id: Uuid,
@@ -178,6 +194,20 @@ pub trait ParticipantRepository: DeleteServiceRepository<Participant> + Mergeabl
         participant_id: Uuid,
     ) -> DomainResult<(i64, i64)>; // (total, active)
     
+    /// Workshop counts of many participants in one query; participants
+    /// without workshops are absent
+    async fn count_workshops_for_participants(
+        &self,
+        participant_ids: &[Uuid],
+    ) -> DomainResult<HashMap<Uuid, (i64, i64, i64)>>; // (total, completed, upcoming)
+    
+    /// Livelihood counts of many participants in one query; participants
+    /// without livelihoods are absent
+    async fn count_livelihoods_for_participants(
+        &self,
+        participant_ids: &[Uuid],
+    ) -> DomainResult<HashMap<Uuid, (i64, i64)>>; // (total, active)
+    
     /// Get document counts by type for a participant
     async fn get_participant_document_counts_by_type(
         &self,
@@ -232,6 +262,7 @@ pub trait ParticipantRepository: DeleteServiceRepository<Participant> + Mergeabl
         &self,
         search_query: &str,
         params: PaginationParams,
+        mode: SearchMode,
     ) -> DomainResult<PaginatedResult<Participant>>;
 
     /// **BATCH PROCESSING: Memory-efficient participant statistics computation**
@@ -262,12 +293,20 @@ pub trait ParticipantRepository: DeleteServiceRepository<Participant> + Mergeabl
 #[derive(Clone)]
 pub struct SqliteParticipantRepository {
     pool: SqlitePool,
+    /// Read-only connections for queries; writes and transactions use `pool`
+    read_pool: SqlitePool,
     change_log_repo: Arc<dyn ChangeLogRepository + Send + Sync>,
 }
 
 impl SqliteParticipantRepository {
     pub fn new(pool: SqlitePool, change_log_repo: Arc<dyn ChangeLogRepository + Send + Sync>) -> Self {
-        Self { pool, change_log_repo }
+        Self { read_pool: pool.clone(), pool, change_log_repo }
+    }
+
+    /// Serve queries from a separate read-only pool
+    pub fn with_read_pool(mut self, read_pool: SqlitePool) -> Self {
+        self.read_pool = read_pool;
+        self
     }
 
     fn map_row_to_entity(row: ParticipantRow) -> DomainResult<Participant> {
@@ -307,6 +346,69 @@ impl SqliteParticipantRepository {
     ) -> DomainResult<()> {
         self.change_log_repo.create_change_log_with_tx(&entry, tx).await
     }
+
+    /// FTS5 variant of `search_participants_with_relationships`. Direct matches
+    /// on participant fields rank first (by bm25); participants found only
+    /// through a matching workshop or livelihood follow, ordered by name.
+    async fn search_participants_fts(
+        &self,
+        match_query: &str,
+        params: PaginationParams,
+    ) -> DomainResult<PaginatedResult<Participant>> {
+        let offset = (params.page - 1) * params.per_page;
+
+        const MATCHES: &str = r#"
+            WITH direct AS (
+                SELECT rowid, bm25(participants_fts) AS score
+                FROM participants_fts WHERE participants_fts MATCH ?
+            ),
+            related AS (
+                SELECT wp.participant_id AS id
+                FROM workshops_fts
+                JOIN workshops w ON w.rowid = workshops_fts.rowid AND w.deleted_at IS NULL
+                JOIN workshop_participants wp ON wp.workshop_id = w.id AND wp.deleted_at IS NULL
+                WHERE workshops_fts MATCH ?
+                UNION
+                SELECT l.participant_id
+                FROM livelihoods_fts
+                JOIN livelihoods l ON l.rowid = livelihoods_fts.rowid AND l.deleted_at IS NULL
+                WHERE livelihoods_fts MATCH ?
+            )
+        "#;
+        const FROM_WHERE: &str = r#"
+            FROM participants p
+            LEFT JOIN direct d ON d.rowid = p.rowid
+            WHERE p.deleted_at IS NULL
+            AND (d.rowid IS NOT NULL OR p.id IN (SELECT id FROM related))
+        "#;
+
+        let total: i64 = query_scalar(&format!("{MATCHES} SELECT COUNT(*) {FROM_WHERE}"))
+            .bind(match_query)
+            .bind(match_query)
+            .bind(match_query)
+            .fetch_one(&self.read_pool)
+            .await
+            .map_err(DbError::from)?;
+
+        let rows = query_as::<_, ParticipantRow>(&format!(
+            "{MATCHES} SELECT p.* {FROM_WHERE} ORDER BY COALESCE(d.score, 0) ASC, p.name ASC LIMIT ? OFFSET ?"
+        ))
+        .bind(match_query)
+        .bind(match_query)
+        .bind(match_query)
+        .bind(params.per_page as i64)
+        .bind(offset as i64)
+        .fetch_all(&self.read_pool)
+        .await
+        .map_err(DbError::from)?;
+
+        let entities = rows
+            .into_iter()
+            .map(Self::map_row_to_entity)
+            .collect::<DomainResult<Vec<Participant>>>()?;
+
+        Ok(PaginatedResult::new(entities, total as u64, params))
+    }
 }
 
 #[async_trait]
@@ -318,7 +420,7 @@ impl FindById<Participant> for SqliteParticipantRepository {
             "SELECT * FROM participants WHERE id = ? AND deleted_at IS NULL",
         )
         .bind(id.to_string())
-        .fetch_optional(&self.pool)
+        .fetch_optional(&self.read_pool)
         .await
         .map_err(|e| {
             println!("🚨 [PARTICIPANT_REPO] Database error finding participant {}: {}", id, e);
@@ -602,6 +704,99 @@ impl ParticipantRepository for SqliteParticipantRepository {
         self.find_by_id_with_tx(id, tx).await
     }
 
+    async fn bulk_create(
+        &self,
+        new_participants: &[NewParticipant],
+        auth: &AuthContext,
+    ) -> DomainResult<Vec<Uuid>> {
+        let now = Utc::now();
+        let now_str = now.to_rfc3339();
+        let user_id_str = auth.user_id.to_string();
+        let device_uuid: Option<Uuid> = auth.device_id.parse::<Uuid>().ok();
+        let device_id_str = device_uuid.map(|u| u.to_string());
+        let ids: Vec<Uuid> = new_participants.iter().map(|_| Uuid::new_v4()).collect();
+        let id_strs: Vec<String> = ids.iter().map(Uuid::to_string).collect();
+        let created_by: Vec<String> = new_participants.iter()
+            .map(|p| p.created_by_user_id.map(|id| id.to_string()).unwrap_or_else(|| user_id_str.clone()))
+            .collect();
+
+        let mut tx = self.pool.begin().await.map_err(DbError::from)?;
+        for (start, chunk) in (0..).step_by(PARTICIPANT_INSERT_CHUNK).zip(new_participants.chunks(PARTICIPANT_INSERT_CHUNK)) {
+            let mut builder = QueryBuilder::<Sqlite>::new(
+                r#"INSERT INTO participants (
+                    id, name, name_updated_at, name_updated_by, name_updated_by_device_id,
+                    gender, gender_updated_at, gender_updated_by, gender_updated_by_device_id,
+                    disability, disability_updated_at, disability_updated_by, disability_updated_by_device_id,
+                    disability_type, disability_type_updated_at, disability_type_updated_by, disability_type_updated_by_device_id,
+                    age_group, age_group_updated_at, age_group_updated_by, age_group_updated_by_device_id,
+                    location, location_updated_at, location_updated_by, location_updated_by_device_id,
+                    sync_priority,
+                    created_at, updated_at, created_by_user_id, updated_by_user_id,
+                    created_by_device_id, updated_by_device_id
+                ) "#
+            );
+            // Field LWW metadata is set only for fields that were provided, as in `create_with_tx`
+            let stamp = |present: bool| {
+                if present {
+                    (Some(now_str.as_str()), Some(user_id_str.as_str()), device_id_str.as_deref())
+                } else {
+                    (None, None, None)
+                }
+            };
+            builder.push_values(chunk.iter().enumerate(), |mut row, (i, p)| {
+                let (gender, disability, disability_type, age_group, location) = (
+                    stamp(p.gender.is_some()),
+                    stamp(p.disability.is_some()),
+                    stamp(p.disability_type.is_some()),
+                    stamp(p.age_group.is_some()),
+                    stamp(p.location.is_some()),
+                );
+                row.push_bind(id_strs[start + i].as_str())
+                    .push_bind(p.name.as_str())
+                    .push_bind(now_str.as_str()).push_bind(user_id_str.as_str()).push_bind(device_id_str.as_deref())
+                    .push_bind(p.gender.as_deref())
+                    .push_bind(gender.0).push_bind(gender.1).push_bind(gender.2)
+                    .push_bind(p.disability.unwrap_or(false))
+                    .push_bind(disability.0).push_bind(disability.1).push_bind(disability.2)
+                    .push_bind(p.disability_type.as_deref())
+                    .push_bind(disability_type.0).push_bind(disability_type.1).push_bind(disability_type.2)
+                    .push_bind(p.age_group.as_deref())
+                    .push_bind(age_group.0).push_bind(age_group.1).push_bind(age_group.2)
+                    .push_bind(p.location.as_deref())
+                    .push_bind(location.0).push_bind(location.1).push_bind(location.2)
+                    .push_bind(p.sync_priority.unwrap_or_default().as_str())
+                    .push_bind(now_str.as_str()).push_bind(now_str.as_str())
+                    .push_bind(created_by[start + i].as_str()).push_bind(user_id_str.as_str())
+                    .push_bind(device_id_str.as_deref()).push_bind(device_id_str.as_deref());
+            });
+            builder.build().execute(&mut *tx).await.map_err(DbError::from)?;
+
+            let entries: Vec<ChangeLogEntry> = chunk.iter().enumerate()
+                .map(|(i, p)| ChangeLogEntry {
+                    operation_id: Uuid::new_v4(),
+                    entity_table: self.entity_name().to_string(),
+                    entity_id: ids[start + i],
+                    operation_type: ChangeOperationType::Create,
+                    field_name: None,
+                    old_value: None,
+                    new_value: serde_json::to_string(p).ok(),
+                    timestamp: now,
+                    user_id: auth.user_id,
+                    device_id: device_uuid,
+                    document_metadata: None,
+                    sync_batch_id: None,
+                    processed_at: None,
+                    sync_error: None,
+                })
+                .collect();
+            self.change_log_repo.create_change_logs_with_tx(&entries, &mut tx).await?;
+        }
+        tx.commit().await.map_err(DbError::from)?;
+
+        println!("✅ [PARTICIPANT_REPO] Bulk created {} participants", ids.len());
+        Ok(ids)
+    }
+
     async fn update(
         &self,
         id: Uuid,
@@ -811,7 +1006,7 @@ impl ParticipantRepository for SqliteParticipantRepository {
 
         // **OPTIMIZATION: Use separate queries to avoid lock escalation**
         let total: i64 = query_scalar("SELECT COUNT(*) FROM participants WHERE deleted_at IS NULL")
-            .fetch_one(&self.pool)
+            .fetch_one(&self.read_pool)
             .await
             .map_err(|e| {
                 println!("🚨 [PARTICIPANT_REPO] Error counting participants: {}", e);
@@ -823,7 +1018,7 @@ impl ParticipantRepository for SqliteParticipantRepository {
         )
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(|e| {
             println!("🚨 [PARTICIPANT_REPO] Error fetching participants: {}", e);
@@ -865,7 +1060,7 @@ impl ParticipantRepository for SqliteParticipantRepository {
         for id_str in &id_strings {
             count_builder = count_builder.bind(id_str);
         }
-        let total = count_builder.fetch_one(&self.pool).await.map_err(DbError::from)?;
+        let total = count_builder.fetch_one(&self.read_pool).await.map_err(DbError::from)?;
 
         // Build dynamic select query
         let select_query = format!(
@@ -879,7 +1074,7 @@ impl ParticipantRepository for SqliteParticipantRepository {
         let rows = select_builder
             .bind(params.per_page as i64)
             .bind(offset as i64)
-            .fetch_all(&self.pool)
+            .fetch_all(&self.read_pool)
             .await
             .map_err(DbError::from)?;
 
@@ -950,13 +1145,9 @@ impl ParticipantRepository for SqliteParticipantRepository {
         update_builder.push_bind(now_str.clone());
         update_builder.push(", updated_by_user_id = "); 
         update_builder.push_bind(user_id_str.clone());
-        update_builder.push(" WHERE id IN (");
-        
-        let mut id_separated = update_builder.separated(",");
-        for id in ids { 
-            id_separated.push_bind(id.to_string()); 
-        }
-        update_builder.push(") AND deleted_at IS NULL");
+        update_builder.push(" WHERE ");
+        update_builder.push_in_json("id", ids);
+        update_builder.push(" AND deleted_at IS NULL");
 
         let query = update_builder.build();
         let result = query.execute(&mut *tx).await.map_err(DbError::from)?;
@@ -994,79 +1185,29 @@ impl ParticipantRepository for SqliteParticipantRepository {
     }
     
     async fn count_by_gender(&self) -> DomainResult<Vec<(Option<String>, i64)>> {
-        let counts = query_as::<_, (Option<String>, i64)>(
-            "SELECT gender, COUNT(*) 
-             FROM participants 
-             WHERE deleted_at IS NULL 
-             GROUP BY gender"
-        )
-        .fetch_all(&self.pool)
-        .await
-        .map_err(DbError::from)?;
-
-        Ok(counts)
+        stat_counters::text_breakdown(&self.read_pool, "participants", "gender").await
     }
     
     async fn count_by_age_group(&self) -> DomainResult<Vec<(Option<String>, i64)>> {
-        let counts = query_as::<_, (Option<String>, i64)>(
-            "SELECT age_group, COUNT(*) 
-             FROM participants 
-             WHERE deleted_at IS NULL 
-             GROUP BY age_group"
-        )
-        .fetch_all(&self.pool)
-        .await
-        .map_err(DbError::from)?;
-
-        Ok(counts)
+        stat_counters::text_breakdown(&self.read_pool, "participants", "age_group").await
     }
     
     async fn count_by_location(&self) -> DomainResult<Vec<(Option<String>, i64)>> {
-        let counts = query_as::<_, (Option<String>, i64)>(
-            "SELECT location, COUNT(*) 
-             FROM participants 
-             WHERE deleted_at IS NULL 
-             GROUP BY location"
-        )
-        .fetch_all(&self.pool)
-        .await
-        .map_err(DbError::from)?;
-
-        Ok(counts)
+        stat_counters::text_breakdown(&self.read_pool, "participants", "location").await
     }
     
     async fn count_by_disability(&self) -> DomainResult<Vec<(bool, i64)>> {
-        let counts = query_as::<_, (i64, i64)>(
-            "SELECT disability, COUNT(*) 
-             FROM participants 
-             WHERE deleted_at IS NULL 
-             GROUP BY disability"
-        )
-        .fetch_all(&self.pool)
-        .await
-        .map_err(DbError::from)?;
+        let counts = stat_counters::integer_breakdown(&self.read_pool, "participants", "disability").await?;
 
         // Convert i64 to bool for the first element
-        let bool_counts: Vec<(bool, i64)> = counts
+        Ok(counts
             .into_iter()
-            .map(|(disability, count)| (disability != 0, count))
-            .collect();
-
-        Ok(bool_counts)
+            .map(|(disability, count)| (disability.unwrap_or(0) != 0, count))
+            .collect())
     }
     
     async fn count_by_disability_type(&self) -> DomainResult<Vec<(Option<String>, i64)>> {
-        let counts = query_as::<_, (Option<String>, i64)>(
-            "SELECT disability_type, COUNT(*) 
-             FROM participants 
-             WHERE deleted_at IS NULL AND disability = 1
-             GROUP BY disability_type"
-        )
-        .fetch_all(&self.pool)
-        .await
-        .map_err(DbError::from)?;
-
-        Ok(counts)
+        stat_counters::text_breakdown(&self.read_pool, "participants", "disability_type").await
     }
     
     async fn get_available_disability_types(&self) -> DomainResult<Vec<String>> {
@@ -1077,7 +1218,7 @@ impl ParticipantRepository for SqliteParticipantRepository {
              AND deleted_at IS NULL
              ORDER BY disability_type ASC"
         )
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
         
@@ -1094,19 +1235,9 @@ impl ParticipantRepository for SqliteParticipantRepository {
         let mut demographics = ParticipantDemographics::new();
         
         // === Basic Counts ===
-        demographics.total_participants = query_scalar(
-            "SELECT COUNT(*) FROM participants"
-        )
-        .fetch_one(&self.pool)
-        .await
-        .map_err(DbError::from)?;
+        demographics.total_participants = stat_counters::row_count(&self.read_pool, "participants", stat_counters::TOTAL).await?;
         
-        demographics.active_participants = query_scalar(
-            "SELECT COUNT(*) FROM participants WHERE deleted_at IS NULL"
-        )
-        .fetch_one(&self.pool)
-        .await
-        .map_err(DbError::from)?;
+        demographics.active_participants = stat_counters::row_count(&self.read_pool, "participants", stat_counters::ACTIVE).await?;
         
         demographics.deleted_participants = demographics.total_participants - demographics.active_participants;
         
@@ -1153,7 +1284,7 @@ impl ParticipantRepository for SqliteParticipantRepository {
              JOIN participants p ON wp.participant_id = p.id 
              WHERE wp.deleted_at IS NULL AND p.deleted_at IS NULL"
         )
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
         
@@ -1163,7 +1294,7 @@ impl ParticipantRepository for SqliteParticipantRepository {
              JOIN participants p ON l.participant_id = p.id 
              WHERE l.deleted_at IS NULL AND p.deleted_at IS NULL"
         )
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
         
@@ -1173,7 +1304,7 @@ impl ParticipantRepository for SqliteParticipantRepository {
              JOIN participants p ON md.related_id = p.id 
              WHERE md.related_table = 'participants' AND md.deleted_at IS NULL AND p.deleted_at IS NULL"
         )
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
         
@@ -1194,7 +1325,7 @@ impl ParticipantRepository for SqliteParticipantRepository {
             WHERE wp.deleted_at IS NULL AND p.deleted_at IS NULL
             GROUP BY wp.participant_id
         ")
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
         
@@ -1232,7 +1363,7 @@ impl ParticipantRepository for SqliteParticipantRepository {
             WHERE dt.deleted_at IS NULL
             GROUP BY dt.id, dt.name
         ")
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
         
@@ -1251,7 +1382,7 @@ impl ParticipantRepository for SqliteParticipantRepository {
             "SELECT COUNT(*) FROM participants WHERE created_at >= ?"
         )
         .bind(&month_start)
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
         
@@ -1259,7 +1390,7 @@ impl ParticipantRepository for SqliteParticipantRepository {
             "SELECT COUNT(*) FROM participants WHERE created_at >= ?"
         )
         .bind(&year_start)
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
         
@@ -1273,7 +1404,7 @@ impl ParticipantRepository for SqliteParticipantRepository {
             GROUP BY strftime('%Y-%m', created_at)
             ORDER BY month
         ")
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
         
@@ -1287,21 +1418,21 @@ impl ParticipantRepository for SqliteParticipantRepository {
         demographics.participants_missing_gender = query_scalar(
             "SELECT COUNT(*) FROM participants WHERE (gender IS NULL OR gender = '') AND deleted_at IS NULL"
         )
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
         
         demographics.participants_missing_age_group = query_scalar(
             "SELECT COUNT(*) FROM participants WHERE (age_group IS NULL OR age_group = '') AND deleted_at IS NULL"
         )
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
         
         demographics.participants_missing_location = query_scalar(
             "SELECT COUNT(*) FROM participants WHERE (location IS NULL OR location = '') AND deleted_at IS NULL"
         )
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
         
@@ -1323,7 +1454,7 @@ impl ParticipantRepository for SqliteParticipantRepository {
             "SELECT COUNT(*) FROM participants WHERE gender = ? AND deleted_at IS NULL"
         )
         .bind(gender)
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1335,7 +1466,7 @@ impl ParticipantRepository for SqliteParticipantRepository {
         .bind(gender)
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1363,7 +1494,7 @@ impl ParticipantRepository for SqliteParticipantRepository {
             "SELECT COUNT(*) FROM participants WHERE age_group = ? AND deleted_at IS NULL"
         )
         .bind(age_group)
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1375,7 +1506,7 @@ impl ParticipantRepository for SqliteParticipantRepository {
         .bind(age_group)
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1403,7 +1534,7 @@ impl ParticipantRepository for SqliteParticipantRepository {
             "SELECT COUNT(*) FROM participants WHERE location = ? AND deleted_at IS NULL"
         )
         .bind(location)
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1415,7 +1546,7 @@ impl ParticipantRepository for SqliteParticipantRepository {
         .bind(location)
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1444,7 +1575,7 @@ impl ParticipantRepository for SqliteParticipantRepository {
             "SELECT COUNT(*) FROM participants WHERE disability = ? AND deleted_at IS NULL"
         )
         .bind(disability_val)
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1456,7 +1587,7 @@ impl ParticipantRepository for SqliteParticipantRepository {
         .bind(disability_val)
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1484,7 +1615,7 @@ impl ParticipantRepository for SqliteParticipantRepository {
             "SELECT COUNT(*) FROM participants WHERE disability_type = ? AND deleted_at IS NULL"
         )
         .bind(disability_type)
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1496,7 +1627,7 @@ impl ParticipantRepository for SqliteParticipantRepository {
         .bind(disability_type)
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1516,190 +1647,102 @@ impl ParticipantRepository for SqliteParticipantRepository {
         &self,
         filter: &ParticipantFilter,
     ) -> DomainResult<Vec<Uuid>> {
+        // List filters bind as one JSON array each, so the SQL text (and the
+        // cached prepared statement) only changes with the filter shape.
         let mut query_builder = QueryBuilder::new("SELECT id FROM participants");
         let mut has_conditions = false;
         
         // Base condition for deletion status
         if filter.exclude_deleted {
-            query_builder.push(" WHERE deleted_at IS NULL");
-            has_conditions = true;
+            query_builder.push_condition(&mut has_conditions).push("deleted_at IS NULL");
         }
         
         // Gender filter (multiple values)
-        if let Some(genders) = &filter.genders {
-            if !genders.is_empty() {
-                if has_conditions {
-                    query_builder.push(" AND ");
-                } else {
-                    query_builder.push(" WHERE ");
-                    has_conditions = true;
-                }
-                query_builder.push("gender IN (");
-                let mut separated = query_builder.separated(",");
-                for gender in genders {
-                    separated.push_bind(gender);
-                }
-                separated.push_unseparated(")");
-            }
+        if let Some(genders) = filter.genders.as_ref().filter(|v| !v.is_empty()) {
+            query_builder.push_condition(&mut has_conditions).push_in_json("gender", genders);
         }
         
         // Age groups filter (multiple values)
-        if let Some(age_groups) = &filter.age_groups {
-            if !age_groups.is_empty() {
-                if has_conditions {
-                    query_builder.push(" AND ");
-                } else {
-                    query_builder.push(" WHERE ");
-                    has_conditions = true;
-                }
-                query_builder.push("age_group IN (");
-                let mut separated = query_builder.separated(",");
-                for age_group in age_groups {
-                    separated.push_bind(age_group);
-                }
-                separated.push_unseparated(")");
-            }
+        if let Some(age_groups) = filter.age_groups.as_ref().filter(|v| !v.is_empty()) {
+            query_builder.push_condition(&mut has_conditions).push_in_json("age_group", age_groups);
         }
         
         // Locations filter (multiple values)
-        if let Some(locations) = &filter.locations {
-            if !locations.is_empty() {
-                if has_conditions {
-                    query_builder.push(" AND ");
-                } else {
-                    query_builder.push(" WHERE ");
-                    has_conditions = true;
-                }
-                query_builder.push("location IN (");
-                let mut separated = query_builder.separated(",");
-                for location in locations {
-                    separated.push_bind(location);
-                }
-                separated.push_unseparated(")");
-            }
+        if let Some(locations) = filter.locations.as_ref().filter(|v| !v.is_empty()) {
+            query_builder.push_condition(&mut has_conditions).push_in_json("location", locations);
         }
         
         // Disability filtering - enhanced logic for grouped UI approach
         if let Some(disability_types) = &filter.disability_types {
-            if !disability_types.is_empty() && disability_types.len() < 10 {
+            if !disability_types.is_empty() {
                 // Specific disability types selected - this implies disability = true
-                query_builder.push(" AND (disability = 1 AND disability_type IN (");
-                let mut separated = query_builder.separated(", ");
-                for disability_type in disability_types {
-                    separated.push_bind(disability_type);
-                }
-                separated.push_unseparated("))");
+                query_builder.push_condition(&mut has_conditions)
+                    .push("(disability = 1 AND ")
+                    .push_in_json("disability_type", disability_types)
+                    .push(")");
             }
         } else if let Some(disability) = filter.disability {
             // General disability filter (only applied if no specific types selected)
-            query_builder.push(" AND disability = ").push_bind(disability);
+            query_builder.push_condition(&mut has_conditions).push("disability = ").push_bind(disability);
         }
         
         // Search text filter (searches name, disability_type, location)
         if let Some(search_text) = &filter.search_text {
             if !search_text.trim().is_empty() {
-                if has_conditions {
-                    query_builder.push(" AND ");
-                } else {
-                    query_builder.push(" WHERE ");
-                    has_conditions = true;
-                }
                 let search_pattern = format!("%{}%", search_text.trim());
-                query_builder.push("(name LIKE ");
-                query_builder.push_bind(search_pattern.clone());
-                query_builder.push(" OR disability_type LIKE ");
-                query_builder.push_bind(search_pattern.clone());
-                query_builder.push(" OR location LIKE ");
-                query_builder.push_bind(search_pattern);
-                query_builder.push(")");
+                query_builder.push_condition(&mut has_conditions)
+                    .push("(name LIKE ")
+                    .push_bind(search_pattern.clone())
+                    .push(" OR disability_type LIKE ")
+                    .push_bind(search_pattern.clone())
+                    .push(" OR location LIKE ")
+                    .push_bind(search_pattern)
+                    .push(")");
             }
         }
         
         // Date range filter
         if let Some((start_date, end_date)) = &filter.date_range {
-            if has_conditions {
-                query_builder.push(" AND ");
-            } else {
-                query_builder.push(" WHERE ");
-                has_conditions = true;
-            }
-            query_builder.push("created_at BETWEEN ");
-            query_builder.push_bind(start_date);
-            query_builder.push(" AND ");
-            query_builder.push_bind(end_date);
+            query_builder.push_condition(&mut has_conditions)
+                .push("created_at BETWEEN ")
+                .push_bind(start_date)
+                .push(" AND ")
+                .push_bind(end_date);
         }
         
         // Created by user filter
-        if let Some(user_ids) = &filter.created_by_user_ids {
-            if !user_ids.is_empty() {
-                if has_conditions {
-                    query_builder.push(" AND ");
-                } else {
-                    query_builder.push(" WHERE ");
-                    has_conditions = true;
-                }
-                query_builder.push("created_by_user_id IN (");
-                let mut separated = query_builder.separated(",");
-                for user_id in user_ids {
-                    separated.push_bind(user_id.to_string());
-                }
-                separated.push_unseparated(")");
-            }
+        if let Some(user_ids) = filter.created_by_user_ids.as_ref().filter(|v| !v.is_empty()) {
+            query_builder.push_condition(&mut has_conditions).push_in_json("created_by_user_id", user_ids);
         }
         
         // Workshop participation filter
-        if let Some(workshop_ids) = &filter.workshop_ids {
-            if !workshop_ids.is_empty() {
-                if has_conditions {
-                    query_builder.push(" AND ");
-                } else {
-                    query_builder.push(" WHERE ");
-                    has_conditions = true;
-                }
-                query_builder.push("id IN (SELECT DISTINCT participant_id FROM workshop_participants WHERE workshop_id IN (");
-                let mut separated = query_builder.separated(",");
-                for workshop_id in workshop_ids {
-                    separated.push_bind(workshop_id.to_string());
-                }
-                separated.push_unseparated(") AND deleted_at IS NULL)");
-            }
+        if let Some(workshop_ids) = filter.workshop_ids.as_ref().filter(|v| !v.is_empty()) {
+            query_builder.push_condition(&mut has_conditions)
+                .push("id IN (SELECT DISTINCT participant_id FROM workshop_participants WHERE ")
+                .push_in_json("workshop_id", workshop_ids)
+                .push(" AND deleted_at IS NULL)");
         }
         
         // Document existence filter
         if let Some(has_documents) = filter.has_documents {
-            if has_conditions {
-                query_builder.push(" AND ");
-            } else {
-                query_builder.push(" WHERE ");
-                has_conditions = true;
-            }
+            query_builder.push_condition(&mut has_conditions);
             if has_documents {
-                query_builder.push("id IN (SELECT DISTINCT entity_id FROM media_documents WHERE entity_table = 'participants' AND deleted_at IS NULL)");
+                query_builder.push("id IN (SELECT DISTINCT related_id FROM media_documents WHERE related_table = 'participants' AND related_id IS NOT NULL AND deleted_at IS NULL)");
             } else {
-                query_builder.push("id NOT IN (SELECT DISTINCT entity_id FROM media_documents WHERE entity_table = 'participants' AND deleted_at IS NULL)");
+                query_builder.push("id NOT IN (SELECT DISTINCT related_id FROM media_documents WHERE related_table = 'participants' AND related_id IS NOT NULL AND deleted_at IS NULL)");
             }
         }
         
         // Document linked fields filter
-        if let Some(linked_fields) = &filter.document_linked_fields {
-            if !linked_fields.is_empty() {
-                if has_conditions {
-                    query_builder.push(" AND ");
-                } else {
-                    query_builder.push(" WHERE ");
-                    has_conditions = true;
-                }
-                query_builder.push("id IN (SELECT DISTINCT entity_id FROM media_documents WHERE entity_table = 'participants' AND linked_field IN (");
-                let mut separated = query_builder.separated(",");
-                for field in linked_fields {
-                    separated.push_bind(field);
-                }
-                separated.push_unseparated(") AND deleted_at IS NULL)");
-            }
+        if let Some(linked_fields) = filter.document_linked_fields.as_ref().filter(|v| !v.is_empty()) {
+            query_builder.push_condition(&mut has_conditions)
+                .push("id IN (SELECT DISTINCT related_id FROM media_documents WHERE related_table = 'participants' AND ")
+                .push_in_json("field_identifier", linked_fields)
+                .push(" AND deleted_at IS NULL)");
         }
 
         let query = query_builder.build_query_as::<(String,)>();
-        let rows = query.fetch_all(&self.pool).await.map_err(DbError::from)?;
+        let rows = query.fetch_all(&self.read_pool).await.map_err(DbError::from)?;
         
         rows.into_iter()
             .map(|(id_str,)| {
@@ -1729,7 +1772,7 @@ impl ParticipantRepository for SqliteParticipantRepository {
              AND wp.deleted_at IS NULL"
         )
         .bind(&workshop_id_str)
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1747,7 +1790,7 @@ impl ParticipantRepository for SqliteParticipantRepository {
         .bind(&workshop_id_str)
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1799,7 +1842,7 @@ impl ParticipantRepository for SqliteParticipantRepository {
         )
         .bind(&today)
         .bind(&participant_id_str)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
         
@@ -1856,7 +1899,7 @@ impl ParticipantRepository for SqliteParticipantRepository {
             "#
         )
         .bind(&participant_id_str)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
         
@@ -1906,7 +1949,7 @@ impl ParticipantRepository for SqliteParticipantRepository {
         .bind(&today)
         .bind(&today)
         .bind(&participant_id_str)
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
         
@@ -1937,13 +1980,84 @@ impl ParticipantRepository for SqliteParticipantRepository {
             "#
         )
         .bind(&participant_id_str)
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
         
         Ok((total, active))
     }
     
+    async fn count_workshops_for_participants(
+        &self,
+        participant_ids: &[Uuid],
+    ) -> DomainResult<HashMap<Uuid, (i64, i64, i64)>> {
+        if participant_ids.is_empty() {
+            return Ok(HashMap::new());
+        }
+        let today = Local::now().naive_local().date().format("%Y-%m-%d").to_string();
+        
+        let rows = query_as::<_, (String, i64, i64, i64)>(
+            r#"
+            SELECT 
+                wp.participant_id,
+                COUNT(*) as total,
+                COUNT(CASE WHEN w.event_date IS NOT NULL AND date(w.event_date) < date(?) THEN 1 END) as completed,
+                COUNT(CASE WHEN w.event_date IS NOT NULL AND date(w.event_date) >= date(?) THEN 1 END) as upcoming
+            FROM 
+                workshops w
+            JOIN 
+                workshop_participants wp ON w.id = wp.workshop_id
+            WHERE 
+                wp.participant_id IN (SELECT value FROM json_each(?))
+                AND w.deleted_at IS NULL
+                AND wp.deleted_at IS NULL
+            GROUP BY wp.participant_id
+            "#
+        )
+        .bind(&today)
+        .bind(&today)
+        .bind(uuid_list_json(participant_ids))
+        .fetch_all(&self.read_pool)
+        .await
+        .map_err(DbError::from)?;
+        
+        Ok(parse_keyed_rows(rows.into_iter().map(|(id, t, c, u)| (id, (t, c, u))).collect()))
+    }
+    
+    async fn count_livelihoods_for_participants(
+        &self,
+        participant_ids: &[Uuid],
+    ) -> DomainResult<HashMap<Uuid, (i64, i64)>> {
+        if participant_ids.is_empty() {
+            return Ok(HashMap::new());
+        }
+        
+        let rows = query_as::<_, (String, i64, i64)>(
+            r#"
+            SELECT 
+                l.participant_id,
+                COUNT(*) as total,
+                COUNT(CASE 
+                    WHEN l.status_id IN (SELECT id FROM status_types WHERE value IN ('active', 'ongoing')) 
+                    THEN 1 
+                    ELSE NULL 
+                END) as active
+            FROM 
+                livelihoods l
+            WHERE 
+                l.participant_id IN (SELECT value FROM json_each(?))
+                AND l.deleted_at IS NULL
+            GROUP BY l.participant_id
+            "#
+        )
+        .bind(uuid_list_json(participant_ids))
+        .fetch_all(&self.read_pool)
+        .await
+        .map_err(DbError::from)?;
+        
+        Ok(parse_keyed_rows(rows.into_iter().map(|(id, t, a)| (id, (t, a))).collect()))
+    }
+    
     /// Get document counts by type for a participant
     async fn get_participant_document_counts_by_type(
         &self,
@@ -1963,7 +2077,7 @@ impl ParticipantRepository for SqliteParticipantRepository {
              ORDER BY dt.name"
         )
         .bind(&participant_id_str)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
         
@@ -1989,7 +2103,7 @@ impl ParticipantRepository for SqliteParticipantRepository {
              AND deleted_at IS NULL"
         )
         .bind(&participant_id_str)
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
         
@@ -2013,7 +2127,7 @@ impl ParticipantRepository for SqliteParticipantRepository {
         )
         .bind(start_date.to_rfc3339())
         .bind(end_date.to_rfc3339())
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -2025,7 +2139,7 @@ impl ParticipantRepository for SqliteParticipantRepository {
         .bind(end_date.to_rfc3339())
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -2079,15 +2193,11 @@ impl ParticipantRepository for SqliteParticipantRepository {
         println!("📋 [PARTICIPANT_REPO] Fetching {} participants for current page", page_ids.len());
         
         // **ROBUST: Fetch the actual entities for this page with comprehensive error handling**
-        let mut query_builder = QueryBuilder::new("SELECT * FROM participants WHERE id IN (");
-        let mut separated = query_builder.separated(",");
-        for id in &page_ids {
-            separated.push_bind(id.to_string());
-        }
-        separated.push_unseparated(") ORDER BY name ASC");
+        let mut query_builder = QueryBuilder::new("SELECT * FROM participants WHERE ");
+        query_builder.push_in_json("id", &page_ids).push(" ORDER BY name ASC");
         
         let query = query_builder.build_query_as::<ParticipantRow>();
-        let rows = query.fetch_all(&self.pool).await.map_err(|e| {
+        let rows = query.fetch_all(&self.read_pool).await.map_err(|e| {
             println!("🚨 [PARTICIPANT_REPO] Error fetching filtered participants: {}", e);
             DbError::from(e)
         })?;
@@ -2141,7 +2251,7 @@ impl ParticipantRepository for SqliteParticipantRepository {
             "SELECT * FROM participants WHERE LOWER(name) = LOWER(?) AND deleted_at IS NULL"
         )
         .bind(name)
-        .fetch_optional(&self.pool)
+        .fetch_optional(&self.read_pool)
         .await
         .map_err(|e| {
             println!("🚨 [PARTICIPANT_REPO] Database error finding participant by name '{}': {}", name, e);
@@ -2168,7 +2278,7 @@ impl ParticipantRepository for SqliteParticipantRepository {
             "SELECT * FROM participants WHERE LOWER(name) = LOWER(?) AND deleted_at IS NULL ORDER BY created_at DESC"
         )
         .bind(name)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(|e| {
             println!("🚨 [PARTICIPANT_REPO] Database error finding participants by name '{}': {}", name, e);
@@ -2217,7 +2327,7 @@ impl ParticipantRepository for SqliteParticipantRepository {
             let row = query(&query_str)
                 .bind(&field.field_name)
                 .bind(&participant_id_str)
-                .fetch_optional(&self.pool)
+                .fetch_optional(&self.read_pool)
                 .await
                 .map_err(|e| {
                     println!("🚨 [PARTICIPANT_REPO] Document reference query failed for field '{}': {}", field.field_name, e);
@@ -2299,7 +2409,7 @@ impl ParticipantRepository for SqliteParticipantRepository {
         
         let row = query(query_str)
             .bind(participant_id.to_string())
-            .fetch_optional(&self.pool)
+            .fetch_optional(&self.read_pool)
             .await
             .map_err(|e| {
                 println!("🚨 [PARTICIPANT_REPO] Enrichment query failed for participant {}: {}", participant_id, e);
@@ -2377,9 +2487,16 @@ impl ParticipantRepository for SqliteParticipantRepository {
         &self,
         search_query: &str,
         params: PaginationParams,
+        mode: SearchMode,
     ) -> DomainResult<PaginatedResult<Participant>> {
         println!("🔍 [PARTICIPANT_REPO] Searching participants with relationships: '{}'", search_query);
         
+        if mode == SearchMode::Fts {
+            if let Some(match_query) = fts_match_query(search_query) {
+                return self.search_participants_fts(&match_query, params).await;
+            }
+        }
+        
         let offset = (params.page - 1) * params.per_page;
         let search_term = format!("%{}%", search_query);
 
@@ -2397,8 +2514,8 @@ impl ParticipantRepository for SqliteParticipantRepository {
                 OR p.age_group LIKE ? 
                 OR p.location LIKE ?
                 OR p.disability_type LIKE ?
-                OR w.name LIKE ?
-                OR l.business_name LIKE ?
+                OR w.purpose LIKE ?
+                OR l.description LIKE ?
             )
         "#;
 
@@ -2410,7 +2527,7 @@ impl ParticipantRepository for SqliteParticipantRepository {
             .bind(&search_term)
             .bind(&search_term)
             .bind(&search_term)
-            .fetch_one(&self.pool)
+            .fetch_one(&self.read_pool)
             .await
             .map_err(|e| {
                 println!("🚨 [PARTICIPANT_REPO] Search count query failed: {}", e);
@@ -2431,8 +2548,8 @@ impl ParticipantRepository for SqliteParticipantRepository {
                 OR p.age_group LIKE ? 
                 OR p.location LIKE ?
                 OR p.disability_type LIKE ?
-                OR w.name LIKE ?
-                OR l.business_name LIKE ?
+                OR w.purpose LIKE ?
+                OR l.description LIKE ?
             )
             ORDER BY p.name ASC 
             LIMIT ? OFFSET ?
@@ -2448,7 +2565,7 @@ impl ParticipantRepository for SqliteParticipantRepository {
             .bind(&search_term)
             .bind(params.per_page as i64)
             .bind(offset as i64)
-            .fetch_all(&self.pool)
+            .fetch_all(&self.read_pool)
             .await
             .map_err(|e| {
                 println!("🚨 [PARTICIPANT_REPO] Search results query failed: {}", e);
@@ -2487,7 +2604,7 @@ impl ParticipantRepository for SqliteParticipantRepository {
         "#;
         
         let stats_row = query(stats_query)
-            .fetch_one(&self.pool)
+            .fetch_one(&self.read_pool)
             .await
             .map_err(|e| {
                 println!("🚨 [PARTICIPANT_REPO] Statistics query failed: {}", e);
@@ -2506,10 +2623,10 @@ impl ParticipantRepository for SqliteParticipantRepository {
         
         // **CONCURRENT: Execute all demographic queries in parallel**
         let (gender_rows, age_rows, location_rows, disability_type_rows) = tokio::try_join!(
-            query_as::<_, (Option<String>, i64)>(gender_query).fetch_all(&self.pool),
-            query_as::<_, (Option<String>, i64)>(age_query).fetch_all(&self.pool),
-            query_as::<_, (Option<String>, i64)>(location_query).fetch_all(&self.pool),
-            query_as::<_, (Option<String>, i64)>(disability_type_query).fetch_all(&self.pool)
+            query_as::<_, (Option<String>, i64)>(gender_query).fetch_all(&self.read_pool),
+            query_as::<_, (Option<String>, i64)>(age_query).fetch_all(&self.read_pool),
+            query_as::<_, (Option<String>, i64)>(location_query).fetch_all(&self.read_pool),
+            query_as::<_, (Option<String>, i64)>(disability_type_query).fetch_all(&self.read_pool)
         ).map_err(|e| {
             println!("🚨 [PARTICIPANT_REPO] Demographic aggregation failed: {}", e);
             DbError::from(e)
@@ -2558,7 +2675,7 @@ impl ParticipantRepository for SqliteParticipantRepository {
         "#;
         
         let engagement_rows = query_as::<_, (String, i64)>(engagement_query)
-            .fetch_all(&self.pool)
+            .fetch_all(&self.read_pool)
             .await
             .map_err(|e| {
                 println!("🚨 [PARTICIPANT_REPO] Engagement analysis failed: {}", e);
@@ -2580,7 +2697,7 @@ impl ParticipantRepository for SqliteParticipantRepository {
         "#;
         
         let monthly_rows = query_as::<_, (String, i64)>(monthly_trends_query)
-            .fetch_all(&self.pool)
+            .fetch_all(&self.read_pool)
             .await
             .map_err(|e| {
                 println!("🚨 [PARTICIPANT_REPO] Monthly trends analysis failed: {}", e);
@@ -2718,7 +2835,7 @@ impl ParticipantRepository for SqliteParticipantRepository {
         
         for (index_name, check_query) in index_check_queries {
             let exists = query_scalar::<_, String>(check_query)
-                .fetch_optional(&self.pool)
+                .fetch_optional(&self.read_pool)
                 .await
                 .map_err(DbError::from)?
                 .is_some();
@@ -2755,7 +2872,7 @@ impl ParticipantRepository for SqliteParticipantRepository {
         
         for (index_name, create_sql) in relationship_indexes {
                     let exists = query_scalar::<_, String>(&format!("SELECT name FROM sqlite_master WHERE type='index' AND name='{}'", index_name))
-            .fetch_optional(&self.pool)
+            .fetch_optional(&self.read_pool)
             .await
             .map_err(DbError::from)?
             .is_some();
@@ -2785,6 +2902,8 @@ impl ParticipantRepository for SqliteParticipantRepository {
         let mut query_builder = QueryBuilder::new("SELECT id FROM participants WHERE 1=1");
         
         // **INDEX OPTIMIZATION: Order conditions by selectivity (most selective first)**
+        // List filters bind as one JSON array each (see `filter_sql`), so any list
+        // size keeps the same statement text.
         
         // 1. Most selective: excluded deleted records (uses primary filter)
         if filter.exclude_deleted {
@@ -2793,14 +2912,11 @@ impl ParticipantRepository for SqliteParticipantRepository {
         
         // 2. High selectivity: disability filter - enhanced logic for grouped UI approach
         if let Some(disability_types) = &filter.disability_types {
-            if !disability_types.is_empty() && disability_types.len() < 10 {
+            if !disability_types.is_empty() {
                 // Specific disability types selected - this implies disability = true
-                query_builder.push(" AND (disability = 1 AND disability_type IN (");
-                let mut separated = query_builder.separated(", ");
-                for disability_type in disability_types {
-                    separated.push_bind(disability_type);
-                }
-                separated.push_unseparated("))");
+                query_builder.push(" AND (disability = 1 AND ")
+                    .push_in_json("disability_type", disability_types)
+                    .push(")");
             }
         } else if let Some(disability) = filter.disability {
             // General disability filter (only applied if no specific types selected)
@@ -2808,37 +2924,16 @@ impl ParticipantRepository for SqliteParticipantRepository {
         }
         
         // 3. Medium-high selectivity: specific field filters
-        if let Some(genders) = &filter.genders {
-            if !genders.is_empty() && genders.len() < 10 { // Only use IN if reasonable list size
-                query_builder.push(" AND gender IN (");
-                let mut separated = query_builder.separated(", ");
-                for gender in genders {
-                    separated.push_bind(gender);
-                }
-                separated.push_unseparated(")");
-            }
+        if let Some(genders) = filter.genders.as_ref().filter(|v| !v.is_empty()) {
+            query_builder.push(" AND ").push_in_json("gender", genders);
         }
         
-        if let Some(age_groups) = &filter.age_groups {
-            if !age_groups.is_empty() && age_groups.len() < 10 {
-                query_builder.push(" AND age_group IN (");
-                let mut separated = query_builder.separated(", ");
-                for age_group in age_groups {
-                    separated.push_bind(age_group);
-                }
-                separated.push_unseparated(")");
-            }
+        if let Some(age_groups) = filter.age_groups.as_ref().filter(|v| !v.is_empty()) {
+            query_builder.push(" AND ").push_in_json("age_group", age_groups);
         }
         
-        if let Some(locations) = &filter.locations {
-            if !locations.is_empty() && locations.len() < 20 {
-                query_builder.push(" AND location IN (");
-                let mut separated = query_builder.separated(", ");
-                for location in locations {
-                    separated.push_bind(location);
-                }
-                separated.push_unseparated(")");
-            }
+        if let Some(locations) = filter.locations.as_ref().filter(|v| !v.is_empty()) {
+            query_builder.push(" AND ").push_in_json("location", locations);
         }
         
         // 4. Lower selectivity: text search (most expensive, do last)
@@ -2878,7 +2973,7 @@ impl ParticipantRepository for SqliteParticipantRepository {
         let query = query_builder.build_query_as::<(String,)>();
         let start_time = std::time::Instant::now();
         
-        let rows = query.fetch_all(&self.pool).await.map_err(|e| {
+        let rows = query.fetch_all(&self.read_pool).await.map_err(|e| {
             println!("🚨 [PARTICIPANT_REPO] Optimized filter query failed: {}", e);
             DbError::from(e)
         })?;
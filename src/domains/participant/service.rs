@@ -4,6 +4,8 @@ use crate::domains::core::dependency_checker::DependencyChecker;
 use crate::domains::core::delete_service::{BaseDeleteService, DeleteOptions, DeleteService, DeleteServiceRepository};
 use crate::domains::core::repository::{DeleteResult, FindById, HardDeletable, SoftDeletable};
 use crate::domains::core::document_linking::DocumentLinkable;
+use crate::domains::core::search::SearchMode;
+use crate::domains::core::loader::RelationLoader;
 use crate::domains::permission::Permission;
 use crate::domains::participant::repository::ParticipantRepository;
 use crate::domains::participant::types::{
@@ -12,7 +14,7 @@ use crate::domains::participant::types::{
     ParticipantWithLivelihoods, ParticipantWithDocumentTimeline, ParticipantFilter, ParticipantDocumentReference,
     ParticipantWithDocumentsByType, ParticipantActivityTimeline, ParticipantWorkshopActivity,
     ParticipantLivelihoodActivity, ParticipantDocumentActivity, ParticipantWithEnrichment,
-    ParticipantEngagementMetrics, ParticipantStatistics, ParticipantBulkOperationResult,
+    ParticipantEngagementMetrics, ParticipantStatistics, ParticipantBulkOperationResult, ParticipantBulkCreateResult,
     ParticipantDuplicateInfo, DuplicateDocumentInfo,
     ParticipantSearchIndex
 };
@@ -294,6 +296,7 @@ pub trait ParticipantService: DeleteService<Participant> + Send + Sync {
         &self,
         search_text: &str,
         params: PaginationParams,
+        mode: SearchMode,
         auth: &AuthContext,
     ) -> ServiceResult<PaginatedResult<ParticipantResponse>>;
 
@@ -325,6 +328,14 @@ pub trait ParticipantService: DeleteService<Participant> + Send + Sync {
         auth: &AuthContext,
     ) -> ServiceResult<ParticipantBulkOperationResult>;
 
+    /// Create many participants at once (imports). Records are validated in
+    /// parallel; the valid ones are inserted in a single transaction.
+    async fn bulk_create_participants(
+        &self,
+        new_participants: Vec<NewParticipant>,
+        auth: &AuthContext,
+    ) -> ServiceResult<ParticipantBulkCreateResult>;
+
     /// Get database index optimization suggestions
     async fn get_index_optimization_suggestions(
         &self,
@@ -428,126 +439,157 @@ impl ParticipantServiceImpl {
     /// Comprehensive enrichment system matching project domain capabilities
     async fn enrich_response(
         &self,
-        mut response: ParticipantResponse,
+        response: ParticipantResponse,
         include: Option<&[ParticipantInclude]>,
         auth: &AuthContext,
     ) -> ServiceResult<ParticipantResponse> {
-        if let Some(includes) = include {
-            // **OPTIMIZATION: Group similar data fetches to reduce database round trips**
+        let relations = RelationLoader::new(self.pool.clone());
+        let mut enriched = self.enrich_responses(vec![response], include, auth, &relations).await?;
+        Ok(enriched.pop().expect("one response in, one out"))
+    }
+
+    /// Enrich a page of responses. Counts are loaded for the whole page at
+    /// once through the request's loader; full relation lists (documents,
+    /// workshops, livelihoods) are still fetched per participant.
+    async fn enrich_responses(
+        &self,
+        mut responses: Vec<ParticipantResponse>,
+        include: Option<&[ParticipantInclude]>,
+        auth: &AuthContext,
+        relations: &RelationLoader,
+    ) -> ServiceResult<Vec<ParticipantResponse>> {
+        let Some(includes) = include else {
+            return Ok(responses);
+        };
+        if responses.is_empty() {
+            return Ok(responses);
+        }
+
+        // Process include options
+        let include_workshop_count = includes.contains(&ParticipantInclude::WorkshopCount) 
+            || includes.contains(&ParticipantInclude::AllCounts) 
+            || includes.contains(&ParticipantInclude::All);
             
-            // Process include options
-            let include_workshop_count = includes.contains(&ParticipantInclude::WorkshopCount) 
-                || includes.contains(&ParticipantInclude::AllCounts) 
-                || includes.contains(&ParticipantInclude::All);
-                
-            let include_livelihood_count = includes.contains(&ParticipantInclude::LivelihoodCount) 
-                || includes.contains(&ParticipantInclude::AllCounts) 
-                || includes.contains(&ParticipantInclude::All);
-                
-            let include_active_livelihood_count = includes.contains(&ParticipantInclude::ActiveLivelihoodCount) 
-                || includes.contains(&ParticipantInclude::AllCounts) 
-                || includes.contains(&ParticipantInclude::All);
-                
-            let include_completed_workshop_count = includes.contains(&ParticipantInclude::CompletedWorkshopCount) 
-                || includes.contains(&ParticipantInclude::AllCounts) 
-                || includes.contains(&ParticipantInclude::All);
-                
-            let include_upcoming_workshop_count = includes.contains(&ParticipantInclude::UpcomingWorkshopCount) 
-                || includes.contains(&ParticipantInclude::AllCounts) 
-                || includes.contains(&ParticipantInclude::All);
-                
-            let include_document_count = includes.contains(&ParticipantInclude::DocumentCount) 
-                || includes.contains(&ParticipantInclude::AllCounts) 
-                || includes.contains(&ParticipantInclude::All);
-                
-            let include_document_counts_by_type = includes.contains(&ParticipantInclude::DocumentCountsByType) 
-                || includes.contains(&ParticipantInclude::AllCounts) 
-                || includes.contains(&ParticipantInclude::All);
-                
-            let include_documents = includes.contains(&ParticipantInclude::Documents) 
-                || includes.contains(&ParticipantInclude::All);
-                
-            let include_workshops = includes.contains(&ParticipantInclude::Workshops) 
-                || includes.contains(&ParticipantInclude::All);
-                
-            let include_livelihoods = includes.contains(&ParticipantInclude::Livelihoods) 
-                || includes.contains(&ParticipantInclude::All);
-
-            // **OPTIMIZATION: Eager field loading - fetch workshop data once if any workshop fields needed**
-            if include_workshop_count || include_completed_workshop_count || include_upcoming_workshop_count || include_workshops {
-                if let Ok((total, completed, upcoming)) = self.repo.count_participant_workshops(response.id).await {
-                    if include_workshop_count {
-                        response.workshop_count = Some(total);
-                    }
-                    if include_completed_workshop_count {
-                        response.completed_workshop_count = Some(completed);
-                    }
-                    if include_upcoming_workshop_count {
-                        response.upcoming_workshop_count = Some(upcoming);
-                    }
+        let include_livelihood_count = includes.contains(&ParticipantInclude::LivelihoodCount) 
+            || includes.contains(&ParticipantInclude::AllCounts) 
+            || includes.contains(&ParticipantInclude::All);
+            
+        let include_active_livelihood_count = includes.contains(&ParticipantInclude::ActiveLivelihoodCount) 
+            || includes.contains(&ParticipantInclude::AllCounts) 
+            || includes.contains(&ParticipantInclude::All);
+            
+        let include_completed_workshop_count = includes.contains(&ParticipantInclude::CompletedWorkshopCount) 
+            || includes.contains(&ParticipantInclude::AllCounts) 
+            || includes.contains(&ParticipantInclude::All);
+            
+        let include_upcoming_workshop_count = includes.contains(&ParticipantInclude::UpcomingWorkshopCount) 
+            || includes.contains(&ParticipantInclude::AllCounts) 
+            || includes.contains(&ParticipantInclude::All);
+            
+        let include_document_count = includes.contains(&ParticipantInclude::DocumentCount) 
+            || includes.contains(&ParticipantInclude::AllCounts) 
+            || includes.contains(&ParticipantInclude::All);
+            
+        let include_document_counts_by_type = includes.contains(&ParticipantInclude::DocumentCountsByType) 
+            || includes.contains(&ParticipantInclude::AllCounts) 
+            || includes.contains(&ParticipantInclude::All);
+            
+        let include_documents = includes.contains(&ParticipantInclude::Documents) 
+            || includes.contains(&ParticipantInclude::All);
+            
+        let include_workshops = includes.contains(&ParticipantInclude::Workshops) 
+            || includes.contains(&ParticipantInclude::All);
+            
+        let include_livelihoods = includes.contains(&ParticipantInclude::Livelihoods) 
+            || includes.contains(&ParticipantInclude::All);
+
+
+        let ids: Vec<Uuid> = responses.iter().map(|r| r.id).collect();
+
+        // **OPTIMIZATION: One query per relation for the whole page**
+        let workshops_by_id = if include_workshop_count || include_completed_workshop_count || include_upcoming_workshop_count {
+            self.repo.count_workshops_for_participants(&ids).await.ok()
+        } else {
+            None
+        };
+        let livelihoods_by_id = if include_livelihood_count || include_active_livelihood_count {
+            self.repo.count_livelihoods_for_participants(&ids).await.ok()
+        } else {
+            None
+        };
+        let documents_by_id = if include_document_count {
+            relations.document_counts("participants", &ids).await.ok()
+        } else {
+            None
+        };
+
+        for response in responses.iter_mut() {
+            // Participants absent from a loaded map have no related rows
+            if let Some(counts) = &workshops_by_id {
+                let (total, completed, upcoming) = counts.get(&response.id).copied().unwrap_or((0, 0, 0));
+                if include_workshop_count {
+                    response.workshop_count = Some(total);
                 }
-                
-                // Fetch full workshops if needed
-                if include_workshops {
-                    if let Ok(workshops) = self.repo.get_participant_workshops(response.id).await {
-                        response.workshops = Some(workshops);
-                    }
+                if include_completed_workshop_count {
+                    response.completed_workshop_count = Some(completed);
+                }
+                if include_upcoming_workshop_count {
+                    response.upcoming_workshop_count = Some(upcoming);
                 }
             }
 
-            // **OPTIMIZATION: Eager field loading - fetch livelihood data once if any livelihood fields needed**  
-            if include_livelihood_count || include_active_livelihood_count || include_livelihoods {
-                if let Ok((total, active)) = self.repo.count_participant_livelihoods(response.id).await {
-                    if include_livelihood_count {
-                        response.livelihood_count = Some(total);
-                    }
-                    if include_active_livelihood_count {
-                        response.active_livelihood_count = Some(active);
-                    }
+            if let Some(counts) = &livelihoods_by_id {
+                let (total, active) = counts.get(&response.id).copied().unwrap_or((0, 0));
+                if include_livelihood_count {
+                    response.livelihood_count = Some(total);
                 }
-                
-                // Fetch full livelihoods if needed
-                if include_livelihoods {
-                    if let Ok(livelihoods) = self.repo.get_participant_livelihoods(response.id).await {
-                        response.livelihoods = Some(livelihoods);
-                    }
+                if include_active_livelihood_count {
+                    response.active_livelihood_count = Some(active);
                 }
             }
 
-            // **OPTIMIZATION: Eager field loading - fetch document data efficiently**
-            if include_document_count || include_document_counts_by_type || include_documents {
-                // Fetch document count if needed
-                if include_document_count {
-                    if let Ok(count) = self.repo.count_participant_documents(response.id).await {
-                        response.document_count = Some(count);
-                    }
+            if let Some(counts) = &documents_by_id {
+                response.document_count = counts.get(&response.id).copied();
+            }
+
+            // Fetch full workshops if needed
+            if include_workshops {
+                if let Ok(workshops) = self.repo.get_participant_workshops(response.id).await {
+                    response.workshops = Some(workshops);
                 }
+            }
 
-                // Fetch document counts by type if needed
-                if include_document_counts_by_type {
-                    if let Ok(counts) = self.repo.get_participant_document_counts_by_type(response.id).await {
-                        response.document_counts_by_type = Some(counts);
-                    }
+            // Fetch full livelihoods if needed
+            if include_livelihoods {
+                if let Ok(livelihoods) = self.repo.get_participant_livelihoods(response.id).await {
+                    response.livelihoods = Some(livelihoods);
                 }
+            }
 
-                // Fetch full documents if needed
-                if include_documents {
-                    let doc_params = PaginationParams::default();
-                    if let Ok(docs_result) = self.document_service
-                        .list_media_documents_by_related_entity(
-                            auth,
-                            "participants",
-                            response.id,
-                            doc_params,
-                            None
-                        ).await {
-                        response.documents = Some(docs_result.items);
-                    }
+            // Fetch document counts by type if needed
+            if include_document_counts_by_type {
+                if let Ok(counts) = self.repo.get_participant_document_counts_by_type(response.id).await {
+                    response.document_counts_by_type = Some(counts);
+                }
+            }
+
+            // Fetch full documents if needed
+            if include_documents {
+                let doc_params = PaginationParams::default();
+                if let Ok(docs_result) = self.document_service
+                    .list_media_documents_by_related_entity(
+                        auth,
+                        "participants",
+                        response.id,
+                        doc_params,
+                        None
+                    ).await {
+                    response.documents = Some(docs_result.items);
                 }
             }
         }
         
-        Ok(response)
+        Ok(responses)
     }
     
     async fn upload_documents_for_entity(
@@ -595,35 +637,9 @@ impl ParticipantServiceImpl {
                      new_participant.name, existing_participant.id);
         }
         
-        // 2. Validate disability consistency
-        if let Some(disability_type) = &new_participant.disability_type {
-            if new_participant.disability == Some(false) {
-                return Err(ServiceError::Domain(DomainError::Validation(ValidationError::custom(
-                    "Cannot specify a disability type when disability is set to false. Either set disability to true or remove the disability type."
-                ))));
-            }
-        }
-        
-        // 3. Check name quality (business rule for data integrity)
-        if new_participant.name.len() < 3 {
-            return Err(ServiceError::Domain(DomainError::Validation(ValidationError::format(
-                "name",
-                "Participant name is too short. Please provide a full name for better identification."
-            ))));
-        }
-        
-        // 4. Validate age group and disability type consistency (business logic)
-        if let (Some(age_group), Some(disability_type)) = (&new_participant.age_group, &new_participant.disability_type) {
-            if age_group == "child" && disability_type.to_lowercase().contains("psychosocial") {
-                return Err(ServiceError::Domain(DomainError::Validation(ValidationError::custom(
-                    "Psychosocial disability type requires careful assessment for child participants. Please consult with a specialist before proceeding."
-                ))));
-            }
-        }
-        
-        Ok(())
+        check_participant_rules(new_participant)
     }
-    
+
     /// Comprehensive business rule validation for participant updates
     async fn validate_participant_business_rules_for_update(
         &self,
@@ -788,6 +804,41 @@ impl ParticipantServiceImpl {
     }
 }
 
+/// Records per validation thread below which splitting further is not worth it
+const BULK_VALIDATION_MIN_CHUNK: usize = 256;
+
+/// Business rules of a new participant that need no database access. Shared by
+/// single creation and the bulk create, which checks records in parallel.
+fn check_participant_rules(new_participant: &NewParticipant) -> ServiceResult<()> {
+    // 1. Validate disability consistency
+    if let Some(disability_type) = &new_participant.disability_type {
+        if new_participant.disability == Some(false) {
+            return Err(ServiceError::Domain(DomainError::Validation(ValidationError::custom(
+                "Cannot specify a disability type when disability is set to false. Either set disability to true or remove the disability type."
+            ))));
+        }
+    }
+    
+    // 2. Check name quality (business rule for data integrity)
+    if new_participant.name.len() < 3 {
+        return Err(ServiceError::Domain(DomainError::Validation(ValidationError::format(
+            "name",
+            "Participant name is too short. Please provide a full name for better identification."
+        ))));
+    }
+    
+    // 3. Validate age group and disability type consistency (business logic)
+    if let (Some(age_group), Some(disability_type)) = (&new_participant.age_group, &new_participant.disability_type) {
+        if age_group == "child" && disability_type.to_lowercase().contains("psychosocial") {
+            return Err(ServiceError::Domain(DomainError::Validation(ValidationError::custom(
+                "Psychosocial disability type requires careful assessment for child participants. Please consult with a specialist before proceeding."
+            ))));
+        }
+    }
+    
+    Ok(())
+}
+
 // Implement DeleteService<Participant> by delegating
 #[async_trait]
 impl DeleteService<Participant> for ParticipantServiceImpl {
@@ -890,12 +941,9 @@ impl ParticipantService for ParticipantServiceImpl {
 
         let paginated_result = self.repo.find_all(params).await?;
 
-        let mut enriched_items = Vec::with_capacity(paginated_result.items.len());
-        for item in paginated_result.items {
-            let response = ParticipantResponse::from(item);
-            let enriched = self.enrich_response(response, include, auth).await?; 
-            enriched_items.push(enriched);
-        }
+        let responses = paginated_result.items.into_iter().map(ParticipantResponse::from).collect();
+        let relations = RelationLoader::new(self.pool.clone());
+        let enriched_items = self.enrich_responses(responses, include, auth, &relations).await?;
 
         Ok(PaginatedResult::new(
             enriched_items,
@@ -994,13 +1042,9 @@ impl ParticipantService for ParticipantServiceImpl {
         filter.validate().map_err(ServiceError::Domain)?;
         
         let paginated_result = self.repo.find_by_filter(&filter, params).await.map_err(ServiceError::Domain)?;
-        let mut enriched_items = Vec::with_capacity(paginated_result.items.len());
-        
-        for item in paginated_result.items {
-            let response = ParticipantResponse::from(item);
-            let enriched = self.enrich_response(response, include, auth).await?;
-            enriched_items.push(enriched);
-        }
+        let responses = paginated_result.items.into_iter().map(ParticipantResponse::from).collect();
+        let relations = RelationLoader::new(self.pool.clone());
+        let enriched_items = self.enrich_responses(responses, include, auth, &relations).await?;
         
         Ok(PaginatedResult::new(
             enriched_items,
@@ -1634,12 +1678,9 @@ impl ParticipantService for ParticipantServiceImpl {
         let paginated_result = self.repo.find_by_gender(gender, params).await?;
 
         // 3. Convert and enrich participants
-        let mut enriched_items = Vec::new();
-        for participant in paginated_result.items {
-            let response = ParticipantResponse::from(participant);
-            let enriched = self.enrich_response(response, include, auth).await?;
-            enriched_items.push(enriched);
-        }
+        let responses = paginated_result.items.into_iter().map(ParticipantResponse::from).collect();
+        let relations = RelationLoader::new(self.pool.clone());
+        let enriched_items = self.enrich_responses(responses, include, auth, &relations).await?;
 
         // 4. Return paginated result
         Ok(PaginatedResult::new(
@@ -1663,12 +1704,9 @@ impl ParticipantService for ParticipantServiceImpl {
         let paginated_result = self.repo.find_by_age_group(age_group, params).await?;
 
         // 3. Convert and enrich participants
-        let mut enriched_items = Vec::new();
-        for participant in paginated_result.items {
-            let response = ParticipantResponse::from(participant);
-            let enriched = self.enrich_response(response, include, auth).await?;
-            enriched_items.push(enriched);
-        }
+        let responses = paginated_result.items.into_iter().map(ParticipantResponse::from).collect();
+        let relations = RelationLoader::new(self.pool.clone());
+        let enriched_items = self.enrich_responses(responses, include, auth, &relations).await?;
 
         // 4. Return paginated result
         Ok(PaginatedResult::new(
@@ -1692,12 +1730,9 @@ impl ParticipantService for ParticipantServiceImpl {
         let paginated_result = self.repo.find_by_location(location, params).await?;
 
         // 3. Convert and enrich participants
-        let mut enriched_items = Vec::new();
-        for participant in paginated_result.items {
-            let response = ParticipantResponse::from(participant);
-            let enriched = self.enrich_response(response, include, auth).await?;
-            enriched_items.push(enriched);
-        }
+        let responses = paginated_result.items.into_iter().map(ParticipantResponse::from).collect();
+        let relations = RelationLoader::new(self.pool.clone());
+        let enriched_items = self.enrich_responses(responses, include, auth, &relations).await?;
 
         // 4. Return paginated result
         Ok(PaginatedResult::new(
@@ -1721,12 +1756,9 @@ impl ParticipantService for ParticipantServiceImpl {
         let paginated_result = self.repo.find_by_disability(has_disability, params).await?;
 
         // 3. Convert and enrich participants
-        let mut enriched_items = Vec::new();
-        for participant in paginated_result.items {
-            let response = ParticipantResponse::from(participant);
-            let enriched = self.enrich_response(response, include, auth).await?;
-            enriched_items.push(enriched);
-        }
+        let responses = paginated_result.items.into_iter().map(ParticipantResponse::from).collect();
+        let relations = RelationLoader::new(self.pool.clone());
+        let enriched_items = self.enrich_responses(responses, include, auth, &relations).await?;
 
         // 4. Return paginated result
         Ok(PaginatedResult::new(
@@ -1751,12 +1783,9 @@ impl ParticipantService for ParticipantServiceImpl {
         let paginated_result = self.repo.find_workshop_participants(workshop_id, params).await?;
 
         // 3. Convert and enrich participants
-        let mut enriched_items = Vec::new();
-        for participant in paginated_result.items {
-            let response = ParticipantResponse::from(participant);
-            let enriched = self.enrich_response(response, include, auth).await?;
-            enriched_items.push(enriched);
-        }
+        let responses = paginated_result.items.into_iter().map(ParticipantResponse::from).collect();
+        let relations = RelationLoader::new(self.pool.clone());
+        let enriched_items = self.enrich_responses(responses, include, auth, &relations).await?;
 
         // 4. Return paginated result
         Ok(PaginatedResult::new(
@@ -1833,11 +1862,12 @@ impl ParticipantService for ParticipantServiceImpl {
         &self,
         search_text: &str,
         params: PaginationParams,
+        mode: SearchMode,
         auth: &AuthContext,
     ) -> ServiceResult<PaginatedResult<ParticipantResponse>> {
         auth.authorize(Permission::ViewParticipants)?;
         
-        let paginated_result = self.repo.search_participants_with_relationships(search_text, params).await?;
+        let paginated_result = self.repo.search_participants_with_relationships(search_text, params, mode).await?;
         
         // Convert to responses
         let participant_responses: Vec<ParticipantResponse> = paginated_result.items
@@ -1898,6 +1928,63 @@ impl ParticipantService for ParticipantServiceImpl {
         Ok(bulk_result)
     }
 
+    async fn bulk_create_participants(
+        &self,
+        new_participants: Vec<NewParticipant>,
+        auth: &AuthContext,
+    ) -> ServiceResult<ParticipantBulkCreateResult> {
+        auth.authorize(Permission::CreateParticipants)?;
+        let started = std::time::Instant::now();
+        let total_requested = new_participants.len();
+
+        // Validation is CPU-only: run it on a blocking thread, split across cores
+        let checks = tokio::task::spawn_blocking(move || {
+            let threads = std::thread::available_parallelism().map_or(1, |n| n.get());
+            let chunk_size = total_requested.div_ceil(threads).max(BULK_VALIDATION_MIN_CHUNK);
+            let errors: Vec<Option<String>> = std::thread::scope(|scope| {
+                let workers: Vec<_> = new_participants
+                    .chunks(chunk_size)
+                    .map(|chunk| scope.spawn(move || {
+                        chunk.iter()
+                            .map(|p| p.validate()
+                                .map_err(ServiceError::Domain)
+                                .and_then(|_| check_participant_rules(p))
+                                .err()
+                                .map(|e| e.to_string()))
+                            .collect::<Vec<_>>()
+                    }))
+                    .collect();
+                workers.into_iter().flat_map(|w| w.join().unwrap_or_default()).collect()
+            });
+            (new_participants, errors)
+        })
+        .await
+        .map_err(|e| ServiceError::InternalError(format!("Bulk validation failed: {}", e)))?;
+        let (new_participants, errors) = checks;
+
+        let mut failed = Vec::new();
+        let mut valid = Vec::with_capacity(total_requested);
+        for (index, (participant, error)) in new_participants.into_iter().zip(errors).enumerate() {
+            match error {
+                Some(message) => failed.push((index, message)),
+                None => valid.push(participant),
+            }
+        }
+
+        let created_ids = if valid.is_empty() {
+            Vec::new()
+        } else {
+            self.repo.bulk_create(&valid, auth).await.map_err(ServiceError::Domain)?
+        };
+
+        Ok(ParticipantBulkCreateResult {
+            total_requested,
+            created_ids,
+            failed,
+            operation_duration_ms: started.elapsed().as_millis() as u64,
+        })
+    }
+
     async fn get_index_optimization_suggestions(
         &self,
         auth: &AuthContext,
@@ -1290,6 +1290,16 @@ pub struct ParticipantBulkOperationResult {
     pub operation_duration_ms: u64,
 }
 
+/// Result of a bulk create (import). Invalid records are reported by their
+/// position in the input; the valid ones are created together.
+#[derive(Debug, Clone, Serialize, Deserialize)]
+pub struct ParticipantBulkCreateResult {
+    pub total_requested: usize,
+    pub created_ids: Vec<Uuid>,
+    pub failed: Vec<(usize, String)>, // (input index, error_message)
+    pub operation_duration_ms: u64,
+}
+
 /// **PERFORMANCE OPTIMIZATION: Participant search index**
 /// Optimized structure for search operations across multiple fields
 #[derive(Debug, Clone, Serialize, Deserialize)]
@@ -1,9 +1,11 @@
 use crate::auth::AuthContext;
 use sqlx::{Executor, Row, Sqlite, Transaction, SqlitePool, Arguments, sqlite::SqliteArguments};
 use sqlx::QueryBuilder;
+use crate::domains::core::stat_counters;
 use crate::domains::core::delete_service::DeleteServiceRepository;
 use crate::domains::core::repository::{FindById, HardDeletable, SoftDeletable};
 use crate::domains::core::document_linking::DocumentLinkable;
+use crate::domains::core::search::{fts_match_query, SearchMode};
 use crate::domains::project::types::{NewProject, Project, ProjectRow, UpdateProject, ProjectStatistics, ProjectStatusBreakdown, ProjectMetadataCounts, ProjectDocumentReference};
 use crate::domains::sync::repository::ChangeLogRepository;
 use crate::domains::sync::types::{ChangeLogEntry, ChangeOperationType, MergeOutcome};
@@ -111,6 +113,7 @@ pub trait ProjectRepository: DeleteServiceRepository<Project> + MergeableEntityR
         &self,
         query: &str,
         params: PaginationParams,
+        mode: SearchMode,
     ) -> DomainResult<PaginatedResult<Project>>;
     
     /// Get project status breakdown
@@ -140,12 +143,20 @@ pub trait ProjectRepository: DeleteServiceRepository<Project> + MergeableEntityR
 #[derive(Clone)]
 pub struct SqliteProjectRepository {
     pool: SqlitePool,
+    /// Read-only connections for queries; writes and transactions use `pool`
+    read_pool: SqlitePool,
     change_log_repo: Arc<dyn ChangeLogRepository + Send + Sync>,
 }
 
 impl SqliteProjectRepository {
     pub fn new(pool: SqlitePool, change_log_repo: Arc<dyn ChangeLogRepository + Send + Sync>) -> Self {
-        Self { pool, change_log_repo }
+        Self { read_pool: pool.clone(), pool, change_log_repo }
+    }
+
+    /// Serve queries from a separate read-only pool
+    pub fn with_read_pool(mut self, read_pool: SqlitePool) -> Self {
+        self.read_pool = read_pool;
+        self
     }
 
     fn map_row_to_entity(row: ProjectRow) -> DomainResult<Project> {
@@ -182,7 +193,7 @@ impl FindById<Project> for SqliteProjectRepository {
             "SELECT * FROM projects WHERE id = ? AND deleted_at IS NULL",
         )
         .bind(id.to_string())
-        .fetch_optional(&self.pool)
+        .fetch_optional(&self.read_pool)
         .await
         .map_err(DbError::from)?
         .ok_or_else(|| DomainError::EntityNotFound("Project".to_string(), id))?;
@@ -398,7 +409,7 @@ impl ProjectRepository for SqliteProjectRepository {
                 // Quick validation outside of main transaction
                 let exists: bool = query_scalar("SELECT EXISTS(SELECT 1 FROM strategic_goals WHERE id = ? AND deleted_at IS NULL)")
                     .bind(sg_id.to_string())
-                    .fetch_one(&self.pool)
+                    .fetch_one(&self.read_pool)
                     .await
                     .map_err(DbError::from)?;
                     
@@ -594,17 +605,14 @@ impl ProjectRepository for SqliteProjectRepository {
     ) -> DomainResult<PaginatedResult<Project>> {
         let offset = (params.page - 1) * params.per_page;
 
-        let total: i64 = query_scalar("SELECT COUNT(*) FROM projects WHERE deleted_at IS NULL")
-            .fetch_one(&self.pool)
-            .await
-            .map_err(DbError::from)?;
+        let total: i64 = stat_counters::row_count(&self.read_pool, "projects", stat_counters::ACTIVE).await?;
 
         let rows = query_as::<_, ProjectRow>(
             "SELECT * FROM projects WHERE deleted_at IS NULL ORDER BY name ASC LIMIT ? OFFSET ?",
         )
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -632,7 +640,7 @@ impl ProjectRepository for SqliteProjectRepository {
              "SELECT COUNT(*) FROM projects WHERE strategic_goal_id = ? AND deleted_at IS NULL"
          )
          .bind(&sg_id_str)
-         .fetch_one(&self.pool)
+         .fetch_one(&self.read_pool)
          .await
          .map_err(DbError::from)?;
 
@@ -642,7 +650,7 @@ impl ProjectRepository for SqliteProjectRepository {
         .bind(sg_id_str)
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -739,71 +747,35 @@ impl ProjectRepository for SqliteProjectRepository {
     }
 
     async fn count_by_status(&self) -> DomainResult<Vec<(Option<i64>, i64)>> {
-        let counts = query_as::<_, (Option<i64>, i64)>(
-            "SELECT status_id, COUNT(*) 
-             FROM projects 
-             WHERE deleted_at IS NULL 
-             GROUP BY status_id"
-        )
-        .fetch_all(&self.pool)
-        .await
-        .map_err(DbError::from)?;
-
-        Ok(counts)
+        stat_counters::integer_breakdown(&self.read_pool, "projects", "status_id").await
     }
     
     async fn count_by_strategic_goal(&self) -> DomainResult<Vec<(Option<Uuid>, i64)>> {
-        let rows = query(
-            "SELECT strategic_goal_id, COUNT(*) as count
-             FROM projects 
-             WHERE deleted_at IS NULL 
-             GROUP BY strategic_goal_id"
-        )
-        .fetch_all(&self.pool)
-        .await
-        .map_err(DbError::from)?;
+        let counts = stat_counters::text_breakdown(&self.read_pool, "projects", "strategic_goal_id").await?;
 
         // Manual mapping to handle Option<Uuid>
         let mut results = Vec::new();
-        for row in rows {
-            let sg_id_str: Option<String> = row.get("strategic_goal_id");
-            let count: i64 = row.get("count");
-            
-            let sg_id = match sg_id_str {
+        for (id_str, count) in counts {
+            let id = match id_str {
                 Some(id_str) => Some(Uuid::parse_str(&id_str).map_err(|_| 
                     DomainError::Internal(format!("Invalid UUID in strategic_goal_id: {}", id_str))
                 )?),
                 None => None,
             };
             
-            results.push((sg_id, count));
+            results.push((id, count));
         }
 
         Ok(results)
     }
     
     async fn count_by_responsible_team(&self) -> DomainResult<Vec<(Option<String>, i64)>> {
-        let counts = query_as::<_, (Option<String>, i64)>(
-            "SELECT responsible_team, COUNT(*) 
-             FROM projects 
-             WHERE deleted_at IS NULL 
-             GROUP BY responsible_team"
-        )
-        .fetch_all(&self.pool)
-        .await
-        .map_err(DbError::from)?;
-
-        Ok(counts)
+        stat_counters::text_breakdown(&self.read_pool, "projects", "responsible_team").await
     }
     
     async fn get_project_statistics(&self) -> DomainResult<ProjectStatistics> {
         // Get total project count
-        let total_projects: i64 = query_scalar(
-            "SELECT COUNT(*) FROM projects WHERE deleted_at IS NULL"
-        )
-        .fetch_one(&self.pool)
-        .await
-        .map_err(DbError::from)?;
+        let total_projects: i64 = stat_counters::row_count(&self.read_pool, "projects", stat_counters::ACTIVE).await?;
         
         // Get document count
         let document_count: i64 = query_scalar(
@@ -812,7 +784,7 @@ impl ProjectRepository for SqliteProjectRepository {
              WHERE related_table = 'projects' -- Corrected entity_type to related_table
              AND deleted_at IS NULL"
         )
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
         
@@ -841,7 +813,7 @@ impl ProjectRepository for SqliteProjectRepository {
                         "SELECT objective_code FROM strategic_goals WHERE id = ? AND deleted_at IS NULL"
                     )
                     .bind(id.to_string())
-                    .fetch_optional(&self.pool)
+                    .fetch_optional(&self.read_pool)
                     .await
                     .map_err(DbError::from)? {
                         Some(code) => code,
@@ -883,7 +855,7 @@ impl ProjectRepository for SqliteProjectRepository {
              WHERE status_id = ? AND deleted_at IS NULL"
         )
         .bind(status_id)
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -896,7 +868,7 @@ impl ProjectRepository for SqliteProjectRepository {
         .bind(status_id)
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -925,7 +897,7 @@ impl ProjectRepository for SqliteProjectRepository {
              WHERE responsible_team = ? AND deleted_at IS NULL"
         )
         .bind(team)
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -938,7 +910,7 @@ impl ProjectRepository for SqliteProjectRepository {
         .bind(team)
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -980,7 +952,7 @@ impl ProjectRepository for SqliteProjectRepository {
             
             let row = query(&query_str)
                 .bind(&project_id_str)
-                .fetch_optional(&self.pool)
+                .fetch_optional(&self.read_pool)
                 .await
                 .map_err(DbError::from)?;
                 
@@ -1023,8 +995,43 @@ impl ProjectRepository for SqliteProjectRepository {
         &self,
         query: &str,
         params: PaginationParams,
+        mode: SearchMode,
     ) -> DomainResult<PaginatedResult<Project>> {
         let offset = (params.page - 1) * params.per_page;
+
+        // FTS5 path: prefix match over the projects_fts index, ranked by bm25
+        if let Some(match_query) = fts_match_query(query).filter(|_| mode == SearchMode::Fts) {
+            let total: i64 = query_scalar(
+                "SELECT COUNT(*) FROM projects_fts 
+                 JOIN projects t ON t.rowid = projects_fts.rowid 
+                 WHERE projects_fts MATCH ? AND t.deleted_at IS NULL"
+            )
+            .bind(&match_query)
+            .fetch_one(&self.read_pool)
+            .await
+            .map_err(DbError::from)?;
+
+            let rows = query_as::<_, ProjectRow>(
+                "SELECT t.* FROM projects_fts 
+                 JOIN projects t ON t.rowid = projects_fts.rowid 
+                 WHERE projects_fts MATCH ? AND t.deleted_at IS NULL 
+                 ORDER BY bm25(projects_fts), t.name ASC LIMIT ? OFFSET ?"
+            )
+            .bind(&match_query)
+            .bind(params.per_page as i64)
+            .bind(offset as i64)
+            .fetch_all(&self.read_pool)
+            .await
+            .map_err(DbError::from)?;
+
+            let entities = rows
+                .into_iter()
+                .map(Self::map_row_to_entity)
+                .collect::<DomainResult<Vec<Project>>>()?;
+
+            return Ok(PaginatedResult::new(entities, total as u64, params));
+        }
+
         let search_term = format!("%{}%", query);
 
         // Get total count
@@ -1037,7 +1044,7 @@ impl ProjectRepository for SqliteProjectRepository {
         .bind(&search_term)
         .bind(&search_term)
         .bind(&search_term)
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1054,7 +1061,7 @@ impl ProjectRepository for SqliteProjectRepository {
         .bind(&search_term)
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1143,7 +1150,7 @@ impl ProjectRepository for SqliteProjectRepository {
                         "SELECT objective_code FROM strategic_goals WHERE id = ? AND deleted_at IS NULL"
                     )
                     .bind(id.to_string())
-                    .fetch_optional(&self.pool)
+                    .fetch_optional(&self.read_pool)
                     .await
                     .map_err(DbError::from)? {
                         Some(code) => code,
@@ -1179,7 +1186,7 @@ impl ProjectRepository for SqliteProjectRepository {
         )
         .bind(start_date.to_rfc3339())
         .bind(end_date.to_rfc3339())
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1194,7 +1201,7 @@ impl ProjectRepository for SqliteProjectRepository {
         .bind(end_date.to_rfc3339())
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1286,7 +1293,7 @@ impl ProjectRepository for SqliteProjectRepository {
         }
         
         let query = query_builder.build_query_as::<(String,)>();
-        let rows = query.fetch_all(&self.pool).await.map_err(DbError::from)?;
+        let rows = query.fetch_all(&self.read_pool).await.map_err(DbError::from)?;
         
         rows.into_iter()
             .map(|(id_str,)| Uuid::parse_str(&id_str).map_err(|e| DomainError::InvalidUuid(e.to_string())))
@@ -1319,7 +1326,7 @@ impl ProjectRepository for SqliteProjectRepository {
 
         let total: i64 = count_builder
             .build_query_scalar()
-            .fetch_one(&self.pool)
+            .fetch_one(&self.read_pool)
             .await
             .map_err(DbError::from)?;
 
@@ -1339,7 +1346,7 @@ impl ProjectRepository for SqliteProjectRepository {
 
         let rows = select_builder
             .build_query_as::<ProjectRow>()
-            .fetch_all(&self.pool)
+            .fetch_all(&self.read_pool)
             .await
             .map_err(DbError::from)?;
 
@@ -4,6 +4,7 @@ use crate::domains::core::dependency_checker::DependencyChecker;
 use crate::domains::core::delete_service::{BaseDeleteService, DeleteOptions, DeleteService, DeleteServiceRepository};
 use crate::domains::core::repository::{DeleteResult, FindById, HardDeletable, SoftDeletable};
 use crate::domains::core::document_linking::DocumentLinkable;
+use crate::domains::core::search::SearchMode;
 use crate::domains::permission::Permission;
 use crate::domains::project::repository::ProjectRepository;
 use crate::domains::project::types::{ // Added new types
@@ -32,9 +33,7 @@ use crate::domains::compression::types::CompressionPriority;
 use crate::domains::core::delete_service::PendingDeletionManager;
 
 // ADDED: Import additional repositories for enrichment
-use crate::domains::user::repository::UserRepository;
-use crate::domains::activity::repository::ActivityRepository;
-use crate::domains::workshop::repository::WorkshopRepository;
+use crate::domains::core::loader::RelationLoader;
 
 /// Trait defining project service operations
 #[async_trait]
@@ -164,6 +163,7 @@ pub trait ProjectService: DeleteService<Project> + Send + Sync {
         &self,
         query: &str,
         params: PaginationParams,
+        mode: SearchMode,
         include: Option<&[ProjectInclude]>,
         auth: &AuthContext,
     ) -> ServiceResult<PaginatedResult<ProjectResponse>>;
@@ -239,10 +239,6 @@ pub struct ProjectServiceImpl {
     strategic_goal_repo: Arc<dyn StrategicGoalRepository + Send + Sync>,
     delete_service: Arc<BaseDeleteService<Project>>,
     document_service: Arc<dyn DocumentService>,
-    // ADDED: Additional repositories for enrichment
-    user_repo: Arc<dyn UserRepository + Send + Sync>,
-    activity_repo: Arc<dyn ActivityRepository + Send + Sync>,
-    workshop_repo: Arc<dyn WorkshopRepository + Send + Sync>,
 }
 
 impl ProjectServiceImpl {
@@ -257,10 +253,6 @@ impl ProjectServiceImpl {
         media_doc_repo: Arc<dyn MediaDocumentRepository>, // Still needed for BaseDeleteService
         document_service: Arc<dyn DocumentService>,
         deletion_manager: Arc<PendingDeletionManager>,
-        // ADDED: Additional repositories for enrichment
-        user_repo: Arc<dyn UserRepository + Send + Sync>,
-        activity_repo: Arc<dyn ActivityRepository + Send + Sync>,
-        workshop_repo: Arc<dyn WorkshopRepository + Send + Sync>,
     ) -> Self {
         // --- Adapter setup remains the same ---
         struct RepoAdapter(Arc<dyn ProjectRepository + Send + Sync>);
@@ -325,130 +317,132 @@ impl ProjectServiceImpl {
             strategic_goal_repo,
             delete_service,
             document_service,
-            // ADDED: Additional repositories for enrichment
-            user_repo,
-            activity_repo,
-            workshop_repo,
         }
     }
 
     /// Helper to enrich ProjectResponse with included data
-    /// PRESERVED: Document enrichment logic is kept
     async fn enrich_response(
         &self,
-        mut response: ProjectResponse,
+        response: ProjectResponse,
         include: Option<&[ProjectInclude]>,
-        auth: &AuthContext, // Auth context is needed for listing documents
+        auth: &AuthContext,
     ) -> ServiceResult<ProjectResponse> {
-        if let Some(includes) = include {
-            // --- PRESERVED Document Enrichment ---
-            let include_docs = includes.contains(&ProjectInclude::All) || includes.contains(&ProjectInclude::Documents);
+        let relations = RelationLoader::new(self.pool.clone());
+        let mut enriched = self.enrich_responses(vec![response], include, auth, &relations).await?;
+        Ok(enriched.pop().expect("one response in, one out"))
+    }
+
+    /// Enrich a page of projects. Usernames, counts and strategic goal
+    /// summaries are loaded once for the page through the request's loader;
+    /// document lists are still fetched per project.
+    async fn enrich_responses(
+        &self,
+        mut responses: Vec<ProjectResponse>,
+        include: Option<&[ProjectInclude]>,
+        auth: &AuthContext, // Auth context is needed for listing documents
+        relations: &RelationLoader,
+    ) -> ServiceResult<Vec<ProjectResponse>> {
+        let Some(includes) = include else {
+            return Ok(responses);
+        };
 
+        let include_docs = includes.contains(&ProjectInclude::All) || includes.contains(&ProjectInclude::Documents);
+        let include_usernames = includes.contains(&ProjectInclude::All) || includes.contains(&ProjectInclude::CreatedBy);
+        let include_counts = includes.contains(&ProjectInclude::All) || includes.contains(&ProjectInclude::Counts);
+        let include_activity_count = include_counts || includes.contains(&ProjectInclude::ActivityCount);
+        let include_workshop_count = include_counts || includes.contains(&ProjectInclude::WorkshopCount);
+        let include_strategic_goal = includes.contains(&ProjectInclude::All) || includes.contains(&ProjectInclude::StrategicGoal);
+
+        let ids: Vec<Uuid> = responses.iter().map(|r| r.id).collect();
+
+        // A failed batch lookup leaves its fields unset (names, goals) or 0
+        // (counts), as the per-project lookups did
+        let user_names = if include_usernames {
+            let user_ids: Vec<Uuid> = responses
+                .iter()
+                .flat_map(|r| [r.created_by_user_id, r.updated_by_user_id])
+                .flatten()
+                .collect();
+            relations.user_names(&user_ids).await.ok()
+        } else {
+            None
+        };
+        let activity_counts = if include_activity_count {
+            relations.child_counts("activities", "project_id", &ids).await.ok()
+        } else {
+            None
+        };
+        let workshop_counts = if include_workshop_count {
+            relations.child_counts("workshops", "project_id", &ids).await.ok()
+        } else {
+            None
+        };
+        // Document lists carry their own total
+        let document_counts = if include_counts && !include_docs {
+            relations.document_counts("projects", &ids).await.ok()
+        } else {
+            None
+        };
+        let (goal_codes, goal_outcomes) = if include_strategic_goal {
+            let goal_ids: Vec<Uuid> = responses
+                .iter()
+                .filter(|r| r.strategic_goal.is_none())
+                .filter_map(|r| r.strategic_goal_id)
+                .collect();
+            (
+                relations.column_values("strategic_goals", "objective_code", &goal_ids).await.ok(),
+                relations.column_values("strategic_goals", "outcome", &goal_ids).await.ok(),
+            )
+        } else {
+            (None, None)
+        };
+
+        for response in responses.iter_mut() {
             if include_docs {
-                // Use default pagination or define specific params if needed
-                let doc_params = PaginationParams::default();
-                // Fetch documents using the document service
                 let docs_result = self.document_service
                     .list_media_documents_by_related_entity(
-                        auth,         // Pass auth context
-                        "projects",   // Correct entity type
-                        response.id,  // Project ID
-                        doc_params,
-                        None // No nested includes needed for the document list itself here
+                        auth,
+                        "projects",
+                        response.id,
+                        PaginationParams::default(),
+                        None,
                     ).await?;
-                // Attach the fetched documents to the response
                 response.documents = Some(docs_result.items);
-                // FIXED: Also set the document_count field based on the total from pagination
                 response.document_count = Some(docs_result.total as i64);
             }
-             // --- END PRESERVED Document Enrichment ---
-
-            // ADDED: Username Enrichment - resolve user IDs to usernames
-            let include_usernames = includes.contains(&ProjectInclude::All) || includes.contains(&ProjectInclude::CreatedBy);
-            if include_usernames {
-                // Resolve created_by_user_id to username
-                if let Some(created_by_id) = response.created_by_user_id {
-                    if let Ok(user) = self.user_repo.find_by_id(created_by_id).await {
-                        response.created_by_username = Some(user.name.clone());
-                    }
-                }
-                // Resolve updated_by_user_id to username
-                if let Some(updated_by_id) = response.updated_by_user_id {
-                    if let Ok(user) = self.user_repo.find_by_id(updated_by_id).await {
-                        response.updated_by_username = Some(user.name.clone());
-                    }
-                }
+
+            if let Some(names) = &user_names {
+                response.created_by_username = response.created_by_user_id.and_then(|id| names.get(&id).cloned());
+                response.updated_by_username = response.updated_by_user_id.and_then(|id| names.get(&id).cloned());
             }
 
-            // ADDED: Count-based Enrichment - pre-compute related entity counts
-            let include_counts = includes.contains(&ProjectInclude::All) || includes.contains(&ProjectInclude::Counts);
-            let include_activity_count = include_counts || includes.contains(&ProjectInclude::ActivityCount);
-            let include_workshop_count = include_counts || includes.contains(&ProjectInclude::WorkshopCount);
-            
             if include_activity_count {
-                // Count activities for this project
-                match self.activity_repo.find_by_project_id(response.id, PaginationParams::default()).await {
-                    Ok(activities_result) => {
-                        response.activity_count = Some(activities_result.total as i64);
-                    }
-                    Err(_) => {
-                        // If there's an error, set count to 0 rather than failing enrichment
-                        response.activity_count = Some(0);
-                    }
-                }
+                response.activity_count = Some(activity_counts.as_ref().and_then(|c| c.get(&response.id).copied()).unwrap_or(0));
             }
-
             if include_workshop_count {
-                // Count workshops for this project
-                match self.workshop_repo.find_by_project_id(response.id, PaginationParams::default()).await {
-                    Ok(workshops_result) => {
-                        response.workshop_count = Some(workshops_result.total as i64);
-                    }
-                    Err(_) => {
-                        // If there's an error, set count to 0 rather than failing enrichment
-                        response.workshop_count = Some(0);
-                    }
-                }
+                response.workshop_count = Some(workshop_counts.as_ref().and_then(|c| c.get(&response.id).copied()).unwrap_or(0));
             }
-
-            // FIXED: Count documents for this project (only if not already set by document enrichment)
             if response.document_count.is_none() && include_counts {
-                match self.document_service.list_media_documents_by_related_entity(
-                    auth,
-                    "projects",
-                    response.id,
-                    PaginationParams { page: 1, per_page: 1 }, // Just get count, don't fetch actual documents
-                    None,
-                ).await {
-                    Ok(docs_result) => {
-                        response.document_count = Some(docs_result.total as i64);
-                    }
-                    Err(_) => {
-                        // If there's an error, set count to 0 rather than failing enrichment
-                        response.document_count = Some(0);
-                    }
-                }
+                response.document_count = Some(document_counts.as_ref().and_then(|c| c.get(&response.id).copied()).unwrap_or(0));
             }
 
-            // ADDED: Strategic Goal Enrichment
-            let include_strategic_goal = includes.contains(&ProjectInclude::All) || includes.contains(&ProjectInclude::StrategicGoal);
-            if include_strategic_goal && response.strategic_goal.is_none() {
-                                 if let Some(sg_id) = response.strategic_goal_id {
-                     if let Ok(strategic_goal) = self.strategic_goal_repo.find_by_id(sg_id).await {
-                         response.strategic_goal = Some(crate::domains::project::types::StrategicGoalSummary {
-                             id: strategic_goal.id,
-                             objective_code: strategic_goal.objective_code,
-                             outcome: strategic_goal.outcome,
-                         });
-                     }
-                 }
+            if response.strategic_goal.is_none() {
+                if let (Some(sg_id), Some(codes)) = (response.strategic_goal_id, &goal_codes) {
+                    if let Some(objective_code) = codes.get(&sg_id) {
+                        response.strategic_goal = Some(crate::domains::project::types::StrategicGoalSummary {
+                            id: sg_id,
+                            objective_code: objective_code.clone(),
+                            outcome: goal_outcomes.as_ref().and_then(|o| o.get(&sg_id).cloned()),
+                        });
+                    }
+                }
             }
 
             // TODO: Add status enrichment when status repository is available
             // let include_status = includes.contains(&ProjectInclude::All) || includes.contains(&ProjectInclude::Status);
             // if include_status && response.status.is_none() { ... fetch status ... }
         }
-        Ok(response)
+        Ok(responses)
     }
 
     // Helper to validate strategic goal existence if ID is provided - Remains the same
@@ -677,13 +671,9 @@ impl ProjectService for ProjectServiceImpl {
         let paginated_result = self.repo.find_all(params).await?;
 
         // PRESERVED: Enrich items before returning
-        let mut enriched_items = Vec::new();
-        for item in paginated_result.items {
-            let response = ProjectResponse::from_project(item);
-            // Pass auth context and include options to enrich_response for each item
-            let enriched = self.enrich_response(response, include, auth).await?;
-            enriched_items.push(enriched);
-        }
+        let responses = paginated_result.items.into_iter().map(ProjectResponse::from_project).collect();
+        let relations = RelationLoader::new(self.pool.clone());
+        let enriched_items = self.enrich_responses(responses, include, auth, &relations).await?;
 
         Ok(PaginatedResult::new(
             enriched_items,
@@ -971,12 +961,9 @@ impl ProjectService for ProjectServiceImpl {
             .map_err(ServiceError::Domain)?;
 
         // 3. Convert and enrich each project
-        let mut enriched_items = Vec::new();
-        for project in paginated_result.items {
-            let response = ProjectResponse::from_project(project);
-            let enriched = self.enrich_response(response, include, auth).await?; // Pass auth
-            enriched_items.push(enriched);
-        }
+        let responses = paginated_result.items.into_iter().map(ProjectResponse::from_project).collect();
+        let relations = RelationLoader::new(self.pool.clone());
+        let enriched_items = self.enrich_responses(responses, include, auth, &relations).await?;
 
         // 4. Return paginated result
         Ok(PaginatedResult::new(
@@ -1001,12 +988,9 @@ impl ProjectService for ProjectServiceImpl {
             .map_err(ServiceError::Domain)?;
 
         // 3. Convert and enrich each project
-        let mut enriched_items = Vec::new();
-        for project in paginated_result.items {
-            let response = ProjectResponse::from_project(project);
-            let enriched = self.enrich_response(response, include, auth).await?; // Pass auth
-            enriched_items.push(enriched);
-        }
+        let responses = paginated_result.items.into_iter().map(ProjectResponse::from_project).collect();
+        let relations = RelationLoader::new(self.pool.clone());
+        let enriched_items = self.enrich_responses(responses, include, auth, &relations).await?;
 
         // 4. Return paginated result
         Ok(PaginatedResult::new(
@@ -1089,6 +1073,7 @@ impl ProjectService for ProjectServiceImpl {
         &self,
         query: &str,
         params: PaginationParams,
+        mode: SearchMode,
         include: Option<&[ProjectInclude]>,
         auth: &AuthContext,
     ) -> ServiceResult<PaginatedResult<ProjectResponse>> {
@@ -1103,16 +1088,13 @@ impl ProjectService for ProjectServiceImpl {
         }
 
         // 3. Search projects
-        let paginated_result = self.repo.search_projects(query, params).await
+        let paginated_result = self.repo.search_projects(query, params, mode).await
             .map_err(ServiceError::Domain)?;
 
         // 4. Convert and enrich each project
-        let mut enriched_items = Vec::new();
-        for project in paginated_result.items {
-            let response = ProjectResponse::from_project(project);
-            let enriched = self.enrich_response(response, include, auth).await?; // Pass auth
-            enriched_items.push(enriched);
-        }
+        let responses = paginated_result.items.into_iter().map(ProjectResponse::from_project).collect();
+        let relations = RelationLoader::new(self.pool.clone());
+        let enriched_items = self.enrich_responses(responses, include, auth, &relations).await?;
 
         // 5. Return paginated result
         Ok(PaginatedResult::new(
@@ -1160,12 +1142,9 @@ impl ProjectService for ProjectServiceImpl {
             .map_err(ServiceError::Domain)?;
 
         // 5. Convert and enrich each project
-        let mut enriched_items = Vec::new();
-        for project in paginated_result.items {
-            let response = ProjectResponse::from_project(project);
-            let enriched = self.enrich_response(response, include, auth).await?;
-            enriched_items.push(enriched);
-        }
+        let responses = paginated_result.items.into_iter().map(ProjectResponse::from_project).collect();
+        let relations = RelationLoader::new(self.pool.clone());
+        let enriched_items = self.enrich_responses(responses, include, auth, &relations).await?;
 
         // 6. Return paginated result
         Ok(PaginatedResult::new(
@@ -1272,12 +1251,9 @@ impl ProjectService for ProjectServiceImpl {
             .map_err(ServiceError::Domain)?;
             
         // 4. Convert and enrich each project
-        let mut enriched_items = Vec::new();
-        for project in paginated_result.items {
-            let response = ProjectResponse::from_project(project);
-            let enriched = self.enrich_response(response, include, auth).await?;
-            enriched_items.push(enriched);
-        }
+        let responses = paginated_result.items.into_iter().map(ProjectResponse::from_project).collect();
+        let relations = RelationLoader::new(self.pool.clone());
+        let enriched_items = self.enrich_responses(responses, include, auth, &relations).await?;
 
         // 5. Return paginated result
         Ok(PaginatedResult::new(
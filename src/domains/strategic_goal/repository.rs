@@ -1,5 +1,6 @@
 use crate::auth::AuthContext;
 use sqlx::{SqlitePool, Transaction, Sqlite, QueryBuilder};
+use crate::domains::core::stat_counters;
 use crate::domains::core::repository::{FindById, HardDeletable, SoftDeletable};
 use crate::domains::core::delete_service::DeleteServiceRepository;
 use crate::domains::core::document_linking::DocumentLinkable;
@@ -160,12 +161,20 @@ pub trait StrategicGoalRepository:
 #[derive(Clone)]
 pub struct SqliteStrategicGoalRepository {
     pool: SqlitePool,
+    /// Read-only connections for queries; writes and transactions use `pool`
+    read_pool: SqlitePool,
     change_log_repo: Arc<dyn ChangeLogRepository + Send + Sync>,
 }
 
 impl SqliteStrategicGoalRepository {
     pub fn new(pool: SqlitePool, change_log_repo: Arc<dyn ChangeLogRepository + Send + Sync>) -> Self {
-        Self { pool, change_log_repo }
+        Self { read_pool: pool.clone(), pool, change_log_repo }
+    }
+
+    /// Serve queries from a separate read-only pool
+    pub fn with_read_pool(mut self, read_pool: SqlitePool) -> Self {
+        self.read_pool = read_pool;
+        self
     }
 
     fn map_row_to_entity(row: StrategicGoalRow) -> DomainResult<StrategicGoal> {
@@ -202,7 +211,7 @@ impl FindById<StrategicGoal> for SqliteStrategicGoalRepository {
             "SELECT * FROM strategic_goals WHERE id = ? AND deleted_at IS NULL",
         )
         .bind(id.to_string())
-        .fetch_optional(&self.pool)
+        .fetch_optional(&self.read_pool)
         .await
         .map_err(DbError::from)?
         .ok_or_else(|| DomainError::EntityNotFound("StrategicGoal".to_string(), id))?;
@@ -623,10 +632,7 @@ impl StrategicGoalRepository for SqliteStrategicGoalRepository {
         let offset = (params.page - 1) * params.per_page;
 
         // Get total count
-        let total: i64 = query_scalar("SELECT COUNT(*) FROM strategic_goals WHERE deleted_at IS NULL")
-            .fetch_one(&self.pool)
-            .await
-            .map_err(DbError::from)?;
+        let total: i64 = stat_counters::row_count(&self.read_pool, "strategic_goals", stat_counters::ACTIVE).await?;
 
         // Fetch paginated rows
         let rows = query_as::<_, StrategicGoalRow>(
@@ -634,7 +640,7 @@ impl StrategicGoalRepository for SqliteStrategicGoalRepository {
         )
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -655,7 +661,7 @@ impl StrategicGoalRepository for SqliteStrategicGoalRepository {
             "SELECT * FROM strategic_goals WHERE objective_code = ? AND deleted_at IS NULL",
         )
         .bind(code)
-        .fetch_optional(&self.pool)
+        .fetch_optional(&self.read_pool)
         .await
         .map_err(DbError::from)?;
          
@@ -693,7 +699,7 @@ impl StrategicGoalRepository for SqliteStrategicGoalRepository {
 
         let total: i64 = count_builder
             .build_query_scalar()
-            .fetch_one(&self.pool)
+            .fetch_one(&self.read_pool)
             .await
             .map_err(DbError::from)?;
             
@@ -702,7 +708,7 @@ impl StrategicGoalRepository for SqliteStrategicGoalRepository {
         // Debug: Show some sample IDs from database
         if total == 0 {
             let sample_ids: Vec<String> = sqlx::query_scalar("SELECT id FROM strategic_goals WHERE deleted_at IS NULL LIMIT 5")
-                .fetch_all(&self.pool)
+                .fetch_all(&self.read_pool)
                 .await
                 .unwrap_or_default();
             log::info!("Sample IDs in database: {:?}", sample_ids);
@@ -721,7 +727,7 @@ impl StrategicGoalRepository for SqliteStrategicGoalRepository {
 
         let rows = select_builder
             .build_query_as::<StrategicGoalRow>()
-            .fetch_all(&self.pool)
+            .fetch_all(&self.read_pool)
             .await
             .map_err(DbError::from)?;
 
@@ -835,7 +841,7 @@ impl StrategicGoalRepository for SqliteStrategicGoalRepository {
             "SELECT COUNT(*) FROM strategic_goals WHERE status_id = ? AND deleted_at IS NULL"
         )
         .bind(status_id)
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -847,7 +853,7 @@ impl StrategicGoalRepository for SqliteStrategicGoalRepository {
         .bind(status_id)
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -876,7 +882,7 @@ impl StrategicGoalRepository for SqliteStrategicGoalRepository {
             "SELECT COUNT(*) FROM strategic_goals WHERE responsible_team = ? AND deleted_at IS NULL"
         )
         .bind(team_name)
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -888,7 +894,7 @@ impl StrategicGoalRepository for SqliteStrategicGoalRepository {
         .bind(team_name)
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -924,7 +930,7 @@ impl StrategicGoalRepository for SqliteStrategicGoalRepository {
 
         let id_strings: Vec<String> = query_scalar(query_str)
             .bind(&user_id_str)
-            .fetch_all(&self.pool)
+            .fetch_all(&self.read_pool)
             .await
             .map_err(DbError::from)?;
 
@@ -939,32 +945,12 @@ impl StrategicGoalRepository for SqliteStrategicGoalRepository {
 
     /// Count goals by status_id, grouped by status
     async fn count_by_status(&self) -> DomainResult<Vec<(Option<i64>, i64)>> {
-        let counts = query_as::<_, (Option<i64>, i64)>(
-            "SELECT status_id, COUNT(*) 
-             FROM strategic_goals 
-             WHERE deleted_at IS NULL 
-             GROUP BY status_id"
-        )
-        .fetch_all(&self.pool)
-        .await
-        .map_err(DbError::from)?;
-
-        Ok(counts)
+        stat_counters::integer_breakdown(&self.read_pool, "strategic_goals", "status_id").await
     }
 
     /// Count goals grouped by responsible team
     async fn count_by_responsible_team(&self) -> DomainResult<Vec<(Option<String>, i64)>> {
-        let counts = query_as::<_, (Option<String>, i64)>(
-            "SELECT responsible_team, COUNT(*) 
-             FROM strategic_goals 
-             WHERE deleted_at IS NULL 
-             GROUP BY responsible_team"
-        )
-        .fetch_all(&self.pool)
-        .await
-        .map_err(DbError::from)?;
-
-        Ok(counts)
+        stat_counters::text_breakdown(&self.read_pool, "strategic_goals", "responsible_team").await
     }
 
     /// Get aggregate value statistics for strategic goals
@@ -982,7 +968,7 @@ impl StrategicGoalRepository for SqliteStrategicGoalRepository {
              // Removed conditions on NOT NULL values as AVG/SUM handle NULLs appropriately in SQL
              // and GoalValueSummary uses Option<f64>
         )
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -996,7 +982,7 @@ impl StrategicGoalRepository for SqliteStrategicGoalRepository {
             "SELECT COUNT(*) FROM strategic_goals WHERE updated_at < ? AND deleted_at IS NULL"
         )
         .bind(cutoff_date_str) // Bind the RFC3339 string
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
         Ok(count)
@@ -1015,7 +1001,7 @@ impl StrategicGoalRepository for SqliteStrategicGoalRepository {
             "SELECT COUNT(*) FROM strategic_goals WHERE updated_at < ? AND deleted_at IS NULL"
         )
         .bind(&cutoff_date_str)
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1028,7 +1014,7 @@ impl StrategicGoalRepository for SqliteStrategicGoalRepository {
         .bind(&cutoff_date_str)
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1054,7 +1040,7 @@ impl StrategicGoalRepository for SqliteStrategicGoalRepository {
              WHERE status_id = ? AND deleted_at IS NULL"
         )
         .bind(status_id)
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1067,7 +1053,7 @@ impl StrategicGoalRepository for SqliteStrategicGoalRepository {
         .bind(status_id)
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1105,7 +1091,7 @@ impl StrategicGoalRepository for SqliteStrategicGoalRepository {
         
         let total: i64 = query_scalar(&count_query_str)
             .bind(&user_id_str)
-            .fetch_one(&self.pool)
+            .fetch_one(&self.read_pool)
             .await
             .map_err(DbError::from)?;
 
@@ -1120,7 +1106,7 @@ impl StrategicGoalRepository for SqliteStrategicGoalRepository {
             .bind(&user_id_str)
             .bind(params.per_page as i64)
             .bind(offset as i64)
-            .fetch_all(&self.pool)
+            .fetch_all(&self.read_pool)
             .await
             .map_err(DbError::from)?;
 
@@ -1151,7 +1137,7 @@ impl StrategicGoalRepository for SqliteStrategicGoalRepository {
              WHERE updated_at < ? AND deleted_at IS NULL"
         )
         .bind(&cutoff_date_str)
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1164,7 +1150,7 @@ impl StrategicGoalRepository for SqliteStrategicGoalRepository {
         .bind(&cutoff_date_str)
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1197,7 +1183,7 @@ impl StrategicGoalRepository for SqliteStrategicGoalRepository {
         )
         .bind(&start_date_str)
         .bind(&end_date_str)
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1209,7 +1195,7 @@ impl StrategicGoalRepository for SqliteStrategicGoalRepository {
         .bind(&end_date_str)
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1436,7 +1422,7 @@ impl StrategicGoalRepository for SqliteStrategicGoalRepository {
         
         // Execute the query
         let query = query_builder.build_query_as::<(String,)>();
-        let rows = query.fetch_all(&self.pool).await
+        let rows = query.fetch_all(&self.read_pool).await
             .map_err(|e| DomainError::Database(DbError::from(e)))?;
         
         // Parse UUIDs
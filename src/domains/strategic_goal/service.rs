@@ -3,6 +3,7 @@ use crate::domains::core::dependency_checker::DependencyChecker;
 use crate::domains::core::delete_service::{BaseDeleteService, DeleteOptions, DeleteService, DeleteServiceRepository};
 use crate::domains::core::repository::{DeleteResult, FindById, HardDeletable, SoftDeletable};
 use crate::domains::core::document_linking::{DocumentLinkable};
+use crate::domains::core::loader::RelationLoader;
 use crate::domains::document::service::DocumentService;
 use crate::domains::document::types::{MediaDocumentResponse};
 use crate::domains::permission::Permission;
@@ -26,10 +27,9 @@ use crate::domains::core::delete_service::PendingDeletionManager;
 use crate::domains::sync::types::SyncPriority;
 use crate::domains::compression::types::CompressionPriority;
 
-// --- ADDED: Import ProjectRepository, ProjectSummary, and UserRepository --- 
+// --- ADDED: Import ProjectRepository and ProjectSummary --- 
 use crate::domains::project::repository::ProjectRepository;
 use crate::domains::project::types::ProjectSummary;
-use crate::domains::user::repository::UserRepository;
 
 /// Trait defining strategic goal service operations
 #[async_trait]
@@ -227,8 +227,6 @@ pub struct StrategicGoalServiceImpl {
     document_service: Arc<dyn DocumentService>,
     // --- ADDED: Project Repository --- 
     project_repo: Arc<dyn ProjectRepository + Send + Sync>,
-    // --- ADDED: User Repository for username lookups --- 
-    user_repo: Arc<dyn UserRepository + Send + Sync>,
 }
 
 impl StrategicGoalServiceImpl {
@@ -241,8 +239,6 @@ impl StrategicGoalServiceImpl {
         document_service: Arc<dyn DocumentService>,
         // --- ADDED: Inject Project Repository --- 
         project_repo: Arc<dyn ProjectRepository + Send + Sync>,
-        // --- ADDED: User Repository for username lookups --- 
-        user_repo: Arc<dyn UserRepository + Send + Sync>,
         deletion_manager: Arc<PendingDeletionManager>,
         // --- ADDED: Inject the properly configured delete service from globals ---
         delete_service: Arc<dyn DeleteService<StrategicGoal>>,
@@ -253,111 +249,116 @@ impl StrategicGoalServiceImpl {
             delete_service,
             document_service,
             project_repo,
-            user_repo,
         }
     }
 
-    // ADDED: Helper to enrich response with usernames
-    async fn enrich_response_with_usernames(
-        &self,
-        mut response: StrategicGoalResponse,
-    ) -> ServiceResult<StrategicGoalResponse> {
-        // Populate created_by username
-        if let Some(created_by_id) = response.created_by_user_id {
-            if let Ok(creator) = self.user_repo.find_by_id(created_by_id).await {
-                response.created_by_username = Some(creator.name.clone());
-                
-                // Populate updated_by username - check if same as creator
-                if let Some(updated_by_id) = response.updated_by_user_id {
-                    if updated_by_id == created_by_id {
-                        // Same person as creator
-                        response.updated_by_username = Some(creator.name);
-                    } else {
-                        // Different person - fetch separately
-                        if let Ok(updater) = self.user_repo.find_by_id(updated_by_id).await {
-                            response.updated_by_username = Some(updater.name);
-                        }
-                    }
+    /// Fill created_by/updated_by usernames of a page with one user lookup
+    async fn fill_usernames(&self, responses: &mut [StrategicGoalResponse], relations: &RelationLoader) {
+        let user_ids: Vec<Uuid> = responses
+            .iter()
+            .flat_map(|r| [r.created_by_user_id, r.updated_by_user_id])
+            .flatten()
+            .collect();
+        if user_ids.is_empty() {
+            return;
+        }
+        match relations.user_names(&user_ids).await {
+            Ok(names) => {
+                for response in responses.iter_mut() {
+                    response.created_by_username = response.created_by_user_id.and_then(|id| names.get(&id).cloned());
+                    response.updated_by_username = response.updated_by_user_id.and_then(|id| names.get(&id).cloned());
                 }
             }
-        } else if let Some(updated_by_id) = response.updated_by_user_id {
-            // No creator found, but we have an updater
-            if let Ok(updater) = self.user_repo.find_by_id(updated_by_id).await {
-                response.updated_by_username = Some(updater.name);
-            }
+            Err(e) => log::error!("Failed to load usernames for strategic goals: {}", e),
         }
-        
-        Ok(response)
     }
 
     // ADDED: Enrichment helper similar to ActivityService
     async fn enrich_response(
         &self, 
-        mut response: StrategicGoalResponse, 
+        response: StrategicGoalResponse, 
         include: Option<&[StrategicGoalInclude]>,
         auth: &AuthContext,
     ) -> ServiceResult<StrategicGoalResponse> {
+        let relations = RelationLoader::new(self.pool.clone());
+        let mut enriched = self.enrich_responses(vec![response], include, auth, &relations).await?;
+        Ok(enriched.pop().expect("one response in, one out"))
+    }
+
+    /// Enrich a page of goals. Project counts and usernames are loaded once
+    /// for the page; documents and project summaries are fetched per goal.
+    async fn enrich_responses(
+        &self,
+        mut responses: Vec<StrategicGoalResponse>,
+        include: Option<&[StrategicGoalInclude]>,
+        auth: &AuthContext,
+        relations: &RelationLoader,
+    ) -> ServiceResult<Vec<StrategicGoalResponse>> {
+
         if let Some(includes) = include {
             let include_set: HashSet<StrategicGoalInclude> = includes.iter().cloned().collect();
-            
-            // Include documents
-            if include_set.contains(&StrategicGoalInclude::Documents) {
-                let doc_params = PaginationParams::default();
-                match self.document_service.list_media_documents_by_related_entity(
-                    auth,
-                    "strategic_goals",
-                    response.id,
-                    doc_params,
-                    None
-                ).await {
-                    Ok(docs_result) => {
-                        response.documents = Some(docs_result.items);
-                    }
+
+            // One grouped count for the whole page
+            let project_counts: Option<HashMap<Uuid, i64>> = if include_set.contains(&StrategicGoalInclude::ProjectCount) {
+                match self.project_repo.count_by_strategic_goal().await {
+                    Ok(counts) => Some(counts.into_iter().filter_map(|(sg_id, count)| sg_id.map(|id| (id, count))).collect()),
                     Err(e) => {
-                        log::error!("Failed to fetch documents for goal {}: {}", response.id, e);
-                        // Decide if this should be a hard error or just skip enrichment
-                        // return Err(e); // Option 1: Return error
-                        response.document_upload_errors = Some(vec![format!("Failed to fetch documents: {}", e)]); // Option 2: Report error, continue
+                        log::error!("Failed to fetch project counts for goals: {}", e);
+                        None
                     }
                 }
-            }
+            } else {
+                None
+            };
 
-            // --- ADDED: Include Project Count --- 
-            if include_set.contains(&StrategicGoalInclude::ProjectCount) {
-                 match self.project_repo.count_by_strategic_goal().await {
-                    Ok(counts) => {
-                        let count = counts.iter()
-                            .find(|(sg_id, _)| sg_id.is_some() && sg_id.unwrap() == response.id)
-                            .map(|(_, count)| *count)
-                            .unwrap_or(0);
-                        response.project_count = Some(count);
-                    }
-                    Err(e) => {
-                        log::error!("Failed to fetch project count for goal {}: {}", response.id, e);
-                        // Handle error appropriately
+            for response in responses.iter_mut() {
+                // Include documents
+                if include_set.contains(&StrategicGoalInclude::Documents) {
+                    let doc_params = PaginationParams::default();
+                    match self.document_service.list_media_documents_by_related_entity(
+                        auth,
+                        "strategic_goals",
+                        response.id,
+                        doc_params,
+                        None
+                    ).await {
+                        Ok(docs_result) => {
+                            response.documents = Some(docs_result.items);
+                        }
+                        Err(e) => {
+                            log::error!("Failed to fetch documents for goal {}: {}", response.id, e);
+                            // Decide if this should be a hard error or just skip enrichment
+                            // return Err(e); // Option 1: Return error
+                            response.document_upload_errors = Some(vec![format!("Failed to fetch documents: {}", e)]); // Option 2: Report error, continue
+                        }
                     }
                 }
-            }
 
-            // --- ADDED: Include Projects (Summaries) --- 
-            if include_set.contains(&StrategicGoalInclude::Projects) {
-                // Fetch a limited number of projects for summary view
-                let project_params = PaginationParams { page: 1, per_page: 10 }; 
-                match self.project_repo.find_by_strategic_goal(response.id, project_params).await {
-                    Ok(paginated_projects) => {
-                        let project_summaries = paginated_projects.items
-                            .into_iter()
-                            .map(ProjectSummary::from) // Convert Project to ProjectSummary
-                            .collect::<Vec<_>>();
-                        response.projects = Some(project_summaries);
-                        // If project_count wasn't explicitly requested, set it from this result
-                        if response.project_count.is_none() {
-                            response.project_count = Some(paginated_projects.total as i64);
+                // --- ADDED: Include Project Count --- 
+                if let Some(counts) = &project_counts {
+                    response.project_count = Some(counts.get(&response.id).copied().unwrap_or(0));
+                }
+
+                // --- ADDED: Include Projects (Summaries) --- 
+                if include_set.contains(&StrategicGoalInclude::Projects) {
+                    // Fetch a limited number of projects for summary view
+                    let project_params = PaginationParams { page: 1, per_page: 10 }; 
+                    match self.project_repo.find_by_strategic_goal(response.id, project_params).await {
+                        Ok(paginated_projects) => {
+                            let project_summaries = paginated_projects.items
+                                .into_iter()
+                                .map(ProjectSummary::from) // Convert Project to ProjectSummary
+                                .collect::<Vec<_>>();
+                            response.projects = Some(project_summaries);
+                            // If project_count wasn't explicitly requested, set it from this result
+                            if response.project_count.is_none() {
+                                response.project_count = Some(paginated_projects.total as i64);
+                            }
+                        }
+                        Err(e) => {
+                            log::error!("Failed to fetch projects for goal {}: {}", response.id, e);
+                            // Handle error appropriately
                         }
-                    }
-                    Err(e) => {
-                        log::error!("Failed to fetch projects for goal {}: {}", response.id, e);
-                        // Handle error appropriately
                     }
                 }
             }
@@ -366,7 +367,8 @@ impl StrategicGoalServiceImpl {
         }
         
         // Always enrich with usernames
-        self.enrich_response_with_usernames(response).await
+        self.fill_usernames(&mut responses, relations).await;
+        Ok(responses)
     }
 }
 
@@ -537,12 +539,9 @@ impl StrategicGoalService for StrategicGoalServiceImpl {
 
         let paginated_result = self.repo.find_all(params).await.map_err(ServiceError::Domain)?;
         
-        let mut enriched_items = Vec::new();
-        for item in paginated_result.items {
-            let response = StrategicGoalResponse::from(item);
-            let enriched = self.enrich_response(response, include, auth).await?; // Call enrich
-            enriched_items.push(enriched);
-        }
+        let responses = paginated_result.items.into_iter().map(StrategicGoalResponse::from).collect();
+        let relations = RelationLoader::new(self.pool.clone());
+        let enriched_items = self.enrich_responses(responses, include, auth, &relations).await?;
 
         Ok(PaginatedResult::new(
             enriched_items,
@@ -930,12 +929,9 @@ impl StrategicGoalService for StrategicGoalServiceImpl {
             .await
             .map_err(ServiceError::Domain)?;
 
-        let mut enriched_items = Vec::new();
-        for item in paginated_result.items {
-            let response = StrategicGoalResponse::from(item);
-            let enriched = self.enrich_response(response, include, auth).await?; // Call enrich
-            enriched_items.push(enriched);
-        }
+        let responses = paginated_result.items.into_iter().map(StrategicGoalResponse::from).collect();
+        let relations = RelationLoader::new(self.pool.clone());
+        let enriched_items = self.enrich_responses(responses, include, auth, &relations).await?;
 
         Ok(PaginatedResult::new(
             enriched_items,
@@ -958,12 +954,9 @@ impl StrategicGoalService for StrategicGoalServiceImpl {
             .await
             .map_err(ServiceError::Domain)?;
 
-        let mut enriched_items = Vec::new();
-        for item in paginated_result.items {
-            let response = StrategicGoalResponse::from(item);
-            let enriched = self.enrich_response(response, include, auth).await?; // Call enrich
-            enriched_items.push(enriched);
-        }
+        let responses = paginated_result.items.into_iter().map(StrategicGoalResponse::from).collect();
+        let relations = RelationLoader::new(self.pool.clone());
+        let enriched_items = self.enrich_responses(responses, include, auth, &relations).await?;
 
         Ok(PaginatedResult::new(
             enriched_items,
@@ -987,12 +980,9 @@ impl StrategicGoalService for StrategicGoalServiceImpl {
             .await
             .map_err(ServiceError::Domain)?;
 
-        let mut enriched_items = Vec::new();
-        for item in paginated_result.items {
-            let response = StrategicGoalResponse::from(item);
-            let enriched = self.enrich_response(response, include, auth).await?; // Call enrich
-            enriched_items.push(enriched);
-        }
+        let responses = paginated_result.items.into_iter().map(StrategicGoalResponse::from).collect();
+        let relations = RelationLoader::new(self.pool.clone());
+        let enriched_items = self.enrich_responses(responses, include, auth, &relations).await?;
 
         Ok(PaginatedResult::new(
             enriched_items,
@@ -1087,12 +1077,9 @@ impl StrategicGoalService for StrategicGoalServiceImpl {
             .await
             .map_err(ServiceError::Domain)?;
             
-        let mut enriched_items = Vec::new();
-        for item in paginated_result.items {
-            let response = StrategicGoalResponse::from(item);
-            let enriched = self.enrich_response(response, include, auth).await?; // Call enrich
-            enriched_items.push(enriched);
-        }
+        let responses = paginated_result.items.into_iter().map(StrategicGoalResponse::from).collect();
+        let relations = RelationLoader::new(self.pool.clone());
+        let enriched_items = self.enrich_responses(responses, include, auth, &relations).await?;
 
         Ok(PaginatedResult::new(
             enriched_items,
@@ -1145,12 +1132,9 @@ impl StrategicGoalService for StrategicGoalServiceImpl {
             .map_err(ServiceError::Domain)?;
 
         // 5. Convert to response DTOs and enrich
-        let mut enriched_items = Vec::new();
-        for goal in paginated_result.items {
-            let response = StrategicGoalResponse::from(goal);
-            let enriched = self.enrich_response(response, include, auth).await?;
-            enriched_items.push(enriched);
-        }
+        let responses = paginated_result.items.into_iter().map(StrategicGoalResponse::from).collect();
+        let relations = RelationLoader::new(self.pool.clone());
+        let enriched_items = self.enrich_responses(responses, include, auth, &relations).await?;
 
         // 6. Return paginated result
         Ok(PaginatedResult::new(
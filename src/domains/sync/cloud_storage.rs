@@ -10,9 +10,13 @@ use log::{info, warn, error, debug};
 use reqwest::Client;
 use std::time::Duration;
 use reqwest::multipart::{Form, Part};
+use reqwest::Body;
 use chrono::Utc;
 use sha2::{Sha256, Digest};
 use tokio::time::{sleep, Duration as TokioDuration};
+use tokio::fs::{File, OpenOptions};
+use tokio::io::{AsyncReadExt, AsyncSeekExt, AsyncWriteExt};
+use std::io::SeekFrom;
 
 /// Trait for cloud storage service operations
 #[async_trait]
@@ -22,6 +26,9 @@ pub trait CloudStorageService: Send + Sync {
     
     /// Push local changes to remote storage
     async fn push_changes(&self, api_token: &str, payload: PushPayload) -> ServiceResult<PushChangesResponse>;
+
+    /// Push a payload that was already serialized with `encode_push`
+    async fn push_encoded(&self, api_token: &str, push: &EncodedPush) -> ServiceResult<PushChangesResponse>;
     
     /// Upload a document to cloud storage
     async fn upload_document(&self, device_id_of_uploader: Uuid, document_id: Uuid, local_path: &str, mime_type: &str, size_bytes: u64) -> ServiceResult<String>;
@@ -30,6 +37,49 @@ pub trait CloudStorageService: Send + Sync {
     async fn download_document(&self, document_id: Uuid, blob_key: &str) -> ServiceResult<(String, u64, bool)>;
 }
 
+/// Payloads at least this large are sent zstd-compressed
+const PUSH_COMPRESSION_THRESHOLD: usize = 8 * 1024;
+const PUSH_COMPRESSION_LEVEL: i32 = 3;
+
+/// A push payload serialized (and, when large, compressed) ahead of sending,
+/// so the sync service can prepare the next page while one is in flight
+pub struct EncodedPush {
+    pub batch_id: String,
+    pub change_count: usize,
+    pub tombstone_count: usize,
+    body: Vec<u8>,
+    content_encoding: Option<&'static str>,
+}
+
+impl EncodedPush {
+    /// Bytes that go over the wire
+    pub fn wire_size(&self) -> usize {
+        self.body.len()
+    }
+}
+
+/// Serialize a push payload, compressing it with zstd above `PUSH_COMPRESSION_THRESHOLD`
+pub fn encode_push(payload: &PushPayload) -> ServiceResult<EncodedPush> {
+    let json = serde_json::to_vec(payload)
+        .map_err(|e| ServiceError::Domain(DomainError::Internal(format!("Failed to serialize push payload: {}", e))))?;
+
+    let (body, content_encoding) = if json.len() >= PUSH_COMPRESSION_THRESHOLD {
+        let compressed = zstd::bulk::compress(&json, PUSH_COMPRESSION_LEVEL)
+            .map_err(|e| ServiceError::Domain(DomainError::Internal(format!("Failed to compress push payload: {}", e))))?;
+        (compressed, Some("zstd"))
+    } else {
+        (json, None)
+    };
+
+    Ok(EncodedPush {
+        batch_id: payload.batch_id.clone(),
+        change_count: payload.changes.len(),
+        tombstone_count: payload.tombstones.as_ref().map_or(0, |t| t.len()),
+        body,
+        content_encoding,
+    })
+}
+
 /// Implementation of CloudStorageService that communicates with an API server
 pub struct ApiCloudStorageService {
     client: Client,
@@ -72,15 +122,333 @@ impl ApiCloudStorageService {
 const MAX_RETRIES: usize = 3;
 const BASE_DELAY_MS: u64 = 1_000; // 1 second base delay for backoff
 
+/// Upload chunk size: small enough that a dropped 3G connection loses little work
+const UPLOAD_CHUNK_SIZE: usize = 1024 * 1024;
+/// Read buffer for hashing and streaming files
+const FILE_READ_BUFFER: usize = 64 * 1024;
+
 fn should_retry_status(status: reqwest::StatusCode) -> bool {
     status.is_server_error() || status == reqwest::StatusCode::TOO_MANY_REQUESTS
 }
 
-fn compute_sha256_hex(bytes: &[u8]) -> String {
+fn file_error(context: &str, e: std::io::Error) -> ServiceError {
+    ServiceError::Domain(DomainError::File(format!("{}: {}", context, e)))
+}
+
+/// SHA-256 (lowercase hex) and size of a file, read in fixed-size chunks
+async fn hash_file(path: &str) -> ServiceResult<(String, u64)> {
+    let mut file = File::open(path).await.map_err(|e| file_error("Failed to read local file", e))?;
     let mut hasher = Sha256::new();
-    hasher.update(bytes);
-    let result = hasher.finalize();
-    hex::encode(result)
+    let mut buf = vec![0u8; FILE_READ_BUFFER];
+    let mut size = 0u64;
+    loop {
+        let n = file.read(&mut buf).await.map_err(|e| file_error("Failed to read local file", e))?;
+        if n == 0 {
+            break;
+        }
+        hasher.update(&buf[..n]);
+        size += n as u64;
+    }
+    Ok((hex::encode(hasher.finalize()), size))
+}
+
+/// Read up to `len` bytes of `path` starting at `offset`
+async fn read_chunk(path: &str, offset: u64, len: usize) -> ServiceResult<Vec<u8>> {
+    let mut file = File::open(path).await.map_err(|e| file_error("Failed to read local file", e))?;
+    file.seek(SeekFrom::Start(offset)).await.map_err(|e| file_error("Failed to seek local file", e))?;
+    let mut chunk = Vec::with_capacity(len);
+    file.take(len as u64).read_to_end(&mut chunk).await.map_err(|e| file_error("Failed to read local file", e))?;
+    Ok(chunk)
+}
+
+/// The file as a stream of buffers, for request bodies that never hold it whole
+fn file_body_stream(file: File) -> impl futures::Stream<Item = std::io::Result<Vec<u8>>> + Send + 'static {
+    futures::stream::try_unfold(file, |mut file| async move {
+        let mut buf = vec![0u8; FILE_READ_BUFFER];
+        let n = file.read(&mut buf).await?;
+        if n == 0 {
+            Ok(None)
+        } else {
+            buf.truncate(n);
+            Ok(Some((buf, file)))
+        }
+    })
+}
+
+enum BodyError {
+    /// Writing locally failed: retrying will not help
+    File(ServiceError),
+    /// The connection failed mid-body: what arrived is kept for a range retry
+    Network(reqwest::Error),
+}
+
+/// Stream a response body into `path`, appending or truncating
+async fn write_body_to_file(response: &mut reqwest::Response, path: &str, append: bool) -> Result<(), BodyError> {
+    let mut file = OpenOptions::new()
+        .create(true)
+        .write(true)
+        .append(append)
+        .truncate(!append)
+        .open(path)
+        .await
+        .map_err(|e| BodyError::File(file_error("Failed to write document to disk", e)))?;
+
+    let result = loop {
+        match response.chunk().await {
+            Ok(Some(chunk)) => {
+                if let Err(e) = file.write_all(&chunk).await {
+                    break Err(BodyError::File(file_error("Failed to write document to disk", e)));
+                }
+            }
+            Ok(None) => break Ok(()),
+            Err(e) => break Err(BodyError::Network(e)),
+        }
+    };
+
+    // Keep whatever arrived, so a retry can continue from it
+    file.flush().await.map_err(|e| BodyError::File(file_error("Failed to write document to disk", e)))?;
+    result
+}
+
+/// Body of the request that opens (or re-opens) a resumable upload session
+#[derive(Serialize)]
+#[serde(rename_all = "camelCase")]
+struct UploadSessionRequest<'a> {
+    document_id: &'a str,
+    device_id: &'a str,
+    file_name: &'a str,
+    mime_type: &'a str,
+    size_bytes: u64,
+    sha256: &'a str,
+}
+
+/// Server-side state of a resumable upload. The server keys sessions by
+/// document and content hash, so re-opening one after a crash or app restart
+/// reports the bytes it already holds.
+#[derive(Deserialize)]
+struct UploadSession {
+    upload_id: String,
+    #[serde(default)]
+    received_bytes: u64,
+}
+
+#[derive(Deserialize)]
+struct UploadProgress {
+    received_bytes: u64,
+}
+
+#[derive(Deserialize)]
+struct UploadResponse {
+    blob_key: String,
+}
+
+impl ApiCloudStorageService {
+    fn upload_session_url(&self, doc_id: &str, upload_id: &str) -> String {
+        format!("{}/api/documents/upload/{}/sessions/{}", self.base_url, doc_id, upload_id)
+    }
+
+    /// Open a resumable upload session. `None` means the server does not
+    /// support sessions and the caller should fall back to a single multipart request.
+    async fn start_upload_session(&self, doc_id: &str, request: &UploadSessionRequest<'_>) -> ServiceResult<Option<UploadSession>> {
+        let url = format!("{}/api/documents/upload/{}/sessions", self.base_url, doc_id);
+
+        let mut attempt = 0usize;
+        loop {
+            let error = match self.client.post(&url).json(request).send().await {
+                Ok(response) => {
+                    let status = response.status();
+                    if status.is_success() {
+                        let session = response.json::<UploadSession>().await
+                            .map_err(|e| ServiceError::ExternalService(format!("Failed to parse upload session response: {}", e)))?;
+                        return Ok(Some(session));
+                    } else if matches!(status, reqwest::StatusCode::NOT_FOUND | reqwest::StatusCode::METHOD_NOT_ALLOWED | reqwest::StatusCode::NOT_IMPLEMENTED) {
+                        return Ok(None);
+                    } else if should_retry_status(status) {
+                        format!("status {}", status)
+                    } else {
+                        let error_text = response.text().await.unwrap_or_else(|_| "Unable to get error details".to_string());
+                        return Err(ServiceError::ExternalService(format!("Server returned error {}: {}", status, error_text)));
+                    }
+                }
+                Err(e) => format!("network error: {}", e),
+            };
+
+            if attempt >= MAX_RETRIES {
+                return Err(ServiceError::ExternalService(format!("Failed to start upload session: {}", error)));
+            }
+            attempt += 1;
+            let delay = BASE_DELAY_MS * 2u64.pow(attempt as u32 - 1);
+            debug!("Retrying upload session start (attempt {}) after {} ms ({})", attempt, delay, error);
+            sleep(TokioDuration::from_millis(delay)).await;
+        }
+    }
+
+    /// Ask the server how many bytes of a session it holds
+    async fn upload_session_progress(&self, doc_id: &str, upload_id: &str) -> Option<u64> {
+        let response = self.client.get(self.upload_session_url(doc_id, upload_id)).send().await.ok()?;
+        if !response.status().is_success() {
+            return None;
+        }
+        response.json::<UploadProgress>().await.ok().map(|p| p.received_bytes)
+    }
+
+    /// Send the file in `UPLOAD_CHUNK_SIZE` pieces with `Content-Range`,
+    /// continuing from the server's offset after any failure. The retry budget
+    /// is per chunk, so a flaky link that keeps making progress still finishes.
+    async fn upload_chunks(&self, doc_id: &str, session: UploadSession, local_path: &str, file_size: u64, file_hash: &str) -> ServiceResult<String> {
+        let session_url = self.upload_session_url(doc_id, &session.upload_id);
+        let mut offset = session.received_bytes.min(file_size);
+        if offset > 0 {
+            debug!("Resuming upload of document {} at byte {} of {}", doc_id, offset, file_size);
+        }
+
+        let mut attempt = 0usize;
+        while offset < file_size {
+            let chunk = read_chunk(local_path, offset, UPLOAD_CHUNK_SIZE).await?;
+            let chunk_end = offset + chunk.len() as u64;
+
+            let error = match self.client.put(&session_url)
+                .header(reqwest::header::CONTENT_RANGE, format!("bytes {}-{}/{}", offset, chunk_end - 1, file_size))
+                .header(reqwest::header::CONTENT_TYPE, "application/octet-stream")
+                .body(chunk)
+                .send()
+                .await
+            {
+                Ok(response) if response.status().is_success() || response.status() == reqwest::StatusCode::PERMANENT_REDIRECT => {
+                    // Trust the server's count when it reports one
+                    offset = response.json::<UploadProgress>().await
+                        .map(|p| p.received_bytes)
+                        .unwrap_or(chunk_end)
+                        .min(file_size);
+                    attempt = 0;
+                    continue;
+                }
+                Ok(response) if matches!(response.status(), reqwest::StatusCode::CONFLICT | reqwest::StatusCode::RANGE_NOT_SATISFIABLE) => {
+                    format!("offset {} rejected ({})", offset, response.status())
+                }
+                Ok(response) if should_retry_status(response.status()) => format!("status {}", response.status()),
+                Ok(response) => {
+                    let status = response.status();
+                    let error_text = response.text().await.unwrap_or_else(|_| "Unable to get error details".to_string());
+                    return Err(ServiceError::ExternalService(format!("Server returned error {}: {}", status, error_text)));
+                }
+                Err(e) => format!("network error: {}", e),
+            };
+
+            if attempt >= MAX_RETRIES {
+                return Err(ServiceError::ExternalService(format!("Failed to upload document at byte {}: {}", offset, error)));
+            }
+            attempt += 1;
+            let delay = BASE_DELAY_MS * 2u64.pow(attempt as u32 - 1);
+            debug!("Retrying upload chunk at byte {} (attempt {}) after {} ms ({})", offset, attempt, delay, error);
+            sleep(TokioDuration::from_millis(delay)).await;
+
+            // Part of the chunk may have arrived before the failure
+            if let Some(received) = self.upload_session_progress(doc_id, &session.upload_id).await {
+                offset = received.min(file_size);
+            }
+        }
+
+        let complete_url = format!("{}/complete", session_url);
+        let mut attempt = 0usize;
+        loop {
+            let error = match self.client.post(&complete_url)
+                .header("X-Content-Sha256", file_hash)
+                .send()
+                .await
+            {
+                Ok(response) if response.status().is_success() => {
+                    return parse_upload_response(response, file_hash).await;
+                }
+                Ok(response) if should_retry_status(response.status()) => format!("status {}", response.status()),
+                Ok(response) => {
+                    let status = response.status();
+                    let error_text = response.text().await.unwrap_or_else(|_| "Unable to get error details".to_string());
+                    return Err(ServiceError::ExternalService(format!("Server returned error {}: {}", status, error_text)));
+                }
+                Err(e) => format!("network error: {}", e),
+            };
+
+            if attempt >= MAX_RETRIES {
+                return Err(ServiceError::ExternalService(format!("Failed to complete upload: {}", error)));
+            }
+            attempt += 1;
+            let delay = BASE_DELAY_MS * 2u64.pow(attempt as u32 - 1);
+            debug!("Retrying upload completion (attempt {}) after {} ms ({})", attempt, delay, error);
+            sleep(TokioDuration::from_millis(delay)).await;
+        }
+    }
+
+    /// Single multipart request for servers without upload sessions. The file
+    /// part is streamed from disk, so retries re-read it instead of keeping a copy.
+    async fn upload_multipart_streaming(
+        &self,
+        doc_id: &str,
+        uploader_device_id: &str,
+        file_name: &str,
+        local_path: &str,
+        mime_type: &str,
+        file_size: u64,
+        file_hash: &str,
+    ) -> ServiceResult<String> {
+        let url = format!("{}/api/documents/upload/{}", self.base_url, doc_id);
+
+        let mut attempt = 0usize;
+        loop {
+            let file = File::open(local_path).await.map_err(|e| file_error("Failed to read local file", e))?;
+            let part = Part::stream_with_length(Body::wrap_stream(file_body_stream(file)), file_size)
+                .file_name(file_name.to_string())
+                .mime_str(mime_type)
+                .map_err(|e| ServiceError::Domain(DomainError::Internal(format!("Invalid MIME type for upload: {}", e))))?;
+
+            let form = Form::new()
+                .part("file", part)
+                .text("documentId", doc_id.to_string())
+                .text("deviceId", uploader_device_id.to_string());
+
+            let error = match self.client.post(&url)
+                .header("X-Content-Sha256", file_hash)
+                .multipart(form)
+                .send()
+                .await
+            {
+                Ok(response) if response.status().is_success() => {
+                    return parse_upload_response(response, file_hash).await;
+                }
+                Ok(response) if should_retry_status(response.status()) => format!("status {}", response.status()),
+                Ok(response) => {
+                    let status = response.status();
+                    let error_text = response.text().await.unwrap_or_else(|_| "Unable to get error details".to_string());
+                    return Err(ServiceError::ExternalService(format!("Server returned error {}: {}", status, error_text)));
+                }
+                Err(e) => format!("network error: {}", e),
+            };
+
+            if attempt >= MAX_RETRIES {
+                return Err(ServiceError::ExternalService(format!("Failed to upload document: {}", error)));
+            }
+            attempt += 1;
+            let delay = BASE_DELAY_MS * 2u64.pow(attempt as u32 - 1);
+            debug!("Retrying upload_document (attempt {}) after {} ms ({})", attempt, delay, error);
+            sleep(TokioDuration::from_millis(delay)).await;
+        }
+    }
+}
+
+/// Read the blob key from a finished upload and check the server's hash
+async fn parse_upload_response(response: reqwest::Response, file_hash: &str) -> ServiceResult<String> {
+    let server_hash_opt = response.headers().get("X-Verified-Sha256").and_then(|v| v.to_str().ok()).map(|s| s.to_string());
+
+    let upload_response = response.json::<UploadResponse>().await
+        .map_err(|e| ServiceError::ExternalService(format!("Failed to parse upload response: {}", e)))?;
+
+    if let Some(server_hash) = server_hash_opt {
+        if server_hash != file_hash {
+            return Err(ServiceError::Domain(DomainError::Internal("Checksum mismatch after upload".into())));
+        }
+    }
+
+    Ok(upload_response.blob_key)
 }
 
 #[async_trait]
@@ -140,10 +508,17 @@ impl CloudStorageService for ApiCloudStorageService {
     }
     
     async fn push_changes(&self, api_token: &str, payload: PushPayload) -> ServiceResult<PushChangesResponse> {
-        debug!("Pushing {} changes and {} tombstones for device {}",
-               payload.changes.len(),
-               payload.tombstones.as_ref().map_or(0, |t| t.len()),
-               payload.device_id);
+        let encoded = encode_push(&payload)?;
+        self.push_encoded(api_token, &encoded).await
+    }
+
+    async fn push_encoded(&self, api_token: &str, push: &EncodedPush) -> ServiceResult<PushChangesResponse> {
+        debug!("Pushing {} changes and {} tombstones in batch {} ({} bytes{})",
+               push.change_count,
+               push.tombstone_count,
+               push.batch_id,
+               push.body.len(),
+               push.content_encoding.map(|e| format!(", {}", e)).unwrap_or_default());
 
         if crate::globals::is_offline_mode() {
             warn!("Device is offline. Skipping push_changes API call.");
@@ -154,9 +529,14 @@ impl CloudStorageService for ApiCloudStorageService {
 
         let mut attempt = 0usize;
         loop {
-            let resp_res = self.client.post(&url)
+            let mut request = self.client.post(&url)
                 .header("Authorization", self.auth_header(api_token))
-                .json(&payload)
+                .header(reqwest::header::CONTENT_TYPE, "application/json");
+            if let Some(encoding) = push.content_encoding {
+                request = request.header(reqwest::header::CONTENT_ENCODING, encoding);
+            }
+            let resp_res = request
+                .body(push.body.clone())
                 .send()
                 .await;
 
@@ -202,72 +582,27 @@ impl CloudStorageService for ApiCloudStorageService {
 
         let doc_id_str = document_id.to_string();
         let uploader_device_id_str = device_id_of_uploader.to_string();
-        let url = format!("{}/api/documents/upload/{}", self.base_url, doc_id_str);
-
-        // Read the file
-        let file_content = tokio::fs::read(local_path)
-            .await
-            .map_err(|e| ServiceError::Domain(DomainError::File(format!("Failed to read local file: {}", e))))?;
-
-        let file_hash = compute_sha256_hex(&file_content);
-
-        let mut attempt = 0usize;
-        loop {
-            let part = Part::bytes(file_content.clone())
-                .file_name(Path::new(local_path).file_name().unwrap_or_default().to_string_lossy().into_owned())
-                .mime_str(mime_type)
-                .map_err(|e| ServiceError::Domain(DomainError::Internal(format!("Invalid MIME type for upload: {}", e))))?;
-
-            let form = Form::new()
-                .part("file", part)
-                .text("documentId", doc_id_str.clone())
-                .text("deviceId", uploader_device_id_str.clone());
-
-            let resp_res = self.client.post(&url)
-                .header("X-Content-Sha256", file_hash.as_str())
-                .multipart(form)
-                .send()
-                .await;
-
-            match resp_res {
-                Ok(response) => {
-                    if response.status().is_success() {
-                        let server_hash_opt = response.headers().get("X-Verified-Sha256").and_then(|v| v.to_str().ok()).map(|s| s.to_string());
-
-                        #[derive(Deserialize)]
-                        struct UploadResponse { blob_key: String }
-                        let upload_response = response.json::<UploadResponse>().await
-                            .map_err(|e| ServiceError::ExternalService(format!("Failed to parse upload response: {}", e)))?;
-
-                        if let Some(server_hash) = server_hash_opt {
-                            if server_hash != file_hash {
-                                return Err(ServiceError::Domain(DomainError::Internal("Checksum mismatch after upload".into())));
-                            }
-                        }
-
-                        return Ok(upload_response.blob_key);
-                    } else if should_retry_status(response.status()) && attempt < MAX_RETRIES {
-                        attempt += 1;
-                        let delay = BASE_DELAY_MS * 2u64.pow(attempt as u32 - 1);
-                        debug!("Retrying upload_document (attempt {}) after {} ms (status {})", attempt, delay, response.status());
-                        sleep(TokioDuration::from_millis(delay)).await;
-                        continue;
-                    } else {
-                        let status = response.status();
-                        let error_text = response.text().await.unwrap_or_else(|_| "Unable to get error details".to_string());
-                        return Err(ServiceError::ExternalService(format!("Server returned error {}: {}", status, error_text)));
-                    }
-                }
-                Err(e) => {
-                    if attempt < MAX_RETRIES {
-                        attempt += 1;
-                        let delay = BASE_DELAY_MS * 2u64.pow(attempt as u32 - 1);
-                        debug!("Network error uploading document (attempt {}): {}. Retrying after {} ms", attempt, e, delay);
-                        sleep(TokioDuration::from_millis(delay)).await;
-                        continue;
-                    }
-                    return Err(ServiceError::ExternalService(format!("Failed to upload document: {}", e)));
-                }
+        let file_name = Path::new(local_path).file_name().unwrap_or_default().to_string_lossy().into_owned();
+
+        // Hash in a streaming pass; the upload itself then reads one chunk at a time
+        let (file_hash, file_size) = hash_file(local_path).await?;
+
+        let session_request = UploadSessionRequest {
+            document_id: &doc_id_str,
+            device_id: &uploader_device_id_str,
+            file_name: &file_name,
+            mime_type,
+            size_bytes: file_size,
+            sha256: &file_hash,
+        };
+
+        match self.start_upload_session(&doc_id_str, &session_request).await? {
+            Some(session) => {
+                self.upload_chunks(&doc_id_str, session, local_path, file_size, &file_hash).await
+            }
+            None => {
+                debug!("Server has no resumable upload sessions, streaming multipart upload for document {}", document_id);
+                self.upload_multipart_streaming(&doc_id_str, &uploader_device_id_str, &file_name, local_path, mime_type, file_size, &file_hash).await
             }
         }
     }
@@ -285,19 +620,27 @@ impl CloudStorageService for ApiCloudStorageService {
         let doc_id_str = document_id.to_string();
         let url = format!("{}/api/documents/download/{}", self.base_url, blob_key);
 
+        // Bytes land in a .part file first; a retry (or a later sync) continues
+        // from its length with a Range request instead of starting over
+        let part_path = format!("{}/{}.part", self.local_storage_path, doc_id_str);
+
         let mut attempt = 0usize;
         loop {
-            let resp_res = self.client.get(&url).send().await;
+            let resume_from = tokio::fs::metadata(&part_path).await.map(|m| m.len()).unwrap_or(0);
+            let mut request = self.client.get(&url);
+            if resume_from > 0 {
+                debug!("Resuming download of document {} at byte {}", document_id, resume_from);
+                request = request.header(reqwest::header::RANGE, format!("bytes={}-", resume_from));
+            }
 
-            match resp_res {
-                Ok(response) => {
-                    if response.status().is_success() {
+            let error = match request.send().await {
+                Ok(mut response) => {
+                    let status = response.status();
+                    if status.is_success() {
                         // Determine compression via headers
-                        let content_type = response.headers().get(reqwest::header::CONTENT_TYPE).and_then(|v| v.to_str().ok()).unwrap_or("application/octet-stream");
+                        let content_type = response.headers().get(reqwest::header::CONTENT_TYPE).and_then(|v| v.to_str().ok()).unwrap_or("application/octet-stream").to_string();
                         let is_compressed = content_type.contains("compressed") || content_type.contains("zip") || response.headers().get("X-Compressed").and_then(|v| v.to_str().ok()).map(|v| v == "true").unwrap_or(false);
 
-                        let size = response.content_length().unwrap_or(0);
-
                         let extension = if content_type.contains("jpeg") || content_type.contains("jpg") { "jpg" } else if content_type.contains("png") { "png" } else if content_type.contains("pdf") { "pdf" } else if content_type.contains("zip") || is_compressed { "zip" } else { "bin" };
 
                         let filename = if is_compressed { format!("{}_compressed.{}", doc_id_str, extension) } else { format!("{}.{}", doc_id_str, extension) };
@@ -308,61 +651,67 @@ impl CloudStorageService for ApiCloudStorageService {
                             .get("X-Content-Sha256")
                             .and_then(|v| v.to_str().ok())
                             .map(|s| s.to_string());
-                        
-                        let bytes = response.bytes().await.map_err(|e| ServiceError::Domain(DomainError::File(format!("Failed to read document bytes: {}", e))))?;
-                        
-                        // Verify checksum if header present
-                        if let Some(expected_hash) = server_hash_opt {
-                            let actual_hash = compute_sha256_hex(&bytes);
-                            if actual_hash != expected_hash {
-                                return Err(ServiceError::Domain(DomainError::Internal("Checksum mismatch in downloaded file".into())));
-                            }
-                        }
 
-                        tokio::fs::write(&local_path, &bytes).await.map_err(|e| ServiceError::Domain(DomainError::File(format!("Failed to write document to disk: {}", e))))?;
+                        // 206 continues the partial file; a plain 200 means the server ignored the range
+                        let append = status == reqwest::StatusCode::PARTIAL_CONTENT && resume_from > 0;
+                        match write_body_to_file(&mut response, &part_path, append).await {
+                            Ok(()) => {
+                                let (actual_hash, size) = hash_file(&part_path).await?;
 
-                        return Ok((local_path, size, is_compressed));
-                    } else if should_retry_status(response.status()) && attempt < MAX_RETRIES {
-                        attempt += 1;
-                        let delay = BASE_DELAY_MS * 2u64.pow(attempt as u32 - 1);
-                        debug!("Retrying download_document (attempt {}) after {} ms (status {})", attempt, delay, response.status());
-                        sleep(TokioDuration::from_millis(delay)).await;
-                        continue;
+                                // Verify checksum if header present
+                                if let Some(expected_hash) = server_hash_opt {
+                                    if actual_hash != expected_hash {
+                                        let _ = tokio::fs::remove_file(&part_path).await;
+                                        return Err(ServiceError::Domain(DomainError::Internal("Checksum mismatch in downloaded file".into())));
+                                    }
+                                }
+
+                                tokio::fs::rename(&part_path, &local_path).await.map_err(|e| ServiceError::Domain(DomainError::File(format!("Failed to write document to disk: {}", e))))?;
+
+                                return Ok((local_path, size, is_compressed));
+                            }
+                            Err(BodyError::File(e)) => return Err(e),
+                            Err(BodyError::Network(e)) => format!("connection dropped mid-download: {}", e),
+                        }
+                    } else if status == reqwest::StatusCode::RANGE_NOT_SATISFIABLE && resume_from > 0 {
+                        // The partial file no longer matches the blob; start over
+                        let _ = tokio::fs::remove_file(&part_path).await;
+                        format!("range {}- not satisfiable", resume_from)
+                    } else if should_retry_status(status) {
+                        format!("status {}", status)
                     } else {
-                        let status = response.status();
                         let error_text = response.text().await.unwrap_or_else(|_| "Unable to get error details".to_string());
                         return Err(ServiceError::ExternalService(format!("Server returned error {}: {}", status, error_text)));
                     }
                 }
-                Err(e) => {
-                    if attempt < MAX_RETRIES {
-                        attempt += 1;
-                        let delay = BASE_DELAY_MS * 2u64.pow(attempt as u32 - 1);
-                        debug!("Network error downloading document (attempt {}): {}. Retrying after {} ms", attempt, e, delay);
-                        sleep(TokioDuration::from_millis(delay)).await;
-                        continue;
-                    }
-                    return Err(ServiceError::ExternalService(format!("Failed to download document: {}", e)));
-                }
+                Err(e) => format!("network error: {}", e),
+            };
+
+            if attempt >= MAX_RETRIES {
+                return Err(ServiceError::ExternalService(format!("Failed to download document: {}", error)));
             }
+            attempt += 1;
+            let delay = BASE_DELAY_MS * 2u64.pow(attempt as u32 - 1);
+            debug!("Retrying download_document (attempt {}) after {} ms ({})", attempt, delay, error);
+            sleep(TokioDuration::from_millis(delay)).await;
         }
     }
 }
 
 /// Mock implementation for testing
-#[cfg(test)]
+#[cfg(any(test, feature = "perf-harness"))]
 pub struct MockCloudStorageService {
     base_path: String,
 }
 
-#[cfg(test)]
+#[cfg(any(test, feature = "perf-harness"))]
 impl MockCloudStorageService {
     pub fn new(base_path: &str) -> Self {
         Self { base_path: base_path.to_string() }
     }
 }
 
-#[cfg(test)]
+#[cfg(any(test, feature = "perf-harness"))]
 #[async_trait]
 impl CloudStorageService for MockCloudStorageService {
     async fn get_changes_since(&self, _api_token: &str, _device_id: Uuid, _sync_token: Option<String>) -> ServiceResult<FetchChangesResponse> {
@@ -391,6 +740,17 @@ impl CloudStorageService for MockCloudStorageService {
         })
     }
     
+    async fn push_encoded(&self, _api_token: &str, push: &EncodedPush) -> ServiceResult<PushChangesResponse> {
+        Ok(PushChangesResponse {
+            batch_id: push.batch_id.clone(),
+            changes_accepted: push.change_count as i64,
+            changes_rejected: 0,
+            conflicts_detected: 0,
+            conflicts: None,
+            server_timestamp: Utc::now(),
+        })
+    }
+    
     async fn upload_document(&self, _device_id_of_uploader: Uuid, document_id: Uuid, _local_path: &str, _mime_type: &str, _size_bytes: u64) -> ServiceResult<String> {
         // Mock successful upload by returning a fake blob key
         Ok(format!("mock_blob_key_for_{}", document_id))
@@ -403,4 +763,31 @@ impl CloudStorageService for MockCloudStorageService {
         // Mock successful download (0 bytes, not compressed)
         Ok((local_path, 0, false))
     }
-}
\ No newline at end of file
+}
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[tokio::test]
+    async fn chunks_cover_the_file_and_hash_matches() {
+        let path = std::env::temp_dir().join(format!("cloud_storage_chunks_{}", Uuid::new_v4()));
+        let data: Vec<u8> = (0..200_000u32).map(|i| (i % 251) as u8).collect();
+        tokio::fs::write(&path, &data).await.unwrap();
+        let path_str = path.to_string_lossy().into_owned();
+
+        let (hash, size) = hash_file(&path_str).await.unwrap();
+        assert_eq!(size, data.len() as u64);
+        assert_eq!(hash, hex::encode(Sha256::digest(&data)));
+
+        let mut reassembled = Vec::new();
+        let mut offset = 0u64;
+        while offset < size {
+            let chunk = read_chunk(&path_str, offset, 65_536).await.unwrap();
+            offset += chunk.len() as u64;
+            reassembled.extend(chunk);
+        }
+        assert_eq!(reassembled, data);
+
+        let _ = tokio::fs::remove_file(&path).await;
+    }
+}
@@ -0,0 +1,157 @@
+//! Change-log compaction.
+//!
+//! Every field update is logged as its own `change_log` row, so a record
+//! edited twenty times offline would be pushed (and merged by the server)
+//! twenty times. Compaction collapses each run of unprocessed updates to the
+//! same (entity, field) into its latest row, which takes over the `old_value`
+//! of the first row of the run. The latest timestamp survives, so
+//! `get_last_field_change_timestamp` answers exactly as before.
+//!
+//! A `create`, `delete` or `hard_delete` of the entity ends every run: updates
+//! are never merged across one, so the server sees the same sequence of
+//! lifecycle operations. Rows referenced by a sync conflict are left alone.
+//!
+//! Pruning removes processed rows older than a retention window, keeping the
+//! newest row per (entity, field) for the merge timestamp checks.
+
+use chrono::{Duration, Utc};
+use serde::Serialize;
+use std::collections::HashMap;
+
+use crate::domains::sync::repository::ChangeLogRepository;
+use crate::errors::DomainResult;
+
+/// Processed entries are kept this long by the automatic pass before `push_changes`
+pub const DEFAULT_CHANGE_LOG_RETENTION_DAYS: i64 = 30;
+
+/// Outcome of a compaction pass
+#[derive(Debug, Clone, Copy, Default, Serialize)]
+pub struct ChangeLogCompactionStats {
+    /// Unprocessed entries folded into a later entry for the same field
+    pub entries_coalesced: u64,
+    /// Processed entries removed by the retention window
+    pub entries_pruned: u64,
+}
+
+/// Coalesce unprocessed entries, then prune processed entries older than
+/// `retention_days`
+pub async fn compact_change_log(
+    repo: &dyn ChangeLogRepository,
+    retention_days: i64,
+) -> DomainResult<ChangeLogCompactionStats> {
+    let entries_coalesced = repo.compact_unprocessed_changes().await?;
+    let entries_pruned = repo
+        .prune_processed_changes(Utc::now() - Duration::days(retention_days))
+        .await?;
+    if entries_coalesced > 0 || entries_pruned > 0 {
+        log::debug!(
+            "Change log compacted: {} entries coalesced, {} pruned",
+            entries_coalesced, entries_pruned
+        );
+    }
+    Ok(ChangeLogCompactionStats { entries_coalesced, entries_pruned })
+}
+
+/// The columns compaction needs from an unprocessed change-log row
+#[derive(Debug, Clone, sqlx::FromRow)]
+pub struct CompactionRow {
+    pub seq: i64,
+    pub entity_table: String,
+    pub entity_id: String,
+    pub operation_type: String,
+    pub field_name: Option<String>,
+    pub old_value: Option<String>,
+    /// Referenced by a sync conflict: kept as is and treated like a lifecycle operation
+    pub pinned: bool,
+}
+
+/// What to change to compact a set of rows
+#[derive(Debug, Default, PartialEq)]
+pub struct CompactionPlan {
+    /// Rows that are superseded by a later row of their run
+    pub redundant: Vec<i64>,
+    /// Surviving rows whose `old_value` becomes that of the first row of their run
+    pub old_values: Vec<(i64, Option<String>)>,
+}
+
+/// A run of updates to one field: (old value of the first row, rows so far)
+type Run = (Option<String>, Vec<i64>);
+
+/// Plan the compaction of `rows`, which must be ordered by entity
+/// (table, id) and then by `timestamp`, `seq`.
+pub fn plan_compaction(rows: &[CompactionRow]) -> CompactionPlan {
+    let mut plan = CompactionPlan::default();
+    let mut runs: HashMap<&str, Run> = HashMap::new();
+    let mut entity: Option<(&str, &str)> = None;
+
+    for row in rows {
+        let key = (row.entity_table.as_str(), row.entity_id.as_str());
+        if entity != Some(key) {
+            flush_runs(&mut runs, &mut plan);
+            entity = Some(key);
+        }
+
+        match (row.operation_type.as_str(), row.field_name.as_deref()) {
+            ("update", Some(field)) if !row.pinned => {
+                runs.entry(field)
+                    .or_insert_with(|| (row.old_value.clone(), Vec::new()))
+                    .1
+                    .push(row.seq);
+            }
+            _ => flush_runs(&mut runs, &mut plan),
+        }
+    }
+    flush_runs(&mut runs, &mut plan);
+
+    plan.redundant.sort_unstable();
+    plan.old_values.sort_unstable_by_key(|(seq, _)| *seq);
+    plan
+}
+
+fn flush_runs(runs: &mut HashMap<&str, Run>, plan: &mut CompactionPlan) {
+    for (_, (first_old_value, mut seqs)) in runs.drain() {
+        if seqs.len() < 2 {
+            continue;
+        }
+        let survivor = seqs.pop().unwrap();
+        plan.redundant.extend(seqs);
+        plan.old_values.push((survivor, first_old_value));
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn row(seq: i64, entity_id: &str, op: &str, field: Option<&str>, old: &str) -> CompactionRow {
+        CompactionRow {
+            seq,
+            entity_table: "participants".into(),
+            entity_id: entity_id.into(),
+            operation_type: op.into(),
+            field_name: field.map(Into::into),
+            old_value: Some(old.into()),
+            pinned: false,
+        }
+    }
+
+    #[test]
+    fn collapses_runs_but_not_across_lifecycle_operations() {
+        let rows = vec![
+            row(1, "a", "update", Some("name"), "n0"),
+            row(2, "a", "update", Some("location"), "l0"),
+            row(3, "a", "update", Some("name"), "n1"),
+            row(4, "a", "update", Some("name"), "n2"),
+            row(5, "a", "delete", None, ""),
+            row(6, "a", "update", Some("name"), "n3"),
+            row(7, "b", "update", Some("name"), "m0"),
+            row(8, "b", "update", Some("name"), "m1"),
+        ];
+        let plan = plan_compaction(&rows);
+        assert_eq!(plan.redundant, vec![1, 3, 7]);
+        assert_eq!(
+            plan.old_values,
+            vec![(4, Some("n0".to_string())), (8, Some("m0".to_string()))]
+        );
+    }
+}
@@ -32,6 +32,8 @@ impl DonorEntityMerger {
 impl DomainEntityMerger for DonorEntityMerger {
     fn entity_table(&self) -> &'static str { "donors" }
 
+    fn merges_by_updated_at(&self) -> bool { true }
+
     async fn apply_create(&self, change: &ChangeLogEntry, auth: &AuthContext) -> DomainResult<()> {
         if BaseDomainMerger::is_local_change(change, auth) {
             log::debug!("Skipping local donor create change: {}", change.operation_id);
@@ -33,6 +33,8 @@ impl FundingEntityMerger {
 impl DomainEntityMerger for FundingEntityMerger {
     fn entity_table(&self) -> &'static str { "project_funding" }
 
+    fn merges_by_updated_at(&self) -> bool { true }
+
     async fn apply_create(&self, change: &ChangeLogEntry, auth: &AuthContext) -> DomainResult<()> {
         if BaseDomainMerger::is_local_change(change, auth) {
             log::debug!("Skipping local funding create change: {}", change.operation_id);
@@ -32,6 +32,8 @@ impl LivelihoodEntityMerger {
 impl DomainEntityMerger for LivelihoodEntityMerger {
     fn entity_table(&self) -> &'static str { "livelihoods" }
 
+    fn merges_by_updated_at(&self) -> bool { true }
+
     async fn apply_create(&self, change: &ChangeLogEntry, auth: &AuthContext) -> DomainResult<()> {
         if BaseDomainMerger::is_local_change(change, auth) { return Ok(()); }
         let mut tx = self.pool.begin().await.map_err(|e| DomainError::Database(e.into()))?;
@@ -94,6 +96,8 @@ impl SubsequentGrantEntityMerger {
 impl DomainEntityMerger for SubsequentGrantEntityMerger {
     fn entity_table(&self) -> &'static str { "subsequent_grants" }
 
+    fn merges_by_updated_at(&self) -> bool { true }
+
     async fn apply_create(&self, change: &ChangeLogEntry, auth: &AuthContext) -> DomainResult<()> {
         if BaseDomainMerger::is_local_change(change, auth) { return Ok(()); }
         let mut tx = self.pool.begin().await.map_err(|e| DomainError::Database(e.into()))?;
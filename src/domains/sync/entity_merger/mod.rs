@@ -6,14 +6,23 @@ use crate::auth::AuthContext;
 use crate::errors::{DomainResult, DomainError, DbError, ValidationError};
 use crate::domains::sync::types::{ChangeLogEntry, Tombstone, ChangeOperationType};
 use std::sync::Arc;
-use std::collections::HashMap;
+use std::collections::{HashMap, HashSet};
 use sqlx::{SqlitePool, Transaction, Sqlite};
+use chrono::{DateTime, Utc};
 
 /// Trait for domain-specific entity mergers
 #[async_trait]
 pub trait DomainEntityMerger: Send + Sync {
     /// Get the entity table name this merger handles
     fn entity_table(&self) -> &'static str;
+
+    /// Whether creates and updates are merged as whole records, last write
+    /// wins on `updated_at`: the remote state replaces an active local row
+    /// only when it is newer. `apply_changes_batch` then settles superseded
+    /// and stale changes for this table in bulk instead of merging each one.
+    fn merges_by_updated_at(&self) -> bool {
+        false
+    }
     
     /// Apply a create operation
     async fn apply_create(&self, change: &ChangeLogEntry, auth: &AuthContext) -> DomainResult<()>;
@@ -119,17 +128,30 @@ impl EntityMerger {
         merger.apply_hard_delete(tombstone, auth).await
     }
     
-    /// Apply multiple changes in a transaction
+    /// Apply multiple changes in a transaction.
+    ///
+    /// For tables whose merger `merges_by_updated_at`, only the newest remote
+    /// state per entity is merged, and states no newer than the active local
+    /// row (looked up with one query per table) are skipped: merging them one
+    /// by one would be a no-op. Their operation ids still count as applied.
     pub async fn apply_changes_batch(
         &self,
         changes: &[ChangeLogEntry],
         auth: &AuthContext,
     ) -> DomainResult<Vec<Uuid>> { // Return IDs of successfully applied changes
         let mut tx = self.pool.begin().await.map_err(DbError::from)?;
-        let mut applied_operation_ids = Vec::new();
+        let plan = self.plan_changes_batch(changes, auth, &mut tx).await?;
+        if !plan.settled.is_empty() {
+            log::debug!(
+                "Merging {} of {} remote changes; {} superseded or not newer than local rows",
+                plan.to_merge.len(), changes.len(), plan.settled.len()
+            );
+        }
+
+        let mut applied_operation_ids = plan.settled;
         let mut first_error: Option<DomainError> = None;
         
-        for change in changes {
+        for change in plan.to_merge {
             if first_error.is_some() {
                 // If an error occurred, skip subsequent changes in this batch for this transaction.
                 // The caller might decide to retry them individually or handle the error.
@@ -168,6 +190,126 @@ impl EntityMerger {
         tx.commit().await.map_err(DbError::from)?;
         Ok(applied_operation_ids)
     }
+
+    /// Split a batch into the changes that need their merger and those that
+    /// are settled already (see `apply_changes_batch`). Server order is kept.
+    async fn plan_changes_batch<'a, 't>(
+        &self,
+        changes: &'a [ChangeLogEntry],
+        auth: &AuthContext,
+        tx: &mut Transaction<'t, Sqlite>,
+    ) -> DomainResult<BatchPlan<'a>> {
+        let stamps: Vec<Option<DateTime<Utc>>> = changes
+            .iter()
+            .map(|change| {
+                let lww = self.mergers.get(&change.entity_table).map_or(false, |m| m.merges_by_updated_at());
+                let upsert = matches!(change.operation_type, ChangeOperationType::Create | ChangeOperationType::Update);
+                if lww && upsert && !BaseDomainMerger::is_local_change(change, auth) {
+                    remote_updated_at(change)
+                } else {
+                    None
+                }
+            })
+            .collect();
+        let mut keep = select_newest_states(changes, &stamps);
+
+        // Drop surviving states that are not newer than the active local row
+        let mut by_table: HashMap<&str, Vec<usize>> = HashMap::new();
+        for (i, change) in changes.iter().enumerate() {
+            if keep[i] && stamps[i].is_some() {
+                by_table.entry(change.entity_table.as_str()).or_default().push(i);
+            }
+        }
+        for (table, indices) in by_table {
+            let table = self.mergers[table].entity_table();
+            let ids: Vec<String> = indices.iter().map(|&i| changes[i].entity_id.to_string()).collect();
+            let ids_json = serde_json::to_string(&ids)
+                .map_err(|e| DomainError::Internal(format!("Failed to encode id list: {}", e)))?;
+            let rows: Vec<(String, String)> = sqlx::query_as(&format!(
+                "SELECT id, updated_at FROM {} WHERE deleted_at IS NULL AND id IN (SELECT value FROM json_each(?))",
+                table
+            ))
+            .bind(ids_json)
+            .fetch_all(&mut **tx)
+            .await
+            .map_err(DbError::from)?;
+
+            let local: HashMap<String, DateTime<Utc>> = rows
+                .into_iter()
+                .filter_map(|(id, updated_at)| {
+                    let ts = DateTime::parse_from_rfc3339(&updated_at).ok()?.with_timezone(&Utc);
+                    Some((id, ts))
+                })
+                .collect();
+            for (&i, id) in indices.iter().zip(&ids) {
+                if let (Some(remote), Some(local)) = (stamps[i], local.get(id)) {
+                    if remote <= *local {
+                        keep[i] = false;
+                    }
+                }
+            }
+        }
+
+        let mut plan = BatchPlan { to_merge: Vec::new(), settled: Vec::new() };
+        for (change, keep) in changes.iter().zip(keep) {
+            if keep {
+                plan.to_merge.push(change);
+            } else {
+                plan.settled.push(change.operation_id);
+            }
+        }
+        Ok(plan)
+    }
+
+    /// Apply a page of tombstones, returning `(applied, failed)`.
+    ///
+    /// Tombstones for rows this device does not have are settled with one
+    /// existence query per table; only the others go through `apply_tombstone`.
+    pub async fn apply_tombstones_batch(
+        &self,
+        tombstones: &[Tombstone],
+        auth: &AuthContext,
+    ) -> DomainResult<(usize, usize)> {
+        let mut present: HashSet<Uuid> = HashSet::new();
+        let mut by_table: HashMap<&'static str, Vec<String>> = HashMap::new();
+        for tomb in tombstones {
+            match self.mergers.get(&tomb.entity_type) {
+                Some(merger) => by_table.entry(merger.entity_table()).or_default().push(tomb.entity_id.to_string()),
+                // Unknown type: let apply_tombstone report it
+                None => { present.insert(tomb.entity_id); }
+            }
+        }
+        for (table, ids) in by_table {
+            let ids_json = serde_json::to_string(&ids)
+                .map_err(|e| DomainError::Internal(format!("Failed to encode id list: {}", e)))?;
+            let existing: Vec<String> = sqlx::query_scalar(&format!(
+                "SELECT id FROM {} WHERE id IN (SELECT value FROM json_each(?))",
+                table
+            ))
+            .bind(ids_json)
+            .fetch_all(&self.pool)
+            .await
+            .map_err(DbError::from)?;
+            present.extend(existing.iter().filter_map(|id| Uuid::parse_str(id).ok()));
+        }
+
+        let (mut applied, mut failed) = (0, 0);
+        for tomb in tombstones {
+            if !present.contains(&tomb.entity_id) {
+                applied += 1;
+                continue;
+            }
+            match self.apply_tombstone(tomb, auth).await {
+                Ok(()) => applied += 1,
+                Err(e) => {
+                    // Log but continue (TODO: create conflict record?)
+                    log::error!("Failed to apply tombstone {:?}: {:?}", tomb, e);
+                    failed += 1;
+                }
+            }
+        }
+        Ok((applied, failed))
+    }
     
     /// Internal helper for applying a single change within an existing transaction.
     /// This is called by `apply_changes_batch`.
@@ -189,6 +331,51 @@ impl EntityMerger {
     }
 }
 
+/// A batch split by `plan_changes_batch`
+struct BatchPlan<'a> {
+    /// Changes to hand to their merger, in server order
+    to_merge: Vec<&'a ChangeLogEntry>,
+    /// Operation ids of changes that would have been no-ops
+    settled: Vec<Uuid>,
+}
+
+/// `updated_at` of the remote state carried by a create/update
+fn remote_updated_at(change: &ChangeLogEntry) -> Option<DateTime<Utc>> {
+    #[derive(serde::Deserialize)]
+    struct Stamp {
+        updated_at: DateTime<Utc>,
+    }
+    let json = change.new_value.as_deref()?;
+    serde_json::from_str::<Stamp>(json).ok().map(|s| s.updated_at)
+}
+
+/// Which changes survive when, per entity, only the newest of a run of
+/// stamped states matters. `stamps[i]` is set for changes taking part; any
+/// other change to the entity ends its run, so runs never span a delete.
+/// Among equal stamps the first one wins, as it would when merged in order.
+fn select_newest_states(changes: &[ChangeLogEntry], stamps: &[Option<DateTime<Utc>>]) -> Vec<bool> {
+    let mut keep = vec![true; changes.len()];
+    let mut newest: HashMap<(&str, Uuid), usize> = HashMap::new();
+    for (i, change) in changes.iter().enumerate() {
+        let key = (change.entity_table.as_str(), change.entity_id);
+        let Some(stamp) = stamps[i] else {
+            newest.remove(&key);
+            continue;
+        };
+        match newest.get(&key) {
+            Some(&best) if stamps[best].map_or(false, |b| stamp <= b) => keep[i] = false,
+            Some(&best) => {
+                keep[best] = false;
+                newest.insert(key, i);
+            }
+            None => {
+                newest.insert(key, i);
+            }
+        }
+    }
+    keep
+}
+
 /// Base implementation helper for domain mergers
 pub struct BaseDomainMerger;
 
@@ -261,25 +448,44 @@ pub mod strategic_goal;
 
 #[cfg(test)]
 mod tests {
-    // use super::*;
-    // use crate::domains::sync::types::ChangeOperationType;
-    
-    #[tokio::test]
-    async fn test_entity_merger_registration() {
-        // Test that mergers can be registered and retrieved
-        // Example:
-        // let pool = /* setup SqlitePool for testing */;
-        // let mut merger = EntityMerger::new(pool);
-        // struct MockMerger;
-        // #[async_trait]
-        // impl DomainEntityMerger for MockMerger {
-        //     fn entity_table(&self) -> &'static str { "mock_table" }
-        //     async fn apply_create(&self, _change: &ChangeLogEntry, _auth: &AuthContext) -> DomainResult<()> { Ok(()) }
-        //     async fn apply_update(&self, _change: &ChangeLogEntry, _auth: &AuthContext) -> DomainResult<()> { Ok(()) }
-        //     async fn apply_soft_delete(&self, _change: &ChangeLogEntry, _auth: &AuthContext) -> DomainResult<()> { Ok(()) }
-        //     async fn apply_hard_delete(&self, _tombstone: &Tombstone, _auth: &AuthContext) -> DomainResult<()> { Ok(()) }
-        // }
-        // merger.register_merger(Arc::new(MockMerger));
-        // assert!(merger.mergers.contains_key("mock_table"));
+    use super::*;
+    use chrono::TimeZone;
+
+    fn change(entity: Uuid, op: ChangeOperationType) -> ChangeLogEntry {
+        ChangeLogEntry {
+            operation_id: Uuid::new_v4(),
+            entity_table: "participants".into(),
+            entity_id: entity,
+            operation_type: op,
+            field_name: None,
+            old_value: None,
+            new_value: None,
+            document_metadata: None,
+            timestamp: Utc::now(),
+            user_id: Uuid::nil(),
+            device_id: None,
+            sync_batch_id: None,
+            processed_at: None,
+            sync_error: None,
+        }
     }
-} 
\ No newline at end of file
+
+    #[test]
+    fn newest_state_per_entity_survives_until_a_delete() {
+        let (a, b) = (Uuid::new_v4(), Uuid::new_v4());
+        let at = |s: i64| Some(Utc.timestamp_opt(s, 0).unwrap());
+        let changes = vec![
+            change(a, ChangeOperationType::Create),
+            change(a, ChangeOperationType::Update),
+            change(b, ChangeOperationType::Update),
+            change(a, ChangeOperationType::Update),
+            change(a, ChangeOperationType::Delete),
+            change(a, ChangeOperationType::Update),
+        ];
+        let stamps = vec![at(1), at(3), at(5), at(2), None, at(1)];
+        assert_eq!(
+            select_newest_states(&changes, &stamps),
+            vec![false, true, true, false, true, true]
+        );
+    }
+}
@@ -29,6 +29,8 @@ impl ParticipantEntityMerger {
 impl DomainEntityMerger for ParticipantEntityMerger {
     fn entity_table(&self) -> &'static str { "participants" }
 
+    fn merges_by_updated_at(&self) -> bool { true }
+
     async fn apply_create(&self, change: &ChangeLogEntry, auth: &AuthContext) -> DomainResult<()> {
         if BaseDomainMerger::is_local_change(change, auth) {
             return Ok(());
@@ -32,6 +32,8 @@ impl ProjectEntityMerger {
 impl DomainEntityMerger for ProjectEntityMerger {
     fn entity_table(&self) -> &'static str { "projects" }
 
+    fn merges_by_updated_at(&self) -> bool { true }
+
     async fn apply_create(&self, change: &ChangeLogEntry, auth: &AuthContext) -> DomainResult<()> {
         if BaseDomainMerger::is_local_change(change, auth) { return Ok(()); }
         let mut tx = self.pool.begin().await.map_err(|e| DomainError::Database(e.into()))?;
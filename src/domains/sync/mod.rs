@@ -7,6 +7,7 @@ pub mod service;
 pub mod complete_change_log_tombstone_repo;
 pub mod utils;
 pub mod cloud_storage;
+pub mod compaction;
 
 // Re-exports
 
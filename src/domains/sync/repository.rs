@@ -10,6 +10,7 @@ use crate::domains::sync::types::{
     SyncPriority, SyncBatchStatus, SyncDirection, SyncBatch, SyncConfig, SyncStatus,
     DeviceSyncState, ChangeLogEntry, ChangeOperationType, Tombstone, SyncConflict,
 };
+use crate::domains::sync::compaction::{plan_compaction, CompactionRow};
 pub use crate::domains::user::repository::MergeableEntityRepository; // Assuming this is still needed
 
 /// Repository for sync-related operations and tracking
@@ -87,6 +88,14 @@ pub trait ChangeLogRepository: Send + Sync {
         tx: &mut Transaction<'t, Sqlite>
     ) -> DomainResult<()>;
 
+    /// Create many change log entries within a transaction, using multi-row
+    /// INSERTs of `CHANGE_LOG_INSERT_CHUNK` entries
+    async fn create_change_logs_with_tx<'t>(
+        &self,
+        entries: &[ChangeLogEntry],
+        tx: &mut Transaction<'t, Sqlite>
+    ) -> DomainResult<()>;
+
     /// Find unprocessed changes by priority
     async fn find_unprocessed_changes_by_priority(
         &self,
@@ -103,6 +112,35 @@ pub trait ChangeLogRepository: Send + Sync {
         tx: &mut Transaction<'t, Sqlite>
     ) -> DomainResult<()>;
 
+    /// Page through unprocessed changes with `min_priority <= priority < max_priority`
+    /// in insertion order. Each entry comes with its row sequence number; pass
+    /// the last one back as `after_seq` to continue where the page ended.
+    async fn find_unprocessed_changes_page(
+        &self,
+        min_priority: i64,
+        max_priority: i64,
+        after_seq: i64,
+        limit: u32
+    ) -> DomainResult<Vec<(i64, ChangeLogEntry)>>;
+
+    /// Mark many change log entries as processed with one statement.
+    /// Returns the number of rows updated.
+    async fn mark_many_as_processed<'t>(
+        &self,
+        operation_ids: &[Uuid],
+        batch_id: &str,
+        timestamp: DateTime<Utc>,
+        tx: &mut Transaction<'t, Sqlite>
+    ) -> DomainResult<u64>;
+
+    /// Collapse runs of unprocessed updates to the same (entity, field) into
+    /// their latest entry (see `compaction`). Returns the number of entries removed.
+    async fn compact_unprocessed_changes(&self) -> DomainResult<u64>;
+
+    /// Delete processed entries processed before `processed_before`, keeping
+    /// the newest entry per (entity, field). Returns the number of entries removed.
+    async fn prune_processed_changes(&self, processed_before: DateTime<Utc>) -> DomainResult<u64>;
+
     /// Get changes for a specific entity
     async fn get_changes_for_entity(
         &self,
@@ -133,6 +171,14 @@ pub trait TombstoneRepository: Send + Sync {
         tx: &mut Transaction<'t, Sqlite>
     ) -> DomainResult<()>;
 
+    /// Create many tombstones within a transaction, using multi-row INSERTs
+    /// of `TOMBSTONE_INSERT_CHUNK` tombstones
+    async fn create_tombstones_with_tx<'t>(
+        &self,
+        tombstones: &[Tombstone],
+        tx: &mut Transaction<'t, Sqlite>
+    ) -> DomainResult<()>;
+
     /// Find unpushed tombstones for sync
     async fn find_unpushed_tombstones(&self, limit: u32) -> DomainResult<Vec<Tombstone>>;
 
@@ -145,6 +191,20 @@ pub trait TombstoneRepository: Send + Sync {
         tx: &mut Transaction<'t, Sqlite>
     ) -> DomainResult<()>;
 
+    /// Page through unpushed tombstones in insertion order, continuing after
+    /// the row sequence number `after_seq`
+    async fn find_unpushed_tombstones_page(&self, after_seq: i64, limit: u32) -> DomainResult<Vec<(i64, Tombstone)>>;
+
+    /// Mark many tombstones as pushed with one statement.
+    /// Returns the number of rows updated.
+    async fn mark_many_as_pushed<'t>(
+        &self,
+        tombstone_ids: &[Uuid],
+        batch_id: &str,
+        timestamp: DateTime<Utc>,
+        tx: &mut Transaction<'t, Sqlite>
+    ) -> DomainResult<u64>;
+
     /// Check if entity was already tombstoned
     async fn check_entity_tombstoned(
         &self,
@@ -159,6 +219,36 @@ pub trait TombstoneRepository: Send + Sync {
         since: DateTime<Utc>,
         table_filter: Option<&str>
     ) -> DomainResult<Vec<Tombstone>>;
+
+    /// Tombstones of one entity type positioned after `after` in
+    /// (deleted_at, id) order, oldest first, for incremental exports
+    async fn find_tombstones_after(
+        &self,
+        entity_type: &str,
+        after: Option<(DateTime<Utc>, Uuid)>,
+        limit: u32,
+    ) -> DomainResult<Vec<Tombstone>>;
+}
+
+/// Change log row together with its rowid, for keyset pagination
+#[derive(sqlx::FromRow)]
+struct SequencedChangeLogRow {
+    seq: i64,
+    #[sqlx(flatten)]
+    row: crate::domains::sync::types::ChangeLogEntryRow,
+}
+
+/// Tombstone row together with its rowid, for keyset pagination
+#[derive(sqlx::FromRow)]
+struct SequencedTombstoneRow {
+    seq: i64,
+    #[sqlx(flatten)]
+    row: crate::domains::sync::types::TombstoneRow,
+}
+
+/// JSON array of ids, bound as the argument of `json_each` in set-based updates
+fn uuid_json_array(ids: &[Uuid]) -> String {
+    serde_json::Value::from(ids.iter().map(|id| id.to_string()).collect::<Vec<_>>()).to_string()
 }
 
 /// SQLite implementation of the SyncRepository
@@ -987,6 +1077,22 @@ impl SyncRepository for SqliteSyncRepository {
     }
 }
 
+/// Change log rows per multi-row INSERT (15 bound values each)
+pub const CHANGE_LOG_INSERT_CHUNK: usize = 500;
+
+/// Tombstones per multi-row INSERT (8 bound values each)
+pub const TOMBSTONE_INSERT_CHUNK: usize = 500;
+
+/// Sync priority stored with a change log row, by operation
+fn change_log_priority(operation_type: ChangeOperationType) -> i64 {
+    match operation_type {
+        ChangeOperationType::Create => 7,
+        ChangeOperationType::Update => 5,
+        ChangeOperationType::Delete => 8,
+        ChangeOperationType::HardDelete => 9,
+    }
+}
+
 /// SQLite implementation of ChangeLogRepository
 pub struct SqliteChangeLogRepository {
     pool: SqlitePool,
@@ -1025,12 +1131,7 @@ impl ChangeLogRepository for SqliteChangeLogRepository {
         
         let device_id_str = entry.device_id.map(|id| id.to_string());
         let processed_at_str = entry.processed_at.map(|dt| dt.to_rfc3339());
-        let priority_value = match entry.operation_type { 
-            ChangeOperationType::Create => 7,
-            ChangeOperationType::Update => 5,
-            ChangeOperationType::Delete => 8,
-            ChangeOperationType::HardDelete => 9,
-        };
+        let priority_value = change_log_priority(entry.operation_type);
 
         sqlx::query!(
             r#"
@@ -1063,6 +1164,46 @@ impl ChangeLogRepository for SqliteChangeLogRepository {
         Ok(())
     }
 
+    async fn create_change_logs_with_tx<'t>(
+        &self,
+        entries: &[ChangeLogEntry],
+        tx: &mut Transaction<'t, Sqlite>
+    ) -> DomainResult<()> {
+        for chunk in entries.chunks(CHANGE_LOG_INSERT_CHUNK) {
+            let mut builder = QueryBuilder::<Sqlite>::new(
+                "INSERT INTO change_log (
+                    operation_id, entity_table, entity_id, operation_type, field_name,
+                    old_value, new_value, document_metadata, timestamp, user_id, device_id,
+                    sync_batch_id, processed_at, sync_error, priority
+                ) "
+            );
+            builder.push_values(chunk, |mut row, entry| {
+                row.push_bind(entry.operation_id.to_string())
+                    .push_bind(entry.entity_table.clone())
+                    .push_bind(entry.entity_id.to_string())
+                    .push_bind(entry.operation_type.as_str())
+                    .push_bind(entry.field_name.clone())
+                    .push_bind(entry.old_value.clone())
+                    .push_bind(entry.new_value.clone())
+                    .push_bind(entry.document_metadata.clone())
+                    .push_bind(entry.timestamp.to_rfc3339())
+                    // Nil UUID is the system context: stored as NULL
+                    .push_bind((!entry.user_id.is_nil()).then(|| entry.user_id.to_string()))
+                    .push_bind(entry.device_id.map(|id| id.to_string()))
+                    .push_bind(entry.sync_batch_id.clone())
+                    .push_bind(entry.processed_at.map(|dt| dt.to_rfc3339()))
+                    .push_bind(entry.sync_error.clone())
+                    .push_bind(change_log_priority(entry.operation_type));
+            });
+            builder
+                .build()
+                .execute(&mut **tx)
+                .await
+                .map_err(|e| DomainError::Database(DbError::from(e)))?;
+        }
+        Ok(())
+    }
+
     async fn find_unprocessed_changes_by_priority(
         &self,
         priority: SyncPriority,
@@ -1121,6 +1262,129 @@ impl ChangeLogRepository for SqliteChangeLogRepository {
         Ok(())
     }
 
+    async fn find_unprocessed_changes_page(
+        &self,
+        min_priority: i64,
+        max_priority: i64,
+        after_seq: i64,
+        limit: u32
+    ) -> DomainResult<Vec<(i64, ChangeLogEntry)>> {
+        let rows = sqlx::query_as::<_, SequencedChangeLogRow>(
+            r#"
+            SELECT 
+                rowid AS seq,
+                operation_id, entity_table, entity_id, operation_type, field_name,
+                old_value, new_value, document_metadata, timestamp, user_id, device_id, 
+                sync_batch_id, processed_at, sync_error, priority
+            FROM change_log
+            WHERE processed_at IS NULL AND sync_batch_id IS NULL
+            AND priority >= ? AND priority < ?
+            AND rowid > ?
+            ORDER BY rowid
+            LIMIT ?
+            "#
+        )
+        .bind(min_priority)
+        .bind(max_priority)
+        .bind(after_seq)
+        .bind(limit as i64)
+        .fetch_all(&self.pool)
+        .await
+        .map_err(|e| DomainError::Database(DbError::from(e)))?;
+
+        rows.into_iter()
+            .map(|r| ChangeLogEntry::try_from(r.row).map(|entry| (r.seq, entry)))
+            .collect()
+    }
+
+    async fn mark_many_as_processed<'t>(
+        &self,
+        operation_ids: &[Uuid],
+        batch_id: &str,
+        timestamp: DateTime<Utc>,
+        tx: &mut Transaction<'t, Sqlite>
+    ) -> DomainResult<u64> {
+        if operation_ids.is_empty() {
+            return Ok(0);
+        }
+        let result = sqlx::query(
+            "UPDATE change_log SET sync_batch_id = ?, processed_at = ?
+             WHERE operation_id IN (SELECT value FROM json_each(?))"
+        )
+        .bind(batch_id)
+        .bind(timestamp.to_rfc3339())
+        .bind(uuid_json_array(operation_ids))
+        .execute(&mut **tx)
+        .await
+        .map_err(|e| DomainError::Database(DbError::from(e)))?;
+        Ok(result.rows_affected())
+    }
+
+    async fn compact_unprocessed_changes(&self) -> DomainResult<u64> {
+        let mut tx = self.pool.begin().await.map_err(|e| DomainError::Database(DbError::from(e)))?;
+
+        let rows = sqlx::query_as::<_, CompactionRow>(
+            r#"
+            SELECT
+                c.rowid AS seq, c.entity_table, c.entity_id, c.operation_type, c.field_name, c.old_value,
+                EXISTS(SELECT 1 FROM sync_conflicts sc WHERE sc.local_change_op_id = c.operation_id) AS pinned
+            FROM change_log c
+            WHERE c.processed_at IS NULL AND c.sync_batch_id IS NULL
+            ORDER BY c.entity_table, c.entity_id, c.timestamp, c.rowid
+            "#
+        )
+        .fetch_all(&mut *tx)
+        .await
+        .map_err(|e| DomainError::Database(DbError::from(e)))?;
+
+        let plan = plan_compaction(&rows);
+        if plan.redundant.is_empty() {
+            return Ok(0);
+        }
+
+        for (seq, old_value) in &plan.old_values {
+            sqlx::query("UPDATE change_log SET old_value = ? WHERE rowid = ?")
+                .bind(old_value)
+                .bind(seq)
+                .execute(&mut *tx)
+                .await
+                .map_err(|e| DomainError::Database(DbError::from(e)))?;
+        }
+
+        let removed = sqlx::query("DELETE FROM change_log WHERE rowid IN (SELECT value FROM json_each(?))")
+            .bind(serde_json::Value::from(plan.redundant.clone()).to_string())
+            .execute(&mut *tx)
+            .await
+            .map_err(|e| DomainError::Database(DbError::from(e)))?
+            .rows_affected();
+
+        tx.commit().await.map_err(|e| DomainError::Database(DbError::from(e)))?;
+        Ok(removed)
+    }
+
+    async fn prune_processed_changes(&self, processed_before: DateTime<Utc>) -> DomainResult<u64> {
+        let result = sqlx::query(
+            r#"
+            DELETE FROM change_log WHERE rowid IN (
+                SELECT c.rowid FROM change_log c
+                WHERE c.processed_at IS NOT NULL AND c.processed_at < ?
+                AND EXISTS (
+                    SELECT 1 FROM change_log n
+                    WHERE n.entity_table = c.entity_table AND n.entity_id = c.entity_id
+                    AND n.field_name IS c.field_name
+                    AND (n.timestamp > c.timestamp OR (n.timestamp = c.timestamp AND n.rowid > c.rowid))
+                )
+                AND NOT EXISTS (SELECT 1 FROM sync_conflicts sc WHERE sc.local_change_op_id = c.operation_id)
+            )
+            "#
+        )
+        .bind(processed_before.to_rfc3339())
+        .execute(&self.pool)
+        .await
+        .map_err(|e| DomainError::Database(DbError::from(e)))?;
+        Ok(result.rows_affected())
+    }
+
     async fn get_changes_for_entity(
         &self,
         entity_table: &str,
@@ -1246,6 +1510,31 @@ impl TombstoneRepository for SqliteTombstoneRepository {
         Ok(())
     }
 
+    async fn create_tombstones_with_tx<'t>(&self, tombstones: &[Tombstone], tx: &mut Transaction<'t, Sqlite>) -> DomainResult<()> {
+        for chunk in tombstones.chunks(TOMBSTONE_INSERT_CHUNK) {
+            let mut builder = QueryBuilder::<Sqlite>::new(
+                "INSERT INTO tombstones (id, entity_id, entity_type, deleted_by, deleted_by_device_id, deleted_at, operation_id, additional_metadata) "
+            );
+            builder.push_values(chunk, |mut row, tombstone| {
+                row.push_bind(tombstone.id.to_string())
+                    .push_bind(tombstone.entity_id.to_string())
+                    .push_bind(tombstone.entity_type.clone())
+                    // Nil UUID is the system context: stored as NULL
+                    .push_bind((!tombstone.deleted_by.is_nil()).then(|| tombstone.deleted_by.to_string()))
+                    .push_bind(tombstone.deleted_by_device_id.map(|id| id.to_string()))
+                    .push_bind(tombstone.deleted_at.to_rfc3339())
+                    .push_bind(tombstone.operation_id.to_string())
+                    .push_bind(tombstone.additional_metadata.clone());
+            });
+            builder
+                .build()
+                .execute(&mut **tx)
+                .await
+                .map_err(|e| DomainError::Database(DbError::from(e)))?;
+        }
+        Ok(())
+    }
+
     async fn find_unpushed_tombstones(&self, limit: u32) -> DomainResult<Vec<Tombstone>> {
         let limit_i64 = limit as i64;
         // Ensure the TombstoneRow in types.rs matches these fields, including pushed_at and sync_batch_id from the migration
@@ -1302,6 +1591,53 @@ impl TombstoneRepository for SqliteTombstoneRepository {
         Ok(())
     }
 
+    async fn find_unpushed_tombstones_page(&self, after_seq: i64, limit: u32) -> DomainResult<Vec<(i64, Tombstone)>> {
+        let rows = sqlx::query_as::<_, SequencedTombstoneRow>(
+            r#"
+            SELECT 
+                rowid AS seq,
+                id, entity_id, entity_type, deleted_by, deleted_by_device_id, 
+                deleted_at, operation_id, additional_metadata
+            FROM tombstones 
+            WHERE pushed_at IS NULL AND rowid > ?
+            ORDER BY rowid
+            LIMIT ?
+            "#
+        )
+        .bind(after_seq)
+        .bind(limit as i64)
+        .fetch_all(&self.pool)
+        .await
+        .map_err(|e| DomainError::Database(DbError::from(e)))?;
+
+        rows.into_iter()
+            .map(|r| Tombstone::try_from(r.row).map(|tomb| (r.seq, tomb)))
+            .collect()
+    }
+
+    async fn mark_many_as_pushed<'t>(
+        &self,
+        tombstone_ids: &[Uuid],
+        batch_id: &str,
+        timestamp: DateTime<Utc>,
+        tx: &mut Transaction<'t, Sqlite>
+    ) -> DomainResult<u64> {
+        if tombstone_ids.is_empty() {
+            return Ok(0);
+        }
+        let result = sqlx::query(
+            "UPDATE tombstones SET pushed_at = ?, sync_batch_id = ?
+             WHERE id IN (SELECT value FROM json_each(?))"
+        )
+        .bind(timestamp.to_rfc3339())
+        .bind(batch_id)
+        .bind(uuid_json_array(tombstone_ids))
+        .execute(&mut **tx)
+        .await
+        .map_err(|e| DomainError::Database(DbError::from(e)))?;
+        Ok(result.rows_affected())
+    }
+
     async fn check_entity_tombstoned(&self, entity_type: &str, entity_id: Uuid) -> DomainResult<bool> {
         let entity_id_str = entity_id.to_string();
         
@@ -1354,4 +1690,37 @@ impl TombstoneRepository for SqliteTombstoneRepository {
             .map(|row| Tombstone::try_from(row))
             .collect::<Result<Vec<Tombstone>, DomainError>>()
     }
+
+    async fn find_tombstones_after(
+        &self,
+        entity_type: &str,
+        after: Option<(DateTime<Utc>, Uuid)>,
+        limit: u32,
+    ) -> DomainResult<Vec<Tombstone>> {
+        let (after_deleted_at, after_id) = after
+            .map(|(deleted_at, id)| (deleted_at.to_rfc3339(), id.to_string()))
+            .unwrap_or_default();
+
+        let rows = sqlx::query_as::<_, crate::domains::sync::types::TombstoneRow>(
+            r#"
+            SELECT id, entity_id, entity_type, deleted_by, deleted_by_device_id,
+                   deleted_at, operation_id, additional_metadata
+            FROM tombstones
+            WHERE entity_type = ? AND (deleted_at, id) > (?, ?)
+            ORDER BY deleted_at, id
+            LIMIT ?
+            "#
+        )
+        .bind(entity_type)
+        .bind(after_deleted_at)
+        .bind(after_id)
+        .bind(limit as i64)
+        .fetch_all(&self.pool)
+        .await
+        .map_err(|e| DomainError::Database(DbError::from(e)))?;
+
+        rows.into_iter()
+            .map(Tombstone::try_from)
+            .collect()
+    }
 }
\ No newline at end of file
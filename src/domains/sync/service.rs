@@ -8,14 +8,16 @@ use crate::auth::AuthContext;
 use crate::errors::{DomainError, DomainResult, ServiceError, ServiceResult};
 use crate::domains::sync::types::{
     SyncStats, SyncPriority, SyncBatch, SyncBatchStatus, SyncDirection, ChangeLogEntry,
-    Tombstone,
+    Tombstone, PushPayload,
 };
 use crate::domains::sync::repository::{
     SyncRepository, ChangeLogRepository, TombstoneRepository,
 };
 use crate::domains::sync::entity_merger::EntityMerger;
-use crate::domains::sync::cloud_storage::CloudStorageService;
+use crate::domains::sync::compaction::{compact_change_log, DEFAULT_CHANGE_LOG_RETENTION_DAYS};
+use crate::domains::sync::cloud_storage::{CloudStorageService, EncodedPush, encode_push};
 use crate::domains::core::file_storage_service::FileStorageService;
+use crate::domains::core::content_blobs;
 use crate::domains::compression::service::CompressionService;
 use crate::domains::document::repository::MediaDocumentRepository;
 use crate::domains::document::types::{CompressionStatus, BlobSyncStatus};
@@ -25,6 +27,52 @@ use crate::domains::document::types::{CompressionStatus, BlobSyncStatus};
 const DEFAULT_MAX_PARALLEL_UPLOADS: usize = 3;
 const DEFAULT_MAX_PARALLEL_DOWNLOADS: usize = 3;
 
+/// Changes and tombstones per push page
+const PUSH_PAGE_CHANGES: usize = 500;
+const PUSH_PAGE_TOMBSTONES: usize = 250;
+
+/// A range of change-log priorities and its share of each push page
+struct PushPriorityBand {
+    min_priority: i64,
+    max_priority: i64,
+    weight: usize,
+}
+
+/// Bands follow the thresholds of `find_unprocessed_changes_by_priority`;
+/// changes below `Low` are never pushed.
+const PUSH_PRIORITY_BANDS: [PushPriorityBand; 3] = [
+    PushPriorityBand { min_priority: 8, max_priority: i64::MAX, weight: 6 }, // High
+    PushPriorityBand { min_priority: 5, max_priority: 8, weight: 3 },        // Normal
+    PushPriorityBand { min_priority: 3, max_priority: 5, weight: 1 },        // Low
+];
+
+/// Where the push backlog scan has got to, per band (change-log rowids)
+#[derive(Default)]
+struct PushCursor {
+    band_seq: [i64; PUSH_PRIORITY_BANDS.len()],
+    tombstone_seq: i64,
+}
+
+/// One page of the push backlog, encoded and registered as a sync batch
+struct PushPage {
+    batch_id: String,
+    change_ids: Vec<Uuid>,
+    tombstone_ids: Vec<Uuid>,
+    encoded: EncodedPush,
+}
+
+/// Close the batch record of a page that was prepared but will not be sent
+async fn discard_push_page(sync_repo: &Arc<dyn SyncRepository>, page: ServiceResult<Option<PushPage>>) {
+    if let Ok(Some(page)) = page {
+        if let Err(e) = sync_repo
+            .finalize_sync_batch(&page.batch_id, SyncBatchStatus::Failed, Some("push aborted"), 0)
+            .await
+        {
+            log::warn!("Failed to record aborted push batch {}: {:?}", page.batch_id, e);
+        }
+    }
+}
+
 ///  A small helper to construct an "empty" SyncStats instance.
 fn empty_stats() -> SyncStats {
     SyncStats {
@@ -142,27 +190,121 @@ impl SyncServiceImpl {
         }
     }
 
-    /// Push local change-log entries and tombstones to the server.
+    /// Push every pending change-log entry and tombstone to the server.
+    ///
+    /// The backlog goes out in pages, each with its own batch record. While one
+    /// page is in flight the next is read and encoded, and a page's rows are
+    /// marked processed in one statement once the server accepted it.
     async fn push_changes(&self, user_id: Uuid, auth: &AuthContext) -> ServiceResult<SyncStats> {
         let mut stats = empty_stats();
         let device_id = Uuid::parse_str(&auth.device_id).unwrap_or_else(|_| Uuid::nil());
 
-        // 1. Collect changes & tombstones (basic strategy: gather high priority first, limit 1000)
-        let changes = self.change_log_repo
-            .find_unprocessed_changes_by_priority(SyncPriority::High, 1000)
-            .await
-            .map_err(ServiceError::Domain)?;
+        // Fewer, coalesced entries make smaller pages; a failed pass only costs payload size
+        if let Err(e) = compact_change_log(&*self.change_log_repo, DEFAULT_CHANGE_LOG_RETENTION_DAYS).await {
+            log::warn!("Change log compaction before push failed: {:?}", e);
+        }
+
+        let mut cursor = PushCursor::default();
+        let Some(mut page) = self.next_push_page(&mut cursor, device_id, user_id).await? else {
+            return Ok(stats); // Nothing to push
+        };
+
+        let api_token = self.obtain_api_token(user_id).await?;
+        let db_pool = crate::globals::get_db_pool()
+            .map_err(|ffi_err| ServiceError::Domain(DomainError::Internal(format!("Failed to get DB pool: {}", ffi_err))))?;
+
+        loop {
+            let (push_res, next_res) = tokio::join!(
+                self.cloud_storage.push_encoded(&api_token, &page.encoded),
+                self.next_push_page(&mut cursor, device_id, user_id),
+            );
+
+            let push_resp = match push_res {
+                Ok(resp) => resp,
+                Err(e) => {
+                    let message = e.to_string();
+                    if let Err(fe) = self.sync_repo
+                        .finalize_sync_batch(&page.batch_id, SyncBatchStatus::Failed, Some(&message), 0)
+                        .await
+                    {
+                        log::warn!("Failed to record failed push batch {}: {:?}", page.batch_id, fe);
+                    }
+                    // Pages pushed before this one stay marked; the rest is retried next sync
+                    discard_push_page(&self.sync_repo, next_res).await;
+                    return Err(e);
+                }
+            };
+
+            // Mark the page's rows as processed (set-based, one transaction)
+            let now = Utc::now();
+            let mut tx = db_pool.begin()
+                .await
+                .map_err(|e| ServiceError::Domain(DomainError::Database(e.into())))?;
+            self.change_log_repo
+                .mark_many_as_processed(&page.change_ids, &page.batch_id, now, &mut tx)
+                .await
+                .map_err(ServiceError::Domain)?;
+            self.tombstone_repo
+                .mark_many_as_pushed(&page.tombstone_ids, &page.batch_id, now, &mut tx)
+                .await
+                .map_err(ServiceError::Domain)?;
+            tx.commit().await.map_err(|e| ServiceError::Domain(DomainError::Database(e.into())))?;
+
+            stats.total_uploads += push_resp.changes_accepted;
+            stats.failed_uploads += push_resp.changes_rejected + push_resp.conflicts_detected;
+            stats.total_bytes_uploaded += page.encoded.wire_size() as i64;
+
+            self.sync_repo
+                .finalize_sync_batch(&page.batch_id, SyncBatchStatus::Completed, None, page.change_ids.len() as u32)
+                .await
+                .map_err(ServiceError::Domain)?;
+
+            match next_res? {
+                Some(next) => page = next,
+                None => break,
+            }
+        }
+
+        Ok(stats)
+    }
+
+    /// Read, encode and register the next page of the push backlog.
+    ///
+    /// Each priority band gets its share of the page, so normal and low
+    /// priority changes keep moving under a steady stream of high priority
+    /// ones; quota a band cannot use goes to the others, highest first.
+    async fn next_push_page(&self, cursor: &mut PushCursor, device_id: Uuid, user_id: Uuid) -> ServiceResult<Option<PushPage>> {
+        let total_weight: usize = PUSH_PRIORITY_BANDS.iter().map(|b| b.weight).sum();
+        let mut changes: Vec<ChangeLogEntry> = Vec::with_capacity(PUSH_PAGE_CHANGES);
+        let mut exhausted = [false; PUSH_PRIORITY_BANDS.len()];
+
+        for (i, band) in PUSH_PRIORITY_BANDS.iter().enumerate() {
+            let quota = PUSH_PAGE_CHANGES * band.weight / total_weight;
+            exhausted[i] = self.read_band(i, quota, cursor, &mut changes).await? < quota;
+        }
+        for i in 0..PUSH_PRIORITY_BANDS.len() {
+            let room = PUSH_PAGE_CHANGES - changes.len();
+            if room == 0 {
+                break;
+            }
+            if !exhausted[i] {
+                exhausted[i] = self.read_band(i, room, cursor, &mut changes).await? < room;
+            }
+        }
 
-        let tombstones = self.tombstone_repo
-            .find_unpushed_tombstones(500)
+        let tombstone_rows = self.tombstone_repo
+            .find_unpushed_tombstones_page(cursor.tombstone_seq, PUSH_PAGE_TOMBSTONES as u32)
             .await
             .map_err(ServiceError::Domain)?;
+        if let Some((seq, _)) = tombstone_rows.last() {
+            cursor.tombstone_seq = *seq;
+        }
+        let tombstones: Vec<Tombstone> = tombstone_rows.into_iter().map(|(_, t)| t).collect();
 
         if changes.is_empty() && tombstones.is_empty() {
-            return Ok(stats); // Nothing to push
+            return Ok(None);
         }
 
-        // 2. Create batch record
         let mut batch = self.build_upload_batch(device_id);
         batch.item_count = Some(changes.len() as i64 + tombstones.len() as i64);
         self.sync_repo
@@ -170,60 +312,36 @@ impl SyncServiceImpl {
             .await
             .map_err(ServiceError::Domain)?;
 
-        // 3. Prepare payload
-        use crate::domains::sync::types::PushPayload;
-        let payload = PushPayload {
+        let change_ids = changes.iter().map(|c| c.operation_id).collect();
+        let tombstone_ids = tombstones.iter().map(|t| t.id).collect();
+        let encoded = encode_push(&PushPayload {
             batch_id: batch.batch_id.clone(),
             device_id,
             user_id,
-            changes: changes.clone(),
-            tombstones: Some(tombstones.clone()),
-        };
-
-        // 4. Call remote
-        let api_token = self.obtain_api_token(user_id).await?;
-        let push_resp = self.cloud_storage
-            .push_changes(&api_token, payload)
-            .await?;
-
-        // 5. Mark local changes/tombstones as processed (best-effort)
-        {
-            let db_pool = crate::globals::get_db_pool()
-                .map_err(|ffi_err| ServiceError::Domain(DomainError::Internal(format!("Failed to get DB pool: {}", ffi_err))))?;
-            let mut tx = db_pool.begin()
-                .await
-                .map_err(|e| ServiceError::Domain(DomainError::Database(e.into())))?;
-
-            for change in &changes {
-                self.change_log_repo
-                    .mark_as_processed(change.operation_id, &batch.batch_id, Utc::now(), &mut tx)
-                    .await
-                    .map_err(ServiceError::Domain)?;
-            }
+            changes,
+            tombstones: Some(tombstones),
+        })?;
 
-            for tomb in &tombstones {
-                self.tombstone_repo
-                    .mark_as_pushed(tomb.id, &batch.batch_id, Utc::now(), &mut tx)
-                    .await
-                    .map_err(ServiceError::Domain)?;
-            }
+        Ok(Some(PushPage { batch_id: batch.batch_id, change_ids, tombstone_ids, encoded }))
+    }
 
-            tx.commit().await.map_err(|e| ServiceError::Domain(DomainError::Database(e.into())))?;
+    /// Append up to `limit` changes of priority band `band` to `changes`,
+    /// advancing the band's cursor. Returns how many were read.
+    async fn read_band(&self, band: usize, limit: usize, cursor: &mut PushCursor, changes: &mut Vec<ChangeLogEntry>) -> ServiceResult<usize> {
+        if limit == 0 {
+            return Ok(0);
         }
-
-        // 6. Update stats (basic)
-        stats.total_uploads = push_resp.changes_accepted;
-        stats.failed_uploads = push_resp.changes_rejected + push_resp.conflicts_detected;
-
-        // TODO: update other stats fields once server returns them.
-
-        // 7. Finalise batch
-        self.sync_repo
-            .finalize_sync_batch(&batch.batch_id, SyncBatchStatus::Completed, None, changes.len() as u32)
+        let b = &PUSH_PRIORITY_BANDS[band];
+        let rows = self.change_log_repo
+            .find_unprocessed_changes_page(b.min_priority, b.max_priority, cursor.band_seq[band], limit as u32)
             .await
             .map_err(ServiceError::Domain)?;
-
-        Ok(stats)
+        if let Some((seq, _)) = rows.last() {
+            cursor.band_seq[band] = *seq;
+        }
+        let read = rows.len();
+        changes.extend(rows.into_iter().map(|(_, c)| c));
+        Ok(read)
     }
 
     /// Pull remote changes and merge them locally.
@@ -236,43 +354,63 @@ impl SyncServiceImpl {
         let token = config.server_token.clone();
 
         // 2. Create download batch
-        let mut batch = self.build_download_batch(device_id);
+        let batch = self.build_download_batch(device_id);
         self.sync_repo.create_sync_batch(&batch).await.map_err(ServiceError::Domain)?;
 
-        // 3. Fetch changes from server
+        // 3-5. Fetch the server delta page by page; each page is merged in
+        // one transaction and its token saved, so an interrupted pull resumes
+        // from the last completed page
         let api_token = self.obtain_api_token(user_id).await?;
-        let fetch_resp = self.cloud_storage
-            .get_changes_since(&api_token, device_id, token)
-            .await?;
+        let mut page_token = token;
+        let mut applied_changes = 0usize;
+        let mut pages = 0u32;
+        let server_timestamp = loop {
+            let page = self.cloud_storage
+                .get_changes_since(&api_token, device_id, page_token.clone())
+                .await?;
+            pages += 1;
+
+            let applied_ids = self.entity_merger
+                .apply_changes_batch(&page.changes, auth)
+                .await
+                .map_err(ServiceError::Domain)?;
+            applied_changes += applied_ids.len();
+            stats.total_downloads += applied_ids.len() as i64;
 
-        // 4. Apply changes locally using entity merger
-        let applied_ids = self.entity_merger
-            .apply_changes_batch(&fetch_resp.changes, auth)
-            .await
-            .map_err(ServiceError::Domain)?;
+            let (tombstones_applied, tombstones_failed) = self.entity_merger
+                .apply_tombstones_batch(page.tombstones.as_deref().unwrap_or_default(), auth)
+                .await
+                .map_err(ServiceError::Domain)?;
+            stats.total_downloads += tombstones_applied as i64;
+            stats.failed_downloads += tombstones_failed as i64;
 
-        // 5. Apply tombstones
-        for tomb in &fetch_resp.tombstones.clone().unwrap_or_default() {
-            if let Err(e) = self.entity_merger.apply_tombstone(tomb, auth).await {
-                // Log but continue (TODO: create conflict record?)
-                log::error!("Failed to apply tombstone {:?}: {:?}", tomb, e);
-                stats.failed_downloads += 1;
-            } else {
-                stats.total_downloads += 1;
+            if !page.has_more {
+                break page.server_timestamp;
             }
-        }
-
-        stats.total_downloads += applied_ids.len() as i64;
+            let next_token = match page.next_batch_hint {
+                Some(hint) if page_token.as_deref() != Some(hint.as_str()) => hint,
+                _ => {
+                    log::warn!("Server reported more changes without a new continuation token; stopping after page {}", pages);
+                    break page.server_timestamp;
+                }
+            };
+            self.sync_repo
+                .update_sync_state_token(user_id, Some(next_token.clone()))
+                .await
+                .map_err(ServiceError::Domain)?;
+            page_token = Some(next_token);
+        };
+        log::debug!("Pulled {} changes in {} page(s)", applied_changes, pages);
 
         // 6. Save new server token from response (if provided)
         self.sync_repo
-            .update_sync_state_token(user_id, Some(fetch_resp.server_timestamp.to_rfc3339()))
+            .update_sync_state_token(user_id, Some(server_timestamp.to_rfc3339()))
             .await
             .map_err(ServiceError::Domain)?;
 
         // 7. Finalise batch
         self.sync_repo
-            .finalize_sync_batch(&batch.batch_id, SyncBatchStatus::Completed, None, applied_ids.len() as u32)
+            .finalize_sync_batch(&batch.batch_id, SyncBatchStatus::Completed, None, applied_changes as u32)
             .await
             .map_err(ServiceError::Domain)?;
 
@@ -306,6 +444,20 @@ impl SyncServiceImpl {
             return Ok(());
         }
 
+        // Same content already uploaded for another document: reuse its key
+        let pool = crate::globals::get_db_pool()
+            .map_err(|e| ServiceError::Domain(DomainError::Internal(format!("Failed to get database pool: {}", e))))?;
+        let blob = content_blobs::blob_for_document(&pool, document_id)
+            .await
+            .map_err(ServiceError::Domain)?;
+        if let Some(blob_key) = blob.as_ref().and_then(|b| b.remote_blob_key.clone()) {
+            log::debug!("Document {} shares uploaded blob {}, skipping upload", document_id, blob_key);
+            media_repo.update_blob_sync_status(document_id, BlobSyncStatus::Synced, Some(&blob_key))
+                .await
+                .map_err(ServiceError::Domain)?;
+            return Ok(());
+        }
+
         // Determine file path (compressed vs original)
         let (path_to_upload, _is_compressed) = match self.compression_service.clone() {
             Some(cs) => {
@@ -349,6 +501,11 @@ impl SyncServiceImpl {
         if let Err(e) = media_repo.update_blob_sync_status(document_id, BlobSyncStatus::Synced, Some(&blob_key)).await {
             log::error!("Failed to update blob status for doc {} after upload: {:?}", document_id, e);
         }
+        if let Some(blob) = &blob {
+            if let Err(e) = content_blobs::record_remote_blob_key(&pool, &blob.content_hash, &blob_key).await {
+                log::error!("Failed to record remote key for blob {}: {:?}", blob.content_hash, e);
+            }
+        }
 
         Ok(())
     }
@@ -8,7 +8,8 @@ use crate::types::{PaginatedResult, PaginationParams}; // Might need pagination
 use async_trait::async_trait;
 use chrono::{Utc, Local}; // Added Local
 use uuid::Uuid;
-use std::collections::HashMap; // Added HashMap
+use std::collections::{HashMap, HashSet}; // Added HashMap
+use crate::domains::core::loader::uuid_list_json;
 use crate::domains::sync::repository::ChangeLogRepository; // Corrected path
 use crate::domains::sync::types::{ChangeLogEntry, ChangeOperationType, SyncPriority}; // Corrected path and type name, removed EntityType
 use serde_json; // Added serde_json for serialization
@@ -18,6 +19,9 @@ use crate::domains::user::repository::MergeableEntityRepository;
 use crate::domains::sync::types::MergeOutcome;
 use sqlx::QueryBuilder;
 
+/// Links per multi-row upsert in `batch_add_participants`
+const WORKSHOP_PARTICIPANT_INSERT_CHUNK: usize = 200;
+
 /// Trait defining workshop-participant relationship repository operations
 #[async_trait]
 pub trait WorkshopParticipantRepository: Send + Sync + MergeableEntityRepository<WorkshopParticipant> {
@@ -876,49 +880,67 @@ impl WorkshopParticipantRepository for SqliteWorkshopParticipantRepository {
         let now_str = now.to_rfc3339();
         let user_id_str = auth.user_id.to_string();
 
-        for &participant_id in participant_ids {
-            let participant_id_str = participant_id.to_string();
-            let link_id = Uuid::new_v4();
+        // One multi-row upsert per chunk instead of one statement per participant
+        for chunk in participant_ids.chunks(WORKSHOP_PARTICIPANT_INSERT_CHUNK) {
+            // An unknown participant id would fail the chunk's foreign key as a
+            // whole, so those are reported on their own and left out
+            let existing: HashSet<String> = query_scalar::<_, String>(
+                "SELECT id FROM participants WHERE id IN (SELECT value FROM json_each(?))",
+            )
+            .bind(uuid_list_json(chunk))
+            .fetch_all(&mut *tx)
+            .await
+            .map_err(DbError::from)?
+            .into_iter()
+            .collect();
+            let (chunk, missing): (Vec<Uuid>, Vec<Uuid>) = chunk
+                .iter()
+                .copied()
+                .partition(|pid| existing.contains(&pid.to_string()));
+            results.extend(
+                missing
+                    .into_iter()
+                    .map(|pid| (pid, Err(DomainError::EntityNotFound("Participant".to_string(), pid)))),
+            );
+            if chunk.is_empty() {
+                continue;
+            }
 
-            let insert_result = query(
-                r#"
-                INSERT INTO workshop_participants (
+            let mut builder = QueryBuilder::<Sqlite>::new(
+                r#"INSERT INTO workshop_participants (
                     id, workshop_id, participant_id,
                     pre_evaluation, pre_evaluation_updated_at, pre_evaluation_updated_by,
                     post_evaluation, post_evaluation_updated_at, post_evaluation_updated_by,
                     created_at, updated_at, created_by_user_id, updated_by_user_id,
                     deleted_at, deleted_by_user_id
-                ) VALUES (
-                    ?, ?, ?, 
-                    NULL, NULL, NULL, 
-                    NULL, NULL, NULL, 
-                    ?, ?, ?, ?, 
-                    NULL, NULL
-                ) ON CONFLICT(workshop_id, participant_id) DO UPDATE SET
+                ) "#,
+            );
+            builder.push_values(&chunk, |mut row, participant_id| {
+                row.push_bind(Uuid::new_v4().to_string())
+                    .push_bind(workshop_id_str.as_str())
+                    .push_bind(participant_id.to_string())
+                    .push("NULL, NULL, NULL, NULL, NULL, NULL")
+                    .push_bind(now_str.as_str())
+                    .push_bind(now_str.as_str())
+                    .push_bind(user_id_str.as_str())
+                    .push_bind(user_id_str.as_str())
+                    .push("NULL, NULL");
+            });
+            builder.push(
+                r#" ON CONFLICT(workshop_id, participant_id) DO UPDATE SET
                     deleted_at = NULL, -- Undelete if previously deleted
                     deleted_by_user_id = NULL,
                     updated_at = excluded.updated_at,
-                    updated_by_user_id = excluded.updated_by_user_id
-                    -- Optionally update evaluations if they were passed in batch, currently NULLed
-                "#,
-            )
-            .bind(link_id.to_string())
-            .bind(&workshop_id_str)
-            .bind(&participant_id_str)
-            .bind(&now_str) // created_at / updated_at for excluded
-            .bind(&now_str)
-            .bind(&user_id_str) // created_by / updated_by for excluded
-            .bind(&user_id_str)
-            .execute(&mut *tx)
-            .await;
-
-            match insert_result {
-                Ok(_) => results.push((participant_id, Ok(()))),
-                Err(sqlx::Error::Database(db_err)) if db_err.message().contains("UNIQUE constraint failed") => {
-                    // This case should theoretically be handled by ON CONFLICT, but check just in case.
-                    results.push((participant_id, Err(DbError::Conflict("Workshop participant link already exists".into()).into())))
+                    updated_by_user_id = excluded.updated_by_user_id"#,
+            );
+
+            match builder.build().execute(&mut *tx).await {
+                Ok(_) => results.extend(chunk.iter().map(|&pid| (pid, Ok(())))),
+                Err(e) => {
+                    // The chunk's statement failed as a whole: report it for each of its participants
+                    let error: DomainError = DbError::from(e).into();
+                    results.extend(chunk.iter().map(|&pid| (pid, Err(error.clone()))));
                 }
-                Err(e) => results.push((participant_id, Err(DbError::from(e).into()))),
             }
         }
 
@@ -1153,4 +1175,61 @@ impl MergeableEntityRepository<WorkshopParticipant> for SqliteWorkshopParticipan
             ChangeOperationType::HardDelete => Ok(MergeOutcome::HardDeleted(remote_change.entity_id)),
         }
     }
-} 
\ No newline at end of file
+} 
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::domains::sync::repository::SqliteChangeLogRepository;
+    use crate::types::UserRole;
+
+    #[tokio::test]
+    async fn batch_add_reports_unknown_participants_individually() {
+        let pool = sqlx::sqlite::SqlitePoolOptions::new()
+            .max_connections(1)
+            .connect("sqlite::memory:")
+            .await
+            .unwrap();
+        sqlx::query(include_str!("../../../migrations/20240101000000_consolidated.sql"))
+            .execute(&pool)
+            .await
+            .unwrap();
+        let user_id = Uuid::new_v4();
+        sqlx::query("INSERT INTO users (id, email, password_hash, name, role) VALUES (?, 'u@example.org', 'x', 'User', 'admin')")
+            .bind(user_id.to_string())
+            .execute(&pool)
+            .await
+            .unwrap();
+        let workshop_id = Uuid::new_v4();
+        sqlx::query("INSERT INTO workshops (id) VALUES (?)")
+            .bind(workshop_id.to_string())
+            .execute(&pool)
+            .await
+            .unwrap();
+        let participants: Vec<Uuid> = (0..3).map(|_| Uuid::new_v4()).collect();
+        for id in &participants {
+            sqlx::query("INSERT INTO participants (id, name) VALUES (?, 'Participant')")
+                .bind(id.to_string())
+                .execute(&pool)
+                .await
+                .unwrap();
+        }
+        let unknown = Uuid::new_v4();
+        let ids = [participants[0], unknown, participants[1], participants[2]];
+
+        let repo = SqliteWorkshopParticipantRepository::new(pool.clone(), Arc::new(SqliteChangeLogRepository::new(pool.clone())));
+        let auth = AuthContext::new(user_id, UserRole::Admin, "device".to_string(), false);
+        let results = repo.batch_add_participants(workshop_id, &ids, &auth).await.unwrap();
+
+        assert_eq!(results.len(), ids.len());
+        for (pid, result) in &results {
+            assert_eq!(result.is_ok(), *pid != unknown, "participant {}", pid);
+        }
+        let linked: i64 = query_scalar("SELECT COUNT(*) FROM workshop_participants WHERE workshop_id = ?")
+            .bind(workshop_id.to_string())
+            .fetch_one(&pool)
+            .await
+            .unwrap();
+        assert_eq!(linked, 3);
+    }
+}
@@ -1,5 +1,6 @@
 use crate::auth::AuthContext;
 use sqlx::SqlitePool;
+use crate::domains::core::stat_counters;
 use crate::domains::core::repository::{FindById, HardDeletable, SoftDeletable};
 use crate::domains::core::delete_service::DeleteServiceRepository;
 use crate::domains::core::document_linking::DocumentLinkable;
@@ -146,6 +147,8 @@ pub trait WorkshopRepository:
 #[derive(Clone)]
 pub struct SqliteWorkshopRepository {
     pool: SqlitePool,
+    /// Read-only connections for queries; writes and transactions use `pool`
+    read_pool: SqlitePool,
     change_log_repo: Arc<dyn ChangeLogRepository + Send + Sync>,
 }
 
@@ -160,7 +163,13 @@ impl std::fmt::Debug for SqliteWorkshopRepository {
 
 impl SqliteWorkshopRepository {
     pub fn new(pool: SqlitePool, change_log_repo: Arc<dyn ChangeLogRepository + Send + Sync>) -> Self {
-        Self { pool, change_log_repo }
+        Self { read_pool: pool.clone(), pool, change_log_repo }
+    }
+
+    /// Serve queries from a separate read-only pool
+    pub fn with_read_pool(mut self, read_pool: SqlitePool) -> Self {
+        self.read_pool = read_pool;
+        self
     }
 
     fn map_row_to_entity(row: WorkshopRow) -> DomainResult<Workshop> {
@@ -197,7 +206,7 @@ impl FindById<Workshop> for SqliteWorkshopRepository {
             "SELECT * FROM workshops WHERE id = ? AND deleted_at IS NULL",
         )
         .bind(id.to_string())
-        .fetch_optional(&self.pool)
+        .fetch_optional(&self.read_pool)
         .await
         .map_err(DbError::from)?
         .ok_or_else(|| DomainError::EntityNotFound("Workshop".to_string(), id))?;
@@ -639,7 +648,7 @@ impl WorkshopRepository for SqliteWorkshopRepository {
             count_query = count_query.bind(val);
         }
         let total: i64 = count_query
-            .fetch_one(&self.pool)
+            .fetch_one(&self.read_pool)
             .await
             .map_err(DbError::from)?;
 
@@ -657,7 +666,7 @@ impl WorkshopRepository for SqliteWorkshopRepository {
         select_query = select_query.bind(offset as i64);
         
         let rows = select_query
-            .fetch_all(&self.pool)
+            .fetch_all(&self.read_pool)
             .await
             .map_err(DbError::from)?;
 
@@ -878,17 +887,7 @@ impl WorkshopRepository for SqliteWorkshopRepository {
     }
 
     async fn count_by_location(&self) -> DomainResult<Vec<(Option<String>, i64)>> {
-        let counts = query_as::<_, (Option<String>, i64)>(
-            "SELECT location, COUNT(*) 
-             FROM workshops 
-             WHERE deleted_at IS NULL 
-             GROUP BY location"
-        )
-        .fetch_all(&self.pool)
-        .await
-        .map_err(DbError::from)?;
-
-        Ok(counts)
+        stat_counters::text_breakdown(&self.read_pool, "workshops", "location").await
     }
     
     async fn count_by_month(&self) -> DomainResult<Vec<(String, i64)>> {
@@ -901,7 +900,7 @@ impl WorkshopRepository for SqliteWorkshopRepository {
              GROUP BY month
              ORDER BY month"
         )
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -909,30 +908,19 @@ impl WorkshopRepository for SqliteWorkshopRepository {
     }
     
     async fn count_by_project(&self) -> DomainResult<Vec<(Option<Uuid>, i64)>> {
-        let project_counts = query(
-            "SELECT project_id, COUNT(*) as count
-             FROM workshops 
-             WHERE deleted_at IS NULL 
-             GROUP BY project_id"
-        )
-        .fetch_all(&self.pool)
-        .await
-        .map_err(DbError::from)?;
+        let counts = stat_counters::text_breakdown(&self.read_pool, "workshops", "project_id").await?;
 
         // Manual mapping to handle Option<Uuid>
         let mut results = Vec::new();
-        for row in project_counts {
-            let project_id_str: Option<String> = row.get("project_id");
-            let count: i64 = row.get("count");
-            
-            let project_id = match project_id_str {
+        for (id_str, count) in counts {
+            let id = match id_str {
                 Some(id_str) => Some(Uuid::parse_str(&id_str).map_err(|_| 
                     DomainError::Internal(format!("Invalid UUID in project_id: {}", id_str))
                 )?),
                 None => None,
             };
             
-            results.push((project_id, count));
+            results.push((id, count));
         }
 
         Ok(results)
@@ -958,7 +946,7 @@ impl WorkshopRepository for SqliteWorkshopRepository {
             )
             .bind(today.format("%Y-%m-%d").to_string())
             .bind(today.format("%Y-%m-%d").to_string())
-            .fetch_one(&self.pool)
+            .fetch_one(&self.read_pool)
             .await
             .map_err(DbError::from)?;
         
@@ -991,7 +979,7 @@ impl WorkshopRepository for SqliteWorkshopRepository {
             WHERE deleted_at IS NULL AND budget > 0 AND actuals IS NOT NULL
             "#
         )
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1060,7 +1048,7 @@ impl WorkshopRepository for SqliteWorkshopRepository {
         )
         .bind(&start_date_str)
         .bind(&end_date_str)
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1074,7 +1062,7 @@ impl WorkshopRepository for SqliteWorkshopRepository {
         .bind(&end_date_str)
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1115,7 +1103,7 @@ impl WorkshopRepository for SqliteWorkshopRepository {
 
         let total: i64 = count_builder
             .build_query_scalar()
-            .fetch_one(&self.pool)
+            .fetch_one(&self.read_pool)
             .await
             .map_err(DbError::from)?;
 
@@ -1135,7 +1123,7 @@ impl WorkshopRepository for SqliteWorkshopRepository {
 
         let rows = select_builder
             .build_query_as::<WorkshopRow>()
-            .fetch_all(&self.pool)
+            .fetch_all(&self.read_pool)
             .await
             .map_err(DbError::from)?;
 
@@ -1164,7 +1152,7 @@ impl WorkshopRepository for SqliteWorkshopRepository {
              WHERE event_date < ? AND deleted_at IS NULL"
         )
         .bind(&today)
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1177,7 +1165,7 @@ impl WorkshopRepository for SqliteWorkshopRepository {
         .bind(&today)
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1206,7 +1194,7 @@ impl WorkshopRepository for SqliteWorkshopRepository {
              WHERE event_date >= ? AND deleted_at IS NULL"
         )
         .bind(&today)
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1219,7 +1207,7 @@ impl WorkshopRepository for SqliteWorkshopRepository {
         .bind(&today)
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1248,7 +1236,7 @@ impl WorkshopRepository for SqliteWorkshopRepository {
              WHERE location = ? AND deleted_at IS NULL"
         )
         .bind(location)
-        .fetch_one(&self.pool)
+        .fetch_one(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1261,7 +1249,7 @@ impl WorkshopRepository for SqliteWorkshopRepository {
         .bind(location)
         .bind(params.per_page as i64)
         .bind(offset as i64)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
 
@@ -1316,7 +1304,7 @@ impl WorkshopRepository for SqliteWorkshopRepository {
             query = query.bind(pid_str);
         }
         
-        let row = query.fetch_one(&self.pool)
+        let row = query.fetch_one(&self.read_pool)
             .await
             .map_err(DbError::from)?;
             
@@ -1362,7 +1350,7 @@ impl WorkshopRepository for SqliteWorkshopRepository {
             "#
         )
         .bind(&project_id_str)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
         
@@ -1422,7 +1410,7 @@ impl WorkshopRepository for SqliteWorkshopRepository {
             "SELECT name FROM projects WHERE id = ? AND deleted_at IS NULL"
         )
         .bind(&project_id_str)
-        .fetch_optional(&self.pool)
+        .fetch_optional(&self.read_pool)
         .await
         .map_err(DbError::from)?
         .ok_or_else(|| DomainError::EntityNotFound("Project".to_string(), project_id))?;
@@ -1443,7 +1431,7 @@ impl WorkshopRepository for SqliteWorkshopRepository {
             .bind(&today)
             .bind(&today)
             .bind(&project_id_str)
-            .fetch_one(&self.pool)
+            .fetch_one(&self.read_pool)
             .await
             .map_err(DbError::from)?;
         
@@ -1464,7 +1452,7 @@ impl WorkshopRepository for SqliteWorkshopRepository {
             "#
         )
         .bind(&project_id_str)
-        .fetch_all(&self.pool)
+        .fetch_all(&self.read_pool)
         .await
         .map_err(DbError::from)?;
         
@@ -1,6 +1,7 @@
 use crate::auth::AuthContext;
 use sqlx::{SqlitePool, Transaction, Sqlite};
 use crate::domains::core::dependency_checker::DependencyChecker;
+use crate::domains::core::loader::RelationLoader;
 use crate::domains::core::delete_service::{BaseDeleteService, DeleteOptions, DeleteService, DeleteServiceRepository};
 use crate::domains::core::repository::{DeleteResult, FindById, HardDeletable, SoftDeletable};
 use crate::domains::core::document_linking::DocumentLinkable;
@@ -316,40 +317,53 @@ impl WorkshopServiceImpl {
     }
     
     // Helper function to enrich a single workshop response
-    async fn enrich_response(&self, mut response: WorkshopResponse, include: Option<&[WorkshopInclude]>) -> ServiceResult<WorkshopResponse> {
-        if let Some(includes) = include {
-            let include_all = includes.contains(&WorkshopInclude::All);
-            
-            // Include Project
-            if include_all || includes.contains(&WorkshopInclude::Project) {
-                 if let Some(project_id) = response.project_id {
-                      match self.project_repo.find_by_id(project_id).await {
-                         Ok(project) => {
-                             let summary = ProjectSummary {
-                                 id: project.id,
-                                 name: project.name,
-                             };
-                             response.project = Some(summary);
-                         },
-                         Err(DomainError::EntityNotFound(_, _)) => {
-                             eprintln!("Warning: Project with ID {} not found for workshop {}", project_id, response.id);
-                             response.project = None;
-                         },
-                         Err(e) => return Err(ServiceError::Domain(e)),
-                      }
-                 }
+    async fn enrich_response(&self, response: WorkshopResponse, include: Option<&[WorkshopInclude]>) -> ServiceResult<WorkshopResponse> {
+        let relations = RelationLoader::new(self.pool.clone());
+        let mut enriched = self.enrich_responses(vec![response], include, &relations).await?;
+        Ok(enriched.pop().expect("one response in, one out"))
+    }
+
+    // Enrich a page of workshops; project names come through the request's
+    // loader, participant lists are still fetched per workshop
+    async fn enrich_responses(
+        &self,
+        mut responses: Vec<WorkshopResponse>,
+        include: Option<&[WorkshopInclude]>,
+        relations: &RelationLoader,
+    ) -> ServiceResult<Vec<WorkshopResponse>> {
+        let Some(includes) = include else {
+            return Ok(responses);
+        };
+        let include_all = includes.contains(&WorkshopInclude::All);
+
+        // Include Project
+        if include_all || includes.contains(&WorkshopInclude::Project) {
+            let project_ids: Vec<Uuid> = responses.iter().filter_map(|r| r.project_id).collect();
+            let names = relations.project_names(&project_ids).await.map_err(ServiceError::Domain)?;
+            for response in responses.iter_mut() {
+                if let Some(project_id) = response.project_id {
+                    response.project = match names.get(&project_id) {
+                        Some(name) => Some(ProjectSummary { id: project_id, name: name.clone() }),
+                        None => {
+                            eprintln!("Warning: Project with ID {} not found for workshop {}", project_id, response.id);
+                            None
+                        }
+                    };
+                }
             }
-            
-            // Include Participants - Use the injected real repo
-            if include_all || includes.contains(&WorkshopInclude::Participants) {
-                 // Directly use self.workshop_participant_repo
-                 match self.workshop_participant_repo.find_participants_for_workshop(response.id).await {
-                     Ok(participants) => response.participants = Some(participants),
-                     Err(e) => return Err(ServiceError::Domain(e)),
-                 }
+        }
+
+        // Include Participants - Use the injected real repo
+        if include_all || includes.contains(&WorkshopInclude::Participants) {
+            for response in responses.iter_mut() {
+                let participants = self.workshop_participant_repo
+                    .find_participants_for_workshop(response.id)
+                    .await
+                    .map_err(ServiceError::Domain)?;
+                response.participants = Some(participants);
             }
         }
-        Ok(response)
+        Ok(responses)
     }
 }
 
@@ -477,12 +491,9 @@ impl WorkshopService for WorkshopServiceImpl {
             ));
         }
         let paginated_result = self.repo.find_all(params, project_id).await?;
-        let mut response_items = Vec::with_capacity(paginated_result.items.len());
-        for workshop in paginated_result.items {
-            let base_response = WorkshopResponse::from_workshop(workshop);
-            let enriched_response = self.enrich_response(base_response, include).await?;
-            response_items.push(enriched_response);
-        }
+        let responses = paginated_result.items.into_iter().map(WorkshopResponse::from_workshop).collect();
+        let relations = RelationLoader::new(self.pool.clone());
+        let response_items = self.enrich_responses(responses, include, &relations).await?;
         Ok(PaginatedResult::new(
             response_items,
             paginated_result.total,
@@ -892,12 +903,9 @@ impl WorkshopService for WorkshopServiceImpl {
             .map_err(ServiceError::Domain)?;
 
         // 5. Convert and enrich each workshop
-        let mut enriched_items = Vec::new();
-        for workshop in paginated_result.items {
-            let response = WorkshopResponse::from_workshop(workshop);
-            let enriched = self.enrich_response(response, include).await?;
-            enriched_items.push(enriched);
-        }
+        let responses = paginated_result.items.into_iter().map(WorkshopResponse::from_workshop).collect();
+        let relations = RelationLoader::new(self.pool.clone());
+        let enriched_items = self.enrich_responses(responses, include, &relations).await?;
 
         // 6. Return paginated result
         Ok(PaginatedResult::new(
@@ -921,12 +929,9 @@ impl WorkshopService for WorkshopServiceImpl {
             .map_err(ServiceError::Domain)?;
 
         // 3. Convert and enrich each workshop
-        let mut enriched_items = Vec::new();
-        for workshop in paginated_result.items {
-            let response = WorkshopResponse::from_workshop(workshop);
-            let enriched = self.enrich_response(response, include).await?;
-            enriched_items.push(enriched);
-        }
+        let responses = paginated_result.items.into_iter().map(WorkshopResponse::from_workshop).collect();
+        let relations = RelationLoader::new(self.pool.clone());
+        let enriched_items = self.enrich_responses(responses, include, &relations).await?;
 
         // 4. Return paginated result
         Ok(PaginatedResult::new(
@@ -950,12 +955,9 @@ impl WorkshopService for WorkshopServiceImpl {
             .map_err(ServiceError::Domain)?;
 
         // 3. Convert and enrich each workshop
-        let mut enriched_items = Vec::new();
-        for workshop in paginated_result.items {
-            let response = WorkshopResponse::from_workshop(workshop);
-            let enriched = self.enrich_response(response, include).await?;
-            enriched_items.push(enriched);
-        }
+        let responses = paginated_result.items.into_iter().map(WorkshopResponse::from_workshop).collect();
+        let relations = RelationLoader::new(self.pool.clone());
+        let enriched_items = self.enrich_responses(responses, include, &relations).await?;
 
         // 4. Return paginated result
         Ok(PaginatedResult::new(
@@ -980,12 +982,9 @@ impl WorkshopService for WorkshopServiceImpl {
             .map_err(ServiceError::Domain)?;
 
         // 3. Convert and enrich each workshop
-        let mut enriched_items = Vec::new();
-        for workshop in paginated_result.items {
-            let response = WorkshopResponse::from_workshop(workshop);
-            let enriched = self.enrich_response(response, include).await?;
-            enriched_items.push(enriched);
-        }
+        let responses = paginated_result.items.into_iter().map(WorkshopResponse::from_workshop).collect();
+        let relations = RelationLoader::new(self.pool.clone());
+        let enriched_items = self.enrich_responses(responses, include, &relations).await?;
 
         // 4. Return paginated result
         Ok(PaginatedResult::new(
@@ -22,21 +22,26 @@
 //   of each payload is documented above every function.
 // ----------------------------------------------------------------------------
 
-use crate::ffi::{handle_status_result, error::FFIError};
+use crate::ffi::{handle_status_result, parse_payload, to_json_result, error::{FFIError, FFIResult}};
+use crate::ffi::cursor::{open_cursor, CursorSortDto, KeysetQuery};
 use crate::domains::activity::types::{
-    NewActivity, UpdateActivity, ActivityResponse, ActivityInclude, 
+    ActivityRow, NewActivity, UpdateActivity, ActivityResponse, ActivityInclude, 
     ActivityDocumentReference, ActivityFilter, ActivityStatistics, 
     ActivityStatusBreakdown, ActivityMetadataCounts, ActivityProgressAnalysis
 };
 use crate::domains::sync::types::SyncPriority;
 use crate::domains::compression::types::CompressionPriority;
+use crate::domains::core::search::SearchMode;
 use crate::auth::AuthContext;
-use crate::types::{UserRole, PaginationParams, PaginatedResult};
+use crate::types::{UserRole, Permission, PaginationParams, PaginatedResult};
 use crate::globals;
 
 use std::ffi::{CStr, CString};
-use std::os::raw::{c_char, c_int};
+use std::os::raw::{c_char, c_int, c_void};
+use crate::ffi::FfiCompletionCallback;
 use std::str::FromStr;
+use sqlx::FromRow;
+use sqlx::sqlite::SqliteRow;
 use uuid::Uuid;
 use serde::{Deserialize, Serialize};
 use std::collections::HashMap;
@@ -112,6 +117,36 @@ impl From<PaginationDto> for PaginationParams {
     }
 }
 
+/// DTO for activity filter criteria; unparseable project ids are dropped
+#[derive(Deserialize)]
+struct ActivityFilterDto {
+    status_ids: Option<Vec<i64>>,
+    project_ids: Option<Vec<String>>,
+    search_text: Option<String>,
+    date_range: Option<(String, String)>,
+    target_value_range: Option<(f64, f64)>,
+    actual_value_range: Option<(f64, f64)>,
+    exclude_deleted: Option<bool>,
+}
+
+impl From<ActivityFilterDto> for ActivityFilter {
+    fn from(dto: ActivityFilterDto) -> Self {
+        ActivityFilter {
+            status_ids: dto.status_ids,
+            project_ids: dto.project_ids.map(|ids| {
+                ids.into_iter()
+                    .filter_map(|id| Uuid::parse_str(&id).ok())
+                    .collect()
+            }),
+            search_text: dto.search_text,
+            date_range: dto.date_range,
+            target_value_range: dto.target_value_range,
+            actual_value_range: dto.actual_value_range,
+            exclude_deleted: dto.exclude_deleted,
+        }
+    }
+}
+
 /// DTO for activity includes
 #[derive(Deserialize)]
 #[serde(rename_all = "snake_case")]
@@ -177,7 +212,7 @@ pub unsafe extern "C" fn activity_create(payload_json: *const c_char, result: *m
         }
         
         println!("🦀 [ACTIVITY_FFI] Parsing JSON...");
-        let p: Payload = serde_json::from_str(json).map_err(|e| {
+        let p: Payload = parse_payload(json).map_err(|e| {
             println!("❌ [ACTIVITY_FFI] JSON parsing failed: {}", e);
             FFIError::invalid_argument(&format!("json {e}"))
         })?;
@@ -247,7 +282,7 @@ pub unsafe extern "C" fn activity_create(payload_json: *const c_char, result: *m
         println!("✅ [ACTIVITY_FFI] Activity created successfully! ID: {}", activity.id);
         
         println!("🦀 [ACTIVITY_FFI] Serializing response to JSON...");
-        let json_resp = serde_json::to_string(&activity)
+        let json_resp = to_json_result(&activity)
             .map_err(|e| {
                 println!("❌ [ACTIVITY_FFI] JSON serialization failed: {}", e);
                 FFIError::internal(format!("ser {e}"))
@@ -306,7 +341,7 @@ pub unsafe extern "C" fn activity_create_with_documents(payload_json: *const c_c
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         
         // Decode all documents
         let mut documents = Vec::new();
@@ -361,7 +396,7 @@ pub unsafe extern "C" fn activity_create_with_documents(payload_json: *const c_c
             document_results: doc_results.into_iter().map(|r| r.map_err(|e| e.to_string())).collect(),
         };
         
-        let json_resp = serde_json::to_string(&response)
+        let json_resp = to_json_result(&response)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -391,7 +426,7 @@ pub unsafe extern "C" fn activity_get(payload_json: *const c_char, result: *mut
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         
@@ -402,7 +437,7 @@ pub unsafe extern "C" fn activity_get(payload_json: *const c_char, result: *mut
         let activity = block_on_async(svc.get_activity_by_id(id, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&activity)
+        let json_resp = to_json_result(&activity)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -434,7 +469,7 @@ pub unsafe extern "C" fn activity_list(payload_json: *const c_char, result: *mut
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let params = parse_pagination(p.pagination);
         let auth: AuthContext = p.auth.try_into()?;
         
@@ -464,7 +499,7 @@ pub unsafe extern "C" fn activity_list(payload_json: *const c_char, result: *mut
             
         let paginated_response = PaginatedResult::new(response_items, activities_result.total, params);
         
-        let json_resp = serde_json::to_string(&paginated_response)
+        let json_resp = to_json_result(&paginated_response)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -494,7 +529,7 @@ pub unsafe extern "C" fn activity_update(payload_json: *const c_char, result: *m
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_activity_service()?;
@@ -502,7 +537,7 @@ pub unsafe extern "C" fn activity_update(payload_json: *const c_char, result: *m
         let activity = block_on_async(svc.update_activity(id, p.update, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&activity)
+        let json_resp = to_json_result(&activity)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -532,7 +567,7 @@ pub unsafe extern "C" fn activity_delete(payload_json: *const c_char, result: *m
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_activity_service()?;
@@ -540,7 +575,7 @@ pub unsafe extern "C" fn activity_delete(payload_json: *const c_char, result: *m
         let delete_result = block_on_async(svc.delete_activity(id, p.hard_delete.unwrap_or(false), &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&delete_result)
+        let json_resp = to_json_result(&delete_result)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -586,7 +621,7 @@ pub unsafe extern "C" fn activity_upload_document(payload_json: *const c_char, r
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         
         // Decode base64 file data
         let file_data = base64::decode(&p.file_data)
@@ -619,7 +654,7 @@ pub unsafe extern "C" fn activity_upload_document(payload_json: *const c_char, r
             &auth,
         )).map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&document)
+        let json_resp = to_json_result(&document)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -663,7 +698,7 @@ pub unsafe extern "C" fn activity_bulk_upload_documents(payload_json: *const c_c
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         
         // Decode all files
         let mut files = Vec::new();
@@ -698,7 +733,7 @@ pub unsafe extern "C" fn activity_bulk_upload_documents(payload_json: *const c_c
             &auth,
         )).map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&documents)
+        let json_resp = to_json_result(&documents)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -726,14 +761,14 @@ pub unsafe extern "C" fn activity_get_statistics(payload_json: *const c_char, re
         #[derive(Deserialize)]
         struct Payload { auth: AuthCtxDto }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_activity_service()?;
         
         let stats = block_on_async(svc.get_activity_statistics(&auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&stats)
+        let json_resp = to_json_result(&stats)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -757,14 +792,14 @@ pub unsafe extern "C" fn activity_get_status_breakdown(payload_json: *const c_ch
         #[derive(Deserialize)]
         struct Payload { auth: AuthCtxDto }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_activity_service()?;
         
         let breakdown = block_on_async(svc.get_activity_status_breakdown(&auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&breakdown)
+        let json_resp = to_json_result(&breakdown)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -788,14 +823,14 @@ pub unsafe extern "C" fn activity_get_metadata_counts(payload_json: *const c_cha
         #[derive(Deserialize)]
         struct Payload { auth: AuthCtxDto }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_activity_service()?;
         
         let counts = block_on_async(svc.get_activity_metadata_counts(&auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&counts)
+        let json_resp = to_json_result(&counts)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -831,7 +866,7 @@ pub unsafe extern "C" fn activity_find_by_status(payload_json: *const c_char, re
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let params = parse_pagination(p.pagination);
         let auth: AuthContext = p.auth.try_into()?;
         
@@ -842,7 +877,7 @@ pub unsafe extern "C" fn activity_find_by_status(payload_json: *const c_char, re
         let activities = block_on_async(svc.find_activities_by_status(p.status_id, params, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&activities)
+        let json_resp = to_json_result(&activities)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -876,7 +911,7 @@ pub unsafe extern "C" fn activity_find_by_date_range(payload_json: *const c_char
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let params = parse_pagination(p.pagination);
         let auth: AuthContext = p.auth.try_into()?;
         
@@ -887,7 +922,7 @@ pub unsafe extern "C" fn activity_find_by_date_range(payload_json: *const c_char
         let activities = block_on_async(svc.find_activities_by_date_range(&p.start_date, &p.end_date, params, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&activities)
+        let json_resp = to_json_result(&activities)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -899,6 +934,7 @@ pub unsafe extern "C" fn activity_find_by_date_range(payload_json: *const c_char
 /// Expected JSON payload:
 /// {
 ///   "query": "string",
+///   "mode": "like" | "fts",           // optional, default "like"; "fts" = ranked prefix search
 ///   "pagination": { PaginationDto },
 ///   "include": [ActivityIncludeDto, ...],
 ///   "auth": { AuthCtxDto }
@@ -914,12 +950,14 @@ pub unsafe extern "C" fn activity_search(payload_json: *const c_char, result: *m
         #[derive(Deserialize)]
         struct Payload {
             query: String,
+            #[serde(default)]
+            mode: SearchMode,
             pagination: Option<PaginationDto>,
             include: Option<Vec<ActivityIncludeDto>>,
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let params = parse_pagination(p.pagination);
         let auth: AuthContext = p.auth.try_into()?;
         
@@ -927,10 +965,10 @@ pub unsafe extern "C" fn activity_search(payload_json: *const c_char, result: *m
         let include_slice = include.as_ref().map(|v| v.as_slice());
         
         let svc = globals::get_activity_service()?;
-        let activities = block_on_async(svc.search_activities(&p.query, params, include_slice, &auth))
+        let activities = block_on_async(svc.search_activities(&p.query, params, p.mode, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&activities)
+        let json_resp = to_json_result(&activities)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -959,7 +997,7 @@ pub unsafe extern "C" fn activity_get_document_references(payload_json: *const c
         #[derive(Deserialize)]
         struct Payload { id: String, auth: AuthCtxDto }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_activity_service()?;
@@ -967,7 +1005,7 @@ pub unsafe extern "C" fn activity_get_document_references(payload_json: *const c
         let doc_refs = block_on_async(svc.get_activity_document_references(id, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&doc_refs)
+        let json_resp = to_json_result(&doc_refs)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -1001,49 +1039,23 @@ pub unsafe extern "C" fn activity_get_filtered_ids(payload_json: *const c_char,
         
         let json = CStr::from_ptr(payload_json).to_str().map_err(|_| FFIError::invalid_argument("utf8"))?;
         
-        #[derive(Deserialize)]
-        struct FilterDto {
-            status_ids: Option<Vec<i64>>,
-            project_ids: Option<Vec<String>>,
-            search_text: Option<String>,
-            date_range: Option<(String, String)>,
-            target_value_range: Option<(f64, f64)>,
-            actual_value_range: Option<(f64, f64)>,
-            exclude_deleted: Option<bool>,
-        }
-        
         #[derive(Deserialize)]
         struct Payload {
-            filter: FilterDto,
+            filter: ActivityFilterDto,
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         
-        // Convert FilterDto to ActivityFilter
-        let filter = ActivityFilter {
-            status_ids: p.filter.status_ids,
-            project_ids: p.filter.project_ids.map(|ids| {
-                ids.into_iter()
-                    .filter_map(|id| Uuid::parse_str(&id).ok())
-                    .collect()
-            }),
-            search_text: p.filter.search_text,
-            date_range: p.filter.date_range,
-            target_value_range: p.filter.target_value_range,
-            actual_value_range: p.filter.actual_value_range,
-            exclude_deleted: p.filter.exclude_deleted,
-        };
-        
         let svc = globals::get_activity_service()?;
-        let ids = block_on_async(svc.get_filtered_activity_ids(filter, &auth))
+        let ids = block_on_async(svc.get_filtered_activity_ids(p.filter.into(), &auth))
             .map_err(FFIError::from_service_error)?;
         
         // Convert UUIDs to strings for FFI
         let id_strings: Vec<String> = ids.into_iter().map(|id| id.to_string()).collect();
         
-        let json_resp = serde_json::to_string(&id_strings)
+        let json_resp = to_json_result(&id_strings)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -1073,7 +1085,7 @@ pub unsafe extern "C" fn activity_bulk_update_status(payload_json: *const c_char
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         
         // Convert string UUIDs to Uuid type
@@ -1099,7 +1111,7 @@ pub unsafe extern "C" fn activity_bulk_update_status(payload_json: *const c_char
             status_id: p.status_id,
         };
         
-        let json_resp = serde_json::to_string(&response)
+        let json_resp = to_json_result(&response)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -1124,14 +1136,14 @@ pub unsafe extern "C" fn activity_get_workload_by_project(payload_json: *const c
         #[derive(Deserialize)]
         struct Payload { auth: AuthCtxDto }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_activity_service()?;
         
         let distribution = block_on_async(svc.get_activity_workload_by_project(&auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&distribution)
+        let json_resp = to_json_result(&distribution)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -1163,7 +1175,7 @@ pub unsafe extern "C" fn activity_find_stale(payload_json: *const c_char, result
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         let params = parse_pagination(p.pagination);
         let include = parse_includes(p.include);
@@ -1173,7 +1185,7 @@ pub unsafe extern "C" fn activity_find_stale(payload_json: *const c_char, result
         let stale_activities = block_on_async(svc.find_stale_activities(p.days_stale, params, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&stale_activities)
+        let json_resp = to_json_result(&stale_activities)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -1194,14 +1206,14 @@ pub unsafe extern "C" fn activity_get_progress_analysis(payload_json: *const c_c
         #[derive(Deserialize)]
         struct Payload { auth: AuthCtxDto }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_activity_service()?;
         
         let analysis = block_on_async(svc.get_activity_progress_analysis(&auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&analysis)
+        let json_resp = to_json_result(&analysis)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -1209,6 +1221,86 @@ pub unsafe extern "C" fn activity_get_progress_analysis(payload_json: *const c_c
     })
 }
 
+// ---------------------------------------------------------------------------
+// Cursor-Based Listing
+// ---------------------------------------------------------------------------
+
+fn activity_cursor_row(row: &SqliteRow) -> FFIResult<String> {
+    let entity = ActivityRow::from_row(row)
+        .map_err(|e| FFIError::internal(format!("row {e}")))?
+        .into_entity()?;
+    to_json_result(&ActivityResponse::from(entity))
+        .map_err(|e| FFIError::internal(format!("ser {e}")))
+}
+
+static ACTIVITY_LIST_CURSOR: KeysetQuery = KeysetQuery {
+    table: "activities",
+    columns: "*",
+    sort_column: "created_at",
+    descending: false,
+    sortable: &["created_at", "updated_at", "description"],
+    map_row: activity_cursor_row,
+};
+
+/// Open a streaming cursor over the activities matching an optional filter,
+/// ordered by creation time unless `sort` names another column
+/// Expected JSON payload:
+/// {
+///   "filter": { ActivityFilterDto, as in activity_get_filtered_ids },
+///   "sort": { "field": "updated_at", "descending": true },
+///   "auth": { AuthCtxDto }
+/// }
+/// Writes an opaque handle to `cursor_out`; read batches with `cursor_next`
+/// and release it with `cursor_close` (see `src/ffi/cursor.rs`).
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn activity_list_open(payload_json: *const c_char, cursor_out: *mut u64) -> c_int {
+    handle_status_result(|| unsafe {
+        ensure_ptr!(payload_json);
+        ensure_ptr!(cursor_out);
+        
+        let json = CStr::from_ptr(payload_json).to_str().map_err(|_| FFIError::invalid_argument("utf8"))?;
+        
+        #[derive(Deserialize)]
+        struct Payload {
+            filter: Option<ActivityFilterDto>,
+            sort: Option<CursorSortDto>,
+            auth: AuthCtxDto,
+        }
+        
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let auth: AuthContext = p.auth.try_into()?;
+        auth.authorize(Permission::ViewActivities)?;
+        
+        let ids = p.filter.map(|filter| {
+            let svc = globals::get_activity_service()?;
+            block_on_async(svc.get_filtered_activity_ids(filter.into(), &auth))
+                .map_err(FFIError::from_service_error)
+        }).transpose()?;
+        *cursor_out = open_cursor(&ACTIVITY_LIST_CURSOR, p.sort, ids)?;
+        Ok(())
+    })
+}
+
+// ---------------------------------------------------------------------------
+// Async Variants
+// ---------------------------------------------------------------------------
+
+// Non-blocking versions of the calls above. They take the same payload, return
+// immediately, and invoke `callback(ctx, status, result)` from a background
+// thread once done. `result` must be freed with `activity_free`.
+
+/// Async variant of `activity_list`
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn activity_list_async(payload_json: *const c_char, ctx: *mut c_void, callback: FfiCompletionCallback) -> c_int {
+    crate::ffi::runtime::dispatch_async(activity_list, payload_json, ctx, callback)
+}
+
+/// Async variant of `activity_get_statistics`
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn activity_get_statistics_async(payload_json: *const c_char, ctx: *mut c_void, callback: FfiCompletionCallback) -> c_int {
+    crate::ffi::runtime::dispatch_async(activity_get_statistics, payload_json, ctx, callback)
+}
+
 // ---------------------------------------------------------------------------
 // Memory Management
 // ---------------------------------------------------------------------------
@@ -13,6 +13,8 @@
 
 use crate::ffi::error::{FFIError, FFIResult};
 use crate::auth::AuthContext;
+use crate::ffi::to_json_result;
+use crate::metrics::{in_phase, Phase};
 use crate::domains::user::types::{NewUser, UpdateUser, Credentials};
 use crate::validation::Validate;
 use std::ffi::{c_char, CStr, CString};
@@ -37,7 +39,10 @@ fn handle_result<F>(func: F) -> c_int
 where
     F: FnOnce() -> FFIResult<()>,
 {
-    match func() {
+    let timer = crate::metrics::begin_call::<F>();
+    let result = func();
+    timer.finish(result.is_ok());
+    match result {
         Ok(_) => {
             crate::ffi::error::clear_last_error();
             0 // Success
@@ -52,20 +57,22 @@ where
 
 /// Helper to create auth context from token
 fn create_auth_context_from_token(token: &str) -> FFIResult<AuthContext> {
-    let auth_service = crate::globals::get_auth_service()?;
-    block_on_async(auth_service.verify_token(token))
-        .map_err(|e| FFIError::internal(format!("Token verification failed: {}", e)))
+    in_phase(Phase::Auth, || {
+        let auth_service = crate::globals::get_auth_service()?;
+        block_on_async(auth_service.verify_token(token))
+            .map_err(|e| FFIError::internal(format!("Token verification failed: {}", e)))
+    })
 }
 
 /// Helper to parse JSON payload
 fn parse_json_payload<T: serde::de::DeserializeOwned>(json_str: &str) -> FFIResult<T> {
-    serde_json::from_str(json_str)
+    in_phase(Phase::Parse, || serde_json::from_str(json_str))
         .map_err(|e| FFIError::invalid_argument(&format!("Invalid JSON payload: {}", e)))
 }
 
 /// Helper to create JSON response
 fn create_json_response<T: serde::Serialize>(data: T) -> FFIResult<*mut c_char> {
-    let json_string = serde_json::to_string(&data)
+    let json_string = in_phase(Phase::Serialize, || serde_json::to_string(&data))
         .map_err(|e| FFIError::internal(format!("JSON serialization failed: {}", e)))?;
     
     let c_string = CString::new(json_string)
@@ -906,7 +913,7 @@ pub unsafe extern "C" fn login(
         "password": password_str
     });
     
-    let json_string = match serde_json::to_string(&credentials_json) {
+    let json_string = match to_json_result(&credentials_json) {
         Ok(s) => s,
         Err(_) => return handle_result(|| Err(FFIError::internal("JSON serialization failed".to_string()))),
     };
@@ -967,7 +974,7 @@ pub unsafe extern "C" fn logout(
         "refresh_token": refresh_token_str
     });
     
-    let json_string = match serde_json::to_string(&logout_json) {
+    let json_string = match to_json_result(&logout_json) {
         Ok(s) => s,
         Err(_) => return handle_result(|| Err(FFIError::internal("JSON serialization failed".to_string()))),
     };
@@ -0,0 +1,395 @@
+// src/ffi/batch.rs
+// ============================================================================
+// Multi-call batch envelope.
+//
+// A screen usually needs several small reads (`project_get`,
+// `project_get_document_references`, `funding_find_by_project`, ...). Instead
+// of one FFI round-trip each, Swift can send them together:
+//
+//     {
+//       "auth": { AuthCtxDto },              // optional, shared by every call
+//       "calls": [
+//         { "op": "project_get", "payload": { "id": "..." } },
+//         { "op": "funding_find_by_project", "payload": { ... } }
+//       ],
+//       "stop_on_error": false               // optional
+//     }
+//
+// Each call is dispatched to the entry point of the same name with its
+// payload; calls whose payload has no `auth` get the shared one. Consecutive
+// read-only calls run concurrently on the runtime's blocking pool; a write
+// runs alone, after everything before it and before everything after it, so
+// a read placed after a write sees its effect. Writes are not rolled back
+// together: each commits in its own service transaction. With
+// `stop_on_error`, calls after the first failed write are not run.
+//
+// Result: `{"results": [{"op", "status", "data", "error"}, ...]}` in call
+// order. `status` is the call's error code (0 = success), `data` its usual
+// JSON result, `error` the message from `get_last_error`. Unknown operations
+// fail individually with `InvalidArgument`. Free the string with `free_string`.
+// ============================================================================
+
+use crate::ffi::error::{ErrorCode, FFIError};
+use crate::ffi::{handle_status_result, parse_payload, to_json_result};
+use crate::ffi::runtime::{block_on_async, get_runtime, FfiJsonEntry};
+use serde::Deserialize;
+use std::collections::HashMap;
+use std::ffi::{CStr, CString};
+use std::ops::Range;
+use std::os::raw::{c_char, c_int};
+use std::sync::OnceLock;
+
+/// Upper bound on calls in one batch
+pub const MAX_BATCH_CALLS: usize = 64;
+
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+enum Access {
+    Read,
+    Write,
+}
+
+macro_rules! batch_operations {
+    (read: [$($rm:ident::$rf:ident),* $(,)?], write: [$($wm:ident::$wf:ident),* $(,)?]) => {
+        &[
+            $((stringify!($rf), Access::Read, crate::ffi::$rm::$rf as FfiJsonEntry),)*
+            $((stringify!($wf), Access::Write, crate::ffi::$wm::$wf as FfiJsonEntry),)*
+        ]
+    };
+}
+
+/// Entry points callable through a batch: the `fn(payload_json, result)`
+/// functions, without document uploads and maintenance operations
+static BATCH_OPERATIONS: &[(&str, Access, FfiJsonEntry)] = batch_operations! {
+    read: [
+        activity::activity_get, activity::activity_list, activity::activity_get_statistics,
+        activity::activity_get_status_breakdown, activity::activity_get_metadata_counts,
+        activity::activity_find_by_status, activity::activity_find_by_date_range,
+        activity::activity_search, activity::activity_get_document_references,
+        activity::activity_get_filtered_ids, activity::activity_get_workload_by_project,
+        activity::activity_find_stale, activity::activity_get_progress_analysis,
+        document::document_type_get, document::document_type_list, document::document_get,
+        document::document_list_by_entity, document::document_is_available,
+        document::document_calculate_summary, document::document_type_find_by_name,
+        document::document_find_by_date_range, document::document_get_counts_by_entities,
+        document::document_get_versions, document::document_get_access_logs,
+        donor::donor_get, donor::donor_list, donor::donor_get_summary, donor::donor_get_statistics,
+        donor::donor_get_type_distribution, donor::donor_get_country_distribution,
+        donor::donor_find_by_type, donor::donor_find_by_country,
+        donor::donor_find_with_recent_donations, donor::donor_find_by_date_range,
+        donor::donor_get_with_funding_details, donor::donor_get_with_document_timeline,
+        funding::funding_get, funding::funding_list, funding::funding_find_by_donor,
+        funding::funding_find_by_project, funding::funding_find_by_date_range,
+        funding::funding_get_analytics, funding::funding_get_by_donor_summary,
+        funding::funding_get_by_project_summary, funding::funding_get_timeline,
+        livelihood::livelihood_get, livelihood::livelihood_list,
+        livelihood::livelihood_get_subsequent_grant, livelihood::livelihood_find_by_date_range,
+        livelihood::livelihood_find_with_outcome, livelihood::livelihood_find_without_outcome,
+        livelihood::livelihood_find_with_multiple_grants, livelihood::livelihood_get_statistics,
+        livelihood::livelihood_get_outcome_distribution,
+        livelihood::livelihood_get_participant_outcome_metrics,
+        livelihood::livelihood_get_dashboard_metrics,
+        livelihood::livelihood_get_with_participant_details,
+        livelihood::livelihood_get_with_document_timeline,
+        participant::participant_get, participant::participant_list,
+        participant::participant_find_ids_by_filter, participant::participant_find_by_filter,
+        participant::participant_search_with_relationships,
+        participant::participant_get_with_enrichment,
+        participant::participant_get_comprehensive_statistics,
+        participant::participant_get_document_references,
+        participant::participant_get_index_optimization_suggestions,
+        participant::participant_find_ids_by_filter_optimized,
+        participant::participant_get_demographics,
+        participant::participant_get_gender_distribution,
+        participant::participant_get_age_group_distribution,
+        participant::participant_get_location_distribution,
+        participant::participant_get_disability_distribution,
+        participant::participant_find_by_gender, participant::participant_find_by_age_group,
+        participant::participant_find_by_location, participant::participant_find_by_disability,
+        participant::participant_get_workshop_participants,
+        participant::participant_get_with_workshops, participant::participant_get_with_livelihoods,
+        participant::participant_get_with_document_timeline,
+        participant::participant_check_duplicates,
+        project::project_get, project::project_list, project::project_get_statistics,
+        project::project_get_status_breakdown, project::project_get_metadata_counts,
+        project::project_find_by_status, project::project_find_by_responsible_team,
+        project::project_find_by_date_range, project::project_search,
+        project::project_get_with_document_timeline, project::project_get_document_references,
+        project::project_get_filtered_ids, project::project_get_team_workload_distribution,
+        project::project_get_strategic_goal_distribution, project::project_find_stale,
+        project::project_get_document_coverage_analysis, project::project_get_activity_timeline,
+        strategic_goal::strategic_goal_get, strategic_goal::strategic_goal_list,
+        strategic_goal::strategic_goal_find_by_status, strategic_goal::strategic_goal_find_by_team,
+        strategic_goal::strategic_goal_find_by_user_role,
+        strategic_goal::strategic_goal_find_stale,
+        strategic_goal::strategic_goal_find_by_date_range,
+        strategic_goal::strategic_goal_get_status_distribution,
+        strategic_goal::strategic_goal_get_value_statistics,
+        strategic_goal::strategic_goal_get_filtered_ids,
+        strategic_goal::strategic_goal_list_summaries,
+        workshop::workshop_get, workshop::workshop_list, workshop::workshop_find_by_date_range,
+        workshop::workshop_find_past, workshop::workshop_find_upcoming,
+        workshop::workshop_find_by_location, workshop::workshop_get_statistics,
+        workshop::workshop_get_budget_statistics, workshop::workshop_get_project_metrics,
+        workshop::workshop_get_participant_attendance, workshop::workshop_get_with_participants,
+        workshop::workshop_get_with_document_timeline,
+        workshop::workshop_get_budget_summaries_for_project,
+        workshop::workshop_find_participants_with_missing_evaluations,
+    ],
+    write: [
+        activity::activity_create, activity::activity_update, activity::activity_delete,
+        activity::activity_bulk_update_status,
+        document::document_type_create, document::document_type_update,
+        document::document_bulk_update_sync_priority,
+        donor::donor_create, donor::donor_update, donor::donor_delete,
+        funding::funding_create, funding::funding_update, funding::funding_delete,
+        funding::funding_create_project_funding, funding::funding_update_project_funding,
+        livelihood::livelihood_create, livelihood::livelihood_update,
+        livelihood::livelihood_delete, livelihood::livelihood_add_subsequent_grant,
+        livelihood::livelihood_update_subsequent_grant,
+        participant::participant_create, participant::participant_update,
+        participant::participant_delete,
+        participant::participant_bulk_update_sync_priority_by_filter,
+        project::project_create, project::project_update, project::project_delete,
+        strategic_goal::strategic_goal_create, strategic_goal::strategic_goal_update,
+        strategic_goal::strategic_goal_delete, strategic_goal::strategic_goal_bulk_delete,
+        workshop::workshop_create, workshop::workshop_update, workshop::workshop_delete,
+        workshop::workshop_add_participant, workshop::workshop_batch_add_participants,
+        workshop::workshop_update_participant_evaluation,
+    ]
+};
+
+fn operations() -> &'static HashMap<&'static str, (Access, FfiJsonEntry)> {
+    static OPERATIONS: OnceLock<HashMap<&'static str, (Access, FfiJsonEntry)>> = OnceLock::new();
+    OPERATIONS.get_or_init(|| {
+        BATCH_OPERATIONS
+            .iter()
+            .map(|&(name, access, entry)| (name, (access, entry)))
+            .collect()
+    })
+}
+
+#[derive(Deserialize)]
+struct BatchRequest {
+    auth: Option<serde_json::Value>,
+    calls: Vec<BatchCall>,
+    #[serde(default)]
+    stop_on_error: bool,
+}
+
+#[derive(Deserialize)]
+struct BatchCall {
+    op: String,
+    #[serde(default)]
+    payload: Option<serde_json::Value>,
+}
+
+/// A call ready to run: its entry point and NUL-terminated payload
+struct PreparedCall {
+    op: String,
+    target: Result<(Access, FfiJsonEntry, CString), String>,
+}
+
+impl PreparedCall {
+    fn access(&self) -> Access {
+        match &self.target {
+            Ok((access, _, _)) => *access,
+            // Failing calls do not touch the database; treat them as reads
+            Err(_) => Access::Read,
+        }
+    }
+}
+
+/// Outcome of one call
+struct CallOutcome {
+    status: c_int,
+    data: Option<String>,
+    error: Option<String>,
+}
+
+impl CallOutcome {
+    fn failed(code: ErrorCode, message: String) -> Self {
+        Self { status: code as c_int, data: None, error: Some(message) }
+    }
+}
+
+fn prepare(call: BatchCall, auth: Option<&serde_json::Value>) -> PreparedCall {
+    let target = (|| -> Result<(Access, FfiJsonEntry, CString), String> {
+        let &(access, entry) = operations()
+            .get(call.op.as_str())
+            .ok_or_else(|| format!("unknown batch operation '{}'", call.op))?;
+        let mut payload = call.payload.unwrap_or_else(|| serde_json::json!({}));
+        if let (Some(object), Some(auth)) = (payload.as_object_mut(), auth) {
+            object.entry("auth").or_insert_with(|| auth.clone());
+        }
+        let payload = CString::new(payload.to_string()).map_err(|e| format!("payload: {}", e))?;
+        Ok((access, entry, payload))
+    })();
+    PreparedCall { op: call.op, target }
+}
+
+/// Run one entry point on the current thread, collecting its result and,
+/// on failure, the thread's last error message
+fn run_entry(entry: FfiJsonEntry, payload: &CStr) -> CallOutcome {
+    let mut out: *mut c_char = std::ptr::null_mut();
+    let status = unsafe { entry(payload.as_ptr(), &mut out) };
+    let data = take_c_string(out);
+    let error = if status == ErrorCode::Success as c_int {
+        None
+    } else {
+        take_c_string(crate::ffi::error::get_last_error_message())
+    };
+    CallOutcome { status, data, error }
+}
+
+fn take_c_string(ptr: *mut c_char) -> Option<String> {
+    if ptr.is_null() {
+        return None;
+    }
+    let owned = unsafe { CString::from_raw(ptr) };
+    Some(owned.to_string_lossy().into_owned())
+}
+
+/// Split calls into runs to execute together: maximal runs of reads, and
+/// every write on its own
+fn plan_groups(accesses: &[Access]) -> Vec<Range<usize>> {
+    let mut groups = Vec::new();
+    let mut start = 0;
+    for (i, access) in accesses.iter().enumerate() {
+        if *access == Access::Write {
+            if start < i {
+                groups.push(start..i);
+            }
+            groups.push(i..i + 1);
+            start = i + 1;
+        }
+    }
+    if start < accesses.len() {
+        groups.push(start..accesses.len());
+    }
+    groups
+}
+
+/// Run a group: a single call inline, several reads concurrently
+fn run_group(calls: &[PreparedCall]) -> Vec<CallOutcome> {
+    if let [call] = calls {
+        return vec![match &call.target {
+            Ok((_, entry, payload)) => run_entry(*entry, payload),
+            Err(message) => CallOutcome::failed(ErrorCode::InvalidArgument, message.clone()),
+        }];
+    }
+
+    let handles: Vec<_> = calls
+        .iter()
+        .map(|call| match &call.target {
+            Ok((_, entry, payload)) => {
+                let (entry, payload) = (*entry, payload.clone());
+                Ok(get_runtime().spawn_blocking(move || run_entry(entry, &payload)))
+            }
+            Err(message) => Err(message.clone()),
+        })
+        .collect();
+
+    block_on_async(async {
+        let mut outcomes = Vec::with_capacity(handles.len());
+        for handle in handles {
+            outcomes.push(match handle {
+                Ok(task) => task.await.unwrap_or_else(|e| {
+                    CallOutcome::failed(ErrorCode::InternalError, format!("batch call panicked: {}", e))
+                }),
+                Err(message) => CallOutcome::failed(ErrorCode::InvalidArgument, message),
+            });
+        }
+        outcomes
+    })
+}
+
+fn write_outcome(out: &mut String, op: &str, outcome: &CallOutcome) {
+    use std::fmt::Write;
+
+    let op_json = to_json_result(op).unwrap_or_else(|_| "null".to_string());
+    let _ = write!(out, "{{\"op\":{},\"status\":{},\"data\":", op_json, outcome.status);
+    match outcome.data.as_deref() {
+        // Results are JSON already; splice them in rather than re-encoding
+        Some(data) if parse_payload::<serde::de::IgnoredAny>(data).is_ok() => out.push_str(data),
+        Some(data) => out.push_str(&to_json_result(data).unwrap_or_else(|_| "null".to_string())),
+        None => out.push_str("null"),
+    }
+    out.push_str(",\"error\":");
+    match outcome.error.as_deref() {
+        Some(error) => out.push_str(&to_json_result(error).unwrap_or_else(|_| "null".to_string())),
+        None => out.push_str("null"),
+    }
+    out.push('}');
+}
+
+// ============================================================================
+// Batch FFI Function
+// ============================================================================
+
+/// Execute several named operations in one call (see the module comment)
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn core_execute_batch(calls_json: *const c_char, result: *mut *mut c_char) -> c_int {
+    handle_status_result(|| unsafe {
+        if calls_json.is_null() || result.is_null() {
+            return Err(FFIError::invalid_argument("null pointer"));
+        }
+        let json = CStr::from_ptr(calls_json).to_str().map_err(|_| FFIError::invalid_argument("utf8"))?;
+        let request: BatchRequest = parse_payload(json)
+            .map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        if request.calls.len() > MAX_BATCH_CALLS {
+            return Err(FFIError::invalid_argument(&format!(
+                "batch has {} calls, at most {} are allowed",
+                request.calls.len(),
+                MAX_BATCH_CALLS
+            )));
+        }
+
+        let auth = request.auth.as_ref();
+        let calls: Vec<PreparedCall> = request.calls.into_iter().map(|call| prepare(call, auth)).collect();
+        let accesses: Vec<Access> = calls.iter().map(PreparedCall::access).collect();
+
+        let mut outcomes: Vec<CallOutcome> = Vec::with_capacity(calls.len());
+        let mut stopped = false;
+        for group in plan_groups(&accesses) {
+            if stopped {
+                for _ in group {
+                    outcomes.push(CallOutcome::failed(
+                        ErrorCode::InvalidArgument,
+                        "not run: an earlier write in the batch failed".to_string(),
+                    ));
+                }
+                continue;
+            }
+            let is_write = accesses[group.start] == Access::Write;
+            let group_outcomes = run_group(&calls[group]);
+            if is_write && request.stop_on_error && group_outcomes[0].status != ErrorCode::Success as c_int {
+                stopped = true;
+            }
+            outcomes.extend(group_outcomes);
+        }
+
+        let mut out = String::from("{\"results\":[");
+        for (i, (call, outcome)) in calls.iter().zip(&outcomes).enumerate() {
+            if i > 0 {
+                out.push(',');
+            }
+            write_outcome(&mut out, &call.op, outcome);
+        }
+        out.push_str("]}");
+
+        *result = CString::new(out).map_err(|e| FFIError::internal(format!("batch result {e}")))?.into_raw();
+        Ok(())
+    })
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn reads_are_grouped_between_writes() {
+        use Access::{Read as R, Write as W};
+        assert_eq!(plan_groups(&[R, R, W, R, W, W, R, R]), vec![0..2, 2..3, 3..4, 4..5, 5..6, 6..8]);
+        assert_eq!(operations().len(), BATCH_OPERATIONS.len(), "operation names must be unique");
+    }
+}
@@ -13,6 +13,10 @@
 //
 // JSON CONTRACTS:
 // - compress_document: {"document_id": "uuid", "config": CompressionConfig?}
+//   CompressionConfig: {"method", "quality_level", "min_size_bytes", "max_dimension"?}
+//   where max_dimension (pixels) downscales images while decoding. Without a
+//   config (and for every queued job) the document type's settings are used,
+//   with images bounded by COMPRESSION_MAX_IMAGE_DIMENSION (default 4096, 0 = off)
 // - queue_document: {"document_id": "uuid", "priority": "HIGH|NORMAL|LOW|BACKGROUND"}
 // - cancel: {"document_id": "uuid"}
 // - get_document_status: {"document_id": "uuid"}
@@ -30,12 +34,16 @@
 use crate::ffi::{handle_status_result, handle_json_result, to_ffi_error, block_on_async, FFIResult};
 use crate::ffi::error::{FFIError, ErrorCode};
 use crate::globals;
+use crate::ffi::{parse_payload, to_json_result};
+use crate::metrics::{in_phase, Phase};
 use crate::domains::compression::types::{CompressionConfig, CompressionPriority};
 use std::ffi::{CStr, CString};
-use std::os::raw::{c_char, c_int};
+use std::os::raw::{c_char, c_int, c_void};
+use crate::ffi::FfiCompletionCallback;
 use serde::{Deserialize, Serialize};
 use uuid::Uuid;
 use crate::domains::compression::service::CompressionService;
+use crate::domains::export::types::MemoryPressureLevel;
 use sqlx::Row;
 use crate::auth::AuthContext;
 use crate::types::UserRole;
@@ -167,8 +175,8 @@ fn parse_json_input<T: for<'de> Deserialize<'de>>(input: *const c_char) -> FFIRe
     }
     
     // Use from_str for better error messages and slightly better performance
-    serde_json::from_str(json_str)
-        .map_err(|e| FFIError::with_details(
+    in_phase(Phase::Parse, || serde_json::from_str(json_str))
+        .map_err(|e: serde_json::Error| FFIError::with_details(
             ErrorCode::InvalidArgument,
             "JSON parsing failed",
             &format!("Failed to parse JSON at line {}: {}", e.line(), e)
@@ -418,6 +426,14 @@ pub unsafe extern "C" fn compression_is_document_in_use(payload_json: *const c_c
     if json_result.is_null() { ErrorCode::InternalError as c_int } else { ErrorCode::Success as c_int }
 }
 
+/// Async variant of `compression_compress_document`.
+/// Returns immediately and invokes `callback(ctx, status, result)` from a
+/// background thread once done. `result` must be freed with `compression_free`.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn compression_compress_document_async(payload_json: *const c_char, ctx: *mut c_void, callback: FfiCompletionCallback) -> c_int {
+    crate::ffi::runtime::dispatch_async(compression_compress_document, payload_json, ctx, callback)
+}
+
 /// Free memory allocated by compression functions
 /// SAFETY: ptr must be a valid pointer returned by a compression function
 #[unsafe(no_mangle)]
@@ -507,6 +523,10 @@ pub unsafe extern "C" fn compression_validate_config(payload_json: *const c_char
             errors.push("Minimum size cannot be negative".to_string());
         }
         
+        if request.config.max_dimension == Some(0) {
+            errors.push("Max dimension must be greater than 0".to_string());
+        }
+        
         let valid = errors.is_empty();
         
         Ok(serde_json::json!({
@@ -911,6 +931,13 @@ pub unsafe extern "C" fn compression_handle_memory_pressure(level: c_int) -> c_i
             return Err(FFIError::invalid_argument("Memory pressure level must be 0-2"));
         }
         
+        // Cached read results are the cheapest memory to give back
+        crate::ffi::result_cache::result_cache().trim(match level {
+            0 => MemoryPressureLevel::Normal,
+            1 => MemoryPressureLevel::Warning,
+            _ => MemoryPressureLevel::Critical,
+        });
+        
                 // Get the compression worker sender directly
         let worker_sender = globals::get_compression_worker_sender()?;
         
@@ -1090,7 +1117,7 @@ pub unsafe extern "C" fn compression_reset_stuck_comprehensive(payload_json: *co
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let _auth: AuthContext = p.auth.try_into()?;
         
         let timeout_minutes = p.timeout_minutes.unwrap_or(10);
@@ -1280,7 +1307,7 @@ pub unsafe extern "C" fn compression_reset_stuck_comprehensive(payload_json: *co
         });
         
         let response = reset_result.map_err(|e: FFIError| FFIError::internal(format!("reset failed: {e}")))?;
-        let json_resp = serde_json::to_string(&response)
+        let json_resp = to_json_result(&response)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -1308,7 +1335,7 @@ pub unsafe extern "C" fn compression_reset_stuck_jobs(payload_json: *const c_cha
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let _auth: AuthContext = p.auth.try_into()?;
         
         let timeout_minutes = p.timeout_minutes.unwrap_or(10);
@@ -1362,7 +1389,7 @@ pub unsafe extern "C" fn compression_reset_stuck_jobs(payload_json: *const c_cha
         });
         
         let response = reset_result.map_err(|e: FFIError| FFIError::internal(format!("reset failed: {e}")))?;
-        let json_resp = serde_json::to_string(&response)
+        let json_resp = to_json_result(&response)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
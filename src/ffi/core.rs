@@ -3,10 +3,41 @@
 // Core FFI functions for library initialization and management
 // ============================================================================
 
-use crate::ffi::{handle_status_result, error::FFIError};
+use crate::ffi::{handle_status_result, parse_payload, to_json_result, error::FFIError};
+use crate::ffi::runtime::RuntimeConfig;
+use crate::ffi::result_buffer::ResultEncoding;
+use crate::db_profile::StorageProfile;
+use crate::ffi::result_cache::ResultCacheStats;
+use crate::metrics::{FfiSignpostCallback, PerformanceMetrics};
+use crate::startup::StartupMode;
+use serde::{Deserialize, Serialize};
 use std::ffi::{c_char, CStr, CString};
 use std::os::raw::c_int;
 
+/// Optional settings accepted by `initialize_library_with_config`.
+/// Every section is optional; omitted keys keep the historical defaults.
+/// Example:
+/// {
+///   "runtime": { "mode": "multi_thread", "worker_threads": 4, "max_blocking_threads": 16 },
+///   "storage": { "wal": true, "synchronous": "normal", "busy_timeout_ms": 5000,
+///                "mmap_size_mb": 64, "cache_size_kb": 8192,
+///                "write_connections": 4, "read_connections": 4 },
+///   "result_encoding": "json",
+///   "startup": "fast"
+/// }
+#[derive(Debug, Default, Deserialize)]
+#[serde(default)]
+pub struct LibraryConfig {
+    pub runtime: RuntimeConfig,
+    /// SQLite pragmas and pool sizes (see `src/db_profile.rs`)
+    pub storage: StorageProfile,
+    /// Encoding of `*_buf` / `*_into` results: "json" (default) or "msgpack"
+    pub result_encoding: ResultEncoding,
+    /// "eager" (default) or "fast": build services on first use and defer
+    /// seeding and workers to `library_finish_startup` (see `src/startup.rs`)
+    pub startup: StartupMode,
+}
+
 /// Initialize the library with database URL, device ID, offline mode, and JWT secret
 /// Returns 0 on success, non-zero on error
 #[unsafe(no_mangle)]
@@ -15,12 +46,56 @@ pub unsafe extern "C" fn initialize_library(
     device_id: *const c_char,
     offline_mode: bool,
     jwt_secret: *const c_char,
+) -> c_int {
+    initialize_with_config(db_url, device_id, offline_mode, jwt_secret, std::ptr::null())
+}
+
+/// Same as `initialize_library`, plus an optional JSON config (see `LibraryConfig`).
+/// `config_json` may be NULL. Must be the first FFI call for runtime settings to apply.
+/// Returns 0 on success, non-zero on error
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn initialize_library_with_config(
+    db_url: *const c_char,
+    device_id: *const c_char,
+    offline_mode: bool,
+    jwt_secret: *const c_char,
+    config_json: *const c_char,
+) -> c_int {
+    initialize_with_config(db_url, device_id, offline_mode, jwt_secret, config_json)
+}
+
+unsafe fn initialize_with_config(
+    db_url: *const c_char,
+    device_id: *const c_char,
+    offline_mode: bool,
+    jwt_secret: *const c_char,
+    config_json: *const c_char,
 ) -> c_int {
     let result = std::panic::catch_unwind(|| {
+        crate::metrics::mark_started();
         if db_url.is_null() || device_id.is_null() || jwt_secret.is_null() {
             return Err(FFIError::invalid_argument("Null pointer(s) provided for initialization"));
         }
 
+        let config: LibraryConfig = if config_json.is_null() {
+            LibraryConfig::default()
+        } else {
+            let config_str = match CStr::from_ptr(config_json).to_str() {
+                Ok(s) => s,
+                Err(_) => return Err(FFIError::invalid_argument("Invalid config_json string")),
+            };
+            match parse_payload(config_str) {
+                Ok(c) => c,
+                Err(e) => return Err(FFIError::invalid_argument(&format!("Invalid config_json: {}", e))),
+            }
+        };
+
+        // Runtime flavour must be fixed before the first block_on below
+        crate::ffi::runtime::configure_runtime(config.runtime)?;
+        crate::globals::configure_storage(config.storage)?;
+        crate::ffi::result_buffer::configure_result_encoding(config.result_encoding)?;
+        crate::startup::configure_startup_mode(config.startup);
+
         let db_url_str = match CStr::from_ptr(db_url).to_str() {
             Ok(s) => s.to_string(),
             Err(_) => return Err(FFIError::invalid_argument("Invalid db_url string")),
@@ -67,6 +142,96 @@ pub unsafe extern "C" fn initialize_library(
     }
 }
 
+/// Run the startup work deferred by `"startup": "fast"`: seed the standard
+/// document types, build the services if nothing needed them yet, and start
+/// the background workers. Call it once the first screen is on display; later
+/// calls (and calls in eager mode) do nothing. On success `result` receives
+/// the startup report (see `library_get_startup_report`).
+/// Returns allocated string that must be freed with free_string()
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn library_finish_startup(result: *mut *mut c_char) -> c_int {
+    handle_status_result(|| unsafe {
+        if result.is_null() {
+            return Err(FFIError::invalid_argument("Null result pointer provided"));
+        }
+        crate::ffi::block_on_async(crate::globals::finish_startup())?;
+        write_startup_report(result)
+    })
+}
+
+/// Get the duration of every startup phase so far, plus whether services are
+/// built and workers started:
+/// { "mode": "fast", "phases": [{ "name": "migrations", "duration_ms": 1.2 }, ...],
+///   "total_ms": 42.0, "services_ready": true, "background_started": false }
+/// Returns allocated string that must be freed with free_string()
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn library_get_startup_report(result: *mut *mut c_char) -> c_int {
+    handle_status_result(|| unsafe {
+        if result.is_null() {
+            return Err(FFIError::invalid_argument("Null result pointer provided"));
+        }
+        write_startup_report(result)
+    })
+}
+
+unsafe fn write_startup_report(result: *mut *mut c_char) -> crate::ffi::error::FFIResult<()> {
+    let json = to_json_result(&crate::globals::startup_report())
+        .map_err(|e| FFIError::internal(format!("ser {e}")))?;
+    *result = CString::new(json).unwrap().into_raw();
+    Ok(())
+}
+
+/// `core_get_performance_metrics` output: the instrumentation snapshot plus
+/// the result cache and string allocation counters
+#[derive(Serialize)]
+struct PerformanceReport {
+    #[serde(flatten)]
+    metrics: PerformanceMetrics,
+    result_cache: ResultCacheStats,
+    allocated_strings: usize,
+}
+
+/// Get call counts and latency histograms of every entry point called so far
+/// (with parse / auth / service / serialize / other phase times), the slowest
+/// SQL statements, compression and export totals, and the result cache
+/// counters (see `src/metrics.rs`):
+/// { "uptime_ms": 93000.0,
+///   "functions": [{ "name": "participant_list", "calls": 12, "errors": 0,
+///                   "total_ms": 48.0, "mean_ms": 4.0, "max_ms": 9.1,
+///                   "phases": { "parse_ms": 0.0, "auth_ms": 0.0, "service_ms": 41.2, ... },
+///                   "latency": { "p50_ms": 4.095, "p95_ms": 8.191, "p99_ms": 16.383,
+///                                "buckets": [{ "le_ms": 4.095, "count": 7 }, ...] } }, ...],
+///   "sql": [{ "sql": "SELECT ...", "calls": 30, "total_ms": 20.5, ... }, ...],
+///   "compression": { "jobs": 3, "failed": 0, "bytes_saved": 812345, ... },
+///   "export": { "completed": 1, "entities_per_second": 52000.0, ... },
+///   "result_cache": { "entries": 4, "hits": 10, ... }, "allocated_strings": 0 }
+/// Returns allocated string that must be freed with free_string()
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn core_get_performance_metrics(result: *mut *mut c_char) -> c_int {
+    handle_status_result(|| unsafe {
+        if result.is_null() {
+            return Err(FFIError::invalid_argument("Null result pointer provided"));
+        }
+        let report = PerformanceReport {
+            metrics: crate::metrics::snapshot(),
+            result_cache: crate::ffi::result_cache::result_cache().stats(),
+            allocated_strings: crate::ffi::get_allocated_string_count(),
+        };
+        let json = to_json_result(&report)
+            .map_err(|e| FFIError::internal(format!("ser {e}")))?;
+        *result = CString::new(json).unwrap().into_raw();
+        Ok(())
+    })
+}
+
+/// Forward the begin and end of every instrumented call to `callback`, e.g.
+/// to emit os_signpost intervals; NULL removes it. The name pointer is valid
+/// for the lifetime of the process.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn core_set_signpost_callback(callback: FfiSignpostCallback) {
+    crate::metrics::set_signpost_callback(callback);
+}
+
 /// Set offline mode status
 #[unsafe(no_mangle)]
 pub unsafe extern "C" fn set_offline_mode(offline_mode: bool) {
@@ -0,0 +1,301 @@
+// src/ffi/cursor.rs
+// ============================================================================
+// Cursor-based streaming list API.
+//
+// `*_list` entry points materialise a whole page as `Vec<T>` and hand it back
+// as one JSON string. For long lists Swift can instead open a cursor with the
+// matching `*_list_open` function and pull rows in batches:
+//
+//     uint64_t cursor;
+//     participant_list_open(payload_json, &cursor);
+//     while (...) { cursor_next(cursor, 200, &json); ...; cursor_free(json); }
+//     cursor_close(cursor);
+//
+// Each `cursor_next` call streams at most `n` rows from SQLite (`fetch`, not
+// `fetch_all`) using keyset pagination on `(sort column, id)`, so batch cost
+// does not grow with the position in the list and only the current batch is
+// ever held in memory.
+//
+// Batch JSON shape: `{"items": [ ... ], "done": bool}`. Once `done` is true
+// further calls return an empty batch. Items are the plain domain response
+// objects; `include` enrichment is not applied on the cursor path.
+//
+// Open payloads take the same `filter` as the domain's filter calls and an
+// optional `"sort": {"field": "...", "descending": bool}` over the columns the
+// list allows. The filter runs once at open time through the domain's filter
+// query; the matching ids bind as one JSON array on every batch, so batches
+// keep exactly the filter's semantics. Soft-deleted rows are always skipped.
+//
+// IMPORTANT – handle rules:
+//   •  Cursor handles are opaque ids, not pointers. Unknown or closed ids are
+//      rejected with `InvalidArgument`, so a double close is harmless.
+//   •  A cursor must not be advanced from two threads at once; a concurrent
+//      `cursor_next` on the same handle fails instead of blocking.
+//   •  Strings returned by `cursor_next` must be freed with `cursor_free`.
+// ============================================================================
+
+use crate::domains::core::filter_sql::json_array;
+use crate::ffi::error::{FFIError, FFIResult};
+use crate::ffi::{block_on_async, handle_status_result};
+use crate::globals;
+use futures::TryStreamExt;
+use serde::Deserialize;
+use sqlx::sqlite::SqliteRow;
+use sqlx::Row;
+use std::collections::HashMap;
+use std::ffi::CString;
+use std::os::raw::{c_char, c_int};
+use std::sync::atomic::{AtomicU64, Ordering};
+use std::sync::{Mutex, OnceLock};
+use uuid::Uuid;
+
+/// Upper bound on rows returned by a single `cursor_next` call
+pub const MAX_CURSOR_BATCH: u32 = 1000;
+
+/// Static description of a keyset-paginated list
+pub struct KeysetQuery {
+    /// Table to read; rows with `deleted_at` set are skipped
+    pub table: &'static str,
+    /// Column list for the SELECT (must include `id`)
+    pub columns: &'static str,
+    /// Default sort column; `id` is appended as a tie-breaker for a stable order
+    pub sort_column: &'static str,
+    pub descending: bool,
+    /// Columns a payload `sort` may name (column names cannot be bound)
+    pub sortable: &'static [&'static str],
+    /// Serialize one row into the JSON item handed to Swift
+    pub map_row: fn(&SqliteRow) -> FFIResult<String>,
+}
+
+/// Optional `sort` of a `*_list_open` payload
+#[derive(Debug, Deserialize)]
+pub struct CursorSortDto {
+    pub field: String,
+    #[serde(default)]
+    pub descending: bool,
+}
+
+/// Position of an open cursor
+struct ListCursor {
+    query: &'static KeysetQuery,
+    sort_column: &'static str,
+    descending: bool,
+    /// JSON array of the ids matching the payload filter; `None` lists every row
+    ids: Option<String>,
+    /// `(sort key, id)` of the last row handed out
+    last_key: Option<(String, String)>,
+    done: bool,
+}
+
+impl ListCursor {
+    fn sql(&self, after_key: bool) -> String {
+        let (cmp, dir) = if self.descending { ("<", "DESC") } else { (">", "ASC") };
+        let sort = format!("COALESCE({}, '')", self.sort_column);
+
+        let mut sql = format!(
+            "SELECT {}, {} AS cursor_sort_key FROM {} WHERE deleted_at IS NULL",
+            self.query.columns, sort, self.query.table
+        );
+        if self.ids.is_some() {
+            sql.push_str(" AND id IN (SELECT value FROM json_each(?))");
+        }
+        if after_key {
+            sql.push_str(&format!(" AND ({sort} {cmp} ? OR ({sort} = ? AND id {cmp} ?))"));
+        }
+        sql.push_str(&format!(" ORDER BY {sort} {dir}, id {dir} LIMIT ?"));
+        sql
+    }
+
+    async fn next_batch(&mut self, n: u32) -> FFIResult<String> {
+        if self.done {
+            return Ok("{\"items\":[],\"done\":true}".to_string());
+        }
+
+        let pool = globals::get_db_read_pool()?;
+        let after = self.last_key.clone();
+        let sql = self.sql(after.is_some());
+
+        let mut query = sqlx::query(&sql);
+        if let Some(ids) = &self.ids {
+            query = query.bind(ids);
+        }
+        if let Some((key, id)) = &after {
+            query = query.bind(key).bind(key).bind(id);
+        }
+        query = query.bind(n as i64);
+
+        let mut out = String::from("{\"items\":[");
+        let mut count = 0u32;
+        let mut rows = query.fetch(&pool);
+        while let Some(row) = rows
+            .try_next()
+            .await
+            .map_err(|e| FFIError::internal(format!("cursor fetch {e}")))?
+        {
+            let key: String = row
+                .try_get("cursor_sort_key")
+                .map_err(|e| FFIError::internal(format!("cursor key {e}")))?;
+            let id: String = row
+                .try_get("id")
+                .map_err(|e| FFIError::internal(format!("cursor id {e}")))?;
+
+            if count > 0 {
+                out.push(',');
+            }
+            out.push_str(&(self.query.map_row)(&row)?);
+            self.last_key = Some((key, id));
+            count += 1;
+        }
+
+        self.done = count < n;
+        out.push_str(if self.done { "],\"done\":true}" } else { "],\"done\":false}" });
+        Ok(out)
+    }
+}
+
+static CURSORS: OnceLock<Mutex<HashMap<u64, Option<ListCursor>>>> = OnceLock::new();
+static NEXT_CURSOR_ID: AtomicU64 = AtomicU64::new(1);
+
+fn cursors() -> &'static Mutex<HashMap<u64, Option<ListCursor>>> {
+    CURSORS.get_or_init(|| Mutex::new(HashMap::new()))
+}
+
+/// Register a new cursor positioned before the first row; returns its handle.
+/// `ids` restricts the rows to the result of a filter query.
+pub fn open_cursor(
+    query: &'static KeysetQuery,
+    sort: Option<CursorSortDto>,
+    ids: Option<Vec<Uuid>>,
+) -> FFIResult<u64> {
+    let cursor = new_cursor(query, sort, ids)?;
+    let id = NEXT_CURSOR_ID.fetch_add(1, Ordering::Relaxed);
+    cursors().lock().unwrap().insert(id, Some(cursor));
+    Ok(id)
+}
+
+fn new_cursor(
+    query: &'static KeysetQuery,
+    sort: Option<CursorSortDto>,
+    ids: Option<Vec<Uuid>>,
+) -> FFIResult<ListCursor> {
+    let (sort_column, descending) = match sort {
+        None => (query.sort_column, query.descending),
+        Some(sort) => {
+            let column = query
+                .sortable
+                .iter()
+                .copied()
+                .find(|c| *c == sort.field)
+                .ok_or_else(|| FFIError::invalid_argument(&format!("cannot sort by {}", sort.field)))?;
+            (column, sort.descending)
+        }
+    };
+    Ok(ListCursor {
+        query,
+        sort_column,
+        descending,
+        ids: ids.map(|ids| json_array(&ids)),
+        last_key: None,
+        done: false,
+    })
+}
+
+// ============================================================================
+// Cursor FFI Functions
+// ============================================================================
+
+/// Fetch the next batch of at most `n` rows (clamped to `MAX_CURSOR_BATCH`)
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn cursor_next(cursor: u64, n: u32, result: *mut *mut c_char) -> c_int {
+    handle_status_result(|| unsafe {
+        if result.is_null() {
+            return Err(FFIError::invalid_argument("null pointer"));
+        }
+        if n == 0 {
+            return Err(FFIError::invalid_argument("batch size must be positive"));
+        }
+
+        // Check the cursor out so the registry lock is not held across the query
+        let mut list_cursor = {
+            let mut map = cursors().lock().unwrap();
+            match map.get_mut(&cursor) {
+                Some(slot) => slot
+                    .take()
+                    .ok_or_else(|| FFIError::invalid_argument("cursor is busy"))?,
+                None => return Err(FFIError::invalid_argument("unknown cursor")),
+            }
+        };
+
+        let batch = block_on_async(list_cursor.next_batch(n.min(MAX_CURSOR_BATCH)));
+
+        // Put it back unless it was closed meanwhile
+        if let Some(slot) = cursors().lock().unwrap().get_mut(&cursor) {
+            *slot = Some(list_cursor);
+        }
+
+        let cstr = CString::new(batch?).unwrap();
+        *result = cstr.into_raw();
+        Ok(())
+    })
+}
+
+/// Close a cursor and release its state
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn cursor_close(cursor: u64) -> c_int {
+    handle_status_result(|| {
+        cursors()
+            .lock()
+            .unwrap()
+            .remove(&cursor)
+            .map(|_| ())
+            .ok_or_else(|| FFIError::invalid_argument("unknown cursor"))
+    })
+}
+
+/// Free a batch string returned by `cursor_next`
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn cursor_free(ptr: *mut c_char) {
+    if !ptr.is_null() {
+        unsafe {
+            let _ = CString::from_raw(ptr);
+        }
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn no_row(_: &SqliteRow) -> FFIResult<String> {
+        Ok(String::new())
+    }
+
+    static TEST_CURSOR: KeysetQuery = KeysetQuery {
+        table: "projects",
+        columns: "*",
+        sort_column: "name",
+        descending: false,
+        sortable: &["name", "updated_at"],
+        map_row: no_row,
+    };
+
+    #[test]
+    fn filter_and_sort_shape_the_batch_query() {
+        let sort = CursorSortDto { field: "updated_at".to_string(), descending: true };
+        let cursor = new_cursor(&TEST_CURSOR, Some(sort), Some(vec![Uuid::nil()])).unwrap();
+        assert_eq!(cursor.ids.as_deref(), Some(r#"["00000000-0000-0000-0000-000000000000"]"#));
+        assert_eq!(
+            cursor.sql(true),
+            "SELECT *, COALESCE(updated_at, '') AS cursor_sort_key FROM projects WHERE deleted_at IS NULL \
+             AND id IN (SELECT value FROM json_each(?)) \
+             AND (COALESCE(updated_at, '') < ? OR (COALESCE(updated_at, '') = ? AND id < ?)) \
+             ORDER BY COALESCE(updated_at, '') DESC, id DESC LIMIT ?"
+        );
+    }
+
+    #[test]
+    fn unknown_sort_columns_are_rejected() {
+        let sort = CursorSortDto { field: "name; DROP TABLE projects".to_string(), descending: false };
+        assert!(new_cursor(&TEST_CURSOR, Some(sort), None).is_err());
+    }
+}
@@ -22,7 +22,8 @@
 //   of each payload is documented above every function.
 // ----------------------------------------------------------------------------
 
-use crate::ffi::{handle_status_result, error::FFIError};
+use crate::ffi::{handle_status_result, parse_payload, to_json_result, error::FFIError};
+use crate::ffi::result_cache;
 use crate::domains::document::types::{
     NewDocumentType, UpdateDocumentType, DocumentTypeResponse, MediaDocumentResponse,
     DocumentSummary
@@ -150,14 +151,14 @@ pub unsafe extern "C" fn document_type_create(payload_json: *const c_char, resul
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_document_service()?;
         
         let doc_type = block_on_async(svc.create_document_type(&auth, p.document_type))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&doc_type)
+        let json_resp = to_json_result(&doc_type)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -182,7 +183,7 @@ pub unsafe extern "C" fn document_type_get(payload_json: *const c_char, result:
         #[derive(Deserialize)]
         struct Payload { id: String, auth: AuthCtxDto }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let _auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_document_service()?;
@@ -190,7 +191,7 @@ pub unsafe extern "C" fn document_type_get(payload_json: *const c_char, result:
         let doc_type = block_on_async(svc.get_document_type_by_id(id))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&doc_type)
+        let json_resp = to_json_result(&doc_type)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -218,16 +219,15 @@ pub unsafe extern "C" fn document_type_list(payload_json: *const c_char, result:
             auth: AuthCtxDto 
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let params = p.pagination.map(|p| p.into()).unwrap_or_default();
-        let _auth: AuthContext = p.auth.try_into()?;
-        let svc = globals::get_document_service()?;
-        
-        let doc_types = block_on_async(svc.list_document_types(params))
-            .map_err(FFIError::from_service_error)?;
-        
-        let json_resp = serde_json::to_string(&doc_types)
-            .map_err(|e| FFIError::internal(format!("ser {e}")))?;
+        let auth: AuthContext = p.auth.try_into()?;
+        let json_resp = result_cache::cached_json("document_type_list", result_cache::cache_args(json), &auth, &["document_types"], || {
+            let svc = globals::get_document_service()?;
+            let doc_types = block_on_async(svc.list_document_types(params))
+                .map_err(FFIError::from_service_error)?;
+            to_json_result(&doc_types).map_err(|e| FFIError::internal(format!("ser {e}")))
+        })?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
         Ok(())
@@ -256,7 +256,7 @@ pub unsafe extern "C" fn document_type_update(payload_json: *const c_char, resul
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_document_service()?;
@@ -264,7 +264,7 @@ pub unsafe extern "C" fn document_type_update(payload_json: *const c_char, resul
         let doc_type = block_on_async(svc.update_document_type(&auth, id, p.update))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&doc_type)
+        let json_resp = to_json_result(&doc_type)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -284,7 +284,7 @@ pub unsafe extern "C" fn document_type_delete(payload_json: *const c_char) -> c_
         ensure_ptr!(payload_json);
         let json = CStr::from_ptr(payload_json).to_str().map_err(|_| FFIError::invalid_argument("utf8"))?;
         #[derive(Deserialize)] struct Payload { id: String, auth: AuthCtxDto }
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_document_service()?;
@@ -335,7 +335,7 @@ pub unsafe extern "C" fn document_upload(payload_json: *const c_char, result: *m
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         
         // Decode base64 file data
         let file_data = base64::decode(&p.file_data)
@@ -374,7 +374,7 @@ pub unsafe extern "C" fn document_upload(payload_json: *const c_char, result: *m
             temp_related_id,
         )).map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&document)
+        let json_resp = to_json_result(&document)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -422,7 +422,7 @@ pub unsafe extern "C" fn document_bulk_upload(payload_json: *const c_char, resul
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         
         // Decode all files
         let mut files = Vec::new();
@@ -463,7 +463,7 @@ pub unsafe extern "C" fn document_bulk_upload(payload_json: *const c_char, resul
             temp_related_id,
         )).map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&documents)
+        let json_resp = to_json_result(&documents)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -493,7 +493,7 @@ pub unsafe extern "C" fn document_get(payload_json: *const c_char, result: *mut
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         
@@ -506,7 +506,7 @@ pub unsafe extern "C" fn document_get(payload_json: *const c_char, result: *mut
         let document = block_on_async(svc.get_media_document_by_id(&auth, id, include_slice))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&document)
+        let json_resp = to_json_result(&document)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -540,7 +540,7 @@ pub unsafe extern "C" fn document_list_by_entity(payload_json: *const c_char, re
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let related_id = Uuid::parse_str(&p.related_id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let params = p.pagination.map(|p| p.into()).unwrap_or_default();
         let auth: AuthContext = p.auth.try_into()?;
@@ -555,7 +555,7 @@ pub unsafe extern "C" fn document_list_by_entity(payload_json: *const c_char, re
             &auth, &p.related_table, related_id, params, include_slice
         )).map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&documents)
+        let json_resp = to_json_result(&documents)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -580,7 +580,7 @@ pub unsafe extern "C" fn document_download(payload_json: *const c_char, result:
         #[derive(Deserialize)]
         struct Payload { id: String, auth: AuthCtxDto }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_document_service()?;
@@ -599,7 +599,7 @@ pub unsafe extern "C" fn document_download(payload_json: *const c_char, result:
             data: data.map(|d| base64::encode(d)),
         };
         
-        let json_resp = serde_json::to_string(&response)
+        let json_resp = to_json_result(&response)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -624,7 +624,7 @@ pub unsafe extern "C" fn document_open(payload_json: *const c_char, result: *mut
         #[derive(Deserialize)]
         struct Payload { id: String, auth: AuthCtxDto }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_document_service()?;
@@ -639,7 +639,7 @@ pub unsafe extern "C" fn document_open(payload_json: *const c_char, result: *mut
         
         let response = OpenResponse { file_path };
         
-        let json_resp = serde_json::to_string(&response)
+        let json_resp = to_json_result(&response)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -664,7 +664,7 @@ pub unsafe extern "C" fn document_is_available(payload_json: *const c_char, resu
         #[derive(Deserialize)]
         struct Payload { id: String, auth: AuthCtxDto }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let _auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_document_service()?;
@@ -679,7 +679,7 @@ pub unsafe extern "C" fn document_is_available(payload_json: *const c_char, resu
         
         let response = AvailabilityResponse { is_available };
         
-        let json_resp = serde_json::to_string(&response)
+        let json_resp = to_json_result(&response)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -699,7 +699,7 @@ pub unsafe extern "C" fn document_delete(payload_json: *const c_char) -> c_int {
         ensure_ptr!(payload_json);
         let json = CStr::from_ptr(payload_json).to_str().map_err(|_| FFIError::invalid_argument("utf8"))?;
         #[derive(Deserialize)] struct Payload { id: String, auth: AuthCtxDto }
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_document_service()?;
@@ -730,7 +730,7 @@ pub unsafe extern "C" fn document_calculate_summary(payload_json: *const c_char,
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let related_id = Uuid::parse_str(&p.related_id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_document_service()?;
@@ -739,7 +739,7 @@ pub unsafe extern "C" fn document_calculate_summary(payload_json: *const c_char,
             &auth, &p.related_table, related_id
         )).map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&summary)
+        let json_resp = to_json_result(&summary)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -771,7 +771,7 @@ pub unsafe extern "C" fn document_link_temp(payload_json: *const c_char, result:
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let temp_related_id = Uuid::parse_str(&p.temp_related_id)
             .map_err(|_| FFIError::invalid_argument("invalid temp_related_id"))?;
         let final_related_id = Uuid::parse_str(&p.final_related_id)
@@ -790,7 +790,7 @@ pub unsafe extern "C" fn document_link_temp(payload_json: *const c_char, result:
         
         let response = LinkResponse { linked_count: count };
         
-        let json_resp = serde_json::to_string(&response)
+        let json_resp = to_json_result(&response)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -822,7 +822,7 @@ pub unsafe extern "C" fn document_register_in_use(payload_json: *const c_char) -
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let document_id = Uuid::parse_str(&p.document_id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let user_id = Uuid::parse_str(&p.user_id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let device_id = Uuid::parse_str(&p.device_id).map_err(|_| FFIError::invalid_argument("uuid"))?;
@@ -857,7 +857,7 @@ pub unsafe extern "C" fn document_unregister_in_use(payload_json: *const c_char)
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let document_id = Uuid::parse_str(&p.document_id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let user_id = Uuid::parse_str(&p.user_id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let device_id = Uuid::parse_str(&p.device_id).map_err(|_| FFIError::invalid_argument("uuid"))?;
@@ -894,7 +894,7 @@ pub unsafe extern "C" fn document_type_find_by_name(payload_json: *const c_char,
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let _auth: AuthContext = p.auth.try_into()?;
         let repo = globals::get_document_type_repo()?;
         
@@ -903,7 +903,7 @@ pub unsafe extern "C" fn document_type_find_by_name(payload_json: *const c_char,
         
         let json_resp = match doc_type_option {
             Some(doc_type) => {
-                serde_json::to_string(&doc_type)
+                to_json_result(&doc_type)
                     .map_err(|e| FFIError::internal(format!("ser {e}")))?
             }
             None => {
@@ -942,7 +942,7 @@ pub unsafe extern "C" fn document_find_by_date_range(payload_json: *const c_char
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let start_date = chrono::DateTime::parse_from_rfc3339(&p.start_date)
             .map_err(|_| FFIError::invalid_argument("invalid start_date format"))?
             .with_timezone(&chrono::Utc);
@@ -956,7 +956,7 @@ pub unsafe extern "C" fn document_find_by_date_range(payload_json: *const c_char
         let documents = block_on_async(repo.find_by_date_range(start_date, end_date, params))
             .map_err(FFIError::from)?;
         
-        let json_resp = serde_json::to_string(&documents)
+        let json_resp = to_json_result(&documents)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -985,7 +985,7 @@ pub unsafe extern "C" fn document_get_counts_by_entities(payload_json: *const c_
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let entity_ids: Result<Vec<Uuid>, _> = p.related_entity_ids.iter()
             .map(|s| Uuid::parse_str(s))
             .collect();
@@ -1010,7 +1010,7 @@ pub unsafe extern "C" fn document_get_counts_by_entities(payload_json: *const c_
             })
             .collect();
         
-        let json_resp = serde_json::to_string(&response)
+        let json_resp = to_json_result(&response)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -1040,7 +1040,7 @@ pub unsafe extern "C" fn document_bulk_update_sync_priority(payload_json: *const
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let document_ids: Result<Vec<Uuid>, _> = p.document_ids.iter()
             .map(|s| Uuid::parse_str(s))
             .collect();
@@ -1060,7 +1060,7 @@ pub unsafe extern "C" fn document_bulk_update_sync_priority(payload_json: *const
         
         let response = UpdateResponse { updated_count };
         
-        let json_resp = serde_json::to_string(&response)
+        let json_resp = to_json_result(&response)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -1088,7 +1088,7 @@ pub unsafe extern "C" fn document_get_versions(payload_json: *const c_char, resu
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let document_id = Uuid::parse_str(&p.document_id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let _auth: AuthContext = p.auth.try_into()?;
         
@@ -1098,7 +1098,7 @@ pub unsafe extern "C" fn document_get_versions(payload_json: *const c_char, resu
         let versions = block_on_async(doc_ver_repo.find_by_document_id(document_id))
             .map_err(FFIError::from)?;
         
-        let json_resp = serde_json::to_string(&versions)
+        let json_resp = to_json_result(&versions)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -1128,7 +1128,7 @@ pub unsafe extern "C" fn document_get_access_logs(payload_json: *const c_char, r
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let document_id = Uuid::parse_str(&p.document_id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let params = p.pagination.map(|p| p.into()).unwrap_or_default();
         let _auth: AuthContext = p.auth.try_into()?;
@@ -1139,7 +1139,7 @@ pub unsafe extern "C" fn document_get_access_logs(payload_json: *const c_char, r
         let logs = block_on_async(doc_log_repo.find_by_document_id(document_id, params))
             .map_err(FFIError::from)?;
         
-        let json_resp = serde_json::to_string(&logs)
+        let json_resp = to_json_result(&logs)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -1189,7 +1189,7 @@ pub unsafe extern "C" fn document_upload_from_path(payload_json: *const c_char,
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         
         println!("🚀 [FFI] Processing upload from path: {}", p.file_path);
         
@@ -1234,7 +1234,7 @@ pub unsafe extern "C" fn document_upload_from_path(payload_json: *const c_char,
 
         println!("✅ [FFI] Path-based upload completed successfully");
 
-        let json_resp = serde_json::to_string(&document)
+        let json_resp = to_json_result(&document)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -1285,7 +1285,7 @@ pub unsafe extern "C" fn document_bulk_upload_from_paths(payload_json: *const c_
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         
         println!("🚀 [FFI] Processing bulk upload from {} paths", p.file_paths.len());
         
@@ -1334,7 +1334,7 @@ pub unsafe extern "C" fn document_bulk_upload_from_paths(payload_json: *const c_
 
         println!("✅ [FFI] Bulk path-based upload completed successfully: {} documents", documents.len());
 
-        let json_resp = serde_json::to_string(&documents)
+        let json_resp = to_json_result(&documents)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -1342,6 +1342,289 @@ pub unsafe extern "C" fn document_bulk_upload_from_paths(payload_json: *const c_
     })
 }
 
+// ---------------------------------------------------------------------------
+// Binary Upload/Download FFI Functions (raw bytes, no base64 in JSON)
+// ---------------------------------------------------------------------------
+//
+// The file bytes travel as a `(const uint8_t* data, size_t len)` pair next to
+// a small metadata JSON, so a photo is never inflated by base64, copied into a
+// CString or parsed by serde. Input buffers stay owned by Swift and are only
+// borrowed for the duration of the call. Buffers returned by
+// `document_download_bytes` are owned by Rust and must be released with
+// `document_buffer_free`.
+
+/// Borrow a caller-owned byte buffer for the duration of an FFI call
+unsafe fn borrow_bytes<'a>(data: *const u8, len: usize) -> Result<&'a [u8], FFIError> {
+    if len == 0 {
+        return Ok(&[]);
+    }
+    if data.is_null() {
+        return Err(FFIError::invalid_argument("null data pointer"));
+    }
+    Ok(unsafe { std::slice::from_raw_parts(data, len) })
+}
+
+/// Upload a single document from a raw byte buffer
+/// Expected metadata JSON (same as `document_upload` without `file_data`):
+/// {
+///   "original_filename": "string",
+///   "title": "optional_string",
+///   "document_type_id": "uuid",
+///   "related_entity_id": "uuid",
+///   "related_entity_type": "string",
+///   "linked_field": "optional_string",
+///   "sync_priority": "HIGH|NORMAL|LOW",
+///   "compression_priority": "HIGH|NORMAL|LOW",
+///   "temp_related_id": "optional_uuid",
+///   "auth": { AuthCtxDto }
+/// }
+/// `data`/`len` describe the file contents; the buffer is not retained.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn document_upload_bytes(
+    metadata_json: *const c_char,
+    data: *const u8,
+    len: usize,
+    result: *mut *mut c_char,
+) -> c_int {
+    handle_status_result(|| unsafe {
+        ensure_ptr!(metadata_json);
+        ensure_ptr!(result);
+        
+        let json = CStr::from_ptr(metadata_json).to_str().map_err(|_| FFIError::invalid_argument("utf8"))?;
+        let bytes = borrow_bytes(data, len)?;
+        
+        #[derive(Deserialize)]
+        struct Payload {
+            original_filename: String,
+            title: Option<String>,
+            document_type_id: String,
+            related_entity_id: String,
+            related_entity_type: String,
+            linked_field: Option<String>,
+            sync_priority: String,
+            compression_priority: Option<String>,
+            temp_related_id: Option<String>,
+            auth: AuthCtxDto,
+        }
+        
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        
+        let document_type_id = Uuid::parse_str(&p.document_type_id)
+            .map_err(|_| FFIError::invalid_argument("invalid document_type_id"))?;
+        let related_entity_id = Uuid::parse_str(&p.related_entity_id)
+            .map_err(|_| FFIError::invalid_argument("invalid related_entity_id"))?;
+        let temp_related_id = p.temp_related_id.as_ref()
+            .map(|s| Uuid::parse_str(s))
+            .transpose()
+            .map_err(|_| FFIError::invalid_argument("invalid temp_related_id"))?;
+        
+        let sync_priority = SyncPriority::from_str(&p.sync_priority)
+            .map_err(|_| FFIError::invalid_argument("invalid sync_priority"))?;
+        let compression_priority = p.compression_priority.as_ref()
+            .map(|s| CompressionPriority::from_str(s))
+            .transpose()
+            .map_err(|_| FFIError::invalid_argument("invalid compression_priority"))?;
+        
+        let auth: AuthContext = p.auth.try_into()?;
+        let svc = globals::get_document_service()?;
+        
+        // Single copy out of the Swift-owned buffer; ownership moves into storage
+        let document = block_on_async(svc.upload_document(
+            &auth,
+            bytes.to_vec(),
+            p.original_filename,
+            p.title,
+            document_type_id,
+            related_entity_id,
+            p.related_entity_type,
+            p.linked_field,
+            sync_priority,
+            compression_priority,
+            temp_related_id,
+        )).map_err(FFIError::from_service_error)?;
+        
+        let json_resp = to_json_result(&document)
+            .map_err(|e| FFIError::internal(format!("ser {e}")))?;
+        let cstr = CString::new(json_resp).unwrap();
+        *result = cstr.into_raw();
+        Ok(())
+    })
+}
+
+/// Bulk upload documents from raw byte buffers
+/// Expected metadata JSON:
+/// {
+///   "filenames": ["string", ...],       // one per buffer, same order
+///   "title": "optional_string",
+///   "document_type_id": "uuid",
+///   "related_entity_id": "uuid",
+///   "related_entity_type": "string",
+///   "sync_priority": "HIGH|NORMAL|LOW",
+///   "compression_priority": "HIGH|NORMAL|LOW",
+///   "temp_related_id": "optional_uuid",
+///   "auth": { AuthCtxDto }
+/// }
+/// `data[i]`/`lens[i]` describe file `i` for `i < count`. Files are copied and
+/// stored one at a time, so Rust never holds more than one file in memory.
+/// Like `document_bulk_upload`, files that fail are skipped and the response
+/// lists the documents that were stored.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn document_bulk_upload_bytes(
+    metadata_json: *const c_char,
+    data: *const *const u8,
+    lens: *const usize,
+    count: usize,
+    result: *mut *mut c_char,
+) -> c_int {
+    handle_status_result(|| unsafe {
+        ensure_ptr!(metadata_json);
+        ensure_ptr!(result);
+        if count > 0 {
+            ensure_ptr!(data);
+            ensure_ptr!(lens);
+        }
+        
+        let json = CStr::from_ptr(metadata_json).to_str().map_err(|_| FFIError::invalid_argument("utf8"))?;
+        
+        #[derive(Deserialize)]
+        struct Payload {
+            filenames: Vec<String>,
+            title: Option<String>,
+            document_type_id: String,
+            related_entity_id: String,
+            related_entity_type: String,
+            sync_priority: String,
+            compression_priority: Option<String>,
+            temp_related_id: Option<String>,
+            auth: AuthCtxDto,
+        }
+        
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        if p.filenames.len() != count {
+            return Err(FFIError::invalid_argument("filenames length does not match buffer count"));
+        }
+        
+        // Validate every buffer before storing anything
+        let (buffers, buffer_lens) = if count > 0 {
+            (std::slice::from_raw_parts(data, count), std::slice::from_raw_parts(lens, count))
+        } else {
+            (&[][..], &[][..])
+        };
+        let files: Vec<&[u8]> = buffers.iter().zip(buffer_lens)
+            .map(|(&ptr, &len)| borrow_bytes(ptr, len))
+            .collect::<Result<_, _>>()?;
+        
+        let document_type_id = Uuid::parse_str(&p.document_type_id)
+            .map_err(|_| FFIError::invalid_argument("invalid document_type_id"))?;
+        let related_entity_id = Uuid::parse_str(&p.related_entity_id)
+            .map_err(|_| FFIError::invalid_argument("invalid related_entity_id"))?;
+        let temp_related_id = p.temp_related_id.as_ref()
+            .map(|s| Uuid::parse_str(s))
+            .transpose()
+            .map_err(|_| FFIError::invalid_argument("invalid temp_related_id"))?;
+        
+        let sync_priority = SyncPriority::from_str(&p.sync_priority)
+            .map_err(|_| FFIError::invalid_argument("invalid sync_priority"))?;
+        let compression_priority = p.compression_priority.as_ref()
+            .map(|s| CompressionPriority::from_str(s))
+            .transpose()
+            .map_err(|_| FFIError::invalid_argument("invalid compression_priority"))?;
+        
+        let auth: AuthContext = p.auth.try_into()?;
+        let svc = globals::get_document_service()?;
+        
+        let mut documents = Vec::with_capacity(count);
+        for (bytes, filename) in files.into_iter().zip(p.filenames) {
+            let uploaded = block_on_async(svc.bulk_upload_documents(
+                &auth,
+                vec![(bytes.to_vec(), filename)],
+                p.title.clone(),
+                document_type_id,
+                related_entity_id,
+                p.related_entity_type.clone(),
+                sync_priority,
+                compression_priority,
+                temp_related_id,
+            )).map_err(FFIError::from_service_error)?;
+            documents.extend(uploaded);
+        }
+        
+        let json_resp = to_json_result(&documents)
+            .map_err(|e| FFIError::internal(format!("ser {e}")))?;
+        let cstr = CString::new(json_resp).unwrap();
+        *result = cstr.into_raw();
+        Ok(())
+    })
+}
+
+/// Download a document into a Rust-owned byte buffer
+/// Expected JSON payload:
+/// {
+///   "id": "uuid",
+///   "auth": { AuthCtxDto }
+/// }
+/// On success `*out_data`/`*out_len` hold the file contents (NULL/0 when the
+/// file is not available locally) and `*result` is
+/// `{"filename": "string", "size": n, "available": bool}`.
+/// Release the buffer with `document_buffer_free(data, len)` and the JSON with
+/// `document_free`. Callers that only need to display the file should prefer
+/// `document_open`, which returns a local path without reading the bytes.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn document_download_bytes(
+    payload_json: *const c_char,
+    out_data: *mut *mut u8,
+    out_len: *mut usize,
+    result: *mut *mut c_char,
+) -> c_int {
+    handle_status_result(|| unsafe {
+        ensure_ptr!(payload_json);
+        ensure_ptr!(out_data);
+        ensure_ptr!(out_len);
+        ensure_ptr!(result);
+        
+        *out_data = std::ptr::null_mut();
+        *out_len = 0;
+        
+        let json = CStr::from_ptr(payload_json).to_str().map_err(|_| FFIError::invalid_argument("utf8"))?;
+        
+        #[derive(Deserialize)]
+        struct Payload { id: String, auth: AuthCtxDto }
+        
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
+        let auth: AuthContext = p.auth.try_into()?;
+        let svc = globals::get_document_service()?;
+        
+        let (filename, data) = block_on_async(svc.download_document(&auth, id))
+            .map_err(FFIError::from_service_error)?;
+        
+        #[derive(Serialize)]
+        struct DownloadBytesResponse {
+            filename: String,
+            size: usize,
+            available: bool,
+        }
+        
+        let response = DownloadBytesResponse {
+            filename,
+            size: data.as_ref().map_or(0, |d| d.len()),
+            available: data.is_some(),
+        };
+        
+        let json_resp = to_json_result(&response)
+            .map_err(|e| FFIError::internal(format!("ser {e}")))?;
+        let cstr = CString::new(json_resp).unwrap();
+        
+        if let Some(bytes) = data {
+            let boxed = bytes.into_boxed_slice();
+            *out_len = boxed.len();
+            *out_data = Box::into_raw(boxed) as *mut u8;
+        }
+        *result = cstr.into_raw();
+        Ok(())
+    })
+}
+
 // ---------------------------------------------------------------------------
 // Memory Management
 // ---------------------------------------------------------------------------
@@ -1357,3 +1640,14 @@ pub unsafe extern "C" fn document_free(ptr: *mut c_char) {
     }
 }
 
+/// Free a byte buffer returned by `document_download_bytes`
+/// `len` must be the length that was returned alongside the buffer
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn document_buffer_free(data: *mut u8, len: usize) {
+    if !data.is_null() {
+        unsafe {
+            let _ = Box::from_raw(std::ptr::slice_from_raw_parts_mut(data, len));
+        }
+    }
+}
+
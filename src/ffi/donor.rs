@@ -22,20 +22,24 @@
 //   of each payload is documented above every function.
 // ----------------------------------------------------------------------------
 
-use crate::ffi::{handle_status_result, error::FFIError};
+use crate::ffi::{handle_status_result, parse_payload, to_json_result, error::{FFIError, FFIResult}};
+use crate::ffi::cursor::{open_cursor, CursorSortDto, KeysetQuery};
 use crate::domains::donor::types::{
-    NewDonor, UpdateDonor, DonorResponse, DonorInclude, DonorSummary,
-    DonorDashboardStats, DonorWithFundingDetails, DonorWithDocumentTimeline
+    DonorRow, NewDonor, UpdateDonor, DonorResponse, DonorInclude, DonorSummary,
+    DonorDashboardStats, DonorWithFundingDetails, DonorWithDocumentTimeline, DonorFilter
 };
 use crate::domains::sync::types::SyncPriority;
 use crate::domains::compression::types::CompressionPriority;
 use crate::auth::AuthContext;
-use crate::types::{UserRole, PaginationParams};
+use crate::types::{UserRole, Permission, PaginationParams};
 use crate::globals;
 
 use std::ffi::{CStr, CString};
-use std::os::raw::{c_char, c_int};
+use std::os::raw::{c_char, c_int, c_void};
+use crate::ffi::FfiCompletionCallback;
 use std::str::FromStr;
+use sqlx::FromRow;
+use sqlx::sqlite::SqliteRow;
 use uuid::Uuid;
 use serde::{Deserialize, Serialize};
 use std::collections::HashMap;
@@ -148,14 +152,14 @@ pub unsafe extern "C" fn donor_create(payload_json: *const c_char, result: *mut
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_donor_service()?;
         
         let donor = block_on_async(svc.create_donor(p.donor, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&donor)
+        let json_resp = to_json_result(&donor)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -194,7 +198,7 @@ pub unsafe extern "C" fn donor_create_with_documents(payload_json: *const c_char
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         
         // Decode all documents
         let mut documents = Vec::new();
@@ -224,7 +228,7 @@ pub unsafe extern "C" fn donor_create_with_documents(payload_json: *const c_char
             document_results: doc_results.into_iter().map(|r| r.map_err(|e| e.to_string())).collect(),
         };
         
-        let json_resp = serde_json::to_string(&response)
+        let json_resp = to_json_result(&response)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -254,7 +258,7 @@ pub unsafe extern "C" fn donor_get(payload_json: *const c_char, result: *mut *mu
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         
@@ -267,7 +271,7 @@ pub unsafe extern "C" fn donor_get(payload_json: *const c_char, result: *mut *mu
         let donor = block_on_async(svc.get_donor_by_id(id, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&donor)
+        let json_resp = to_json_result(&donor)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -297,7 +301,7 @@ pub unsafe extern "C" fn donor_list(payload_json: *const c_char, result: *mut *m
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let params = p.pagination.map(|p| p.into()).unwrap_or_default();
         let auth: AuthContext = p.auth.try_into()?;
         
@@ -310,7 +314,7 @@ pub unsafe extern "C" fn donor_list(payload_json: *const c_char, result: *mut *m
         let donors = block_on_async(svc.list_donors(params, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&donors)
+        let json_resp = to_json_result(&donors)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -340,7 +344,7 @@ pub unsafe extern "C" fn donor_update(payload_json: *const c_char, result: *mut
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_donor_service()?;
@@ -348,7 +352,7 @@ pub unsafe extern "C" fn donor_update(payload_json: *const c_char, result: *mut
         let donor = block_on_async(svc.update_donor(id, p.update, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&donor)
+        let json_resp = to_json_result(&donor)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -378,7 +382,7 @@ pub unsafe extern "C" fn donor_delete(payload_json: *const c_char, result: *mut
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_donor_service()?;
@@ -386,7 +390,7 @@ pub unsafe extern "C" fn donor_delete(payload_json: *const c_char, result: *mut
         let delete_result = block_on_async(svc.delete_donor(id, p.hard_delete.unwrap_or(false), &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&delete_result)
+        let json_resp = to_json_result(&delete_result)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -411,7 +415,7 @@ pub unsafe extern "C" fn donor_get_summary(payload_json: *const c_char, result:
         #[derive(Deserialize)]
         struct Payload { id: String, auth: AuthCtxDto }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_donor_service()?;
@@ -419,7 +423,7 @@ pub unsafe extern "C" fn donor_get_summary(payload_json: *const c_char, result:
         let summary = block_on_async(svc.get_donor_summary(id, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&summary)
+        let json_resp = to_json_result(&summary)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -465,7 +469,7 @@ pub unsafe extern "C" fn donor_upload_document(payload_json: *const c_char, resu
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         
         // Decode base64 file data
         let file_data = base64::decode(&p.file_data)
@@ -498,7 +502,7 @@ pub unsafe extern "C" fn donor_upload_document(payload_json: *const c_char, resu
             &auth,
         )).map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&document)
+        let json_resp = to_json_result(&document)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -542,7 +546,7 @@ pub unsafe extern "C" fn donor_bulk_upload_documents(payload_json: *const c_char
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         
         // Decode all files
         let mut files = Vec::new();
@@ -577,7 +581,7 @@ pub unsafe extern "C" fn donor_bulk_upload_documents(payload_json: *const c_char
             &auth,
         )).map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&documents)
+        let json_resp = to_json_result(&documents)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -605,14 +609,14 @@ pub unsafe extern "C" fn donor_get_statistics(payload_json: *const c_char, resul
         #[derive(Deserialize)]
         struct Payload { auth: AuthCtxDto }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_donor_service()?;
         
         let stats = block_on_async(svc.get_donor_statistics(&auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&stats)
+        let json_resp = to_json_result(&stats)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -636,14 +640,14 @@ pub unsafe extern "C" fn donor_get_type_distribution(payload_json: *const c_char
         #[derive(Deserialize)]
         struct Payload { auth: AuthCtxDto }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_donor_service()?;
         
         let distribution = block_on_async(svc.get_type_distribution(&auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&distribution)
+        let json_resp = to_json_result(&distribution)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -667,14 +671,14 @@ pub unsafe extern "C" fn donor_get_country_distribution(payload_json: *const c_c
         #[derive(Deserialize)]
         struct Payload { auth: AuthCtxDto }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_donor_service()?;
         
         let distribution = block_on_async(svc.get_country_distribution(&auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&distribution)
+        let json_resp = to_json_result(&distribution)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -710,7 +714,7 @@ pub unsafe extern "C" fn donor_find_by_type(payload_json: *const c_char, result:
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let params = p.pagination.map(|p| p.into()).unwrap_or_default();
         let auth: AuthContext = p.auth.try_into()?;
         
@@ -723,7 +727,7 @@ pub unsafe extern "C" fn donor_find_by_type(payload_json: *const c_char, result:
         let donors = block_on_async(svc.find_donors_by_type(&p.donor_type, params, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&donors)
+        let json_resp = to_json_result(&donors)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -755,7 +759,7 @@ pub unsafe extern "C" fn donor_find_by_country(payload_json: *const c_char, resu
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let params = p.pagination.map(|p| p.into()).unwrap_or_default();
         let auth: AuthContext = p.auth.try_into()?;
         
@@ -768,7 +772,7 @@ pub unsafe extern "C" fn donor_find_by_country(payload_json: *const c_char, resu
         let donors = block_on_async(svc.find_donors_by_country(&p.country, params, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&donors)
+        let json_resp = to_json_result(&donors)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -800,7 +804,7 @@ pub unsafe extern "C" fn donor_find_with_recent_donations(payload_json: *const c
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let params = p.pagination.map(|p| p.into()).unwrap_or_default();
         let auth: AuthContext = p.auth.try_into()?;
         
@@ -813,7 +817,7 @@ pub unsafe extern "C" fn donor_find_with_recent_donations(payload_json: *const c
         let donors = block_on_async(svc.find_donors_with_recent_donations(p.days_ago, params, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&donors)
+        let json_resp = to_json_result(&donors)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -847,7 +851,7 @@ pub unsafe extern "C" fn donor_find_by_date_range(payload_json: *const c_char, r
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let params = p.pagination.map(|p| p.into()).unwrap_or_default();
         let auth: AuthContext = p.auth.try_into()?;
         
@@ -860,7 +864,7 @@ pub unsafe extern "C" fn donor_find_by_date_range(payload_json: *const c_char, r
         let donors = block_on_async(svc.find_donors_by_date_range(&p.start_date, &p.end_date, params, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&donors)
+        let json_resp = to_json_result(&donors)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -889,7 +893,7 @@ pub unsafe extern "C" fn donor_get_with_funding_details(payload_json: *const c_c
         #[derive(Deserialize)]
         struct Payload { id: String, auth: AuthCtxDto }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_donor_service()?;
@@ -897,7 +901,7 @@ pub unsafe extern "C" fn donor_get_with_funding_details(payload_json: *const c_c
         let donor_details = block_on_async(svc.get_donor_with_funding_details(id, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&donor_details)
+        let json_resp = to_json_result(&donor_details)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -922,7 +926,7 @@ pub unsafe extern "C" fn donor_get_with_document_timeline(payload_json: *const c
         #[derive(Deserialize)]
         struct Payload { id: String, auth: AuthCtxDto }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_donor_service()?;
@@ -930,7 +934,7 @@ pub unsafe extern "C" fn donor_get_with_document_timeline(payload_json: *const c
         let donor_timeline = block_on_async(svc.get_donor_with_document_timeline(id, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&donor_timeline)
+        let json_resp = to_json_result(&donor_timeline)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -938,6 +942,88 @@ pub unsafe extern "C" fn donor_get_with_document_timeline(payload_json: *const c
     })
 }
 
+// ---------------------------------------------------------------------------
+// Cursor-Based Listing
+// ---------------------------------------------------------------------------
+
+fn donor_cursor_row(row: &SqliteRow) -> FFIResult<String> {
+    let entity = DonorRow::from_row(row)
+        .map_err(|e| FFIError::internal(format!("row {e}")))?
+        .into_entity()?;
+    to_json_result(&DonorResponse::from(entity))
+        .map_err(|e| FFIError::internal(format!("ser {e}")))
+}
+
+static DONOR_LIST_CURSOR: KeysetQuery = KeysetQuery {
+    table: "donors",
+    // `DonorRow` names the `type` column `type_` and carries sync fields the table lacks
+    columns: "*, type AS type_, NULL AS sync_priority_updated_at, NULL AS sync_priority_updated_by, \
+              NULL AS sync_priority_updated_by_device_id, NULL AS last_sync_at",
+    sort_column: "name",
+    descending: false,
+    sortable: &["name", "created_at", "updated_at"],
+    map_row: donor_cursor_row,
+};
+
+/// Open a streaming cursor over the donors matching an optional filter,
+/// ordered by name unless `sort` names another column
+/// Expected JSON payload:
+/// {
+///   "filter": { DonorFilter },
+///   "sort": { "field": "updated_at", "descending": true },
+///   "auth": { AuthCtxDto }
+/// }
+/// Writes an opaque handle to `cursor_out`; read batches with `cursor_next`
+/// and release it with `cursor_close` (see `src/ffi/cursor.rs`).
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn donor_list_open(payload_json: *const c_char, cursor_out: *mut u64) -> c_int {
+    handle_status_result(|| unsafe {
+        ensure_ptr!(payload_json);
+        ensure_ptr!(cursor_out);
+        
+        let json = CStr::from_ptr(payload_json).to_str().map_err(|_| FFIError::invalid_argument("utf8"))?;
+        
+        #[derive(Deserialize)]
+        struct Payload {
+            filter: Option<DonorFilter>,
+            sort: Option<CursorSortDto>,
+            auth: AuthCtxDto,
+        }
+        
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let auth: AuthContext = p.auth.try_into()?;
+        auth.authorize(Permission::ViewDonors)?;
+        
+        let ids = p.filter.map(|filter| {
+            let svc = globals::get_donor_service()?;
+            block_on_async(svc.find_donor_ids_by_filter(filter, &auth))
+                .map_err(FFIError::from_service_error)
+        }).transpose()?;
+        *cursor_out = open_cursor(&DONOR_LIST_CURSOR, p.sort, ids)?;
+        Ok(())
+    })
+}
+
+// ---------------------------------------------------------------------------
+// Async Variants
+// ---------------------------------------------------------------------------
+
+// Non-blocking versions of the calls above. They take the same payload, return
+// immediately, and invoke `callback(ctx, status, result)` from a background
+// thread once done. `result` must be freed with `donor_free`.
+
+/// Async variant of `donor_list`
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn donor_list_async(payload_json: *const c_char, ctx: *mut c_void, callback: FfiCompletionCallback) -> c_int {
+    crate::ffi::runtime::dispatch_async(donor_list, payload_json, ctx, callback)
+}
+
+/// Async variant of `donor_get_statistics`
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn donor_get_statistics_async(payload_json: *const c_char, ctx: *mut c_void, callback: FfiCompletionCallback) -> c_int {
+    crate::ffi::runtime::dispatch_async(donor_get_statistics, payload_json, ctx, callback)
+}
+
 // ---------------------------------------------------------------------------
 // Memory Management
 // ---------------------------------------------------------------------------
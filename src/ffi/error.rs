@@ -26,6 +26,8 @@ pub enum ErrorCode {
     InvalidUtf8 = 4,
     InvalidUuid = 5,
     InternalError = 6,
+    /// Caller-provided result buffer is too small (see `src/ffi/result_buffer.rs`)
+    BufferTooSmall = 7,
 
     // Database errors (100-199)
     DatabaseGeneral = 100,
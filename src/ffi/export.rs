@@ -15,7 +15,9 @@
 
 use crate::ffi::{handle_status_result, error::FFIError};
 use crate::auth::AuthContext;
-use crate::domains::export::types::{ExportRequest, ExportSummary, EntityFilter, ExportStatus, ExportFormat};
+use crate::ffi::parse_payload;
+use crate::metrics::{in_phase, Phase};
+use crate::domains::export::types::{ExportRequest, ExportSummary, EntityFilter, ExportStatus, ExportFormat, ExportMode};
 // Removed redundant v1 service import
 use crate::domains::export::service_v2::{ExportServiceV2, ExportProgress};
 use crate::domains::export::repository::SqliteExportJobRepository;
@@ -23,7 +25,8 @@ use crate::domains::export::repository_v2::SqliteStreamingRepository;
 use crate::globals;
 use tokio::runtime::Runtime;
 use std::ffi::{c_char, CStr, CString};
-use std::os::raw::c_int;
+use std::os::raw::{c_int, c_void};
+use crate::ffi::FfiCompletionCallback;
 use uuid::Uuid;
 use serde_json::json;
 use chrono::{DateTime, Utc};
@@ -51,21 +54,32 @@ where
 
 /// Helper to create auth context from token
 fn create_auth_context_from_token(token: &str) -> Result<AuthContext, FFIError> {
-    let auth_service = crate::globals::get_auth_service()
-        .map_err(|e| FFIError::internal(format!("Failed to get auth service: {}", e)))?;
-    block_on_async(auth_service.verify_token(token))
-        .map_err(|e| FFIError::internal(format!("Token verification failed: {}", e)))
+    in_phase(Phase::Auth, || {
+        let auth_service = crate::globals::get_auth_service()
+            .map_err(|e| FFIError::internal(format!("Failed to get auth service: {}", e)))?;
+        block_on_async(auth_service.verify_token(token))
+            .map_err(|e| FFIError::internal(format!("Token verification failed: {}", e)))
+    })
 }
 
 /// Helper to parse JSON payload
 fn parse_json_payload<T: serde::de::DeserializeOwned>(json_str: &str) -> Result<T, FFIError> {
-    serde_json::from_str(json_str)
+    in_phase(Phase::Parse, || serde_json::from_str(json_str))
         .map_err(|e| FFIError::invalid_argument(&format!("Invalid JSON payload: {}", e)))
 }
 
+/// Helper to read the optional export `mode` ("full" or "incremental") from export options
+fn parse_export_mode(options: &serde_json::Value) -> Result<ExportMode, FFIError> {
+    match options.get("mode") {
+        None | Some(serde_json::Value::Null) => Ok(ExportMode::Full),
+        Some(mode) => serde_json::from_value(mode.clone())
+            .map_err(|_| FFIError::invalid_argument(&format!("Invalid export mode: {}", mode))),
+    }
+}
+
 /// Helper to create JSON response
 fn create_json_response<T: serde::Serialize>(data: T) -> Result<*mut c_char, FFIError> {
-    let json_string = serde_json::to_string(&data)
+    let json_string = in_phase(Phase::Serialize, || serde_json::to_string(&data))
         .map_err(|e| FFIError::internal(format!("JSON serialization failed: {}", e)))?;
     
     let c_string = CString::new(json_string)
@@ -182,7 +196,8 @@ pub unsafe extern "C" fn export_create_export(
 /// * `job_id` - UUID of the export job
 /// 
 /// # Returns
-/// JSON containing export job summary with current status
+/// JSON containing export job summary with current status, plus a `progress`
+/// object (entities and bytes per domain) while a unified export is running
 #[unsafe(no_mangle)]
 pub unsafe extern "C" fn export_get_status(
     job_id: *const c_char,
@@ -204,7 +219,12 @@ pub unsafe extern "C" fn export_get_status(
         let summary = block_on_async(export_service_v2.get_export_status(id))
             .map_err(|e| FFIError::internal(format!("Failed to get export status: {}", e)))?;
         
-        let response = format_export_job_response(summary);
+        let mut response = format_export_job_response(summary);
+        // Running unified exports also report per-domain progress
+        if let Some(progress) = crate::domains::export::unified::unified_progress(id) {
+            response["progress"] = serde_json::to_value(progress)
+                .map_err(|e| FFIError::internal(format!("Failed to serialize export progress: {}", e)))?;
+        }
         *result = create_json_response(response)?;
         Ok(())
     })
@@ -276,6 +296,7 @@ pub unsafe extern "C" fn export_strategic_goals_by_ids(
             })),
             use_compression: false,
             use_background: false,
+            mode: ExportMode::Full,
         };
         
         // Use V2 service for proper CSV/Parquet streaming with iOS optimizations
@@ -292,7 +313,7 @@ pub unsafe extern "C" fn export_strategic_goals_by_ids(
 /// Create export for all strategic goals
 /// 
 /// # Arguments
-/// * `export_options_json` - JSON containing export options (include_blobs, target_path, status_id)
+/// * `export_options_json` - JSON containing export options (include_blobs, target_path, status_id, mode)
 /// * `token` - Access token for authentication
 /// 
 /// # Returns
@@ -333,6 +354,7 @@ pub unsafe extern "C" fn export_strategic_goals_all(
             }),
             use_compression: false,
             use_background: false,
+            mode: parse_export_mode(&options)?,
         };
         
         let export_service_v2 = build_export_service_v2()?;
@@ -428,6 +450,7 @@ pub unsafe extern "C" fn export_projects_by_ids(
             })),
             use_compression: false,
             use_background: false,
+            mode: ExportMode::Full,
         };
         
         log::info!("[PROJECT_EXPORT_FFI] Created export request with format: {:?}", export_request.format);
@@ -457,7 +480,7 @@ pub unsafe extern "C" fn export_projects_by_ids(
 /// Create export for all projects
 /// 
 /// # Arguments
-/// * `export_options_json` - JSON containing export options (include_blobs, target_path)
+/// * `export_options_json` - JSON containing export options (include_blobs, target_path, mode)
 /// * `token` - Access token for authentication
 /// 
 /// # Returns
@@ -497,6 +520,7 @@ pub unsafe extern "C" fn export_projects_all(
             }),
             use_compression: false,
             use_background: false,
+            mode: parse_export_mode(&options)?,
         };
         
         let export_service_v2 = build_export_service_v2()?;
@@ -588,6 +612,7 @@ pub unsafe extern "C" fn export_participants_by_ids(
             })),
             use_compression: false,
             use_background: false,
+            mode: ExportMode::Full,
         };
         
         log::info!("[PARTICIPANT_EXPORT_FFI] Created export request with format: {:?}", export_request.format);
@@ -617,7 +642,7 @@ pub unsafe extern "C" fn export_participants_by_ids(
 /// Create export for all participants
 /// 
 /// # Arguments
-/// * `export_options_json` - JSON containing export options (include_blobs, target_path)
+/// * `export_options_json` - JSON containing export options (include_blobs, target_path, mode)
 /// * `token` - Access token for authentication
 /// 
 /// # Returns
@@ -657,6 +682,7 @@ pub unsafe extern "C" fn export_participants_all(
             }),
             use_compression: false,
             use_background: false,
+            mode: parse_export_mode(&options)?,
         };
         
         let export_service_v2 = build_export_service_v2()?;
@@ -672,7 +698,7 @@ pub unsafe extern "C" fn export_participants_all(
 /// Create export for all activities
 /// 
 /// # Arguments
-/// * `export_options_json` - JSON containing export options (include_blobs, target_path)
+/// * `export_options_json` - JSON containing export options (include_blobs, target_path, mode)
 /// * `token` - Access token for authentication
 /// 
 /// # Returns
@@ -712,6 +738,7 @@ pub unsafe extern "C" fn export_activities_all(
             }),
             use_compression: false,
             use_background: false,
+            mode: parse_export_mode(&options)?,
         };
         
         let export_service_v2 = build_export_service_v2()?;
@@ -803,6 +830,7 @@ pub unsafe extern "C" fn export_activities_by_ids(
             })),
             use_compression: false,
             use_background: false,
+            mode: ExportMode::Full,
         };
         
         log::info!("[ACTIVITY_EXPORT_FFI] Created export request with format: {:?}", export_request.format);
@@ -833,7 +861,7 @@ pub unsafe extern "C" fn export_activities_by_ids(
 /// Create export for all donors
 /// 
 /// # Arguments
-/// * `export_options_json` - JSON containing export options (include_blobs, target_path)
+/// * `export_options_json` - JSON containing export options (include_blobs, target_path, mode)
 /// * `token` - Access token for authentication
 /// 
 /// # Returns
@@ -873,6 +901,7 @@ pub unsafe extern "C" fn export_donors_all(
             }),
             use_compression: false,
             use_background: false,
+            mode: parse_export_mode(&options)?,
         };
         
         let export_service_v2 = build_export_service_v2()?;
@@ -888,7 +917,7 @@ pub unsafe extern "C" fn export_donors_all(
 /// Create export for all funding records
 /// 
 /// # Arguments
-/// * `export_options_json` - JSON containing export options (include_blobs, target_path)
+/// * `export_options_json` - JSON containing export options (include_blobs, target_path, mode)
 /// * `token` - Access token for authentication
 /// 
 /// # Returns
@@ -928,6 +957,7 @@ pub unsafe extern "C" fn export_funding_all(
             }),
             use_compression: false,
             use_background: false,
+            mode: parse_export_mode(&options)?,
         };
         
         let export_service_v2 = build_export_service_v2()?;
@@ -943,7 +973,7 @@ pub unsafe extern "C" fn export_funding_all(
 /// Create export for all livelihoods
 /// 
 /// # Arguments
-/// * `export_options_json` - JSON containing export options (include_blobs, target_path)
+/// * `export_options_json` - JSON containing export options (include_blobs, target_path, mode)
 /// * `token` - Access token for authentication
 /// 
 /// # Returns
@@ -983,6 +1013,7 @@ pub unsafe extern "C" fn export_livelihoods_all(
             }),
             use_compression: false,
             use_background: false,
+            mode: parse_export_mode(&options)?,
         };
         
         let export_service_v2 = build_export_service_v2()?;
@@ -998,7 +1029,7 @@ pub unsafe extern "C" fn export_livelihoods_all(
 /// Create export for all workshops
 /// 
 /// # Arguments
-/// * `export_options_json` - JSON containing export options (include_blobs, target_path)
+/// * `export_options_json` - JSON containing export options (include_blobs, target_path, mode)
 /// * `token` - Access token for authentication
 /// 
 /// # Returns
@@ -1038,6 +1069,7 @@ pub unsafe extern "C" fn export_workshops_all(
             }),
             use_compression: false,
             use_background: false,
+            mode: parse_export_mode(&options)?,
         };
         
         let export_service_v2 = build_export_service_v2()?;
@@ -1053,7 +1085,7 @@ pub unsafe extern "C" fn export_workshops_all(
 /// Create unified export for all domains
 /// 
 /// # Arguments
-/// * `unified_export_json` - JSON containing export options (include_blobs, target_path, include_type_tags)
+/// * `unified_export_json` - JSON containing export options (include_blobs, target_path, include_type_tags, mode)
 /// * `token` - Access token for authentication
 /// 
 /// # Returns
@@ -1086,14 +1118,10 @@ pub unsafe extern "C" fn export_unified_all_domains(
             filters: vec![EntityFilter::UnifiedAllDomains { include_type_tags }],
             include_blobs,
             target_path,
-            format: Some(ExportFormat::Csv { 
-                delimiter: b',', 
-                quote_char: b'"', 
-                escape_char: None, 
-                compress: false 
-            }),
+            format: Some(ExportFormat::JsonLines),
             use_compression: false,
             use_background: false,
+            mode: parse_export_mode(&options)?,
         };
         
         let export_service_v2 = build_export_service_v2()?;
@@ -1158,6 +1186,7 @@ pub unsafe extern "C" fn export_strategic_goals_by_date_range(
             }),
             use_compression: false,
             use_background: false,
+            mode: ExportMode::Full,
         };
         
         let export_service = build_export_service_v2()?;
@@ -1225,6 +1254,7 @@ pub unsafe extern "C" fn export_strategic_goals_by_filter(
             }),
             use_compression: false,
             use_background: false,
+            mode: ExportMode::Full,
         };
         
         let export_service_v2 = build_export_service_v2()?;
@@ -1284,6 +1314,7 @@ pub unsafe extern "C" fn export_projects_by_date_range(
             }),
             use_compression: false,
             use_background: false,
+            mode: ExportMode::Full,
         };
         
         let export_service = build_export_service_v2()?;
@@ -1343,6 +1374,7 @@ pub unsafe extern "C" fn export_activities_by_date_range(
             }),
             use_compression: false,
             use_background: false,
+            mode: ExportMode::Full,
         };
         
         let export_service = build_export_service_v2()?;
@@ -1402,6 +1434,7 @@ pub unsafe extern "C" fn export_donors_by_date_range(
             }),
             use_compression: false,
             use_background: false,
+            mode: ExportMode::Full,
         };
         
         let export_service = build_export_service_v2()?;
@@ -1461,6 +1494,7 @@ pub unsafe extern "C" fn export_funding_by_date_range(
             }),
             use_compression: false,
             use_background: false,
+            mode: ExportMode::Full,
         };
         
         let export_service = build_export_service_v2()?;
@@ -1520,6 +1554,7 @@ pub unsafe extern "C" fn export_livelihoods_by_date_range(
             }),
             use_compression: false,
             use_background: false,
+            mode: ExportMode::Full,
         };
         
         let export_service = build_export_service_v2()?;
@@ -1579,6 +1614,7 @@ pub unsafe extern "C" fn export_workshops_by_date_range(
             }),
             use_compression: false,
             use_background: false,
+            mode: ExportMode::Full,
         };
         
         let export_service = build_export_service_v2()?;
@@ -1638,6 +1674,7 @@ pub unsafe extern "C" fn export_media_documents_by_date_range(
             }),
             use_compression: false,
             use_background: false,
+            mode: ExportMode::Full,
         };
         
         let export_service = build_export_service_v2()?;
@@ -1690,14 +1727,10 @@ pub unsafe extern "C" fn export_unified_by_date_range(
             filters: vec![EntityFilter::UnifiedByDateRange { start_date, end_date, include_type_tags }],
             include_blobs,
             target_path,
-            format: Some(ExportFormat::Csv { 
-                delimiter: b',', 
-                quote_char: b'"', 
-                escape_char: None, 
-                compress: false 
-            }),
+            format: Some(ExportFormat::JsonLines),
             use_compression: false,
             use_background: false,
+            mode: ExportMode::Full,
         };
         
         let export_service = build_export_service_v2()?;
@@ -1763,6 +1796,7 @@ pub unsafe extern "C" fn export_media_documents_by_entity(
             }),
             use_compression: false,
             use_background: false,
+            mode: ExportMode::Full,
         };
         
         let export_service_v2 = build_export_service_v2()?;
@@ -1843,7 +1877,7 @@ pub unsafe extern "C" fn export_validate_request(
             .map_err(|_| FFIError::invalid_argument("Invalid token string"))?;
         
         // Validate JSON parsing
-        let export_request: Result<ExportRequest, _> = serde_json::from_str(json_str);
+        let export_request: Result<ExportRequest, _> = parse_payload(json_str);
         let auth_context = create_auth_context_from_token(token_str)?;
         
         let validation_result = match export_request {
@@ -1875,6 +1909,36 @@ pub unsafe extern "C" fn export_validate_request(
     })
 }
 
+// ============================================================================
+// ASYNC VARIANTS
+// ============================================================================
+
+// Non-blocking versions of the long-running exports. They take the same
+// arguments, return immediately, and invoke `callback(ctx, status, result)`
+// from a background thread once done. `result` must be freed with `export_free`.
+
+/// Async variant of `export_unified_all_domains`
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn export_unified_all_domains_async(
+    unified_export_json: *const c_char,
+    token: *const c_char,
+    ctx: *mut c_void,
+    callback: FfiCompletionCallback,
+) -> c_int {
+    crate::ffi::runtime::dispatch_async_with_token(export_unified_all_domains, unified_export_json, token, ctx, callback)
+}
+
+/// Async variant of `export_unified_by_date_range`
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn export_unified_by_date_range_async(
+    export_options_json: *const c_char,
+    token: *const c_char,
+    ctx: *mut c_void,
+    callback: FfiCompletionCallback,
+) -> c_int {
+    crate::ffi::runtime::dispatch_async_with_token(export_unified_by_date_range, export_options_json, token, ctx, callback)
+}
+
 // ============================================================================
 // MEMORY MANAGEMENT
 // ============================================================================
@@ -22,7 +22,8 @@
 //   of each payload is documented above every function.
 // ----------------------------------------------------------------------------
 
-use crate::ffi::{handle_status_result, error::FFIError};
+use crate::ffi::{handle_status_result, parse_payload, to_json_result, error::FFIError};
+use crate::ffi::result_cache;
 use crate::domains::funding::types::{
     NewProjectFunding, UpdateProjectFunding, ProjectFundingResponse, FundingInclude,
     FundingStatsSummary, DonorWithFundingDetails, FundingWithDocumentTimeline
@@ -35,7 +36,8 @@ use crate::types::{UserRole, PaginationParams};
 use crate::globals;
 
 use std::ffi::{CStr, CString};
-use std::os::raw::{c_char, c_int};
+use std::os::raw::{c_char, c_int, c_void};
+use crate::ffi::FfiCompletionCallback;
 use std::str::FromStr;
 use uuid::Uuid;
 use serde::{Deserialize, Serialize};
@@ -150,14 +152,14 @@ pub unsafe extern "C" fn funding_create(payload_json: *const c_char, result: *mu
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_funding_service()?;
         
         let funding = block_on_async(svc.create_funding(p.funding, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&funding)
+        let json_resp = to_json_result(&funding)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -196,7 +198,7 @@ pub unsafe extern "C" fn funding_create_with_documents(payload_json: *const c_ch
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         
         // Decode all documents
         let mut documents = Vec::new();
@@ -243,7 +245,7 @@ pub unsafe extern "C" fn funding_create_with_documents(payload_json: *const c_ch
             document_results: doc_results.into_iter().map(|r| r.map_err(|e| e.to_string())).collect(),
         };
         
-        let json_resp = serde_json::to_string(&response)
+        let json_resp = to_json_result(&response)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -273,7 +275,7 @@ pub unsafe extern "C" fn funding_get(payload_json: *const c_char, result: *mut *
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         
@@ -286,7 +288,7 @@ pub unsafe extern "C" fn funding_get(payload_json: *const c_char, result: *mut *
         let funding = block_on_async(svc.get_funding_by_id(id, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&funding)
+        let json_resp = to_json_result(&funding)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -316,7 +318,7 @@ pub unsafe extern "C" fn funding_list(payload_json: *const c_char, result: *mut
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let params = p.pagination.map(|p| p.into()).unwrap_or_default();
         let auth: AuthContext = p.auth.try_into()?;
         
@@ -329,7 +331,7 @@ pub unsafe extern "C" fn funding_list(payload_json: *const c_char, result: *mut
         let fundings = block_on_async(svc.list_fundings(params, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&fundings)
+        let json_resp = to_json_result(&fundings)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -359,7 +361,7 @@ pub unsafe extern "C" fn funding_update(payload_json: *const c_char, result: *mu
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_funding_service()?;
@@ -367,7 +369,7 @@ pub unsafe extern "C" fn funding_update(payload_json: *const c_char, result: *mu
         let funding = block_on_async(svc.update_funding(id, p.update, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&funding)
+        let json_resp = to_json_result(&funding)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -397,7 +399,7 @@ pub unsafe extern "C" fn funding_delete(payload_json: *const c_char, result: *mu
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_funding_service()?;
@@ -407,7 +409,7 @@ pub unsafe extern "C" fn funding_delete(payload_json: *const c_char, result: *mu
             .map_err(FFIError::from_service_error)?;
         
         // Serialize and return the DeleteResult
-        let json_resp = serde_json::to_string(&delete_result)
+        let json_resp = to_json_result(&delete_result)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -443,7 +445,7 @@ pub unsafe extern "C" fn funding_find_by_donor(payload_json: *const c_char, resu
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let donor_id = Uuid::parse_str(&p.donor_id).map_err(|_| FFIError::invalid_argument("invalid donor_id"))?;
         let params = p.pagination.map(|p| p.into()).unwrap_or_default();
         let auth: AuthContext = p.auth.try_into()?;
@@ -457,7 +459,7 @@ pub unsafe extern "C" fn funding_find_by_donor(payload_json: *const c_char, resu
         let fundings = block_on_async(svc.list_fundings_by_donor(donor_id, params, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&fundings)
+        let json_resp = to_json_result(&fundings)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -489,7 +491,7 @@ pub unsafe extern "C" fn funding_find_by_project(payload_json: *const c_char, re
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let project_id = Uuid::parse_str(&p.project_id).map_err(|_| FFIError::invalid_argument("invalid project_id"))?;
         let params = p.pagination.map(|p| p.into()).unwrap_or_default();
         let auth: AuthContext = p.auth.try_into()?;
@@ -503,7 +505,7 @@ pub unsafe extern "C" fn funding_find_by_project(payload_json: *const c_char, re
         let fundings = block_on_async(svc.list_fundings_by_project(project_id, params, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&fundings)
+        let json_resp = to_json_result(&fundings)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -537,7 +539,7 @@ pub unsafe extern "C" fn funding_find_by_date_range(payload_json: *const c_char,
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let params = p.pagination.map(|p| p.into()).unwrap_or_default();
         let auth: AuthContext = p.auth.try_into()?;
         
@@ -552,7 +554,7 @@ pub unsafe extern "C" fn funding_find_by_date_range(payload_json: *const c_char,
         let fundings = block_on_async(svc.list_fundings(params, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&fundings)
+        let json_resp = to_json_result(&fundings)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -584,14 +586,14 @@ pub unsafe extern "C" fn funding_create_project_funding(payload_json: *const c_c
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_funding_service()?;
         
         let project_funding = block_on_async(svc.create_funding(p.project_funding, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&project_funding)
+        let json_resp = to_json_result(&project_funding)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -621,7 +623,7 @@ pub unsafe extern "C" fn funding_update_project_funding(payload_json: *const c_c
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_funding_service()?;
@@ -629,7 +631,7 @@ pub unsafe extern "C" fn funding_update_project_funding(payload_json: *const c_c
         let project_funding = block_on_async(svc.update_funding(id, p.update, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&project_funding)
+        let json_resp = to_json_result(&project_funding)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -657,15 +659,16 @@ pub unsafe extern "C" fn funding_get_analytics(payload_json: *const c_char, resu
         #[derive(Deserialize)]
         struct Payload { auth: AuthCtxDto }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
-        let svc = globals::get_funding_service()?;
-        
-        let analytics = block_on_async(svc.get_funding_statistics(&auth))
-            .map_err(FFIError::from_service_error)?;
-        
-        let json_resp = serde_json::to_string(&analytics)
-            .map_err(|e| FFIError::internal(format!("ser {e}")))?;
+        // Upcoming/overdue counts depend on the date as well as the table
+        let args = format!("{}@{}", result_cache::cache_args(json), chrono::Local::now().format("%Y-%m-%d"));
+        let json_resp = result_cache::cached_json("funding_get_analytics", args, &auth, &["project_funding"], || {
+            let svc = globals::get_funding_service()?;
+            let analytics = block_on_async(svc.get_funding_statistics(&auth))
+                .map_err(FFIError::from_service_error)?;
+            to_json_result(&analytics).map_err(|e| FFIError::internal(format!("ser {e}")))
+        })?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
         Ok(())
@@ -688,7 +691,7 @@ pub unsafe extern "C" fn funding_get_by_donor_summary(payload_json: *const c_cha
         #[derive(Deserialize)]
         struct Payload { auth: AuthCtxDto }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_funding_service()?;
         
@@ -698,7 +701,7 @@ pub unsafe extern "C" fn funding_get_by_donor_summary(payload_json: *const c_cha
             "message": "get_funding_by_donor_summary not implemented yet"
         });
         
-        let json_resp = serde_json::to_string(&summary)
+        let json_resp = to_json_result(&summary)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -722,7 +725,7 @@ pub unsafe extern "C" fn funding_get_by_project_summary(payload_json: *const c_c
         #[derive(Deserialize)]
         struct Payload { auth: AuthCtxDto }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_funding_service()?;
         
@@ -732,7 +735,7 @@ pub unsafe extern "C" fn funding_get_by_project_summary(payload_json: *const c_c
             "message": "get_funding_by_project_summary not implemented yet"
         });
         
-        let json_resp = serde_json::to_string(&summary)
+        let json_resp = to_json_result(&summary)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -762,7 +765,7 @@ pub unsafe extern "C" fn funding_get_timeline(payload_json: *const c_char, resul
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_funding_service()?;
         
@@ -772,7 +775,7 @@ pub unsafe extern "C" fn funding_get_timeline(payload_json: *const c_char, resul
             "message": "get_funding_timeline not implemented yet"
         });
         
-        let json_resp = serde_json::to_string(&timeline)
+        let json_resp = to_json_result(&timeline)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -818,7 +821,7 @@ pub unsafe extern "C" fn funding_upload_document(payload_json: *const c_char, re
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         
         // Decode base64 file data
         let file_data = base64::decode(&p.file_data)
@@ -851,7 +854,7 @@ pub unsafe extern "C" fn funding_upload_document(payload_json: *const c_char, re
             &auth,
         )).map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&document)
+        let json_resp = to_json_result(&document)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -903,7 +906,7 @@ pub unsafe extern "C" fn funding_upload_documents_bulk(payload_json: *const c_ch
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         
         let funding_id = Uuid::parse_str(&p.funding_id)
             .map_err(|_| FFIError::invalid_argument("invalid funding_id"))?;
@@ -961,7 +964,7 @@ pub unsafe extern "C" fn funding_upload_documents_bulk(payload_json: *const c_ch
             failed_uploads,
         };
         
-        let json_resp = serde_json::to_string(&response)
+        let json_resp = to_json_result(&response)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -969,6 +972,20 @@ pub unsafe extern "C" fn funding_upload_documents_bulk(payload_json: *const c_ch
     })
 }
 
+// ---------------------------------------------------------------------------
+// Async Variants
+// ---------------------------------------------------------------------------
+
+// Non-blocking versions of the calls above. They take the same payload, return
+// immediately, and invoke `callback(ctx, status, result)` from a background
+// thread once done. `result` must be freed with `funding_free`.
+
+/// Async variant of `funding_list`
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn funding_list_async(payload_json: *const c_char, ctx: *mut c_void, callback: FfiCompletionCallback) -> c_int {
+    crate::ffi::runtime::dispatch_async(funding_list, payload_json, ctx, callback)
+}
+
 // ---------------------------------------------------------------------------
 // Memory Management
 // ---------------------------------------------------------------------------
@@ -22,7 +22,7 @@
 //   of each payload is documented above every function.
 // ----------------------------------------------------------------------------
 
-use crate::ffi::{handle_status_result, error::FFIError};
+use crate::ffi::{handle_status_result, parse_payload, to_json_result, error::FFIError};
 use crate::domains::livelihood::types::{
     NewLivelihood, UpdateLivelihood, LivelihoodResponse, LivelihoodInclude,
     NewSubsequentGrant, UpdateSubsequentGrant, SubsequentGrantResponse,
@@ -37,7 +37,8 @@ use crate::types::{UserRole, PaginationParams};
 use crate::globals;
 
 use std::ffi::{CStr, CString};
-use std::os::raw::{c_char, c_int};
+use std::os::raw::{c_char, c_int, c_void};
+use crate::ffi::FfiCompletionCallback;
 use std::str::FromStr;
 use uuid::Uuid;
 use serde::{Deserialize, Serialize};
@@ -155,14 +156,14 @@ pub unsafe extern "C" fn livelihood_create(payload_json: *const c_char, result:
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_livelihood_service()?;
         
         let livelihood = block_on_async(svc.create_livelihood(p.livelihood, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&livelihood)
+        let json_resp = to_json_result(&livelihood)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -201,7 +202,7 @@ pub unsafe extern "C" fn livelihood_create_with_documents(payload_json: *const c
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         
         // Decode all documents
         let mut documents = Vec::new();
@@ -231,7 +232,7 @@ pub unsafe extern "C" fn livelihood_create_with_documents(payload_json: *const c
             document_results: doc_results.into_iter().map(|r| r.map_err(|e| e.to_string())).collect(),
         };
         
-        let json_resp = serde_json::to_string(&response)
+        let json_resp = to_json_result(&response)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -261,7 +262,7 @@ pub unsafe extern "C" fn livelihood_get(payload_json: *const c_char, result: *mu
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         
@@ -274,7 +275,7 @@ pub unsafe extern "C" fn livelihood_get(payload_json: *const c_char, result: *mu
         let livelihood = block_on_async(svc.get_livelihood_by_id(id, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&livelihood)
+        let json_resp = to_json_result(&livelihood)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -308,7 +309,7 @@ pub unsafe extern "C" fn livelihood_list(payload_json: *const c_char, result: *m
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let params = p.pagination.map(|p| p.into()).unwrap_or_default();
         let project_id = p.project_id.as_ref()
             .map(|id| Uuid::parse_str(id))
@@ -329,7 +330,7 @@ pub unsafe extern "C" fn livelihood_list(payload_json: *const c_char, result: *m
         let livelihoods = block_on_async(svc.list_livelihoods(params, project_id, participant_id, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&livelihoods)
+        let json_resp = to_json_result(&livelihoods)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -359,7 +360,7 @@ pub unsafe extern "C" fn livelihood_update(payload_json: *const c_char, result:
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_livelihood_service()?;
@@ -367,7 +368,7 @@ pub unsafe extern "C" fn livelihood_update(payload_json: *const c_char, result:
         let livelihood = block_on_async(svc.update_livelihood(id, p.update, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&livelihood)
+        let json_resp = to_json_result(&livelihood)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -397,7 +398,7 @@ pub unsafe extern "C" fn livelihood_delete(payload_json: *const c_char, result:
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_livelihood_service()?;
@@ -407,7 +408,7 @@ pub unsafe extern "C" fn livelihood_delete(payload_json: *const c_char, result:
             .map_err(FFIError::from_service_error)?;
         
         // Serialize and return the DeleteResult
-        let json_resp = serde_json::to_string(&delete_result)
+        let json_resp = to_json_result(&delete_result)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -439,14 +440,14 @@ pub unsafe extern "C" fn livelihood_add_subsequent_grant(payload_json: *const c_
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_livelihood_service()?;
         
         let grant = block_on_async(svc.add_subsequent_grant(p.grant, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&grant)
+        let json_resp = to_json_result(&grant)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -476,7 +477,7 @@ pub unsafe extern "C" fn livelihood_update_subsequent_grant(payload_json: *const
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_livelihood_service()?;
@@ -484,7 +485,7 @@ pub unsafe extern "C" fn livelihood_update_subsequent_grant(payload_json: *const
         let grant = block_on_async(svc.update_subsequent_grant(id, p.update, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&grant)
+        let json_resp = to_json_result(&grant)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -512,7 +513,7 @@ pub unsafe extern "C" fn livelihood_get_subsequent_grant(payload_json: *const c_
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_livelihood_service()?;
@@ -520,7 +521,7 @@ pub unsafe extern "C" fn livelihood_get_subsequent_grant(payload_json: *const c_
         let grant = block_on_async(svc.get_subsequent_grant_by_id(id, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&grant)
+        let json_resp = to_json_result(&grant)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -549,7 +550,7 @@ pub unsafe extern "C" fn livelihood_delete_subsequent_grant(payload_json: *const
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_livelihood_service()?;
@@ -591,7 +592,7 @@ pub unsafe extern "C" fn livelihood_find_by_date_range(payload_json: *const c_ch
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let params = p.pagination.map(|p| p.into()).unwrap_or_default();
         let auth: AuthContext = p.auth.try_into()?;
         
@@ -604,7 +605,7 @@ pub unsafe extern "C" fn livelihood_find_by_date_range(payload_json: *const c_ch
         let livelihoods = block_on_async(svc.find_livelihoods_by_date_range(&p.start_date, &p.end_date, params, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&livelihoods)
+        let json_resp = to_json_result(&livelihoods)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -634,7 +635,7 @@ pub unsafe extern "C" fn livelihood_find_with_outcome(payload_json: *const c_cha
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let params = p.pagination.map(|p| p.into()).unwrap_or_default();
         let auth: AuthContext = p.auth.try_into()?;
         
@@ -647,7 +648,7 @@ pub unsafe extern "C" fn livelihood_find_with_outcome(payload_json: *const c_cha
         let livelihoods = block_on_async(svc.find_livelihoods_with_outcome(params, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&livelihoods)
+        let json_resp = to_json_result(&livelihoods)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -677,7 +678,7 @@ pub unsafe extern "C" fn livelihood_find_without_outcome(payload_json: *const c_
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let params = p.pagination.map(|p| p.into()).unwrap_or_default();
         let auth: AuthContext = p.auth.try_into()?;
         
@@ -690,7 +691,7 @@ pub unsafe extern "C" fn livelihood_find_without_outcome(payload_json: *const c_
         let livelihoods = block_on_async(svc.find_livelihoods_without_outcome(params, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&livelihoods)
+        let json_resp = to_json_result(&livelihoods)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -720,7 +721,7 @@ pub unsafe extern "C" fn livelihood_find_with_multiple_grants(payload_json: *con
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let params = p.pagination.map(|p| p.into()).unwrap_or_default();
         let auth: AuthContext = p.auth.try_into()?;
         
@@ -733,7 +734,7 @@ pub unsafe extern "C" fn livelihood_find_with_multiple_grants(payload_json: *con
         let livelihoods = block_on_async(svc.find_livelihoods_with_multiple_grants(params, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&livelihoods)
+        let json_resp = to_json_result(&livelihoods)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -761,14 +762,14 @@ pub unsafe extern "C" fn livelihood_get_statistics(payload_json: *const c_char,
         #[derive(Deserialize)]
         struct Payload { auth: AuthCtxDto }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_livelihood_service()?;
         
         let statistics = block_on_async(svc.get_livelihood_statistics(&auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&statistics)
+        let json_resp = to_json_result(&statistics)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -792,14 +793,14 @@ pub unsafe extern "C" fn livelihood_get_outcome_distribution(payload_json: *cons
         #[derive(Deserialize)]
         struct Payload { auth: AuthCtxDto }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_livelihood_service()?;
         
         let distribution = block_on_async(svc.get_outcome_distribution(&auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&distribution)
+        let json_resp = to_json_result(&distribution)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -827,7 +828,7 @@ pub unsafe extern "C" fn livelihood_get_participant_outcome_metrics(payload_json
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let participant_id = Uuid::parse_str(&p.participant_id).map_err(|_| FFIError::invalid_argument("invalid participant_id"))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_livelihood_service()?;
@@ -835,7 +836,7 @@ pub unsafe extern "C" fn livelihood_get_participant_outcome_metrics(payload_json
         let metrics = block_on_async(svc.get_participant_outcome_metrics(participant_id, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&metrics)
+        let json_resp = to_json_result(&metrics)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -863,7 +864,7 @@ pub unsafe extern "C" fn livelihood_get_dashboard_metrics(payload_json: *const c
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let months_back = p.months_back.unwrap_or(12);
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_livelihood_service()?;
@@ -871,7 +872,7 @@ pub unsafe extern "C" fn livelihood_get_dashboard_metrics(payload_json: *const c
         let metrics = block_on_async(svc.get_livelihood_dashboard_metrics(months_back, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&metrics)
+        let json_resp = to_json_result(&metrics)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -903,7 +904,7 @@ pub unsafe extern "C" fn livelihood_get_with_participant_details(payload_json: *
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_livelihood_service()?;
@@ -911,7 +912,7 @@ pub unsafe extern "C" fn livelihood_get_with_participant_details(payload_json: *
         let livelihood_with_details = block_on_async(svc.get_livelihood_with_participant_details(id, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&livelihood_with_details)
+        let json_resp = to_json_result(&livelihood_with_details)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -939,7 +940,7 @@ pub unsafe extern "C" fn livelihood_get_with_document_timeline(payload_json: *co
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_livelihood_service()?;
@@ -947,7 +948,7 @@ pub unsafe extern "C" fn livelihood_get_with_document_timeline(payload_json: *co
         let livelihood_with_timeline = block_on_async(svc.get_livelihood_with_document_timeline(id, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&livelihood_with_timeline)
+        let json_resp = to_json_result(&livelihood_with_timeline)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -993,7 +994,7 @@ pub unsafe extern "C" fn livelihood_upload_document(payload_json: *const c_char,
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         
         // Decode base64 file data
         let file_data = base64::decode(&p.file_data)
@@ -1026,7 +1027,7 @@ pub unsafe extern "C" fn livelihood_upload_document(payload_json: *const c_char,
             &auth,
         )).map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&document)
+        let json_resp = to_json_result(&document)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -1078,7 +1079,7 @@ pub unsafe extern "C" fn livelihood_upload_documents_bulk(payload_json: *const c
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         
         let livelihood_id = Uuid::parse_str(&p.livelihood_id)
             .map_err(|_| FFIError::invalid_argument("invalid livelihood_id"))?;
@@ -1136,7 +1137,7 @@ pub unsafe extern "C" fn livelihood_upload_documents_bulk(payload_json: *const c
             failed_uploads,
         };
         
-        let json_resp = serde_json::to_string(&response)
+        let json_resp = to_json_result(&response)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -1144,6 +1145,26 @@ pub unsafe extern "C" fn livelihood_upload_documents_bulk(payload_json: *const c
     })
 }
 
+// ---------------------------------------------------------------------------
+// Async Variants
+// ---------------------------------------------------------------------------
+
+// Non-blocking versions of the calls above. They take the same payload, return
+// immediately, and invoke `callback(ctx, status, result)` from a background
+// thread once done. `result` must be freed with `livelihood_free`.
+
+/// Async variant of `livelihood_list`
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn livelihood_list_async(payload_json: *const c_char, ctx: *mut c_void, callback: FfiCompletionCallback) -> c_int {
+    crate::ffi::runtime::dispatch_async(livelihood_list, payload_json, ctx, callback)
+}
+
+/// Async variant of `livelihood_get_dashboard_metrics`
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn livelihood_get_dashboard_metrics_async(payload_json: *const c_char, ctx: *mut c_void, callback: FfiCompletionCallback) -> c_int {
+    crate::ffi::runtime::dispatch_async(livelihood_get_dashboard_metrics, payload_json, ctx, callback)
+}
+
 // ---------------------------------------------------------------------------
 // Memory Management
 // ---------------------------------------------------------------------------
@@ -4,9 +4,6 @@ use std::ffi::CString;
 // Corrected imports for FFIError and FFIResult
 use crate::ffi::error::{FFIError, ErrorCode};
 use serde::Serialize;
-use std::sync::OnceLock;
-use tokio::runtime::Runtime;
-use std::future::Future;
 
 // Declare necessary FFI submodules
 pub mod auth;
@@ -27,30 +24,47 @@ pub mod livelihood;
 pub mod workshop;
 pub mod participant;
 
-// iOS-safe single-threaded runtime
-static RUNTIME: OnceLock<Runtime> = OnceLock::new();
-
-/// Initialize or get the iOS-safe Tokio runtime
-pub fn get_runtime() -> &'static Runtime {
-    RUNTIME.get_or_init(|| {
-        tokio::runtime::Builder::new_current_thread()
-            .enable_all()
-            .build()
-            .expect("Failed to create iOS-safe Tokio runtime")
-    })
-}
+// Dashboard counter maintenance (`stats_rebuild`)
+pub mod stats;
 
-/// Block on async operation in iOS-safe manner
-pub fn block_on_async<F: Future>(future: F) -> F::Output {
-    get_runtime().block_on(future)
-}
+// Change-log maintenance (`sync_compact_change_log`)
+pub mod sync;
+
+// Cursor-based streaming list API (`*_list_open` / `cursor_next` / `cursor_close`)
+pub mod cursor;
+
+// Multi-call batch envelope (`core_execute_batch`)
+pub mod batch;
+
+// Buffer-based result ABI (`*_buf` / `*_into`, optional MessagePack)
+pub mod result_buffer;
+pub use result_buffer::{handle_buffer_result, handle_into_result};
+
+// Generation-stamped read-through cache for hot read endpoints
+pub mod result_cache;
+
+// Runtime management (current-thread by default, opt-in multi-threaded)
+pub mod runtime;
+pub use runtime::{get_runtime, block_on_async, FfiCompletionCallback};
 
 /// Error handling helper for FFI boundaries (returns error code)
 pub fn handle_status_result<F>(func: F) -> c_int
 where
     F: FnOnce() -> FFIResult<()>,
 {
-    match func() {
+    handle_status_result_for::<F, F>(func)
+}
+
+/// `handle_status_result`, with the call timed under the entry point whose
+/// closure type is `N` (for helpers that wrap the entry point's closure)
+pub(crate) fn handle_status_result_for<N, F>(func: F) -> c_int
+where
+    F: FnOnce() -> FFIResult<()>,
+{
+    let timer = crate::metrics::begin_call::<N>();
+    let result = func();
+    timer.finish(result.is_ok());
+    match result {
         Ok(_) => {
             // Clear any previous error on success
             error::clear_last_error();
@@ -66,6 +80,22 @@ where
     }
 }
 
+/// `serde_json::from_str` for entry-point payloads, timed as the call's parse phase
+pub fn parse_payload<'a, T>(json: &'a str) -> serde_json::Result<T>
+where
+    T: serde::Deserialize<'a>,
+{
+    crate::metrics::in_phase(crate::metrics::Phase::Parse, || serde_json::from_str(json))
+}
+
+/// `serde_json::to_string` for entry-point results, timed as the call's serialize phase
+pub fn to_json_result<T>(value: &T) -> serde_json::Result<String>
+where
+    T: ?Sized + Serialize,
+{
+    crate::metrics::in_phase(crate::metrics::Phase::Serialize, || serde_json::to_string(value))
+}
+
 /// Handles results for FFI functions that return data, serializing Ok(T) or Err(FFIError) to JSON.
 /// Returns a pointer to a C string (must be freed by the caller).
 pub fn handle_json_result<F, T>(func: F) -> *mut c_char
@@ -73,8 +103,10 @@ where
     F: FnOnce() -> FFIResult<T>,
     T: Serialize,
 {
+    let timer = crate::metrics::begin_call::<F>();
     let result = func();
-    let json_string = match result {
+    let ok = result.is_ok();
+    let json_string = crate::metrics::in_phase(crate::metrics::Phase::Serialize, || match result {
         Ok(value) => {
             // Clear any previous error on success
             error::clear_last_error();
@@ -88,7 +120,8 @@ where
             // Serialize the FFIError itself
             serde_json::to_string(&ffi_error)
         },
-    };
+    });
+    timer.finish(ok);
 
     let final_json = match json_string {
         Ok(s) => s,
@@ -151,3 +184,27 @@ pub fn track_string_deallocation(_ptr: *mut std::os::raw::c_char) {
 pub fn get_allocated_string_count() -> usize {
     ALLOCATION_COUNTER.load(std::sync::atomic::Ordering::Relaxed)
 }
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn payload_helpers_are_timed_as_parse_and_serialize() {
+        let payload = serde_json::to_string(&vec!["participant"; 50_000]).unwrap();
+        handle_status_result(|| {
+            let items: Vec<String> = parse_payload(&payload).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+            to_json_result(&items).map_err(|e| FFIError::internal(format!("ser {e}")))?;
+            Ok(())
+        });
+
+        let snapshot = crate::metrics::snapshot();
+        let stats = snapshot
+            .functions
+            .iter()
+            .find(|f| f.name == "payload_helpers_are_timed_as_parse_and_serialize")
+            .unwrap();
+        assert!(stats.phases.parse_ms > 0.0);
+        assert!(stats.phases.serialize_ms > 0.0);
+    }
+}
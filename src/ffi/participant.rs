@@ -22,9 +22,10 @@
 //   of each payload is documented above every function.
 // ----------------------------------------------------------------------------
 
-use crate::ffi::{handle_status_result, error::FFIError};
+use crate::ffi::{handle_status_result, parse_payload, to_json_result, handle_buffer_result, handle_into_result, error::{FFIError, FFIResult}};
+use crate::ffi::cursor::{open_cursor, CursorSortDto, KeysetQuery};
 use crate::domains::participant::types::{
-    NewParticipant, UpdateParticipant, ParticipantResponse, ParticipantInclude,
+    ParticipantRow, NewParticipant, UpdateParticipant, ParticipantResponse, ParticipantInclude,
     ParticipantDemographics, ParticipantWithWorkshops, ParticipantWithLivelihoods, 
     ParticipantWithDocumentTimeline, ParticipantFilter, ParticipantWithEnrichment,
     ParticipantEngagementMetrics, ParticipantStatistics, ParticipantBulkOperationResult,
@@ -33,14 +34,18 @@ use crate::domains::participant::types::{
 };
 use crate::domains::sync::types::SyncPriority;
 use crate::domains::compression::types::CompressionPriority;
+use crate::domains::core::search::SearchMode;
 use crate::domains::core::repository::DeleteResult;
 use crate::auth::AuthContext;
-use crate::types::{UserRole, PaginationParams};
+use crate::types::{UserRole, Permission, PaginationParams, PaginatedResult};
 use crate::globals;
 
 use std::ffi::{CStr, CString};
-use std::os::raw::{c_char, c_int};
+use std::os::raw::{c_char, c_int, c_void};
+use crate::ffi::FfiCompletionCallback;
 use std::str::FromStr;
+use sqlx::FromRow;
+use sqlx::sqlite::SqliteRow;
 use uuid::Uuid;
 use serde::{Deserialize, Serialize};
 use std::collections::HashMap;
@@ -154,14 +159,14 @@ pub unsafe extern "C" fn participant_create(payload_json: *const c_char, result:
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_participant_service()?;
         
         let participant = block_on_async(svc.create_participant(p.participant, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&participant)
+        let json_resp = to_json_result(&participant)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -200,7 +205,7 @@ pub unsafe extern "C" fn participant_create_with_documents(payload_json: *const
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         
         // Decode all documents
         let mut documents = Vec::new();
@@ -230,7 +235,7 @@ pub unsafe extern "C" fn participant_create_with_documents(payload_json: *const
             document_results: doc_results.into_iter().map(|r| r.map_err(|e| e.to_string())).collect(),
         };
         
-        let json_resp = serde_json::to_string(&response)
+        let json_resp = to_json_result(&response)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -260,7 +265,7 @@ pub unsafe extern "C" fn participant_get(payload_json: *const c_char, result: *m
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         
@@ -273,7 +278,7 @@ pub unsafe extern "C" fn participant_get(payload_json: *const c_char, result: *m
         let participant = block_on_async(svc.get_participant_by_id(id, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&participant)
+        let json_resp = to_json_result(&participant)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -291,32 +296,10 @@ pub unsafe extern "C" fn participant_get(payload_json: *const c_char, result: *m
 #[unsafe(no_mangle)]
 pub unsafe extern "C" fn participant_list(payload_json: *const c_char, result: *mut *mut c_char) -> c_int {
     handle_status_result(|| unsafe {
-        ensure_ptr!(payload_json);
         ensure_ptr!(result);
+        let participants = list_participants_from_payload(payload_json)?;
         
-        let json = CStr::from_ptr(payload_json).to_str().map_err(|_| FFIError::invalid_argument("utf8"))?;
-        
-        #[derive(Deserialize)]
-        struct Payload {
-            pagination: Option<PaginationDto>,
-            include: Option<Vec<ParticipantIncludeDto>>,
-            auth: AuthCtxDto,
-        }
-        
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
-        let params = p.pagination.map(|p| p.into()).unwrap_or_default();
-        let auth: AuthContext = p.auth.try_into()?;
-        
-        let include: Option<Vec<ParticipantInclude>> = p.include.map(|inc| 
-            inc.into_iter().map(|i| i.into()).collect()
-        );
-        let include_slice = include.as_ref().map(|v| v.as_slice());
-        
-        let svc = globals::get_participant_service()?;
-        let participants = block_on_async(svc.list_participants(params, include_slice, &auth))
-            .map_err(FFIError::from_service_error)?;
-        
-        let json_resp = serde_json::to_string(&participants)
+        let json_resp = to_json_result(&participants)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -324,6 +307,56 @@ pub unsafe extern "C" fn participant_list(payload_json: *const c_char, result: *
     })
 }
 
+/// `participant_list` through the calling thread's result buffer (see
+/// `src/ffi/result_buffer.rs`). `*out_ptr` stays valid until the next
+/// buffer-returning call on this thread and must not be freed.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn participant_list_buf(
+    payload_json: *const c_char,
+    out_ptr: *mut *const u8,
+    out_len: *mut usize,
+) -> c_int {
+    handle_buffer_result(|| unsafe { list_participants_from_payload(payload_json) }, out_ptr, out_len)
+}
+
+/// `participant_list` encoded into a caller-owned buffer of `capacity` bytes.
+/// Fails with `BufferTooSmall` and the required size in `*out_len` if it does not fit.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn participant_list_into(
+    payload_json: *const c_char,
+    buf: *mut u8,
+    capacity: usize,
+    out_len: *mut usize,
+) -> c_int {
+    handle_into_result(|| unsafe { list_participants_from_payload(payload_json) }, buf, capacity, out_len)
+}
+
+unsafe fn list_participants_from_payload(payload_json: *const c_char) -> FFIResult<PaginatedResult<ParticipantResponse>> {
+    ensure_ptr!(payload_json);
+    
+    let json = CStr::from_ptr(payload_json).to_str().map_err(|_| FFIError::invalid_argument("utf8"))?;
+    
+    #[derive(Deserialize)]
+    struct Payload {
+        pagination: Option<PaginationDto>,
+        include: Option<Vec<ParticipantIncludeDto>>,
+        auth: AuthCtxDto,
+    }
+    
+    let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+    let params = p.pagination.map(|p| p.into()).unwrap_or_default();
+    let auth: AuthContext = p.auth.try_into()?;
+    
+    let include: Option<Vec<ParticipantInclude>> = p.include.map(|inc| 
+        inc.into_iter().map(|i| i.into()).collect()
+    );
+    let include_slice = include.as_ref().map(|v| v.as_slice());
+    
+    let svc = globals::get_participant_service()?;
+    block_on_async(svc.list_participants(params, include_slice, &auth))
+        .map_err(FFIError::from_service_error)
+}
+
 /// Update participant
 /// Expected JSON payload:
 /// {
@@ -346,7 +379,7 @@ pub unsafe extern "C" fn participant_update(payload_json: *const c_char, result:
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_participant_service()?;
@@ -354,7 +387,7 @@ pub unsafe extern "C" fn participant_update(payload_json: *const c_char, result:
         let participant = block_on_async(svc.update_participant(id, p.update, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&participant)
+        let json_resp = to_json_result(&participant)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -384,7 +417,7 @@ pub unsafe extern "C" fn participant_delete(payload_json: *const c_char, result:
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_participant_service()?;
@@ -394,7 +427,7 @@ pub unsafe extern "C" fn participant_delete(payload_json: *const c_char, result:
             .map_err(FFIError::from_service_error)?;
         
         // Serialize and return the DeleteResult
-        let json_resp = serde_json::to_string(&delete_result)
+        let json_resp = to_json_result(&delete_result)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -426,14 +459,14 @@ pub unsafe extern "C" fn participant_find_ids_by_filter(payload_json: *const c_c
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_participant_service()?;
         
         let ids = block_on_async(svc.find_participant_ids_by_filter(p.filter, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&ids)
+        let json_resp = to_json_result(&ids)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -465,7 +498,7 @@ pub unsafe extern "C" fn participant_find_by_filter(payload_json: *const c_char,
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let params = p.pagination.map(|p| p.into()).unwrap_or_default();
         let auth: AuthContext = p.auth.try_into()?;
         
@@ -478,7 +511,7 @@ pub unsafe extern "C" fn participant_find_by_filter(payload_json: *const c_char,
         let participants = block_on_async(svc.find_participants_by_filter(p.filter, params, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&participants)
+        let json_resp = to_json_result(&participants)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -508,7 +541,7 @@ pub unsafe extern "C" fn participant_bulk_update_sync_priority_by_filter(payload
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let sync_priority = SyncPriority::from_str(&p.sync_priority)
             .map_err(|_| FFIError::invalid_argument("invalid sync_priority"))?;
         let auth: AuthContext = p.auth.try_into()?;
@@ -523,7 +556,7 @@ pub unsafe extern "C" fn participant_bulk_update_sync_priority_by_filter(payload
         }
         
         let response = BulkUpdateResponse { updated_count: updated_count as usize };
-        let json_resp = serde_json::to_string(&response)
+        let json_resp = to_json_result(&response)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -535,6 +568,7 @@ pub unsafe extern "C" fn participant_bulk_update_sync_priority_by_filter(payload
 /// Expected JSON payload:
 /// {
 ///   "search_text": "string",
+///   "mode": "like" | "fts",           // optional, default "like"; "fts" = ranked prefix search
 ///   "pagination": { PaginationDto },
 ///   "auth": { AuthCtxDto }
 /// }
@@ -549,19 +583,21 @@ pub unsafe extern "C" fn participant_search_with_relationships(payload_json: *co
         #[derive(Deserialize)]
         struct Payload {
             search_text: String,
+            #[serde(default)]
+            mode: SearchMode,
             pagination: Option<PaginationDto>,
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let params = p.pagination.map(|p| p.into()).unwrap_or_default();
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_participant_service()?;
         
-        let participants = block_on_async(svc.search_participants_with_relationships(&p.search_text, params, &auth))
+        let participants = block_on_async(svc.search_participants_with_relationships(&p.search_text, params, p.mode, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&participants)
+        let json_resp = to_json_result(&participants)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -593,7 +629,7 @@ pub unsafe extern "C" fn participant_get_with_enrichment(payload_json: *const c_
             auth: AuthCtxDto 
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_participant_service()?;
@@ -601,7 +637,7 @@ pub unsafe extern "C" fn participant_get_with_enrichment(payload_json: *const c_
         let enriched_participant = block_on_async(svc.get_participant_with_enrichment(id, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&enriched_participant)
+        let json_resp = to_json_result(&enriched_participant)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -625,14 +661,14 @@ pub unsafe extern "C" fn participant_get_comprehensive_statistics(payload_json:
         #[derive(Deserialize)]
         struct Payload { auth: AuthCtxDto }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_participant_service()?;
         
         let statistics = block_on_async(svc.get_comprehensive_statistics(&auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&statistics)
+        let json_resp = to_json_result(&statistics)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -660,7 +696,7 @@ pub unsafe extern "C" fn participant_get_document_references(payload_json: *cons
             auth: AuthCtxDto 
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let participant_id = Uuid::parse_str(&p.participant_id).map_err(|_| FFIError::invalid_argument("invalid participant_id"))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_participant_service()?;
@@ -668,7 +704,7 @@ pub unsafe extern "C" fn participant_get_document_references(payload_json: *cons
         let document_refs = block_on_async(svc.get_participant_document_references(participant_id, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&document_refs)
+        let json_resp = to_json_result(&document_refs)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -708,7 +744,7 @@ pub unsafe extern "C" fn participant_bulk_update_streaming(payload_json: *const
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         
         // Convert string IDs to UUIDs
@@ -725,7 +761,7 @@ pub unsafe extern "C" fn participant_bulk_update_streaming(payload_json: *const
         let bulk_result = block_on_async(svc.bulk_update_participants_streaming(updates, chunk_size, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&bulk_result)
+        let json_resp = to_json_result(&bulk_result)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -733,6 +769,71 @@ pub unsafe extern "C" fn participant_bulk_update_streaming(payload_json: *const
     })
 }
 
+/// Create many participants at once (imports)
+/// Expected JSON payload, with the records either inline or in a JSON Lines
+/// file (one NewParticipant per line):
+/// {
+///   "participants": [{ NewParticipant }, ...],   // or
+///   "jsonl_path": "/path/to/import.jsonl",
+///   "auth": { AuthCtxDto }
+/// }
+/// Returns a ParticipantBulkCreateResult; invalid records are listed by index
+/// and do not prevent the others from being created.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn participant_bulk_create(payload_json: *const c_char, result: *mut *mut c_char) -> c_int {
+    handle_status_result(|| unsafe {
+        ensure_ptr!(payload_json);
+        ensure_ptr!(result);
+        
+        let json = CStr::from_ptr(payload_json).to_str().map_err(|_| FFIError::invalid_argument("utf8"))?;
+        
+        #[derive(Deserialize)]
+        struct Payload {
+            participants: Option<Vec<NewParticipant>>,
+            jsonl_path: Option<String>,
+            auth: AuthCtxDto,
+        }
+        
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let auth: AuthContext = p.auth.try_into()?;
+        
+        let participants = match (p.participants, p.jsonl_path) {
+            (Some(participants), None) => participants,
+            (None, Some(path)) => read_participants_jsonl(&path)?,
+            _ => return Err(FFIError::invalid_argument("exactly one of participants or jsonl_path is required")),
+        };
+        
+        let svc = globals::get_participant_service()?;
+        let bulk_result = block_on_async(svc.bulk_create_participants(participants, &auth))
+            .map_err(FFIError::from_service_error)?;
+        
+        let json_resp = to_json_result(&bulk_result)
+            .map_err(|e| FFIError::internal(format!("ser {e}")))?;
+        let cstr = CString::new(json_resp).unwrap();
+        *result = cstr.into_raw();
+        Ok(())
+    })
+}
+
+/// Read one NewParticipant per non-empty line
+fn read_participants_jsonl(path: &str) -> FFIResult<Vec<NewParticipant>> {
+    use std::io::BufRead;
+    
+    let file = std::fs::File::open(path)
+        .map_err(|e| FFIError::invalid_argument(&format!("cannot open {path}: {e}")))?;
+    let mut participants = Vec::new();
+    for (number, line) in std::io::BufReader::new(file).lines().enumerate() {
+        let line = line.map_err(|e| FFIError::internal(format!("read {path}: {e}")))?;
+        if line.trim().is_empty() {
+            continue;
+        }
+        let participant = parse_payload(&line)
+            .map_err(|e| FFIError::invalid_argument(&format!("line {}: {e}", number + 1)))?;
+        participants.push(participant);
+    }
+    Ok(participants)
+}
+
 /// Get database index optimization suggestions
 /// Expected JSON payload:
 /// {
@@ -749,14 +850,14 @@ pub unsafe extern "C" fn participant_get_index_optimization_suggestions(payload_
         #[derive(Deserialize)]
         struct Payload { auth: AuthCtxDto }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_participant_service()?;
         
         let suggestions = block_on_async(svc.get_index_optimization_suggestions(&auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&suggestions)
+        let json_resp = to_json_result(&suggestions)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -784,14 +885,14 @@ pub unsafe extern "C" fn participant_find_ids_by_filter_optimized(payload_json:
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_participant_service()?;
         
         let ids = block_on_async(svc.find_participant_ids_by_filter_optimized(p.filter, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&ids)
+        let json_resp = to_json_result(&ids)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -837,7 +938,7 @@ pub unsafe extern "C" fn participant_upload_document(payload_json: *const c_char
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         
         // Decode base64 file data
         let file_data = base64::decode(&p.file_data)
@@ -870,7 +971,7 @@ pub unsafe extern "C" fn participant_upload_document(payload_json: *const c_char
             &auth,
         )).map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&document)
+        let json_resp = to_json_result(&document)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -914,7 +1015,7 @@ pub unsafe extern "C" fn participant_bulk_upload_documents(payload_json: *const
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         
         // Decode all files
         let mut files = Vec::new();
@@ -949,7 +1050,7 @@ pub unsafe extern "C" fn participant_bulk_upload_documents(payload_json: *const
             &auth,
         )).map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&documents)
+        let json_resp = to_json_result(&documents)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -977,14 +1078,14 @@ pub unsafe extern "C" fn participant_get_demographics(payload_json: *const c_cha
         #[derive(Deserialize)]
         struct Payload { auth: AuthCtxDto }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_participant_service()?;
         
         let demographics = block_on_async(svc.get_participant_demographics(&auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&demographics)
+        let json_resp = to_json_result(&demographics)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -1008,14 +1109,14 @@ pub unsafe extern "C" fn participant_get_gender_distribution(payload_json: *cons
         #[derive(Deserialize)]
         struct Payload { auth: AuthCtxDto }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_participant_service()?;
         
         let distribution = block_on_async(svc.get_gender_distribution(&auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&distribution)
+        let json_resp = to_json_result(&distribution)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -1039,14 +1140,14 @@ pub unsafe extern "C" fn participant_get_age_group_distribution(payload_json: *c
         #[derive(Deserialize)]
         struct Payload { auth: AuthCtxDto }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_participant_service()?;
         
         let distribution = block_on_async(svc.get_age_group_distribution(&auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&distribution)
+        let json_resp = to_json_result(&distribution)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -1070,14 +1171,14 @@ pub unsafe extern "C" fn participant_get_location_distribution(payload_json: *co
         #[derive(Deserialize)]
         struct Payload { auth: AuthCtxDto }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_participant_service()?;
         
         let distribution = block_on_async(svc.get_location_distribution(&auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&distribution)
+        let json_resp = to_json_result(&distribution)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -1101,14 +1202,14 @@ pub unsafe extern "C" fn participant_get_disability_distribution(payload_json: *
         #[derive(Deserialize)]
         struct Payload { auth: AuthCtxDto }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_participant_service()?;
         
         let distribution = block_on_async(svc.get_disability_distribution(&auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&distribution)
+        let json_resp = to_json_result(&distribution)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -1144,7 +1245,7 @@ pub unsafe extern "C" fn participant_find_by_gender(payload_json: *const c_char,
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let params = p.pagination.map(|p| p.into()).unwrap_or_default();
         let auth: AuthContext = p.auth.try_into()?;
         
@@ -1157,7 +1258,7 @@ pub unsafe extern "C" fn participant_find_by_gender(payload_json: *const c_char,
         let participants = block_on_async(svc.find_participants_by_gender(&p.gender, params, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&participants)
+        let json_resp = to_json_result(&participants)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -1189,7 +1290,7 @@ pub unsafe extern "C" fn participant_find_by_age_group(payload_json: *const c_ch
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let params = p.pagination.map(|p| p.into()).unwrap_or_default();
         let auth: AuthContext = p.auth.try_into()?;
         
@@ -1202,7 +1303,7 @@ pub unsafe extern "C" fn participant_find_by_age_group(payload_json: *const c_ch
         let participants = block_on_async(svc.find_participants_by_age_group(&p.age_group, params, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&participants)
+        let json_resp = to_json_result(&participants)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -1234,7 +1335,7 @@ pub unsafe extern "C" fn participant_find_by_location(payload_json: *const c_cha
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let params = p.pagination.map(|p| p.into()).unwrap_or_default();
         let auth: AuthContext = p.auth.try_into()?;
         
@@ -1247,7 +1348,7 @@ pub unsafe extern "C" fn participant_find_by_location(payload_json: *const c_cha
         let participants = block_on_async(svc.find_participants_by_location(&p.location, params, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&participants)
+        let json_resp = to_json_result(&participants)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -1279,7 +1380,7 @@ pub unsafe extern "C" fn participant_find_by_disability(payload_json: *const c_c
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let params = p.pagination.map(|p| p.into()).unwrap_or_default();
         let auth: AuthContext = p.auth.try_into()?;
         
@@ -1292,7 +1393,7 @@ pub unsafe extern "C" fn participant_find_by_disability(payload_json: *const c_c
         let participants = block_on_async(svc.find_participants_by_disability(p.has_disability, params, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&participants)
+        let json_resp = to_json_result(&participants)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -1324,7 +1425,7 @@ pub unsafe extern "C" fn participant_get_workshop_participants(payload_json: *co
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let workshop_id = Uuid::parse_str(&p.workshop_id).map_err(|_| FFIError::invalid_argument("invalid workshop_id"))?;
         let params = p.pagination.map(|p| p.into()).unwrap_or_default();
         let auth: AuthContext = p.auth.try_into()?;
@@ -1338,7 +1439,7 @@ pub unsafe extern "C" fn participant_get_workshop_participants(payload_json: *co
         let participants = block_on_async(svc.get_workshop_participants(workshop_id, params, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&participants)
+        let json_resp = to_json_result(&participants)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -1367,7 +1468,7 @@ pub unsafe extern "C" fn participant_get_with_workshops(payload_json: *const c_c
         #[derive(Deserialize)]
         struct Payload { id: String, auth: AuthCtxDto }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_participant_service()?;
@@ -1375,7 +1476,7 @@ pub unsafe extern "C" fn participant_get_with_workshops(payload_json: *const c_c
         let participant_with_workshops = block_on_async(svc.get_participant_with_workshops(id, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&participant_with_workshops)
+        let json_resp = to_json_result(&participant_with_workshops)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -1400,7 +1501,7 @@ pub unsafe extern "C" fn participant_get_with_livelihoods(payload_json: *const c
         #[derive(Deserialize)]
         struct Payload { id: String, auth: AuthCtxDto }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_participant_service()?;
@@ -1408,7 +1509,7 @@ pub unsafe extern "C" fn participant_get_with_livelihoods(payload_json: *const c
         let participant_with_livelihoods = block_on_async(svc.get_participant_with_livelihoods(id, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&participant_with_livelihoods)
+        let json_resp = to_json_result(&participant_with_livelihoods)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -1433,7 +1534,7 @@ pub unsafe extern "C" fn participant_get_with_document_timeline(payload_json: *c
         #[derive(Deserialize)]
         struct Payload { id: String, auth: AuthCtxDto }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_participant_service()?;
@@ -1441,7 +1542,7 @@ pub unsafe extern "C" fn participant_get_with_document_timeline(payload_json: *c
         let participant_timeline = block_on_async(svc.get_participant_with_document_timeline(id, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&participant_timeline)
+        let json_resp = to_json_result(&participant_timeline)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -1470,7 +1571,7 @@ pub unsafe extern "C" fn participant_check_duplicates(payload_json: *const c_cha
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_participant_service()?;
         
@@ -1479,7 +1580,7 @@ pub unsafe extern "C" fn participant_check_duplicates(payload_json: *const c_cha
         
         println!("🔍 [FFI_DUPLICATE_CHECK] Found {} duplicates for name '{}'", duplicates.len(), p.name);
         
-        let json_resp = serde_json::to_string(&duplicates)
+        let json_resp = to_json_result(&duplicates)
             .map_err(|e| {
                 println!("🚨 [FFI_DUPLICATE_CHECK] JSON serialization failed: {}", e);
                 FFIError::internal(format!("ser {e}"))
@@ -1494,6 +1595,86 @@ pub unsafe extern "C" fn participant_check_duplicates(payload_json: *const c_cha
     })
 }
 
+// ---------------------------------------------------------------------------
+// Cursor-Based Listing
+// ---------------------------------------------------------------------------
+
+fn participant_cursor_row(row: &SqliteRow) -> FFIResult<String> {
+    let entity = ParticipantRow::from_row(row)
+        .map_err(|e| FFIError::internal(format!("row {e}")))?
+        .into_entity()?;
+    to_json_result(&ParticipantResponse::from(entity))
+        .map_err(|e| FFIError::internal(format!("ser {e}")))
+}
+
+static PARTICIPANT_LIST_CURSOR: KeysetQuery = KeysetQuery {
+    table: "participants",
+    columns: "*",
+    sort_column: "name",
+    descending: false,
+    sortable: &["name", "created_at", "updated_at"],
+    map_row: participant_cursor_row,
+};
+
+/// Open a streaming cursor over the participants matching an optional filter,
+/// ordered by name unless `sort` names another column
+/// Expected JSON payload:
+/// {
+///   "filter": { ParticipantFilter },
+///   "sort": { "field": "updated_at", "descending": true },
+///   "auth": { AuthCtxDto }
+/// }
+/// Writes an opaque handle to `cursor_out`; read batches with `cursor_next`
+/// and release it with `cursor_close` (see `src/ffi/cursor.rs`).
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn participant_list_open(payload_json: *const c_char, cursor_out: *mut u64) -> c_int {
+    handle_status_result(|| unsafe {
+        ensure_ptr!(payload_json);
+        ensure_ptr!(cursor_out);
+        
+        let json = CStr::from_ptr(payload_json).to_str().map_err(|_| FFIError::invalid_argument("utf8"))?;
+        
+        #[derive(Deserialize)]
+        struct Payload {
+            filter: Option<ParticipantFilter>,
+            sort: Option<CursorSortDto>,
+            auth: AuthCtxDto,
+        }
+        
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let auth: AuthContext = p.auth.try_into()?;
+        auth.authorize(Permission::ViewParticipants)?;
+        
+        let ids = p.filter.map(|filter| {
+            let svc = globals::get_participant_service()?;
+            block_on_async(svc.find_participant_ids_by_filter(filter, &auth))
+                .map_err(FFIError::from_service_error)
+        }).transpose()?;
+        *cursor_out = open_cursor(&PARTICIPANT_LIST_CURSOR, p.sort, ids)?;
+        Ok(())
+    })
+}
+
+// ---------------------------------------------------------------------------
+// Async Variants
+// ---------------------------------------------------------------------------
+
+// Non-blocking versions of the calls above. They take the same payload, return
+// immediately, and invoke `callback(ctx, status, result)` from a background
+// thread once done. `result` must be freed with `participant_free`.
+
+/// Async variant of `participant_list`
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn participant_list_async(payload_json: *const c_char, ctx: *mut c_void, callback: FfiCompletionCallback) -> c_int {
+    crate::ffi::runtime::dispatch_async(participant_list, payload_json, ctx, callback)
+}
+
+/// Async variant of `participant_get_demographics`
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn participant_get_demographics_async(payload_json: *const c_char, ctx: *mut c_void, callback: FfiCompletionCallback) -> c_int {
+    crate::ffi::runtime::dispatch_async(participant_get_demographics, payload_json, ctx, callback)
+}
+
 // ---------------------------------------------------------------------------
 // Memory Management
 // ---------------------------------------------------------------------------
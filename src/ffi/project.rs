@@ -22,21 +22,27 @@
 //   of each payload is documented above every function.
 // ----------------------------------------------------------------------------
 
-use crate::ffi::{handle_status_result, error::FFIError};
+use crate::ffi::{handle_status_result, parse_payload, to_json_result, error::{FFIError, FFIResult}};
+use crate::ffi::result_cache;
+use crate::ffi::cursor::{open_cursor, CursorSortDto, KeysetQuery};
 use crate::domains::project::types::{
-    NewProject, UpdateProject, ProjectResponse, ProjectInclude, ProjectSummary,
+    ProjectRow, NewProject, UpdateProject, ProjectResponse, ProjectInclude, ProjectSummary,
     ProjectStatistics, ProjectStatusBreakdown, ProjectMetadataCounts,
     ProjectWithDocumentTimeline, ProjectDocumentReference
 };
 use crate::domains::sync::types::SyncPriority;
 use crate::domains::compression::types::CompressionPriority;
+use crate::domains::core::search::SearchMode;
 use crate::auth::AuthContext;
-use crate::types::{UserRole, PaginationParams};
+use crate::types::{UserRole, Permission, PaginationParams};
 use crate::globals;
 
 use std::ffi::{CStr, CString};
-use std::os::raw::{c_char, c_int};
+use std::os::raw::{c_char, c_int, c_void};
+use crate::ffi::FfiCompletionCallback;
 use std::str::FromStr;
+use sqlx::FromRow;
+use sqlx::sqlite::SqliteRow;
 use uuid::Uuid;
 use serde::{Deserialize, Serialize};
 use std::collections::HashMap;
@@ -112,6 +118,34 @@ impl From<PaginationDto> for PaginationParams {
     }
 }
 
+/// DTO for project filter criteria; unparseable goal ids are dropped
+#[derive(Deserialize)]
+struct ProjectFilterDto {
+    status_ids: Option<Vec<i64>>,
+    strategic_goal_ids: Option<Vec<String>>,
+    responsible_teams: Option<Vec<String>>,
+    search_text: Option<String>,
+    date_range: Option<(String, String)>,
+    exclude_deleted: Option<bool>,
+}
+
+impl From<ProjectFilterDto> for crate::domains::project::types::ProjectFilter {
+    fn from(dto: ProjectFilterDto) -> Self {
+        crate::domains::project::types::ProjectFilter {
+            status_ids: dto.status_ids,
+            strategic_goal_ids: dto.strategic_goal_ids.map(|ids| {
+                ids.into_iter()
+                    .filter_map(|id| Uuid::parse_str(&id).ok())
+                    .collect()
+            }),
+            responsible_teams: dto.responsible_teams,
+            search_text: dto.search_text,
+            date_range: dto.date_range,
+            exclude_deleted: dto.exclude_deleted,
+        }
+    }
+}
+
 /// DTO for project includes
 #[derive(Deserialize)]
 #[serde(rename_all = "snake_case")]
@@ -184,7 +218,7 @@ pub unsafe extern "C" fn project_create(payload_json: *const c_char, result: *mu
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         
         // Convert DTO to domain struct with UUID parsing
@@ -217,7 +251,7 @@ pub unsafe extern "C" fn project_create(payload_json: *const c_char, result: *mu
         let project = block_on_async(svc.create_project(new_project, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&project)
+        let json_resp = to_json_result(&project)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -269,7 +303,7 @@ pub unsafe extern "C" fn project_create_with_documents(payload_json: *const c_ch
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         
         // Decode all documents
         let mut documents = Vec::new();
@@ -325,7 +359,7 @@ pub unsafe extern "C" fn project_create_with_documents(payload_json: *const c_ch
             document_results: doc_results.into_iter().map(|r| r.map_err(|e| e.to_string())).collect(),
         };
         
-        let json_resp = serde_json::to_string(&response)
+        let json_resp = to_json_result(&response)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -355,7 +389,7 @@ pub unsafe extern "C" fn project_get(payload_json: *const c_char, result: *mut *
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         
@@ -366,7 +400,7 @@ pub unsafe extern "C" fn project_get(payload_json: *const c_char, result: *mut *
         let project = block_on_async(svc.get_project_by_id(id, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&project)
+        let json_resp = to_json_result(&project)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -396,7 +430,7 @@ pub unsafe extern "C" fn project_list(payload_json: *const c_char, result: *mut
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let params = parse_pagination(p.pagination);
         let auth: AuthContext = p.auth.try_into()?;
         
@@ -407,7 +441,7 @@ pub unsafe extern "C" fn project_list(payload_json: *const c_char, result: *mut
         let projects = block_on_async(svc.list_projects(params, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&projects)
+        let json_resp = to_json_result(&projects)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -437,13 +471,13 @@ pub unsafe extern "C" fn project_update(payload_json: *const c_char, result: *mu
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         
         // Debug: Print the deserialized UpdateProject struct
         println!("🔧 [FFI_UPDATE] Deserialized UpdateProject:");
         println!("   • strategic_goal_id: {:?}", p.update.strategic_goal_id);
         println!("   • Raw JSON strategic_goal_id: {:?}", 
-            serde_json::from_str::<serde_json::Value>(json)
+            parse_payload::<serde_json::Value>(json)
                 .and_then(|v| Ok(v.get("update").and_then(|u| u.get("strategic_goal_id")).cloned()))
                 .unwrap_or(Some(serde_json::Value::String("PARSE_ERROR".to_string())))
         );
@@ -455,7 +489,7 @@ pub unsafe extern "C" fn project_update(payload_json: *const c_char, result: *mu
         let project = block_on_async(svc.update_project(id, p.update, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&project)
+        let json_resp = to_json_result(&project)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -485,7 +519,7 @@ pub unsafe extern "C" fn project_delete(payload_json: *const c_char, result: *mu
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_project_service()?;
@@ -493,7 +527,7 @@ pub unsafe extern "C" fn project_delete(payload_json: *const c_char, result: *mu
         let delete_result = block_on_async(svc.delete_project(id, p.hard_delete.unwrap_or(false), &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&delete_result)
+        let json_resp = to_json_result(&delete_result)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -539,7 +573,7 @@ pub unsafe extern "C" fn project_upload_document(payload_json: *const c_char, re
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         
         // Decode base64 file data
         let file_data = base64::decode(&p.file_data)
@@ -572,7 +606,7 @@ pub unsafe extern "C" fn project_upload_document(payload_json: *const c_char, re
             &auth,
         )).map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&document)
+        let json_resp = to_json_result(&document)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -616,7 +650,7 @@ pub unsafe extern "C" fn project_bulk_upload_documents(payload_json: *const c_ch
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         
         // Decode all files
         let mut files = Vec::new();
@@ -651,7 +685,7 @@ pub unsafe extern "C" fn project_bulk_upload_documents(payload_json: *const c_ch
             &auth,
         )).map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&documents)
+        let json_resp = to_json_result(&documents)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -679,15 +713,14 @@ pub unsafe extern "C" fn project_get_statistics(payload_json: *const c_char, res
         #[derive(Deserialize)]
         struct Payload { auth: AuthCtxDto }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
-        let svc = globals::get_project_service()?;
-        
-        let stats = block_on_async(svc.get_project_statistics(&auth))
-            .map_err(FFIError::from_service_error)?;
-        
-        let json_resp = serde_json::to_string(&stats)
-            .map_err(|e| FFIError::internal(format!("ser {e}")))?;
+        let json_resp = result_cache::cached_json("project_get_statistics", result_cache::cache_args(json), &auth, &["projects", "strategic_goals", "media_documents"], || {
+            let svc = globals::get_project_service()?;
+            let stats = block_on_async(svc.get_project_statistics(&auth))
+                .map_err(FFIError::from_service_error)?;
+            to_json_result(&stats).map_err(|e| FFIError::internal(format!("ser {e}")))
+        })?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
         Ok(())
@@ -710,14 +743,14 @@ pub unsafe extern "C" fn project_get_status_breakdown(payload_json: *const c_cha
         #[derive(Deserialize)]
         struct Payload { auth: AuthCtxDto }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_project_service()?;
         
         let breakdown = block_on_async(svc.get_project_status_breakdown(&auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&breakdown)
+        let json_resp = to_json_result(&breakdown)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -741,14 +774,14 @@ pub unsafe extern "C" fn project_get_metadata_counts(payload_json: *const c_char
         #[derive(Deserialize)]
         struct Payload { auth: AuthCtxDto }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_project_service()?;
         
         let counts = block_on_async(svc.get_project_metadata_counts(&auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&counts)
+        let json_resp = to_json_result(&counts)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -784,7 +817,7 @@ pub unsafe extern "C" fn project_find_by_status(payload_json: *const c_char, res
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let params = parse_pagination(p.pagination);
         let auth: AuthContext = p.auth.try_into()?;
         
@@ -795,7 +828,7 @@ pub unsafe extern "C" fn project_find_by_status(payload_json: *const c_char, res
         let projects = block_on_async(svc.find_projects_by_status(p.status_id, params, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&projects)
+        let json_resp = to_json_result(&projects)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -827,7 +860,7 @@ pub unsafe extern "C" fn project_find_by_responsible_team(payload_json: *const c
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let params = parse_pagination(p.pagination);
         let auth: AuthContext = p.auth.try_into()?;
         
@@ -838,7 +871,7 @@ pub unsafe extern "C" fn project_find_by_responsible_team(payload_json: *const c
         let projects = block_on_async(svc.find_projects_by_responsible_team(&p.team_name, params, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&projects)
+        let json_resp = to_json_result(&projects)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -872,7 +905,7 @@ pub unsafe extern "C" fn project_find_by_date_range(payload_json: *const c_char,
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let params = parse_pagination(p.pagination);
         let auth: AuthContext = p.auth.try_into()?;
         
@@ -883,7 +916,7 @@ pub unsafe extern "C" fn project_find_by_date_range(payload_json: *const c_char,
         let projects = block_on_async(svc.find_projects_by_date_range(&p.start_date, &p.end_date, params, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&projects)
+        let json_resp = to_json_result(&projects)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -896,6 +929,7 @@ pub unsafe extern "C" fn project_find_by_date_range(payload_json: *const c_char,
 /// {
 ///   "query": "string",
 ///   "search_fields": ["name", "objective", "outcome"],
+///   "mode": "like" | "fts",           // optional, default "like"; "fts" = ranked prefix search
 ///   "pagination": { PaginationDto },
 ///   "include": [ProjectIncludeDto, ...],
 ///   "auth": { AuthCtxDto }
@@ -912,12 +946,14 @@ pub unsafe extern "C" fn project_search(payload_json: *const c_char, result: *mu
         struct Payload {
             query: String,
             // search_fields: Option<Vec<String>>, // Currently unused - could be used for field-specific search
+            #[serde(default)]
+            mode: SearchMode,
             pagination: Option<PaginationDto>,
             include: Option<Vec<ProjectIncludeDto>>,
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let params = parse_pagination(p.pagination);
         let auth: AuthContext = p.auth.try_into()?;
         
@@ -925,10 +961,10 @@ pub unsafe extern "C" fn project_search(payload_json: *const c_char, result: *mu
         let include_slice = include.as_ref().map(|v| v.as_slice());
         
         let svc = globals::get_project_service()?;
-        let projects = block_on_async(svc.search_projects(&p.query, params, include_slice, &auth))
+        let projects = block_on_async(svc.search_projects(&p.query, params, p.mode, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&projects)
+        let json_resp = to_json_result(&projects)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -957,7 +993,7 @@ pub unsafe extern "C" fn project_get_with_document_timeline(payload_json: *const
         #[derive(Deserialize)]
         struct Payload { id: String, auth: AuthCtxDto }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_project_service()?;
@@ -965,7 +1001,7 @@ pub unsafe extern "C" fn project_get_with_document_timeline(payload_json: *const
         let project_timeline = block_on_async(svc.get_project_with_document_timeline(id, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&project_timeline)
+        let json_resp = to_json_result(&project_timeline)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -990,7 +1026,7 @@ pub unsafe extern "C" fn project_get_document_references(payload_json: *const c_
         #[derive(Deserialize)]
         struct Payload { id: String, auth: AuthCtxDto }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_project_service()?;
@@ -998,7 +1034,7 @@ pub unsafe extern "C" fn project_get_document_references(payload_json: *const c_
         let doc_refs = block_on_async(svc.get_project_document_references(id, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&doc_refs)
+        let json_resp = to_json_result(&doc_refs)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -1031,47 +1067,23 @@ pub unsafe extern "C" fn project_get_filtered_ids(payload_json: *const c_char, r
         
         let json = CStr::from_ptr(payload_json).to_str().map_err(|_| FFIError::invalid_argument("utf8"))?;
         
-        #[derive(Deserialize)]
-        struct FilterDto {
-            status_ids: Option<Vec<i64>>,
-            strategic_goal_ids: Option<Vec<String>>,
-            responsible_teams: Option<Vec<String>>,
-            search_text: Option<String>,
-            date_range: Option<(String, String)>,
-            exclude_deleted: Option<bool>,
-        }
-        
         #[derive(Deserialize)]
         struct Payload {
-            filter: FilterDto,
+            filter: ProjectFilterDto,
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         
-        // Convert FilterDto to ProjectFilter
-        let filter = crate::domains::project::types::ProjectFilter {
-            status_ids: p.filter.status_ids,
-            strategic_goal_ids: p.filter.strategic_goal_ids.map(|ids| {
-                ids.into_iter()
-                    .filter_map(|id| Uuid::parse_str(&id).ok())
-                    .collect()
-            }),
-            responsible_teams: p.filter.responsible_teams,
-            search_text: p.filter.search_text,
-            date_range: p.filter.date_range,
-            exclude_deleted: p.filter.exclude_deleted,
-        };
-        
         let svc = globals::get_project_service()?;
-        let ids = block_on_async(svc.get_filtered_project_ids(filter, &auth))
+        let ids = block_on_async(svc.get_filtered_project_ids(p.filter.into(), &auth))
             .map_err(FFIError::from_service_error)?;
         
         // Convert UUIDs to strings for FFI
         let id_strings: Vec<String> = ids.into_iter().map(|id| id.to_string()).collect();
         
-        let json_resp = serde_json::to_string(&id_strings)
+        let json_resp = to_json_result(&id_strings)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -1096,14 +1108,14 @@ pub unsafe extern "C" fn project_get_team_workload_distribution(payload_json: *c
         #[derive(Deserialize)]
         struct Payload { auth: AuthCtxDto }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_project_service()?;
         
         let distribution = block_on_async(svc.get_team_workload_distribution(&auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&distribution)
+        let json_resp = to_json_result(&distribution)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -1124,14 +1136,14 @@ pub unsafe extern "C" fn project_get_strategic_goal_distribution(payload_json: *
         #[derive(Deserialize)]
         struct Payload { auth: AuthCtxDto }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_project_service()?;
         
         let distribution = block_on_async(svc.get_projects_by_strategic_goal_distribution(&auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&distribution)
+        let json_resp = to_json_result(&distribution)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -1163,7 +1175,7 @@ pub unsafe extern "C" fn project_find_stale(payload_json: *const c_char, result:
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         let params = parse_pagination(p.pagination);
         let include = parse_includes(p.include);
@@ -1173,7 +1185,7 @@ pub unsafe extern "C" fn project_find_stale(payload_json: *const c_char, result:
         let stale_projects = block_on_async(svc.find_stale_projects(p.days_stale, params, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&stale_projects)
+        let json_resp = to_json_result(&stale_projects)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -1194,14 +1206,14 @@ pub unsafe extern "C" fn project_get_document_coverage_analysis(payload_json: *c
         #[derive(Deserialize)]
         struct Payload { auth: AuthCtxDto }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_project_service()?;
         
         let analysis = block_on_async(svc.get_document_coverage_analysis(&auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&analysis)
+        let json_resp = to_json_result(&analysis)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -1229,14 +1241,14 @@ pub unsafe extern "C" fn project_get_activity_timeline(payload_json: *const c_ch
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_project_service()?;
         
         let timeline = block_on_async(svc.get_project_activity_timeline(p.days_active, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&timeline)
+        let json_resp = to_json_result(&timeline)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -1244,6 +1256,86 @@ pub unsafe extern "C" fn project_get_activity_timeline(payload_json: *const c_ch
     })
 }
 
+// ---------------------------------------------------------------------------
+// Cursor-Based Listing
+// ---------------------------------------------------------------------------
+
+fn project_cursor_row(row: &SqliteRow) -> FFIResult<String> {
+    let entity = ProjectRow::from_row(row)
+        .map_err(|e| FFIError::internal(format!("row {e}")))?
+        .into_entity()?;
+    to_json_result(&ProjectResponse::from_project(entity))
+        .map_err(|e| FFIError::internal(format!("ser {e}")))
+}
+
+static PROJECT_LIST_CURSOR: KeysetQuery = KeysetQuery {
+    table: "projects",
+    columns: "*",
+    sort_column: "name",
+    descending: false,
+    sortable: &["name", "created_at", "updated_at"],
+    map_row: project_cursor_row,
+};
+
+/// Open a streaming cursor over the projects matching an optional filter,
+/// ordered by name unless `sort` names another column
+/// Expected JSON payload:
+/// {
+///   "filter": { ProjectFilterDto, as in project_get_filtered_ids },
+///   "sort": { "field": "updated_at", "descending": true },
+///   "auth": { AuthCtxDto }
+/// }
+/// Writes an opaque handle to `cursor_out`; read batches with `cursor_next`
+/// and release it with `cursor_close` (see `src/ffi/cursor.rs`).
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn project_list_open(payload_json: *const c_char, cursor_out: *mut u64) -> c_int {
+    handle_status_result(|| unsafe {
+        ensure_ptr!(payload_json);
+        ensure_ptr!(cursor_out);
+        
+        let json = CStr::from_ptr(payload_json).to_str().map_err(|_| FFIError::invalid_argument("utf8"))?;
+        
+        #[derive(Deserialize)]
+        struct Payload {
+            filter: Option<ProjectFilterDto>,
+            sort: Option<CursorSortDto>,
+            auth: AuthCtxDto,
+        }
+        
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let auth: AuthContext = p.auth.try_into()?;
+        auth.authorize(Permission::ViewProjects)?;
+        
+        let ids = p.filter.map(|filter| {
+            let svc = globals::get_project_service()?;
+            block_on_async(svc.get_filtered_project_ids(filter.into(), &auth))
+                .map_err(FFIError::from_service_error)
+        }).transpose()?;
+        *cursor_out = open_cursor(&PROJECT_LIST_CURSOR, p.sort, ids)?;
+        Ok(())
+    })
+}
+
+// ---------------------------------------------------------------------------
+// Async Variants
+// ---------------------------------------------------------------------------
+
+// Non-blocking versions of the calls above. They take the same payload, return
+// immediately, and invoke `callback(ctx, status, result)` from a background
+// thread once done. `result` must be freed with `project_free`.
+
+/// Async variant of `project_list`
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn project_list_async(payload_json: *const c_char, ctx: *mut c_void, callback: FfiCompletionCallback) -> c_int {
+    crate::ffi::runtime::dispatch_async(project_list, payload_json, ctx, callback)
+}
+
+/// Async variant of `project_get_statistics`
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn project_get_statistics_async(payload_json: *const c_char, ctx: *mut c_void, callback: FfiCompletionCallback) -> c_int {
+    crate::ffi::runtime::dispatch_async(project_get_statistics, payload_json, ctx, callback)
+}
+
 // ---------------------------------------------------------------------------
 // Memory Management
 // ---------------------------------------------------------------------------
@@ -0,0 +1,215 @@
+// src/ffi/result_buffer.rs
+// ============================================================================
+// Buffer-based result ABI.
+//
+// The classic entry points hand back a fresh CString per call, which Swift
+// must release with the matching `*_free`. The buffer variants return raw
+// bytes instead and need no free:
+//
+//   •  `*_buf(..., &ptr, &len)` encodes the result into a buffer owned by the
+//      calling thread and reused across calls. The bytes stay valid until
+//      the next buffer-returning call on the same thread; copy them (or
+//      decode them) before calling again.
+//   •  `*_into(..., buf, cap, &len)` encodes straight into memory owned by the
+//      caller. If the result does not fit, `len` receives the required size
+//      and the call fails with `BufferTooSmall`; grow the buffer and retry.
+//
+// Bytes are not NUL-terminated. They are JSON unless
+// `initialize_library_with_config` selected `"result_encoding": "msgpack"`
+// (requires the `msgpack` feature), in which case they are MessagePack maps
+// keyed by the same field names as the JSON. Errors are reported like every
+// other status-returning call: a non-zero code plus `get_last_error`.
+// ============================================================================
+
+use crate::ffi::error::{ErrorCode, FFIError, FFIResult};
+use crate::ffi::handle_status_result_for;
+use crate::metrics::{in_phase, Phase};
+use serde::{Deserialize, Serialize};
+use std::cell::RefCell;
+use std::io::{self, Write};
+use std::os::raw::c_int;
+use std::sync::atomic::{AtomicU8, Ordering};
+
+/// Capacity the per-thread buffer keeps between calls; a larger result is
+/// released again on the next call
+const RETAINED_CAPACITY: usize = 1024 * 1024;
+
+/// Wire encoding of buffer results, chosen once at initialization
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq, Deserialize)]
+pub enum ResultEncoding {
+    #[default]
+    #[serde(rename = "json")]
+    Json = 0,
+    #[serde(rename = "msgpack", alias = "messagepack")]
+    MessagePack = 1,
+}
+
+static RESULT_ENCODING: AtomicU8 = AtomicU8::new(ResultEncoding::Json as u8);
+
+thread_local! {
+    static RESULT_BUFFER: RefCell<Vec<u8>> = RefCell::new(Vec::new());
+}
+
+/// Select the encoding used by every `*_buf` / `*_into` call
+pub fn configure_result_encoding(encoding: ResultEncoding) -> FFIResult<()> {
+    if encoding == ResultEncoding::MessagePack && !cfg!(feature = "msgpack") {
+        return Err(FFIError::new(
+            ErrorCode::ConfigurationError,
+            "result_encoding \"msgpack\" requires the msgpack feature",
+        ));
+    }
+    RESULT_ENCODING.store(encoding as u8, Ordering::Relaxed);
+    Ok(())
+}
+
+pub fn result_encoding() -> ResultEncoding {
+    match RESULT_ENCODING.load(Ordering::Relaxed) {
+        1 => ResultEncoding::MessagePack,
+        _ => ResultEncoding::Json,
+    }
+}
+
+/// Encode `value` into `writer` with the configured encoding
+pub fn encode_result<T: Serialize, W: Write>(value: &T, writer: W) -> FFIResult<()> {
+    match result_encoding() {
+        ResultEncoding::Json => serde_json::to_writer(writer, value)
+            .map_err(|e| FFIError::internal(format!("ser {e}"))),
+        #[cfg(feature = "msgpack")]
+        ResultEncoding::MessagePack => {
+            let mut writer = writer;
+            rmp_serde::encode::write_named(&mut writer, value)
+                .map_err(|e| FFIError::internal(format!("ser {e}")))
+        }
+        #[cfg(not(feature = "msgpack"))]
+        ResultEncoding::MessagePack => Err(FFIError::internal("msgpack support not compiled in".to_string())),
+    }
+}
+
+/// Run `func` and return its encoded result through the calling thread's buffer
+pub fn handle_buffer_result<F, T>(func: F, out_ptr: *mut *const u8, out_len: *mut usize) -> c_int
+where
+    F: FnOnce() -> FFIResult<T>,
+    T: Serialize,
+{
+    handle_status_result_for::<F, _>(|| {
+        if out_ptr.is_null() || out_len.is_null() {
+            return Err(FFIError::invalid_argument("null pointer"));
+        }
+        let value = func()?;
+        RESULT_BUFFER.with(|cell| {
+            let mut buffer = cell.borrow_mut();
+            buffer.clear();
+            if buffer.capacity() > RETAINED_CAPACITY {
+                buffer.shrink_to(RETAINED_CAPACITY);
+            }
+            in_phase(Phase::Serialize, || encode_result(&value, &mut *buffer))?;
+            unsafe {
+                *out_ptr = buffer.as_ptr();
+                *out_len = buffer.len();
+            }
+            Ok(())
+        })
+    })
+}
+
+/// Run `func` and encode its result into `buf` (`capacity` bytes, owned by the caller)
+pub fn handle_into_result<F, T>(func: F, buf: *mut u8, capacity: usize, out_len: *mut usize) -> c_int
+where
+    F: FnOnce() -> FFIResult<T>,
+    T: Serialize,
+{
+    handle_status_result_for::<F, _>(|| {
+        if out_len.is_null() || (buf.is_null() && capacity > 0) {
+            return Err(FFIError::invalid_argument("null pointer"));
+        }
+        let value = func()?;
+
+        let target: &mut [u8] = if capacity == 0 {
+            &mut []
+        } else {
+            unsafe { std::slice::from_raw_parts_mut(buf, capacity) }
+        };
+        let mut writer = SliceWriter { target, written: 0, overflowed: false };
+        let encoded = in_phase(Phase::Serialize, || encode_result(&value, &mut writer));
+
+        if writer.overflowed {
+            // Measure what the caller needs instead of failing blindly
+            let mut counter = CountingWriter(0);
+            encode_result(&value, &mut counter)?;
+            unsafe { *out_len = counter.0 };
+            return Err(FFIError::with_details(
+                ErrorCode::BufferTooSmall,
+                "result buffer too small",
+                &format!("{{\"required\":{},\"capacity\":{}}}", counter.0, capacity),
+            ));
+        }
+        encoded?;
+        unsafe { *out_len = writer.written };
+        Ok(())
+    })
+}
+
+/// Writes into a fixed slice and remembers whether anything did not fit
+struct SliceWriter<'a> {
+    target: &'a mut [u8],
+    written: usize,
+    overflowed: bool,
+}
+
+impl Write for SliceWriter<'_> {
+    fn write(&mut self, data: &[u8]) -> io::Result<usize> {
+        let end = self.written + data.len();
+        if end > self.target.len() {
+            self.overflowed = true;
+            return Err(io::Error::new(io::ErrorKind::WriteZero, "result buffer full"));
+        }
+        self.target[self.written..end].copy_from_slice(data);
+        self.written = end;
+        Ok(data.len())
+    }
+
+    fn flush(&mut self) -> io::Result<()> {
+        Ok(())
+    }
+}
+
+/// Discards output, counting its length
+struct CountingWriter(usize);
+
+impl Write for CountingWriter {
+    fn write(&mut self, data: &[u8]) -> io::Result<usize> {
+        self.0 += data.len();
+        Ok(data.len())
+    }
+
+    fn flush(&mut self) -> io::Result<()> {
+        Ok(())
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn into_reports_required_size_when_the_buffer_is_short() {
+        let value = serde_json::json!({ "items": [1, 2, 3], "done": true });
+        let expected = serde_json::to_vec(&value).unwrap();
+
+        let mut len = 0usize;
+        let mut small = [0u8; 4];
+        let code = handle_into_result(|| Ok(value.clone()), small.as_mut_ptr(), small.len(), &mut len);
+        assert_eq!(code, ErrorCode::BufferTooSmall as c_int);
+        assert_eq!(len, expected.len());
+
+        let mut big = vec![0u8; len];
+        let code = handle_into_result(|| Ok(value.clone()), big.as_mut_ptr(), big.len(), &mut len);
+        assert_eq!(code, ErrorCode::Success as c_int);
+        assert_eq!(&big[..len], &expected[..]);
+
+        let mut ptr: *const u8 = std::ptr::null();
+        let code = handle_buffer_result(|| Ok(value.clone()), &mut ptr, &mut len);
+        assert_eq!(code, ErrorCode::Success as c_int);
+        assert_eq!(unsafe { std::slice::from_raw_parts(ptr, len) }, &expected[..]);
+    }
+}
@@ -0,0 +1,269 @@
+// src/ffi/result_cache.rs
+// ============================================================================
+// Read-through cache for hot read endpoints.
+//
+// SwiftUI re-runs the same dashboard and picker calls on every view rebuild,
+// and almost every time the data has not changed. Results of those calls are
+// kept here as their serialized JSON, keyed by
+//
+//   (function, arguments without `auth`, role)
+//
+// The role is part of the key because the services authorize by role: an
+// entry only exists for a role that already passed the service's checks.
+//
+// Each entry remembers the generations of the tables it was computed from
+// (`table_generations`, bumped by triggers inside every write, see
+// migrations/20250710000000_table_generations.sql). A lookup reads the
+// current generations in one query and recomputes when any of them moved,
+// so writes, applied sync merges and deletes invalidate without any call
+// sites of their own. Generations are read before computing: a write that
+// lands in between only makes the next lookup recompute again.
+//
+// The cache holds at most a byte budget chosen by device tier, evicting the
+// least recently used entries. `compression_handle_memory_pressure` shrinks
+// the budget (a quarter on warning, nothing on critical) and a normal level
+// restores it.
+// ============================================================================
+
+use crate::auth::AuthContext;
+use crate::domains::export::ios::memory::ios_device_tier;
+use crate::domains::export::types::{DeviceTier, MemoryPressureLevel};
+use crate::errors::DbError;
+use crate::ffi::block_on_async;
+use crate::ffi::error::FFIResult;
+use crate::globals;
+use serde::Serialize;
+use std::collections::HashMap;
+use std::sync::{Mutex, OnceLock};
+
+/// Bookkeeping bytes charged per entry on top of its key and JSON
+const ENTRY_OVERHEAD_BYTES: usize = 128;
+
+#[derive(Debug, Clone, PartialEq, Eq, Hash)]
+struct CacheKey {
+    function: &'static str,
+    args: String,
+    role: &'static str,
+}
+
+struct CacheEntry {
+    json: String,
+    generations: Vec<i64>,
+    last_used: u64,
+    bytes: usize,
+}
+
+#[derive(Default)]
+struct CacheState {
+    entries: HashMap<CacheKey, CacheEntry>,
+    bytes: usize,
+    budget_bytes: usize,
+    clock: u64,
+    hits: u64,
+    misses: u64,
+    evictions: u64,
+}
+
+/// Counters reported with the library's performance metrics
+#[derive(Debug, Clone, Copy, Serialize)]
+pub struct ResultCacheStats {
+    pub entries: usize,
+    pub bytes: usize,
+    pub budget_bytes: usize,
+    pub hits: u64,
+    pub misses: u64,
+    pub evictions: u64,
+}
+
+pub struct ResultCache {
+    full_budget_bytes: usize,
+    state: Mutex<CacheState>,
+}
+
+impl ResultCache {
+    pub fn new(budget_bytes: usize) -> Self {
+        Self {
+            full_budget_bytes: budget_bytes,
+            state: Mutex::new(CacheState { budget_bytes, ..CacheState::default() }),
+        }
+    }
+
+    /// The cached JSON for `key` if it was computed at `generations`
+    fn lookup(&self, key: &CacheKey, generations: &[i64]) -> Option<String> {
+        let mut state = self.state.lock().unwrap();
+        state.clock += 1;
+        let now = state.clock;
+        let hit = match state.entries.get_mut(key) {
+            Some(entry) if entry.generations == generations => {
+                entry.last_used = now;
+                Some(entry.json.clone())
+            }
+            _ => None,
+        };
+        if hit.is_some() {
+            state.hits += 1;
+        } else {
+            state.misses += 1;
+        }
+        hit
+    }
+
+    fn insert(&self, key: CacheKey, generations: Vec<i64>, json: String) {
+        let bytes = key.args.len() + json.len() + ENTRY_OVERHEAD_BYTES;
+        let mut state = self.state.lock().unwrap();
+        if let Some(old) = state.entries.remove(&key) {
+            state.bytes -= old.bytes;
+        }
+        if bytes > state.budget_bytes {
+            return;
+        }
+        state.clock += 1;
+        let last_used = state.clock;
+        state.bytes += bytes;
+        state.entries.insert(key, CacheEntry { json, generations, last_used, bytes });
+        evict_to_budget(&mut state);
+    }
+
+    /// Resize the budget for `level` and evict down to it
+    pub fn trim(&self, level: MemoryPressureLevel) {
+        let mut state = self.state.lock().unwrap();
+        state.budget_bytes = match level {
+            MemoryPressureLevel::Normal => self.full_budget_bytes,
+            MemoryPressureLevel::Warning => self.full_budget_bytes / 4,
+            MemoryPressureLevel::Critical => 0,
+        };
+        evict_to_budget(&mut state);
+    }
+
+    pub fn stats(&self) -> ResultCacheStats {
+        let state = self.state.lock().unwrap();
+        ResultCacheStats {
+            entries: state.entries.len(),
+            bytes: state.bytes,
+            budget_bytes: state.budget_bytes,
+            hits: state.hits,
+            misses: state.misses,
+            evictions: state.evictions,
+        }
+    }
+}
+
+/// Drop least recently used entries until the cache fits its budget
+fn evict_to_budget(state: &mut CacheState) {
+    while state.bytes > state.budget_bytes {
+        let Some(oldest) = state
+            .entries
+            .iter()
+            .min_by_key(|(_, entry)| entry.last_used)
+            .map(|(key, _)| key.clone())
+        else {
+            break;
+        };
+        if let Some(entry) = state.entries.remove(&oldest) {
+            state.bytes -= entry.bytes;
+            state.evictions += 1;
+        }
+    }
+}
+
+/// The process-wide result cache, with a budget by device tier
+pub fn result_cache() -> &'static ResultCache {
+    static CACHE: OnceLock<ResultCache> = OnceLock::new();
+    CACHE.get_or_init(|| {
+        let budget_mb = match ios_device_tier() {
+            DeviceTier::Max => 8,
+            DeviceTier::Pro => 4,
+            DeviceTier::Standard => 2,
+            DeviceTier::Basic => 1,
+        };
+        ResultCache::new(budget_mb * 1024 * 1024)
+    })
+}
+
+/// Arguments of a call as a cache key: the payload without `auth`, with
+/// object keys in sorted order so equivalent payloads share an entry
+pub fn cache_args(payload_json: &str) -> String {
+    match serde_json::from_str::<serde_json::Value>(payload_json) {
+        Ok(serde_json::Value::Object(mut object)) => {
+            object.remove("auth");
+            serde_json::Value::Object(object).to_string()
+        }
+        _ => payload_json.to_string(),
+    }
+}
+
+/// Current generations of `tables`, in the order given (0 for untracked tables)
+fn current_generations(tables: &[&str]) -> FFIResult<Vec<i64>> {
+    let pool = globals::get_db_read_pool()?;
+    let names = serde_json::to_string(tables).unwrap_or_else(|_| "[]".to_string());
+    let rows = block_on_async(
+        sqlx::query_as::<_, (String, i64)>(
+            "SELECT table_name, generation FROM table_generations
+             WHERE table_name IN (SELECT value FROM json_each(?))",
+        )
+        .bind(names)
+        .fetch_all(&pool),
+    )
+    .map_err(DbError::from)?;
+    let by_table: HashMap<String, i64> = rows.into_iter().collect();
+    Ok(tables.iter().map(|t| by_table.get(*t).copied().unwrap_or(0)).collect())
+}
+
+/// The JSON result of `function` for `args` and the caller's role, computed
+/// with `compute` unless a result for the current generations of `tables`
+/// is cached. When the generations cannot be read the call is not cached.
+pub fn cached_json<F>(
+    function: &'static str,
+    args: String,
+    auth: &AuthContext,
+    tables: &[&str],
+    compute: F,
+) -> FFIResult<String>
+where
+    F: FnOnce() -> FFIResult<String>,
+{
+    let generations = match current_generations(tables) {
+        Ok(generations) => generations,
+        Err(e) => {
+            log::debug!("Result cache bypassed for {}: {}", function, e);
+            return compute();
+        }
+    };
+
+    let cache = result_cache();
+    let key = CacheKey { function, args, role: auth.role.as_str() };
+    if let Some(json) = cache.lookup(&key, &generations) {
+        return Ok(json);
+    }
+    let json = compute()?;
+    cache.insert(key, generations, json.clone());
+    Ok(json)
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn entries_follow_generations_and_budget() {
+        let cache = ResultCache::new(2 * (ENTRY_OVERHEAD_BYTES + 16));
+        let key = |args: &str| CacheKey { function: "f", args: args.to_string(), role: "admin" };
+
+        cache.insert(key("a"), vec![1, 7], "{\"a\":1}".to_string());
+        assert_eq!(cache.lookup(&key("a"), &[1, 7]).as_deref(), Some("{\"a\":1}"));
+        assert_eq!(cache.lookup(&key("a"), &[2, 7]), None);
+
+        // A third entry evicts the least recently used one
+        cache.insert(key("b"), vec![1], "{}".to_string());
+        cache.lookup(&key("a"), &[1, 7]);
+        cache.insert(key("c"), vec![1], "{}".to_string());
+        assert!(cache.lookup(&key("b"), &[1]).is_none());
+        assert!(cache.lookup(&key("a"), &[1, 7]).is_some());
+
+        cache.trim(MemoryPressureLevel::Critical);
+        assert_eq!(cache.stats().entries, 0);
+        assert_eq!(cache.stats().bytes, 0);
+
+        assert_eq!(cache_args(r#"{"b":1,"auth":{"x":1},"a":2}"#), r#"{"a":2,"b":1}"#);
+    }
+}
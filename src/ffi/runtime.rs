@@ -0,0 +1,227 @@
+// src/ffi/runtime.rs
+// ============================================================================
+// Tokio runtime management for the FFI layer.
+//
+// By default every FFI call is driven by a single current-thread runtime,
+// which keeps the library iOS-safe but serialises all calls coming from Swift.
+// Callers can opt in to a bounded multi-threaded runtime through
+// `initialize_library_with_config` (see `src/ffi/core.rs`), and use the
+// `*_async` entry points which return immediately and report completion
+// through a C callback.
+//
+// IMPORTANT – callback contract for `*_async` entry points:
+//   •  The callback is invoked exactly once, from a Rust-owned background
+//      thread (never from the calling thread).
+//   •  `ctx` is passed back untouched; Rust never dereferences it.
+//   •  When `status` is zero the `char*` handed to the callback follows the
+//      same ownership rules as the synchronous variant: it must be freed with
+//      the matching `*_free` function.
+//   •  When `status` is non-zero it carries the error message that
+//      `get_last_error()` would have returned on the worker thread (or NULL),
+//      and must be freed with `free_string`, like `get_last_error()`'s result.
+// ============================================================================
+
+use crate::ffi::error::{ErrorCode, FFIError, FFIResult};
+use serde::Deserialize;
+use std::ffi::{CStr, CString};
+use std::future::Future;
+use std::os::raw::{c_char, c_int, c_void};
+use std::sync::OnceLock;
+use tokio::runtime::Runtime;
+
+/// Completion callback used by every `*_async` entry point:
+/// `void (*)(void* ctx, int32_t status, char* result)`.
+pub type FfiCompletionCallback = Option<unsafe extern "C" fn(*mut c_void, c_int, *mut c_char)>;
+
+/// Signature shared by the synchronous `fn(payload_json, result) -> c_int` entry points.
+pub type FfiJsonEntry = unsafe extern "C" fn(*const c_char, *mut *mut c_char) -> c_int;
+
+/// Signature shared by the synchronous `fn(payload_json, token, result) -> c_int` entry points.
+pub type FfiJsonTokenEntry = unsafe extern "C" fn(*const c_char, *const c_char, *mut *mut c_char) -> c_int;
+
+/// Upper bound on worker threads, regardless of what the caller asks for.
+const MAX_WORKER_THREADS: usize = 8;
+/// Upper bound on the blocking pool used by `*_async` entry points.
+const MAX_BLOCKING_THREADS: usize = 32;
+
+/// Runtime flavour selected at initialization time
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Deserialize)]
+#[serde(rename_all = "snake_case")]
+pub enum RuntimeMode {
+    /// Single-threaded runtime driven by the calling thread (historical default)
+    CurrentThread,
+    /// Bounded multi-threaded runtime; FFI calls no longer serialise behind each other
+    MultiThread,
+}
+
+impl Default for RuntimeMode {
+    fn default() -> Self {
+        RuntimeMode::CurrentThread
+    }
+}
+
+/// Runtime configuration, deserialized from the `runtime` key of the init config JSON
+#[derive(Debug, Clone, Default, Deserialize)]
+#[serde(default)]
+pub struct RuntimeConfig {
+    pub mode: RuntimeMode,
+    /// Worker threads for `MultiThread` mode (defaults to min(available cores, 4))
+    pub worker_threads: Option<usize>,
+    /// Maximum threads in the blocking pool (defaults to 16)
+    pub max_blocking_threads: Option<usize>,
+}
+
+impl RuntimeConfig {
+    fn effective_worker_threads(&self) -> usize {
+        let cores = std::thread::available_parallelism().map(|n| n.get()).unwrap_or(2);
+        self.worker_threads
+            .unwrap_or_else(|| cores.min(4))
+            .clamp(1, MAX_WORKER_THREADS.min(cores.max(1)))
+    }
+
+    fn effective_max_blocking_threads(&self) -> usize {
+        self.max_blocking_threads.unwrap_or(16).clamp(1, MAX_BLOCKING_THREADS)
+    }
+}
+
+static RUNTIME: OnceLock<Runtime> = OnceLock::new();
+static RUNTIME_CONFIG: OnceLock<RuntimeConfig> = OnceLock::new();
+
+/// Record the runtime configuration. Must happen before the runtime is first used.
+pub fn configure_runtime(config: RuntimeConfig) -> FFIResult<()> {
+    if RUNTIME.get().is_some() {
+        // The runtime was already built by an earlier FFI call; only accept
+        // the config if it matches what is running.
+        let current = RUNTIME_CONFIG.get().map(|c| c.mode).unwrap_or_default();
+        if current != config.mode {
+            return Err(FFIError::new(
+                ErrorCode::ConfigurationError,
+                "Runtime already started; runtime mode must be configured before the first FFI call",
+            ));
+        }
+        return Ok(());
+    }
+    let _ = RUNTIME_CONFIG.set(config);
+    Ok(())
+}
+
+/// Whether the active runtime is the multi-threaded flavour
+pub fn is_multi_threaded() -> bool {
+    RUNTIME_CONFIG.get().map(|c| c.mode == RuntimeMode::MultiThread).unwrap_or(false)
+}
+
+/// Initialize or get the Tokio runtime
+pub fn get_runtime() -> &'static Runtime {
+    RUNTIME.get_or_init(|| {
+        let config = RUNTIME_CONFIG.get_or_init(RuntimeConfig::default);
+        match config.mode {
+            RuntimeMode::CurrentThread => tokio::runtime::Builder::new_current_thread()
+                .enable_all()
+                .max_blocking_threads(config.effective_max_blocking_threads())
+                .build()
+                .expect("Failed to create iOS-safe Tokio runtime"),
+            RuntimeMode::MultiThread => {
+                let workers = config.effective_worker_threads();
+                log::info!("Starting multi-threaded FFI runtime with {} worker threads", workers);
+                tokio::runtime::Builder::new_multi_thread()
+                    .worker_threads(workers)
+                    .max_blocking_threads(config.effective_max_blocking_threads())
+                    .thread_name("ipad-rust-core-worker")
+                    .enable_all()
+                    .build()
+                    .expect("Failed to create multi-threaded Tokio runtime")
+            }
+        }
+    })
+}
+
+/// Block on async operation in iOS-safe manner
+pub fn block_on_async<F: Future>(future: F) -> F::Output {
+    // Time awaited here is the service phase of the FFI call in progress
+    crate::metrics::in_phase(crate::metrics::Phase::Service, || get_runtime().block_on(future))
+}
+
+/// Copy a caller-owned C string so it can outlive the FFI call
+fn copy_c_string(ptr: *const c_char) -> FFIResult<CString> {
+    if ptr.is_null() {
+        return Err(FFIError::invalid_argument("null pointer"));
+    }
+    Ok(unsafe { CStr::from_ptr(ptr) }.to_owned())
+}
+
+/// `*mut c_void` is not `Send`; the context pointer is opaque to Rust and only
+/// handed back to the caller's callback, so moving it across threads is sound.
+struct CallbackContext(*mut c_void);
+unsafe impl Send for CallbackContext {}
+
+/// Run `call` on the runtime's blocking pool and report the outcome through `callback`.
+/// Returns immediately with `Success` once the call is queued.
+fn spawn_with_callback<F>(ctx: *mut c_void, callback: FfiCompletionCallback, call: F) -> c_int
+where
+    F: FnOnce(*mut *mut c_char) -> c_int + Send + 'static,
+{
+    let callback = match callback {
+        Some(cb) => cb,
+        None => {
+            let err = FFIError::invalid_argument("null completion callback");
+            crate::ffi::error::store_last_error(&err);
+            return err.code as c_int;
+        }
+    };
+    let ctx = CallbackContext(ctx);
+
+    get_runtime().spawn_blocking(move || {
+        let ctx = ctx;
+        let mut result: *mut c_char = std::ptr::null_mut();
+        let status = match std::panic::catch_unwind(std::panic::AssertUnwindSafe(|| call(&mut result))) {
+            Ok(status) => status,
+            Err(_) => {
+                eprintln!("[Rust FFI Panic] in async FFI call");
+                ErrorCode::InternalError as c_int
+            }
+        };
+        // last_error is thread-local, so hand the message over explicitly;
+        // the caller frees it with free_string, as it would get_last_error()
+        if status != ErrorCode::Success as c_int && result.is_null() {
+            result = crate::ffi::error::get_last_error_message();
+        }
+        unsafe { callback(ctx.0, status, result) };
+    });
+
+    ErrorCode::Success as c_int
+}
+
+/// Dispatch a `fn(payload_json, result)` entry point asynchronously
+pub unsafe fn dispatch_async(
+    entry: FfiJsonEntry,
+    payload_json: *const c_char,
+    ctx: *mut c_void,
+    callback: FfiCompletionCallback,
+) -> c_int {
+    let payload = match copy_c_string(payload_json) {
+        Ok(p) => p,
+        Err(e) => {
+            crate::ffi::error::store_last_error(&e);
+            return e.code as c_int;
+        }
+    };
+    spawn_with_callback(ctx, callback, move |result| unsafe { entry(payload.as_ptr(), result) })
+}
+
+/// Dispatch a `fn(payload_json, token, result)` entry point asynchronously
+pub unsafe fn dispatch_async_with_token(
+    entry: FfiJsonTokenEntry,
+    payload_json: *const c_char,
+    token: *const c_char,
+    ctx: *mut c_void,
+    callback: FfiCompletionCallback,
+) -> c_int {
+    let (payload, token) = match (copy_c_string(payload_json), copy_c_string(token)) {
+        (Ok(p), Ok(t)) => (p, t),
+        (Err(e), _) | (_, Err(e)) => {
+            crate::ffi::error::store_last_error(&e);
+            return e.code as c_int;
+        }
+    };
+    spawn_with_callback(ctx, callback, move |result| unsafe { entry(payload.as_ptr(), token.as_ptr(), result) })
+}
@@ -0,0 +1,98 @@
+// src/ffi/stats.rs
+// ============================================================================
+// Maintenance entry points for the materialized dashboard counters.
+//
+// The `count_by_*` statistics read `stat_counters`, which triggers keep in
+// step with every write (see `domains::core::stat_counters`). `stats_rebuild`
+// recomputes the counters from the base tables; it is only needed for repair,
+// e.g. after rows were changed with triggers disabled.
+//
+// Strings returned from here must be freed with `stats_free`.
+// ============================================================================
+
+use crate::auth::AuthContext;
+use crate::domains::core::stat_counters;
+use crate::ffi::parse_payload;
+use crate::ffi::{block_on_async, handle_status_result, error::FFIError};
+use crate::globals;
+use crate::types::{Permission, UserRole};
+use serde::Deserialize;
+use std::ffi::{CStr, CString};
+use std::os::raw::{c_char, c_int};
+use uuid::Uuid;
+
+/// Helper macro – return `InvalidArgument` if the pointer is NULL
+macro_rules! ensure_ptr {
+    ($ptr:expr) => {
+        if $ptr.is_null() {
+            return Err(FFIError::invalid_argument("null pointer"));
+        }
+    };
+}
+
+/// DTO mirroring the subset of `AuthContext` that we expect to receive from Swift
+#[derive(Deserialize)]
+struct AuthCtxDto {
+    user_id: String,
+    role: String,
+    device_id: String,
+    offline_mode: bool,
+}
+
+impl TryFrom<AuthCtxDto> for AuthContext {
+    type Error = FFIError;
+
+    fn try_from(value: AuthCtxDto) -> Result<Self, Self::Error> {
+        Ok(AuthContext::new(
+            Uuid::parse_str(&value.user_id)
+                .map_err(|_| FFIError::invalid_argument("invalid user_id"))?,
+            UserRole::from_str(&value.role)
+                .ok_or_else(|| FFIError::invalid_argument("invalid role"))?,
+            value.device_id,
+            value.offline_mode,
+        ))
+    }
+}
+
+/// Recompute all dashboard counters from the base tables
+/// Expected JSON payload:
+/// {
+///   "auth": { AuthCtxDto }
+/// }
+/// Result: { "counters_written": number }
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn stats_rebuild(payload_json: *const c_char, result: *mut *mut c_char) -> c_int {
+    handle_status_result(|| unsafe {
+        ensure_ptr!(payload_json);
+        ensure_ptr!(result);
+
+        let json = CStr::from_ptr(payload_json).to_str().map_err(|_| FFIError::invalid_argument("utf8"))?;
+
+        #[derive(Deserialize)]
+        struct Payload {
+            auth: AuthCtxDto,
+        }
+
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let auth: AuthContext = p.auth.try_into()?;
+        auth.authorize(Permission::ConfigureSystem)?;
+
+        let pool = globals::get_db_pool()?;
+        let written = block_on_async(stat_counters::rebuild_stat_counters(&pool))?;
+
+        let json_resp = serde_json::json!({ "counters_written": written }).to_string();
+        let cstr = CString::new(json_resp).unwrap();
+        *result = cstr.into_raw();
+        Ok(())
+    })
+}
+
+/// Free a string returned by `stats_rebuild`
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn stats_free(ptr: *mut c_char) {
+    if !ptr.is_null() {
+        unsafe {
+            let _ = CString::from_raw(ptr);
+        }
+    }
+}
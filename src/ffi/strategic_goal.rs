@@ -22,20 +22,25 @@
 //   of each payload is documented above every function.
 // ----------------------------------------------------------------------------
 
-use crate::ffi::{handle_status_result, error::FFIError};
+use crate::ffi::{handle_status_result, parse_payload, to_json_result, error::{FFIError, FFIResult}};
+use crate::ffi::result_cache;
+use crate::ffi::cursor::{open_cursor, CursorSortDto, KeysetQuery};
 use crate::domains::strategic_goal::types::{
-    NewStrategicGoal, UpdateStrategicGoal, StrategicGoalResponse, StrategicGoalInclude,
+    StrategicGoalRow, NewStrategicGoal, UpdateStrategicGoal, StrategicGoalResponse, StrategicGoalInclude,
     UserGoalRole, GoalValueSummaryResponse
 };
 use crate::domains::sync::types::SyncPriority;
 use crate::domains::compression::types::CompressionPriority;
 use crate::auth::AuthContext;
-use crate::types::{UserRole, PaginationParams};
+use crate::types::{UserRole, Permission, PaginationParams};
 use crate::globals;
 
 use std::ffi::{CStr, CString};
-use std::os::raw::{c_char, c_int};
+use std::os::raw::{c_char, c_int, c_void};
+use crate::ffi::FfiCompletionCallback;
 use std::str::FromStr;
+use sqlx::FromRow;
+use sqlx::sqlite::SqliteRow;
 use uuid::Uuid;
 use serde::{Deserialize, Serialize};
 use std::collections::HashMap;
@@ -112,6 +117,77 @@ impl From<PaginationDto> for PaginationParams {
     }
 }
 
+/// DTO for the `user_role` criterion of a goal filter
+#[derive(Deserialize)]
+struct UserRoleFilter {
+    user_id: String,
+    role: String,
+}
+
+/// DTO for strategic goal filter criteria
+#[derive(Deserialize)]
+struct StrategicGoalFilterDto {
+    status_ids: Option<Vec<i64>>,
+    responsible_teams: Option<Vec<String>>,
+    years: Option<Vec<i32>>,
+    months: Option<Vec<i32>>,
+    user_role: Option<UserRoleFilter>,
+    sync_priorities: Option<Vec<String>>,
+    search_text: Option<String>,
+    progress_range: Option<(f64, f64)>,
+    target_value_range: Option<(f64, f64)>,
+    actual_value_range: Option<(f64, f64)>,
+    date_range: Option<(String, String)>,
+    days_stale: Option<u32>,
+    exclude_deleted: Option<bool>,
+}
+
+impl TryFrom<StrategicGoalFilterDto> for crate::domains::strategic_goal::types::StrategicGoalFilter {
+    type Error = FFIError;
+
+    fn try_from(dto: StrategicGoalFilterDto) -> Result<Self, Self::Error> {
+        let user_role = if let Some(ur) = dto.user_role {
+            let user_id = Uuid::parse_str(&ur.user_id)
+                .map_err(|_| FFIError::invalid_argument("invalid user_id in user_role"))?;
+            let role = match ur.role.as_str() {
+                "created" => crate::domains::strategic_goal::types::UserGoalRole::Created,
+                "updated" => crate::domains::strategic_goal::types::UserGoalRole::Updated,
+                _ => return Err(FFIError::invalid_argument("invalid role in user_role")),
+            };
+            Some((user_id, role))
+        } else {
+            None
+        };
+        
+        // Convert sync priority strings to enums
+        let sync_priorities = if let Some(priorities) = dto.sync_priorities {
+            let converted: Result<Vec<_>, _> = priorities
+                .into_iter()
+                .map(|s| crate::domains::sync::types::SyncPriority::from_str(&s))
+                .collect();
+            Some(converted.map_err(|_| FFIError::invalid_argument("invalid sync_priority"))?)
+        } else {
+            None
+        };
+        
+        Ok(crate::domains::strategic_goal::types::StrategicGoalFilter {
+            status_ids: dto.status_ids,
+            responsible_teams: dto.responsible_teams,
+            years: dto.years,
+            months: dto.months,
+            user_role,
+            sync_priorities,
+            search_text: dto.search_text,
+            progress_range: dto.progress_range,
+            target_value_range: dto.target_value_range,
+            actual_value_range: dto.actual_value_range,
+            date_range: dto.date_range,
+            days_stale: dto.days_stale,
+            exclude_deleted: dto.exclude_deleted,
+        })
+    }
+}
+
 /// DTO for strategic goal includes
 #[derive(Deserialize)]
 #[serde(rename_all = "snake_case")]
@@ -163,14 +239,14 @@ pub unsafe extern "C" fn strategic_goal_create(payload_json: *const c_char, resu
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_strategic_goal_service()?;
         
         let goal = block_on_async(svc.create_strategic_goal(p.goal, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&goal)
+        let json_resp = to_json_result(&goal)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -209,7 +285,7 @@ pub unsafe extern "C" fn strategic_goal_create_with_documents(payload_json: *con
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         
         // Decode all documents
         let mut documents = Vec::new();
@@ -239,7 +315,7 @@ pub unsafe extern "C" fn strategic_goal_create_with_documents(payload_json: *con
             document_results: doc_results.into_iter().map(|r| r.map_err(|e| e.to_string())).collect(),
         };
         
-        let json_resp = serde_json::to_string(&response)
+        let json_resp = to_json_result(&response)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -269,7 +345,7 @@ pub unsafe extern "C" fn strategic_goal_get(payload_json: *const c_char, result:
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         
@@ -280,7 +356,7 @@ pub unsafe extern "C" fn strategic_goal_get(payload_json: *const c_char, result:
         let goal = block_on_async(svc.get_strategic_goal_by_id(id, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&goal)
+        let json_resp = to_json_result(&goal)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -310,7 +386,7 @@ pub unsafe extern "C" fn strategic_goal_list(payload_json: *const c_char, result
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let params = parse_pagination(p.pagination);
         let auth: AuthContext = p.auth.try_into()?;
         
@@ -321,7 +397,7 @@ pub unsafe extern "C" fn strategic_goal_list(payload_json: *const c_char, result
         let goals = block_on_async(svc.list_strategic_goals(params, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&goals)
+        let json_resp = to_json_result(&goals)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -351,7 +427,7 @@ pub unsafe extern "C" fn strategic_goal_update(payload_json: *const c_char, resu
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_strategic_goal_service()?;
@@ -359,7 +435,7 @@ pub unsafe extern "C" fn strategic_goal_update(payload_json: *const c_char, resu
         let goal = block_on_async(svc.update_strategic_goal(id, p.update, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&goal)
+        let json_resp = to_json_result(&goal)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -389,7 +465,7 @@ pub unsafe extern "C" fn strategic_goal_delete(payload_json: *const c_char, resu
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_strategic_goal_service()?;
@@ -397,7 +473,7 @@ pub unsafe extern "C" fn strategic_goal_delete(payload_json: *const c_char, resu
         let delete_result = block_on_async(svc.delete_strategic_goal(id, p.hard_delete.unwrap_or(false), &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&delete_result)
+        let json_resp = to_json_result(&delete_result)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -429,7 +505,7 @@ pub unsafe extern "C" fn strategic_goal_bulk_delete(payload_json: *const c_char,
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         
         // Parse UUIDs
@@ -450,7 +526,7 @@ pub unsafe extern "C" fn strategic_goal_bulk_delete(payload_json: *const c_char,
         let batch_result = block_on_async(svc.batch_delete(&uuids, &auth, options))
             .map_err(FFIError::from)?;
         
-        let json_resp = serde_json::to_string(&batch_result)
+        let json_resp = to_json_result(&batch_result)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -496,7 +572,7 @@ pub unsafe extern "C" fn strategic_goal_upload_document(payload_json: *const c_c
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         
         // Decode base64 file data
         let file_data = base64::decode(&p.file_data)
@@ -529,7 +605,7 @@ pub unsafe extern "C" fn strategic_goal_upload_document(payload_json: *const c_c
             &auth,
         )).map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&document)
+        let json_resp = to_json_result(&document)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -573,7 +649,7 @@ pub unsafe extern "C" fn strategic_goal_bulk_upload_documents(payload_json: *con
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         
         let goal_uuid = Uuid::parse_str(&p.goal_id)
@@ -609,7 +685,7 @@ pub unsafe extern "C" fn strategic_goal_bulk_upload_documents(payload_json: *con
         ))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&documents)
+        let json_resp = to_json_result(&documents)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -651,7 +727,7 @@ pub unsafe extern "C" fn strategic_goal_upload_document_from_path(payload_json:
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         
         let goal_uuid = Uuid::parse_str(&p.goal_id)
@@ -682,7 +758,7 @@ pub unsafe extern "C" fn strategic_goal_upload_document_from_path(payload_json:
         ))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&document)
+        let json_resp = to_json_result(&document)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -726,7 +802,7 @@ pub unsafe extern "C" fn strategic_goal_bulk_upload_documents_from_paths(payload
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         
         let goal_uuid = Uuid::parse_str(&p.goal_id)
@@ -761,7 +837,7 @@ pub unsafe extern "C" fn strategic_goal_bulk_upload_documents_from_paths(payload
         ))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&documents)
+        let json_resp = to_json_result(&documents)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -797,7 +873,7 @@ pub unsafe extern "C" fn strategic_goal_find_by_status(payload_json: *const c_ch
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let params = p.pagination.map(|p| p.into()).unwrap_or_default();
         let auth: AuthContext = p.auth.try_into()?;
         
@@ -810,7 +886,7 @@ pub unsafe extern "C" fn strategic_goal_find_by_status(payload_json: *const c_ch
         let goals = block_on_async(svc.find_goals_by_status(p.status_id, params, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&goals)
+        let json_resp = to_json_result(&goals)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -842,7 +918,7 @@ pub unsafe extern "C" fn strategic_goal_find_by_team(payload_json: *const c_char
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let params = p.pagination.map(|p| p.into()).unwrap_or_default();
         let auth: AuthContext = p.auth.try_into()?;
         
@@ -855,7 +931,7 @@ pub unsafe extern "C" fn strategic_goal_find_by_team(payload_json: *const c_char
         let goals = block_on_async(svc.find_goals_by_responsible_team(&p.team_name, params, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&goals)
+        let json_resp = to_json_result(&goals)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -889,7 +965,7 @@ pub unsafe extern "C" fn strategic_goal_find_by_user_role(payload_json: *const c
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let user_id = Uuid::parse_str(&p.user_id).map_err(|_| FFIError::invalid_argument("invalid user_id"))?;
         let role = match p.role.as_str() {
             "created" => UserGoalRole::Created,
@@ -908,7 +984,7 @@ pub unsafe extern "C" fn strategic_goal_find_by_user_role(payload_json: *const c
         let goals = block_on_async(svc.find_goals_by_user_role(user_id, role, params, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&goals)
+        let json_resp = to_json_result(&goals)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -940,7 +1016,7 @@ pub unsafe extern "C" fn strategic_goal_find_stale(payload_json: *const c_char,
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let params = p.pagination.map(|p| p.into()).unwrap_or_default();
         let auth: AuthContext = p.auth.try_into()?;
         
@@ -953,7 +1029,7 @@ pub unsafe extern "C" fn strategic_goal_find_stale(payload_json: *const c_char,
         let goals = block_on_async(svc.find_stale_goals(p.days_stale, params, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&goals)
+        let json_resp = to_json_result(&goals)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -987,7 +1063,7 @@ pub unsafe extern "C" fn strategic_goal_find_by_date_range(payload_json: *const
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let params = p.pagination.map(|p| p.into()).unwrap_or_default();
         let auth: AuthContext = p.auth.try_into()?;
         
@@ -1000,7 +1076,7 @@ pub unsafe extern "C" fn strategic_goal_find_by_date_range(payload_json: *const
         let goals = block_on_async(svc.find_strategic_goals_by_date_range(&p.start_date, &p.end_date, params, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&goals)
+        let json_resp = to_json_result(&goals)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -1028,14 +1104,14 @@ pub unsafe extern "C" fn strategic_goal_get_status_distribution(payload_json: *c
         #[derive(Deserialize)]
         struct Payload { auth: AuthCtxDto }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_strategic_goal_service()?;
         
         let distribution = block_on_async(svc.get_status_distribution(&auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&distribution)
+        let json_resp = to_json_result(&distribution)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -1059,14 +1135,14 @@ pub unsafe extern "C" fn strategic_goal_get_value_statistics(payload_json: *cons
         #[derive(Deserialize)]
         struct Payload { auth: AuthCtxDto }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_strategic_goal_service()?;
         
         let stats = block_on_async(svc.get_value_statistics(&auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&stats)
+        let json_resp = to_json_result(&stats)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -1101,78 +1177,15 @@ pub unsafe extern "C" fn strategic_goal_get_filtered_ids(payload_json: *const c_
         
         let json = CStr::from_ptr(payload_json).to_str().map_err(|_| FFIError::invalid_argument("utf8"))?;
         
-        #[derive(Deserialize)]
-        struct UserRoleFilter {
-            user_id: String,
-            role: String,
-        }
-        
-        #[derive(Deserialize)]
-        struct FilterDto {
-            status_ids: Option<Vec<i64>>,
-            responsible_teams: Option<Vec<String>>,
-            years: Option<Vec<i32>>,
-            months: Option<Vec<i32>>,
-            user_role: Option<UserRoleFilter>,
-            sync_priorities: Option<Vec<String>>,
-            search_text: Option<String>,
-            progress_range: Option<(f64, f64)>,
-            target_value_range: Option<(f64, f64)>,
-            actual_value_range: Option<(f64, f64)>,
-            date_range: Option<(String, String)>,
-            days_stale: Option<u32>,
-            exclude_deleted: Option<bool>,
-        }
-        
         #[derive(Deserialize)]
         struct Payload {
-            filter: FilterDto,
+            filter: StrategicGoalFilterDto,
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
-        
-        // Convert DTO to domain filter
-        let user_role = if let Some(ur) = p.filter.user_role {
-            let user_id = Uuid::parse_str(&ur.user_id)
-                .map_err(|_| FFIError::invalid_argument("invalid user_id in user_role"))?;
-            let role = match ur.role.as_str() {
-                "created" => crate::domains::strategic_goal::types::UserGoalRole::Created,
-                "updated" => crate::domains::strategic_goal::types::UserGoalRole::Updated,
-                _ => return Err(FFIError::invalid_argument("invalid role in user_role")),
-            };
-            Some((user_id, role))
-        } else {
-            None
-        };
-        
-        // Convert sync priority strings to enums
-        let sync_priorities = if let Some(priorities) = p.filter.sync_priorities {
-            let converted: Result<Vec<_>, _> = priorities
-                .into_iter()
-                .map(|s| crate::domains::sync::types::SyncPriority::from_str(&s))
-                .collect();
-            Some(converted.map_err(|_| FFIError::invalid_argument("invalid sync_priority"))?)
-        } else {
-            None
-        };
-        
-        let filter = crate::domains::strategic_goal::types::StrategicGoalFilter {
-            status_ids: p.filter.status_ids,
-            responsible_teams: p.filter.responsible_teams,
-            years: p.filter.years,
-            months: p.filter.months,
-            user_role,
-            sync_priorities,
-            search_text: p.filter.search_text,
-            progress_range: p.filter.progress_range,
-            target_value_range: p.filter.target_value_range,
-            actual_value_range: p.filter.actual_value_range,
-            date_range: p.filter.date_range,
-            days_stale: p.filter.days_stale,
-            exclude_deleted: p.filter.exclude_deleted,
-        };
+        let filter = p.filter.try_into()?;
         
         let svc = globals::get_strategic_goal_service()?;
         let filtered_ids = block_on_async(svc.get_filtered_goal_ids(filter, &auth))
@@ -1181,7 +1194,7 @@ pub unsafe extern "C" fn strategic_goal_get_filtered_ids(payload_json: *const c_
         // Convert UUIDs to strings for JSON response
         let id_strings: Vec<String> = filtered_ids.into_iter().map(|id| id.to_string()).collect();
         
-        let json_resp = serde_json::to_string(&id_strings)
+        let json_resp = to_json_result(&id_strings)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -1209,22 +1222,102 @@ pub unsafe extern "C" fn strategic_goal_list_summaries(payload_json: *const c_ch
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let params = parse_pagination(p.pagination);
         let auth: AuthContext = p.auth.try_into()?;
         
-        let svc = globals::get_strategic_goal_service()?;
-        let goals = block_on_async(svc.list_strategic_goal_summaries(params, &auth))
-            .map_err(FFIError::from_service_error)?;
-        
-        let json_resp = serde_json::to_string(&goals)
-            .map_err(|e| FFIError::internal(format!("ser {e}")))?;
+        let json_resp = result_cache::cached_json("strategic_goal_list_summaries", result_cache::cache_args(json), &auth, &["strategic_goals"], || {
+            let svc = globals::get_strategic_goal_service()?;
+            let goals = block_on_async(svc.list_strategic_goal_summaries(params, &auth))
+                .map_err(FFIError::from_service_error)?;
+            to_json_result(&goals).map_err(|e| FFIError::internal(format!("ser {e}")))
+        })?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
         Ok(())
     })
 }
 
+// ---------------------------------------------------------------------------
+// Cursor-Based Listing
+// ---------------------------------------------------------------------------
+
+fn strategic_goal_cursor_row(row: &SqliteRow) -> FFIResult<String> {
+    let entity = StrategicGoalRow::from_row(row)
+        .map_err(|e| FFIError::internal(format!("row {e}")))?
+        .into_entity()?;
+    to_json_result(&StrategicGoalResponse::from(entity))
+        .map_err(|e| FFIError::internal(format!("ser {e}")))
+}
+
+static STRATEGIC_GOAL_LIST_CURSOR: KeysetQuery = KeysetQuery {
+    table: "strategic_goals",
+    columns: "*",
+    sort_column: "objective_code",
+    descending: false,
+    sortable: &["objective_code", "created_at", "updated_at"],
+    map_row: strategic_goal_cursor_row,
+};
+
+/// Open a streaming cursor over the strategic goals matching an optional filter,
+/// ordered by objective code unless `sort` names another column
+/// Expected JSON payload:
+/// {
+///   "filter": { StrategicGoalFilterDto, as in strategic_goal_get_filtered_ids },
+///   "sort": { "field": "updated_at", "descending": true },
+///   "auth": { AuthCtxDto }
+/// }
+/// Writes an opaque handle to `cursor_out`; read batches with `cursor_next`
+/// and release it with `cursor_close` (see `src/ffi/cursor.rs`).
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn strategic_goal_list_open(payload_json: *const c_char, cursor_out: *mut u64) -> c_int {
+    handle_status_result(|| unsafe {
+        ensure_ptr!(payload_json);
+        ensure_ptr!(cursor_out);
+        
+        let json = CStr::from_ptr(payload_json).to_str().map_err(|_| FFIError::invalid_argument("utf8"))?;
+        
+        #[derive(Deserialize)]
+        struct Payload {
+            filter: Option<StrategicGoalFilterDto>,
+            sort: Option<CursorSortDto>,
+            auth: AuthCtxDto,
+        }
+        
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let auth: AuthContext = p.auth.try_into()?;
+        auth.authorize(Permission::ViewStrategicGoals)?;
+        
+        let ids = p.filter.map(|filter| {
+            let svc = globals::get_strategic_goal_service()?;
+            block_on_async(svc.get_filtered_goal_ids(filter.try_into()?, &auth))
+                .map_err(FFIError::from_service_error)
+        }).transpose()?;
+        *cursor_out = open_cursor(&STRATEGIC_GOAL_LIST_CURSOR, p.sort, ids)?;
+        Ok(())
+    })
+}
+
+// ---------------------------------------------------------------------------
+// Async Variants
+// ---------------------------------------------------------------------------
+
+// Non-blocking versions of the calls above. They take the same payload, return
+// immediately, and invoke `callback(ctx, status, result)` from a background
+// thread once done. `result` must be freed with `strategic_goal_free`.
+
+/// Async variant of `strategic_goal_list`
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn strategic_goal_list_async(payload_json: *const c_char, ctx: *mut c_void, callback: FfiCompletionCallback) -> c_int {
+    crate::ffi::runtime::dispatch_async(strategic_goal_list, payload_json, ctx, callback)
+}
+
+/// Async variant of `strategic_goal_list_summaries`
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn strategic_goal_list_summaries_async(payload_json: *const c_char, ctx: *mut c_void, callback: FfiCompletionCallback) -> c_int {
+    crate::ffi::runtime::dispatch_async(strategic_goal_list_summaries, payload_json, ctx, callback)
+}
+
 // ---------------------------------------------------------------------------
 // Memory Management
 // ---------------------------------------------------------------------------
@@ -0,0 +1,106 @@
+// src/ffi/sync.rs
+// ============================================================================
+// Maintenance entry points for the sync change log.
+//
+// `sync_compact_change_log` coalesces unprocessed per-field updates and prunes
+// processed entries past the retention window (see
+// `domains::sync::compaction`). The same pass also runs before every push, so
+// calling it is only needed to reclaim space on demand.
+//
+// Strings returned from here must be freed with `sync_free`.
+// ============================================================================
+
+use crate::auth::AuthContext;
+use crate::domains::sync::compaction::{compact_change_log, DEFAULT_CHANGE_LOG_RETENTION_DAYS};
+use crate::ffi::{parse_payload, to_json_result};
+use crate::ffi::{block_on_async, handle_status_result, error::FFIError};
+use crate::globals;
+use crate::types::{Permission, UserRole};
+use serde::Deserialize;
+use std::ffi::{CStr, CString};
+use std::os::raw::{c_char, c_int};
+use uuid::Uuid;
+
+/// Helper macro – return `InvalidArgument` if the pointer is NULL
+macro_rules! ensure_ptr {
+    ($ptr:expr) => {
+        if $ptr.is_null() {
+            return Err(FFIError::invalid_argument("null pointer"));
+        }
+    };
+}
+
+/// DTO mirroring the subset of `AuthContext` that we expect to receive from Swift
+#[derive(Deserialize)]
+struct AuthCtxDto {
+    user_id: String,
+    role: String,
+    device_id: String,
+    offline_mode: bool,
+}
+
+impl TryFrom<AuthCtxDto> for AuthContext {
+    type Error = FFIError;
+
+    fn try_from(value: AuthCtxDto) -> Result<Self, Self::Error> {
+        Ok(AuthContext::new(
+            Uuid::parse_str(&value.user_id)
+                .map_err(|_| FFIError::invalid_argument("invalid user_id"))?,
+            UserRole::from_str(&value.role)
+                .ok_or_else(|| FFIError::invalid_argument("invalid role"))?,
+            value.device_id,
+            value.offline_mode,
+        ))
+    }
+}
+
+/// Compact the change log now
+/// Expected JSON payload:
+/// {
+///   "auth": { AuthCtxDto },
+///   "retention_days": number (optional, default 30)
+/// }
+/// Result: { "entries_coalesced": number, "entries_pruned": number }
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn sync_compact_change_log(payload_json: *const c_char, result: *mut *mut c_char) -> c_int {
+    handle_status_result(|| unsafe {
+        ensure_ptr!(payload_json);
+        ensure_ptr!(result);
+
+        let json = CStr::from_ptr(payload_json).to_str().map_err(|_| FFIError::invalid_argument("utf8"))?;
+
+        #[derive(Deserialize)]
+        struct Payload {
+            auth: AuthCtxDto,
+            retention_days: Option<i64>,
+        }
+
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let auth: AuthContext = p.auth.try_into()?;
+        auth.authorize(Permission::ConfigureSystem)?;
+
+        let retention_days = p.retention_days.unwrap_or(DEFAULT_CHANGE_LOG_RETENTION_DAYS);
+        if retention_days < 0 {
+            return Err(FFIError::invalid_argument("retention_days must not be negative"));
+        }
+
+        let repo = globals::get_change_log_repo()?;
+        let stats = block_on_async(compact_change_log(&*repo, retention_days))?;
+
+        let json_resp = to_json_result(&stats)
+            .map_err(|e| FFIError::internal(format!("ser {e}")))?;
+        let cstr = CString::new(json_resp).unwrap();
+        *result = cstr.into_raw();
+        Ok(())
+    })
+}
+
+/// Free a string returned by `sync_compact_change_log`
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn sync_free(ptr: *mut c_char) {
+    if !ptr.is_null() {
+        unsafe {
+            let _ = CString::from_raw(ptr);
+        }
+    }
+}
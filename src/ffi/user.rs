@@ -22,7 +22,7 @@
 //   of each payload is documented above every function.
 // ----------------------------------------------------------------------------
 
-use crate::ffi::{handle_status_result, error::{FFIError}};
+use crate::ffi::{handle_status_result, parse_payload, to_json_result, error::{FFIError}};
 use crate::domains::user::types::{NewUser, UpdateUser, UserResponse, UserStats};
 use crate::auth::AuthContext;
 use crate::types::UserRole;
@@ -96,7 +96,7 @@ pub unsafe extern "C" fn user_create(payload_json: *const c_char, result: *mut *
             auth: AuthCtxDto,
         }
 
-        let payload: Payload = serde_json::from_str(json_str)
+        let payload: Payload = parse_payload(json_str)
             .map_err(|e| FFIError::invalid_argument(&format!("json parse: {e}")))?;
 
         let auth_ctx: AuthContext = payload.auth.try_into()?;
@@ -106,7 +106,7 @@ pub unsafe extern "C" fn user_create(payload_json: *const c_char, result: *mut *
             .map_err(|e| FFIError::from_service_error(e))?;
         let resp: UserResponse = user.into();
 
-        let json_resp = serde_json::to_string(&resp)
+        let json_resp = to_json_result(&resp)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -137,7 +137,7 @@ pub unsafe extern "C" fn user_get(payload_json: *const c_char, result: *mut *mut
             id: String,
             auth: AuthCtxDto,
         }
-        let payload: Payload = serde_json::from_str(json_str)
+        let payload: Payload = parse_payload(json_str)
             .map_err(|e| FFIError::invalid_argument(&format!("json parse: {e}")))?;
 
         let id = Uuid::parse_str(&payload.id)
@@ -148,7 +148,7 @@ pub unsafe extern "C" fn user_get(payload_json: *const c_char, result: *mut *mut
         let user = block_on_async(svc.get_user_response(id, &auth_ctx))
             .map_err(|e| FFIError::from_service_error(e))?;
 
-        let json_resp = serde_json::to_string(&user)
+        let json_resp = to_json_result(&user)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -175,7 +175,7 @@ pub unsafe extern "C" fn user_get_all(payload_json: *const c_char, result: *mut
 
         #[derive(Deserialize)]
         struct Payload { auth: AuthCtxDto }
-        let payload: Payload = serde_json::from_str(json_str)
+        let payload: Payload = parse_payload(json_str)
             .map_err(|e| FFIError::invalid_argument(&format!("json parse: {e}")))?;
         let auth_ctx: AuthContext = payload.auth.try_into()?;
         let svc = globals::get_user_service()?;
@@ -183,7 +183,7 @@ pub unsafe extern "C" fn user_get_all(payload_json: *const c_char, result: *mut
         let users = block_on_async(svc.get_all_user_responses(&auth_ctx))
             .map_err(|e| FFIError::from_service_error(e))?;
 
-        let json_resp = serde_json::to_string(&users)
+        let json_resp = to_json_result(&users)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -228,7 +228,7 @@ pub unsafe extern "C" fn user_update(payload_json: *const c_char, result: *mut *
             active: Option<bool>,
         }
 
-        let payload: Payload = serde_json::from_str(json_str)
+        let payload: Payload = parse_payload(json_str)
             .map_err(|e| FFIError::invalid_argument(&format!("json parse: {e}")))?;
 
         let id = Uuid::parse_str(&payload.id)
@@ -248,7 +248,7 @@ pub unsafe extern "C" fn user_update(payload_json: *const c_char, result: *mut *
 
         let resp = block_on_async(svc.update_user_with_response(id, update, &auth_ctx))
             .map_err(|e| FFIError::from_service_error(e))?;
-        let json_resp = serde_json::to_string(&resp)
+        let json_resp = to_json_result(&resp)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -276,7 +276,7 @@ pub unsafe extern "C" fn user_hard_delete(payload_json: *const c_char) -> c_int
 
         #[derive(Deserialize)]
         struct Payload { id: String, auth: AuthCtxDto }
-        let payload: Payload = serde_json::from_str(json_str)
+        let payload: Payload = parse_payload(json_str)
             .map_err(|e| FFIError::invalid_argument(&format!("json parse: {e}")))?;
 
         let id = Uuid::parse_str(&payload.id)
@@ -314,7 +314,7 @@ pub unsafe extern "C" fn user_is_email_unique(payload_json: *const c_char, resul
             exclude_id: Option<String>,
             auth: AuthCtxDto,
         }
-        let payload: Payload = serde_json::from_str(json_str)
+        let payload: Payload = parse_payload(json_str)
             .map_err(|e| FFIError::invalid_argument(&format!("json parse: {e}")))?;
 
         let exclude = match payload.exclude_id {
@@ -328,7 +328,7 @@ pub unsafe extern "C" fn user_is_email_unique(payload_json: *const c_char, resul
         let is_unique = block_on_async(svc.is_email_unique(&payload.email, exclude))
             .map_err(|e| FFIError::from_service_error(e))?;
 
-        let json_resp = serde_json::to_string(&is_unique)
+        let json_resp = to_json_result(&is_unique)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -357,7 +357,7 @@ pub unsafe extern "C" fn user_change_password(payload_json: *const c_char) -> c_
 
         #[derive(Deserialize)]
         struct Payload { old_password: String, new_password: String, auth: AuthCtxDto }
-        let payload: Payload = serde_json::from_str(json_str)
+        let payload: Payload = parse_payload(json_str)
             .map_err(|e| FFIError::invalid_argument(&format!("json parse: {e}")))?;
 
         let auth_ctx: AuthContext = payload.auth.try_into()?;
@@ -388,7 +388,7 @@ pub unsafe extern "C" fn user_get_stats(payload_json: *const c_char, result: *mu
 
         #[derive(Deserialize)]
         struct Payload { auth: AuthCtxDto }
-        let payload: Payload = serde_json::from_str(json_str)
+        let payload: Payload = parse_payload(json_str)
             .map_err(|e| FFIError::invalid_argument(&format!("json parse: {e}")))?;
 
         let auth_ctx: AuthContext = payload.auth.try_into()?;
@@ -397,7 +397,7 @@ pub unsafe extern "C" fn user_get_stats(payload_json: *const c_char, result: *mu
         let stats = block_on_async(svc.get_user_stats(&auth_ctx))
             .map_err(|e| FFIError::from_service_error(e))?;
 
-        let json_resp = serde_json::to_string(&stats)
+        let json_resp = to_json_result(&stats)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
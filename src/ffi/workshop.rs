@@ -22,7 +22,8 @@
 //   of each payload is documented above every function.
 // ----------------------------------------------------------------------------
 
-use crate::ffi::{handle_status_result, error::FFIError};
+use crate::ffi::{handle_status_result, parse_payload, to_json_result, error::FFIError};
+use crate::ffi::result_cache;
 use crate::domains::workshop::types::{
     NewWorkshop, UpdateWorkshop, WorkshopResponse, WorkshopInclude,
     WorkshopParticipant, WorkshopStatistics, WorkshopWithParticipants,
@@ -37,7 +38,8 @@ use crate::types::{UserRole, PaginationParams};
 use crate::globals;
 
 use std::ffi::{CStr, CString};
-use std::os::raw::{c_char, c_int};
+use std::os::raw::{c_char, c_int, c_void};
+use crate::ffi::FfiCompletionCallback;
 use std::str::FromStr;
 use uuid::Uuid;
 use serde::{Deserialize, Serialize};
@@ -152,14 +154,14 @@ pub unsafe extern "C" fn workshop_create(payload_json: *const c_char, result: *m
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_workshop_service()?;
         
         let workshop = block_on_async(svc.create_workshop(p.workshop, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&workshop)
+        let json_resp = to_json_result(&workshop)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -198,7 +200,7 @@ pub unsafe extern "C" fn workshop_create_with_documents(payload_json: *const c_c
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         
         // Decode all documents
         let mut documents = Vec::new();
@@ -228,7 +230,7 @@ pub unsafe extern "C" fn workshop_create_with_documents(payload_json: *const c_c
             document_results: doc_results.into_iter().map(|r| r.map_err(|e| e.to_string())).collect(),
         };
         
-        let json_resp = serde_json::to_string(&response)
+        let json_resp = to_json_result(&response)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -258,7 +260,7 @@ pub unsafe extern "C" fn workshop_get(payload_json: *const c_char, result: *mut
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         
@@ -271,7 +273,7 @@ pub unsafe extern "C" fn workshop_get(payload_json: *const c_char, result: *mut
         let workshop = block_on_async(svc.get_workshop_by_id(id, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&workshop)
+        let json_resp = to_json_result(&workshop)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -303,7 +305,7 @@ pub unsafe extern "C" fn workshop_list(payload_json: *const c_char, result: *mut
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let params = p.pagination.map(|p| p.into()).unwrap_or_default();
         let project_id = p.project_id.as_ref()
             .map(|id| Uuid::parse_str(id))
@@ -320,7 +322,7 @@ pub unsafe extern "C" fn workshop_list(payload_json: *const c_char, result: *mut
         let workshops = block_on_async(svc.list_workshops(params, project_id, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&workshops)
+        let json_resp = to_json_result(&workshops)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -350,7 +352,7 @@ pub unsafe extern "C" fn workshop_update(payload_json: *const c_char, result: *m
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_workshop_service()?;
@@ -358,7 +360,7 @@ pub unsafe extern "C" fn workshop_update(payload_json: *const c_char, result: *m
         let workshop = block_on_async(svc.update_workshop(id, p.update, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&workshop)
+        let json_resp = to_json_result(&workshop)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -388,7 +390,7 @@ pub unsafe extern "C" fn workshop_delete(payload_json: *const c_char, result: *m
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_workshop_service()?;
@@ -398,7 +400,7 @@ pub unsafe extern "C" fn workshop_delete(payload_json: *const c_char, result: *m
             .map_err(FFIError::from_service_error)?;
         
         // Serialize and return the DeleteResult
-        let json_resp = serde_json::to_string(&delete_result)
+        let json_resp = to_json_result(&delete_result)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -432,7 +434,7 @@ pub unsafe extern "C" fn workshop_add_participant(payload_json: *const c_char, r
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let workshop_id = Uuid::parse_str(&p.workshop_id).map_err(|_| FFIError::invalid_argument("workshop_id"))?;
         let participant_id = Uuid::parse_str(&p.participant_id).map_err(|_| FFIError::invalid_argument("participant_id"))?;
         let auth: AuthContext = p.auth.try_into()?;
@@ -441,7 +443,7 @@ pub unsafe extern "C" fn workshop_add_participant(payload_json: *const c_char, r
         let workshop_participant = block_on_async(svc.add_participant_to_workshop(workshop_id, participant_id, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&workshop_participant)
+        let json_resp = to_json_result(&workshop_participant)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -470,7 +472,7 @@ pub unsafe extern "C" fn workshop_remove_participant(payload_json: *const c_char
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let workshop_id = Uuid::parse_str(&p.workshop_id).map_err(|_| FFIError::invalid_argument("workshop_id"))?;
         let participant_id = Uuid::parse_str(&p.participant_id).map_err(|_| FFIError::invalid_argument("participant_id"))?;
         let auth: AuthContext = p.auth.try_into()?;
@@ -505,7 +507,7 @@ pub unsafe extern "C" fn workshop_batch_add_participants(payload_json: *const c_
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let workshop_id = Uuid::parse_str(&p.workshop_id).map_err(|_| FFIError::invalid_argument("workshop_id"))?;
         
         let mut participant_ids = Vec::new();
@@ -520,7 +522,7 @@ pub unsafe extern "C" fn workshop_batch_add_participants(payload_json: *const c_
         let results = block_on_async(svc.batch_add_participants_to_workshop(workshop_id, participant_ids, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&results)
+        let json_resp = to_json_result(&results)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -552,7 +554,7 @@ pub unsafe extern "C" fn workshop_update_participant_evaluation(payload_json: *c
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let workshop_id = Uuid::parse_str(&p.workshop_id).map_err(|_| FFIError::invalid_argument("workshop_id"))?;
         let participant_id = Uuid::parse_str(&p.participant_id).map_err(|_| FFIError::invalid_argument("participant_id"))?;
         let auth: AuthContext = p.auth.try_into()?;
@@ -561,7 +563,7 @@ pub unsafe extern "C" fn workshop_update_participant_evaluation(payload_json: *c
         let workshop_participant = block_on_async(svc.update_participant_evaluation(workshop_id, participant_id, p.update, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&workshop_participant)
+        let json_resp = to_json_result(&workshop_participant)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -599,7 +601,7 @@ pub unsafe extern "C" fn workshop_find_by_date_range(payload_json: *const c_char
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let params = p.pagination.map(|p| p.into()).unwrap_or_default();
         let auth: AuthContext = p.auth.try_into()?;
         
@@ -612,7 +614,7 @@ pub unsafe extern "C" fn workshop_find_by_date_range(payload_json: *const c_char
         let workshops = block_on_async(svc.find_workshops_by_date_range(&p.start_date, &p.end_date, params, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&workshops)
+        let json_resp = to_json_result(&workshops)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -642,7 +644,7 @@ pub unsafe extern "C" fn workshop_find_past(payload_json: *const c_char, result:
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let params = p.pagination.map(|p| p.into()).unwrap_or_default();
         let auth: AuthContext = p.auth.try_into()?;
         
@@ -655,7 +657,7 @@ pub unsafe extern "C" fn workshop_find_past(payload_json: *const c_char, result:
         let workshops = block_on_async(svc.find_past_workshops(params, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&workshops)
+        let json_resp = to_json_result(&workshops)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -685,7 +687,7 @@ pub unsafe extern "C" fn workshop_find_upcoming(payload_json: *const c_char, res
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let params = p.pagination.map(|p| p.into()).unwrap_or_default();
         let auth: AuthContext = p.auth.try_into()?;
         
@@ -698,7 +700,7 @@ pub unsafe extern "C" fn workshop_find_upcoming(payload_json: *const c_char, res
         let workshops = block_on_async(svc.find_upcoming_workshops(params, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&workshops)
+        let json_resp = to_json_result(&workshops)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -730,7 +732,7 @@ pub unsafe extern "C" fn workshop_find_by_location(payload_json: *const c_char,
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let params = p.pagination.map(|p| p.into()).unwrap_or_default();
         let auth: AuthContext = p.auth.try_into()?;
         
@@ -743,7 +745,7 @@ pub unsafe extern "C" fn workshop_find_by_location(payload_json: *const c_char,
         let workshops = block_on_async(svc.find_workshops_by_location(&p.location, params, include_slice, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&workshops)
+        let json_resp = to_json_result(&workshops)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -771,14 +773,14 @@ pub unsafe extern "C" fn workshop_get_statistics(payload_json: *const c_char, re
         #[derive(Deserialize)]
         struct Payload { auth: AuthCtxDto }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_workshop_service()?;
         
         let statistics = block_on_async(svc.get_workshop_statistics(&auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&statistics)
+        let json_resp = to_json_result(&statistics)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -806,7 +808,7 @@ pub unsafe extern "C" fn workshop_get_budget_statistics(payload_json: *const c_c
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let project_id = p.project_id.as_ref()
             .map(|id| Uuid::parse_str(id))
             .transpose()
@@ -833,7 +835,7 @@ pub unsafe extern "C" fn workshop_get_budget_statistics(payload_json: *const c_c
             avg_variance_pct,
         };
         
-        let json_resp = serde_json::to_string(&stats)
+        let json_resp = to_json_result(&stats)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -861,16 +863,17 @@ pub unsafe extern "C" fn workshop_get_project_metrics(payload_json: *const c_cha
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let project_id = Uuid::parse_str(&p.project_id).map_err(|_| FFIError::invalid_argument("invalid project_id"))?;
         let auth: AuthContext = p.auth.try_into()?;
-        let svc = globals::get_workshop_service()?;
-        
-        let metrics = block_on_async(svc.get_project_workshop_metrics(project_id, &auth))
-            .map_err(FFIError::from_service_error)?;
-        
-        let json_resp = serde_json::to_string(&metrics)
-            .map_err(|e| FFIError::internal(format!("ser {e}")))?;
+        // Metrics include the project name and count upcoming workshops against today's date
+        let args = format!("{}@{}", result_cache::cache_args(json), chrono::Local::now().format("%Y-%m-%d"));
+        let json_resp = result_cache::cached_json("workshop_get_project_metrics", args, &auth, &["workshops", "projects"], || {
+            let svc = globals::get_workshop_service()?;
+            let metrics = block_on_async(svc.get_project_workshop_metrics(project_id, &auth))
+                .map_err(FFIError::from_service_error)?;
+            to_json_result(&metrics).map_err(|e| FFIError::internal(format!("ser {e}")))
+        })?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
         Ok(())
@@ -897,7 +900,7 @@ pub unsafe extern "C" fn workshop_get_participant_attendance(payload_json: *cons
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let participant_id = Uuid::parse_str(&p.participant_id).map_err(|_| FFIError::invalid_argument("invalid participant_id"))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_workshop_service()?;
@@ -905,7 +908,7 @@ pub unsafe extern "C" fn workshop_get_participant_attendance(payload_json: *cons
         let attendance = block_on_async(svc.get_participant_attendance(participant_id, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&attendance)
+        let json_resp = to_json_result(&attendance)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -937,7 +940,7 @@ pub unsafe extern "C" fn workshop_get_with_participants(payload_json: *const c_c
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_workshop_service()?;
@@ -945,7 +948,7 @@ pub unsafe extern "C" fn workshop_get_with_participants(payload_json: *const c_c
         let workshop_with_participants = block_on_async(svc.get_workshop_with_participants(id, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&workshop_with_participants)
+        let json_resp = to_json_result(&workshop_with_participants)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -973,7 +976,7 @@ pub unsafe extern "C" fn workshop_get_with_document_timeline(payload_json: *cons
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let id = Uuid::parse_str(&p.id).map_err(|_| FFIError::invalid_argument("uuid"))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_workshop_service()?;
@@ -981,7 +984,7 @@ pub unsafe extern "C" fn workshop_get_with_document_timeline(payload_json: *cons
         let workshop_with_timeline = block_on_async(svc.get_workshop_with_document_timeline(id, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&workshop_with_timeline)
+        let json_resp = to_json_result(&workshop_with_timeline)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -1009,7 +1012,7 @@ pub unsafe extern "C" fn workshop_get_budget_summaries_for_project(payload_json:
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let project_id = Uuid::parse_str(&p.project_id).map_err(|_| FFIError::invalid_argument("invalid project_id"))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_workshop_service()?;
@@ -1017,7 +1020,7 @@ pub unsafe extern "C" fn workshop_get_budget_summaries_for_project(payload_json:
         let budget_summaries = block_on_async(svc.get_workshop_budget_summaries_for_project(project_id, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&budget_summaries)
+        let json_resp = to_json_result(&budget_summaries)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -1047,7 +1050,7 @@ pub unsafe extern "C" fn workshop_find_participants_with_missing_evaluations(pay
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         let workshop_id = Uuid::parse_str(&p.workshop_id).map_err(|_| FFIError::invalid_argument("invalid workshop_id"))?;
         let auth: AuthContext = p.auth.try_into()?;
         let svc = globals::get_workshop_service()?;
@@ -1055,7 +1058,7 @@ pub unsafe extern "C" fn workshop_find_participants_with_missing_evaluations(pay
         let participants = block_on_async(svc.find_participants_with_missing_evaluations(workshop_id, &p.eval_type, &auth))
             .map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&participants)
+        let json_resp = to_json_result(&participants)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -1101,7 +1104,7 @@ pub unsafe extern "C" fn workshop_upload_document(payload_json: *const c_char, r
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         
         // Decode base64 file data
         let file_data = base64::decode(&p.file_data)
@@ -1134,7 +1137,7 @@ pub unsafe extern "C" fn workshop_upload_document(payload_json: *const c_char, r
             &auth,
         )).map_err(FFIError::from_service_error)?;
         
-        let json_resp = serde_json::to_string(&document)
+        let json_resp = to_json_result(&document)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -1186,7 +1189,7 @@ pub unsafe extern "C" fn workshop_upload_documents_bulk(payload_json: *const c_c
             auth: AuthCtxDto,
         }
         
-        let p: Payload = serde_json::from_str(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
+        let p: Payload = parse_payload(json).map_err(|e| FFIError::invalid_argument(&format!("json {e}")))?;
         
         let workshop_id = Uuid::parse_str(&p.workshop_id)
             .map_err(|_| FFIError::invalid_argument("invalid workshop_id"))?;
@@ -1244,7 +1247,7 @@ pub unsafe extern "C" fn workshop_upload_documents_bulk(payload_json: *const c_c
             failed_uploads,
         };
         
-        let json_resp = serde_json::to_string(&response)
+        let json_resp = to_json_result(&response)
             .map_err(|e| FFIError::internal(format!("ser {e}")))?;
         let cstr = CString::new(json_resp).unwrap();
         *result = cstr.into_raw();
@@ -1252,6 +1255,26 @@ pub unsafe extern "C" fn workshop_upload_documents_bulk(payload_json: *const c_c
     })
 }
 
+// ---------------------------------------------------------------------------
+// Async Variants
+// ---------------------------------------------------------------------------
+
+// Non-blocking versions of the calls above. They take the same payload, return
+// immediately, and invoke `callback(ctx, status, result)` from a background
+// thread once done. `result` must be freed with `workshop_free`.
+
+/// Async variant of `workshop_list`
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn workshop_list_async(payload_json: *const c_char, ctx: *mut c_void, callback: FfiCompletionCallback) -> c_int {
+    crate::ffi::runtime::dispatch_async(workshop_list, payload_json, ctx, callback)
+}
+
+/// Async variant of `workshop_get_budget_statistics`
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn workshop_get_budget_statistics_async(payload_json: *const c_char, ctx: *mut c_void, callback: FfiCompletionCallback) -> c_int {
+    crate::ffi::runtime::dispatch_async(workshop_get_budget_statistics, payload_json, ctx, callback)
+}
+
 // ---------------------------------------------------------------------------
 // Memory Management
 // ---------------------------------------------------------------------------
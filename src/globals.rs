@@ -3,10 +3,12 @@ use crate::domains::user::{UserRepository, UserService, User};
 use crate::domains::user::repository::SqliteUserRepository;
 use crate::domains::sync::repository::{ChangeLogRepository, SqliteChangeLogRepository, TombstoneRepository, SqliteTombstoneRepository, SyncRepository, SqliteSyncRepository};
 use crate::domains::sync::service::{SyncService, SyncServiceImpl};
-use crate::ffi::error::{FFIError, FFIResult};
+use crate::ffi::error::{ErrorCode, FFIError, FFIResult};
+use crate::db_profile::StorageProfile;
 use sqlx::SqlitePool;
-use std::sync::{Arc, Mutex};
+use std::sync::{Arc, OnceLock};
 use std::sync::atomic::{AtomicBool, Ordering};
+use std::time::Instant;
 use lazy_static::lazy_static;
 use chrono;
 use crate::domains::core::dependency_checker::{DependencyChecker, SqliteDependencyChecker};
@@ -75,241 +77,295 @@ use crate::domains::strategic_goal::service::{StrategicGoalService, StrategicGoa
 // Global state definitions
 lazy_static! {
     static ref INIT_MUTEX: tokio::sync::Mutex<()> = tokio::sync::Mutex::new(());
-    static ref INITIALIZED: AtomicBool = AtomicBool::new(false);
-    
-    static ref DB_POOL: Mutex<Option<SqlitePool>> = Mutex::new(None);
-    static ref DEVICE_ID: Mutex<Option<String>> = Mutex::new(None);
-    static ref OFFLINE_MODE: Mutex<bool> = Mutex::new(false);
-
+    static ref FINISH_STARTUP_MUTEX: tokio::sync::Mutex<()> = tokio::sync::Mutex::new(());
+}
+
+static INITIALIZED: AtomicBool = AtomicBool::new(false);
+static BACKGROUND_STARTED: AtomicBool = AtomicBool::new(false);
+static OFFLINE_MODE: AtomicBool = AtomicBool::new(false);
+
+// Set once during initialization and read-only afterwards, so lookups on the
+// FFI hot path are a plain atomic load instead of a mutex lock.
+static DB_POOL: OnceLock<SqlitePool> = OnceLock::new();
+static DB_READ_POOL: OnceLock<SqlitePool> = OnceLock::new();
+static STORAGE_PROFILE: OnceLock<StorageProfile> = OnceLock::new();
+static DEVICE_ID: OnceLock<String> = OnceLock::new();
+static COMPRESSION_WORKER_SENDER: OnceLock<tokio::sync::mpsc::Sender<crate::domains::compression::worker::CompressionWorkerMessage>> = OnceLock::new();
+static AUTH_SERVICE: OnceLock<Arc<AuthService>> = OnceLock::new();
+static SERVICES: OnceLock<ServiceRegistry> = OnceLock::new();
+// Held only while the registry is built on first use
+static SERVICES_BUILD_LOCK: std::sync::Mutex<()> = std::sync::Mutex::new(());
+
+/// Typed handles to every repository and service, built once: by `initialize`
+/// in eager startup, on the first getter call in fast startup
+struct ServiceRegistry {
     // Core Services
-    static ref CHANGE_LOG_REPO: Mutex<Option<Arc<dyn ChangeLogRepository>>> = Mutex::new(None);
-    static ref TOMBSTONE_REPO: Mutex<Option<Arc<dyn TombstoneRepository>>> = Mutex::new(None);
-    static ref DEPENDENCY_CHECKER: Mutex<Option<Arc<dyn DependencyChecker>>> = Mutex::new(None);
-    static ref DELETION_MANAGER: Mutex<Option<Arc<PendingDeletionManager>>> = Mutex::new(None);
-    static ref AUTH_SERVICE: Mutex<Option<Arc<AuthService>>> = Mutex::new(None);
-    static ref FILE_STORAGE_SERVICE: Mutex<Option<Arc<dyn FileStorageService>>> = Mutex::new(None);
-    static ref COMPRESSION_MANAGER: Mutex<Option<Arc<dyn CompressionManager>>> = Mutex::new(None);
-    static ref COMPRESSION_REPO: Mutex<Option<Arc<dyn CompressionRepository>>> = Mutex::new(None); // Added for completeness
-    static ref COMPRESSION_SERVICE: Mutex<Option<Arc<dyn CompressionService>>> = Mutex::new(None);
-    static ref COMPRESSION_WORKER_SENDER: Mutex<Option<tokio::sync::mpsc::Sender<crate::domains::compression::worker::CompressionWorkerMessage>>> = Mutex::new(None);
-    static ref CLOUD_STORAGE_SERVICE: Mutex<Option<Arc<dyn CloudStorageService>>> = Mutex::new(None);
+    change_log_repo: Arc<dyn ChangeLogRepository>,
+    tombstone_repo: Arc<dyn TombstoneRepository>,
+    dependency_checker: Arc<dyn DependencyChecker>,
+    deletion_manager: Arc<PendingDeletionManager>,
+    file_storage_service: Arc<dyn FileStorageService>,
+    compression_manager: Arc<dyn CompressionManager>,
+    compression_repo: Arc<dyn CompressionRepository>,
+    compression_service: Arc<dyn CompressionService>,
+    cloud_storage_service: Arc<dyn CloudStorageService>,
 
     // User Domain
-    static ref USER_REPO: Mutex<Option<Arc<dyn UserRepository>>> = Mutex::new(None);
-    static ref USER_SERVICE: Mutex<Option<Arc<UserService>>> = Mutex::new(None);
-    static ref DELETE_SERVICE_USER: Mutex<Option<Arc<dyn DeleteService<User>>>> = Mutex::new(None);
-    static ref USER_ENTITY_MERGER: Mutex<Option<Arc<UserEntityMerger>>> = Mutex::new(None);
+    user_repo: Arc<dyn UserRepository>,
+    user_service: Arc<UserService>,
+    delete_service_user: Arc<dyn DeleteService<User>>,
+    user_entity_merger: Arc<UserEntityMerger>,
 
     // Donor Domain
-    static ref DONOR_REPO: Mutex<Option<Arc<dyn DonorRepository>>> = Mutex::new(None);
-    static ref DELETE_SERVICE_DONOR: Mutex<Option<Arc<dyn DeleteService<Donor>>>> = Mutex::new(None);
-    static ref DONOR_ENTITY_MERGER: Mutex<Option<Arc<DonorEntityMerger>>> = Mutex::new(None);
+    donor_repo: Arc<dyn DonorRepository>,
+    delete_service_donor: Arc<dyn DeleteService<Donor>>,
+    donor_entity_merger: Arc<DonorEntityMerger>,
 
     // Document Domain
-    static ref MEDIA_DOCUMENT_REPO: Mutex<Option<Arc<dyn MediaDocumentRepository>>> = Mutex::new(None);
-    static ref DELETE_SERVICE_MEDIA_DOCUMENT: Mutex<Option<Arc<dyn DeleteService<MediaDocument>>>> = Mutex::new(None);
-    static ref MEDIA_DOCUMENT_ENTITY_MERGER: Mutex<Option<Arc<DocumentEntityMerger>>> = Mutex::new(None);
-    static ref DOCUMENT_TYPE_REPO: Mutex<Option<Arc<dyn DocumentTypeRepository>>> = Mutex::new(None);
-    static ref DELETE_SERVICE_DOCUMENT_TYPE: Mutex<Option<Arc<dyn DeleteService<DocumentType>>>> = Mutex::new(None);
-    static ref DOCUMENT_TYPE_ENTITY_MERGER: Mutex<Option<Arc<DocumentTypeEntityMerger>>> = Mutex::new(None);
-
+    media_document_repo: Arc<dyn MediaDocumentRepository>,
+    delete_service_media_document: Arc<dyn DeleteService<MediaDocument>>,
+    media_document_entity_merger: Arc<DocumentEntityMerger>,
+    document_type_repo: Arc<dyn DocumentTypeRepository>,
+    delete_service_document_type: Arc<dyn DeleteService<DocumentType>>,
+    document_type_entity_merger: Arc<DocumentTypeEntityMerger>,
 
     // Project Domain
-    static ref PROJECT_REPO: Mutex<Option<Arc<dyn ProjectRepository>>> = Mutex::new(None);
-    static ref DELETE_SERVICE_PROJECT: Mutex<Option<Arc<dyn DeleteService<Project>>>> = Mutex::new(None);
-    static ref PROJECT_ENTITY_MERGER: Mutex<Option<Arc<ProjectEntityMerger>>> = Mutex::new(None);
+    project_repo: Arc<dyn ProjectRepository>,
+    delete_service_project: Arc<dyn DeleteService<Project>>,
+    project_entity_merger: Arc<ProjectEntityMerger>,
 
     // Activity Domain
-    static ref ACTIVITY_REPO: Mutex<Option<Arc<dyn ActivityRepository>>> = Mutex::new(None);
-    static ref DELETE_SERVICE_ACTIVITY: Mutex<Option<Arc<dyn DeleteService<Activity>>>> = Mutex::new(None);
-    static ref ACTIVITY_ENTITY_MERGER: Mutex<Option<Arc<ActivityEntityMerger>>> = Mutex::new(None);
+    activity_repo: Arc<dyn ActivityRepository>,
+    delete_service_activity: Arc<dyn DeleteService<Activity>>,
+    activity_entity_merger: Arc<ActivityEntityMerger>,
 
     // Funding Domain (ProjectFunding)
-    static ref PROJECT_FUNDING_REPO: Mutex<Option<Arc<dyn ProjectFundingRepository>>> = Mutex::new(None);
-    static ref DELETE_SERVICE_PROJECT_FUNDING: Mutex<Option<Arc<dyn DeleteService<ProjectFunding>>>> = Mutex::new(None);
-    static ref PROJECT_FUNDING_ENTITY_MERGER: Mutex<Option<Arc<FundingEntityMerger>>> = Mutex::new(None);
+    project_funding_repo: Arc<dyn ProjectFundingRepository>,
+    delete_service_project_funding: Arc<dyn DeleteService<ProjectFunding>>,
+    project_funding_entity_merger: Arc<FundingEntityMerger>,
 
     // Workshop Domain
-    static ref WORKSHOP_REPO: Mutex<Option<Arc<dyn WorkshopRepository>>> = Mutex::new(None);
-    static ref DELETE_SERVICE_WORKSHOP: Mutex<Option<Arc<dyn DeleteService<Workshop>>>> = Mutex::new(None);
-    static ref WORKSHOP_ENTITY_MERGER: Mutex<Option<Arc<WorkshopEntityMerger>>> = Mutex::new(None);
+    workshop_repo: Arc<dyn WorkshopRepository>,
+    delete_service_workshop: Arc<dyn DeleteService<Workshop>>,
+    workshop_entity_merger: Arc<WorkshopEntityMerger>,
 
     // Livelihood Domain
-    static ref LIVELIHOOD_REPO: Mutex<Option<Arc<dyn LivehoodRepository>>> = Mutex::new(None);
-    static ref DELETE_SERVICE_LIVELIHOOD: Mutex<Option<Arc<dyn DeleteService<Livelihood>>>> = Mutex::new(None);
-    static ref LIVELIHOOD_ENTITY_MERGER: Mutex<Option<Arc<LivelihoodEntityMerger>>> = Mutex::new(None);
+    livelihood_repo: Arc<dyn LivehoodRepository>,
+    delete_service_livelihood: Arc<dyn DeleteService<Livelihood>>,
+    livelihood_entity_merger: Arc<LivelihoodEntityMerger>,
 
     // SubsequentGrant Domain
-    static ref SUBSEQUENT_GRANT_REPO: Mutex<Option<Arc<dyn SubsequentGrantRepository>>> = Mutex::new(None);
-    static ref DELETE_SERVICE_SUBSEQUENT_GRANT: Mutex<Option<Arc<dyn DeleteService<SubsequentGrant>>>> = Mutex::new(None);
-    static ref SUBSEQUENT_GRANT_ENTITY_MERGER: Mutex<Option<Arc<SubsequentGrantEntityMerger>>> = Mutex::new(None);
+    subsequent_grant_repo: Arc<dyn SubsequentGrantRepository>,
+    delete_service_subsequent_grant: Arc<dyn DeleteService<SubsequentGrant>>,
+    subsequent_grant_entity_merger: Arc<SubsequentGrantEntityMerger>,
 
     // Participant Domain
-    static ref PARTICIPANT_REPO: Mutex<Option<Arc<dyn ParticipantRepository>>> = Mutex::new(None);
-    static ref DELETE_SERVICE_PARTICIPANT: Mutex<Option<Arc<dyn DeleteService<Participant>>>> = Mutex::new(None);
-    static ref PARTICIPANT_ENTITY_MERGER: Mutex<Option<Arc<ParticipantEntityMerger>>> = Mutex::new(None);
+    participant_repo: Arc<dyn ParticipantRepository>,
+    delete_service_participant: Arc<dyn DeleteService<Participant>>,
+    participant_entity_merger: Arc<ParticipantEntityMerger>,
 
     // StrategicGoal Domain
-    static ref STRATEGIC_GOAL_REPO: Mutex<Option<Arc<dyn StrategicGoalRepository>>> = Mutex::new(None);
-    static ref DELETE_SERVICE_STRATEGIC_GOAL: Mutex<Option<Arc<dyn DeleteService<StrategicGoal>>>> = Mutex::new(None);
-    static ref STRATEGIC_GOAL_ENTITY_MERGER: Mutex<Option<Arc<StrategicGoalEntityMerger>>> = Mutex::new(None);
+    strategic_goal_repo: Arc<dyn StrategicGoalRepository>,
+    delete_service_strategic_goal: Arc<dyn DeleteService<StrategicGoal>>,
+    strategic_goal_entity_merger: Arc<StrategicGoalEntityMerger>,
 
     // WorkshopParticipant Domain
-    static ref WORKSHOP_PARTICIPANT_REPO: Mutex<Option<Arc<dyn WorkshopParticipantRepository>>> = Mutex::new(None);
-    static ref DELETE_SERVICE_WORKSHOP_PARTICIPANT: Mutex<Option<Arc<dyn DeleteService<WorkshopParticipant>>>> = Mutex::new(None);
-    static ref WORKSHOP_PARTICIPANT_ENTITY_MERGER: Mutex<Option<Arc<WorkshopParticipantEntityMerger>>> = Mutex::new(None);
+    workshop_participant_repo: Arc<dyn WorkshopParticipantRepository>,
+    delete_service_workshop_participant: Arc<dyn DeleteService<WorkshopParticipant>>,
+    workshop_participant_entity_merger: Arc<WorkshopParticipantEntityMerger>,
 
     // Document Version and Access Log Repositories
-    static ref DOCUMENT_VERSION_REPO: Mutex<Option<Arc<dyn DocumentVersionRepository>>> = Mutex::new(None);
-    static ref DOCUMENT_ACCESS_LOG_REPO: Mutex<Option<Arc<dyn DocumentAccessLogRepository>>> = Mutex::new(None);
+    document_version_repo: Arc<dyn DocumentVersionRepository>,
+    document_access_log_repo: Arc<dyn DocumentAccessLogRepository>,
 
-    // ... within lazy_static! block after CLOUD_STORAGE_SERVICE definition ...
-    static ref DOCUMENT_SERVICE: Mutex<Option<Arc<dyn DocumentService>>> = Mutex::new(None);
-    static ref PROJECT_SERVICE: Mutex<Option<Arc<dyn ProjectService>>> = Mutex::new(None);
-    static ref ACTIVITY_SERVICE: Mutex<Option<Arc<dyn ActivityService>>> = Mutex::new(None);
+    // Domain Services
+    document_service: Arc<dyn DocumentService>,
+    project_service: Arc<dyn ProjectService>,
+    activity_service: Arc<dyn ActivityService>,
 
     // Donor Domain
-    static ref DONOR_SERVICE: Mutex<Option<Arc<dyn DonorService>>> = Mutex::new(None);
-    static ref PROJECT_FUNDING_SERVICE: Mutex<Option<Arc<dyn ProjectFundingService>>> = Mutex::new(None);
-    static ref PARTICIPANT_SERVICE: Mutex<Option<Arc<dyn ParticipantService>>> = Mutex::new(None);
+    donor_service: Arc<dyn DonorService>,
+    project_funding_service: Arc<dyn ProjectFundingService>,
+    participant_service: Arc<dyn ParticipantService>,
 
     // Workshop Service
-    static ref WORKSHOP_SERVICE: Mutex<Option<Arc<dyn WorkshopService>>> = Mutex::new(None);
-    static ref LIVELIHOOD_SERVICE: Mutex<Option<Arc<dyn LivehoodService>>> = Mutex::new(None);
-    static ref STRATEGIC_GOAL_SERVICE: Mutex<Option<Arc<dyn StrategicGoalService>>> = Mutex::new(None);
-    
+    workshop_service: Arc<dyn WorkshopService>,
+    livelihood_service: Arc<dyn LivehoodService>,
+    strategic_goal_service: Arc<dyn StrategicGoalService>,
+
     // Funding Service (alias for ProjectFundingService)
-    static ref FUNDING_SERVICE: Mutex<Option<Arc<dyn ProjectFundingService>>> = Mutex::new(None);
+    funding_service: Arc<dyn ProjectFundingService>,
 
     // ---- Sync / Merge ----
-    static ref SYNC_REPO: Mutex<Option<Arc<dyn SyncRepository>>> = Mutex::new(None);
-    static ref ENTITY_MERGER_GLOBAL: Mutex<Option<Arc<EntityMerger>>> = Mutex::new(None);
-    static ref SYNC_SERVICE_GLOBAL: Mutex<Option<Arc<dyn SyncService>>> = Mutex::new(None);
+    sync_repo: Arc<dyn SyncRepository>,
+    entity_merger: Arc<EntityMerger>,
+    sync_service: Arc<dyn SyncService>,
+}
 
+fn services() -> FFIResult<&'static ServiceRegistry> {
+    if let Some(registry) = SERVICES.get() {
+        return Ok(registry);
+    }
+    // First use: one caller builds the registry, concurrent callers wait for it
+    let _guard = SERVICES_BUILD_LOCK.lock().unwrap_or_else(|e| e.into_inner());
+    if let Some(registry) = SERVICES.get() {
+        return Ok(registry);
+    }
+    let started = Instant::now();
+    let registry = build_services()?;
+    crate::startup::record_phase("services", started.elapsed());
+    Ok(SERVICES.get_or_init(|| registry))
 }
 
 // --- Getter Functions (moved before initialization to avoid ordering issues) ---
 
+/// Writer pool: transactions, inserts, updates and deletes
 pub fn get_db_pool() -> FFIResult<SqlitePool> {
-    DB_POOL.lock().map_err(|_| FFIError::internal("DB_POOL lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("Database pool not initialized".to_string()))
+    DB_POOL.get().cloned().ok_or_else(|| FFIError::internal("Database pool not initialized".to_string()))
+}
+/// Read-only pool for queries (the writer pool when WAL is disabled or the database is in memory)
+pub fn get_db_read_pool() -> FFIResult<SqlitePool> {
+    DB_READ_POOL.get().cloned().ok_or_else(|| FFIError::internal("Database read pool not initialized".to_string()))
+}
+
+/// Record the storage profile. Must happen before `initialize` opens the database.
+pub fn configure_storage(profile: StorageProfile) -> FFIResult<()> {
+    if DB_POOL.get().is_some() {
+        if STORAGE_PROFILE.get().map_or(false, |current| *current == profile) {
+            return Ok(());
+        }
+        return Err(FFIError::new(
+            ErrorCode::ConfigurationError,
+            "Database already opened; storage profile must be configured before initialization",
+        ));
+    }
+    let _ = STORAGE_PROFILE.set(profile);
+    Ok(())
 }
 pub fn get_device_id() -> FFIResult<String> {
-    DEVICE_ID.lock().map_err(|_| FFIError::internal("DEVICE_ID lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("Device ID not initialized".to_string()))
+    DEVICE_ID.get().cloned().ok_or_else(|| FFIError::internal("Device ID not initialized".to_string()))
 }
-pub fn is_offline_mode() -> bool { OFFLINE_MODE.lock().map(|guard| *guard).unwrap_or(false) }
-pub fn set_offline_mode(offline: bool) { if let Ok(mut guard) = OFFLINE_MODE.lock() { *guard = offline; } }
+pub fn is_offline_mode() -> bool { OFFLINE_MODE.load(Ordering::Relaxed) }
+pub fn set_offline_mode(offline: bool) { OFFLINE_MODE.store(offline, Ordering::Relaxed) }
 
 pub fn get_change_log_repo() -> FFIResult<Arc<dyn ChangeLogRepository>> {
-    CHANGE_LOG_REPO.lock().map_err(|_| FFIError::internal("CHANGE_LOG_REPO lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("ChangeLogRepository not initialized".to_string()))
+    services().map(|s| s.change_log_repo.clone())
 }
 pub fn get_tombstone_repo() -> FFIResult<Arc<dyn TombstoneRepository>> {
-    TOMBSTONE_REPO.lock().map_err(|_| FFIError::internal("TOMBSTONE_REPO lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("TombstoneRepository not initialized".to_string()))
+    services().map(|s| s.tombstone_repo.clone())
 }
 pub fn get_dependency_checker() -> FFIResult<Arc<dyn DependencyChecker>> {
-    DEPENDENCY_CHECKER.lock().map_err(|_| FFIError::internal("DEPENDENCY_CHECKER lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("DependencyChecker not initialized".to_string()))
+    services().map(|s| s.dependency_checker.clone())
 }
 pub fn get_deletion_manager() -> FFIResult<Arc<PendingDeletionManager>> {
-    DELETION_MANAGER.lock().map_err(|_| FFIError::internal("DELETION_MANAGER lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("PendingDeletionManager not initialized".to_string()))
+    services().map(|s| s.deletion_manager.clone())
 }
 pub fn get_auth_service() -> FFIResult<Arc<AuthService>> {
-    AUTH_SERVICE.lock().map_err(|_| FFIError::internal("AUTH_SERVICE lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("AuthService not initialized".to_string()))
+    AUTH_SERVICE.get().cloned().ok_or_else(|| FFIError::internal("Services not initialized".to_string()))
 }
 pub fn get_file_storage_service() -> FFIResult<Arc<dyn FileStorageService>> {
-    FILE_STORAGE_SERVICE.lock().map_err(|_| FFIError::internal("FILE_STORAGE_SERVICE lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("FileStorageService not initialized".to_string()))
+    services().map(|s| s.file_storage_service.clone())
 }
 pub fn get_compression_repo() -> FFIResult<Arc<dyn CompressionRepository>> {
-    COMPRESSION_REPO.lock().map_err(|_| FFIError::internal("COMPRESSION_REPO lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("CompressionRepository not initialized".to_string()))
+    services().map(|s| s.compression_repo.clone())
 }
 pub fn get_compression_service() -> FFIResult<Arc<dyn CompressionService>> {
-    COMPRESSION_SERVICE.lock().map_err(|_| FFIError::internal("COMPRESSION_SERVICE lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("CompressionService not initialized".to_string()))
+    services().map(|s| s.compression_service.clone())
 }
 pub fn get_compression_manager() -> FFIResult<Arc<dyn CompressionManager>> {
-    COMPRESSION_MANAGER.lock().map_err(|_| FFIError::internal("COMPRESSION_MANAGER lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("CompressionManager not initialized".to_string()))
+    services().map(|s| s.compression_manager.clone())
 }
+/// Sender of the compression worker. Fast startup defers the worker to
+/// `finish_startup`; a compression call made before then starts it here.
 pub fn get_compression_worker_sender() -> FFIResult<tokio::sync::mpsc::Sender<crate::domains::compression::worker::CompressionWorkerMessage>> {
-    COMPRESSION_WORKER_SENDER.lock().map_err(|_| FFIError::internal("COMPRESSION_WORKER_SENDER lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("CompressionWorkerSender not initialized".to_string()))
+    if let Some(sender) = COMPRESSION_WORKER_SENDER.get() {
+        return Ok(sender.clone());
+    }
+    let pool = get_db_pool()?;
+    let registry = services()?;
+    Ok(COMPRESSION_WORKER_SENDER.get_or_init(|| start_compression_worker(&pool, registry)).clone())
 }
 
 // User
 pub fn get_user_repo() -> FFIResult<Arc<dyn UserRepository>> {
-    USER_REPO.lock().map_err(|_| FFIError::internal("USER_REPO lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("UserRepository not initialized".to_string()))
+    services().map(|s| s.user_repo.clone())
 }
 pub fn get_user_service() -> FFIResult<Arc<UserService>> {
-    USER_SERVICE.lock().map_err(|_| FFIError::internal("USER_SERVICE lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("UserService not initialized".to_string()))
+    services().map(|s| s.user_service.clone())
 }
 pub fn get_user_delete_service() -> FFIResult<Arc<dyn DeleteService<User>>> {
-    DELETE_SERVICE_USER.lock().map_err(|_| FFIError::internal("DELETE_SERVICE_USER lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("User DeleteService not initialized".to_string()))
+    services().map(|s| s.delete_service_user.clone())
 }
 pub fn get_user_entity_merger() -> FFIResult<Arc<UserEntityMerger>> {
-    USER_ENTITY_MERGER.lock().map_err(|_| FFIError::internal("USER_ENTITY_MERGER lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("UserEntityMerger not initialized".to_string()))
+    services().map(|s| s.user_entity_merger.clone())
 }
 
 // Donor
 pub fn get_donor_repo() -> FFIResult<Arc<dyn DonorRepository>> {
-    DONOR_REPO.lock().map_err(|_| FFIError::internal("DONOR_REPO lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("DonorRepository not initialized".to_string()))
+    services().map(|s| s.donor_repo.clone())
 }
 pub fn get_donor_delete_service() -> FFIResult<Arc<dyn DeleteService<Donor>>> {
-    DELETE_SERVICE_DONOR.lock().map_err(|_| FFIError::internal("DELETE_SERVICE_DONOR lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("Donor DeleteService not initialized".to_string()))
+    services().map(|s| s.delete_service_donor.clone())
 }
 pub fn get_donor_entity_merger() -> FFIResult<Arc<DonorEntityMerger>> {
-    DONOR_ENTITY_MERGER.lock().map_err(|_| FFIError::internal("DONOR_ENTITY_MERGER lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("DonorEntityMerger not initialized".to_string()))
+    services().map(|s| s.donor_entity_merger.clone())
 }
 
 // Document
 pub fn get_media_document_repo() -> FFIResult<Arc<dyn MediaDocumentRepository>> {
-    MEDIA_DOCUMENT_REPO.lock().map_err(|_| FFIError::internal("MEDIA_DOCUMENT_REPO lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("MediaDocumentRepository not initialized".to_string()))
+    services().map(|s| s.media_document_repo.clone())
 }
 pub fn get_media_document_delete_service() -> FFIResult<Arc<dyn DeleteService<MediaDocument>>> {
-    DELETE_SERVICE_MEDIA_DOCUMENT.lock().map_err(|_| FFIError::internal("DELETE_SERVICE_MEDIA_DOCUMENT lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("MediaDocument DeleteService not initialized".to_string()))
+    services().map(|s| s.delete_service_media_document.clone())
 }
 pub fn get_media_document_entity_merger() -> FFIResult<Arc<DocumentEntityMerger>> {
-    MEDIA_DOCUMENT_ENTITY_MERGER.lock().map_err(|_| FFIError::internal("MEDIA_DOCUMENT_ENTITY_MERGER lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("MediaDocumentEntityMerger not initialized".to_string()))
+    services().map(|s| s.media_document_entity_merger.clone())
 }
 pub fn get_document_type_repo() -> FFIResult<Arc<dyn DocumentTypeRepository>> {
-    DOCUMENT_TYPE_REPO.lock().map_err(|_| FFIError::internal("DOCUMENT_TYPE_REPO lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("DocumentTypeRepository not initialized".to_string()))
+    services().map(|s| s.document_type_repo.clone())
 }
 pub fn get_document_type_delete_service() -> FFIResult<Arc<dyn DeleteService<DocumentType>>> {
-    DELETE_SERVICE_DOCUMENT_TYPE.lock().map_err(|_| FFIError::internal("DELETE_SERVICE_DOCUMENT_TYPE lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("DocumentType DeleteService not initialized".to_string()))
+    services().map(|s| s.delete_service_document_type.clone())
 }
 pub fn get_document_type_entity_merger() -> FFIResult<Arc<DocumentTypeEntityMerger>> {
-    DOCUMENT_TYPE_ENTITY_MERGER.lock().map_err(|_| FFIError::internal("DOCUMENT_TYPE_ENTITY_MERGER lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("DocumentTypeEntityMerger not initialized".to_string()))
+    services().map(|s| s.document_type_entity_merger.clone())
 }
 
 // Document Version Repository
 pub fn get_document_version_repo() -> FFIResult<Arc<dyn DocumentVersionRepository>> {
-    DOCUMENT_VERSION_REPO.lock().map_err(|_| FFIError::internal("DOCUMENT_VERSION_REPO lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("DocumentVersionRepository not initialized".to_string()))
+    services().map(|s| s.document_version_repo.clone())
 }
 
 // Document Access Log Repository  
 pub fn get_document_access_log_repo() -> FFIResult<Arc<dyn DocumentAccessLogRepository>> {
-    DOCUMENT_ACCESS_LOG_REPO.lock().map_err(|_| FFIError::internal("DOCUMENT_ACCESS_LOG_REPO lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("DocumentAccessLogRepository not initialized".to_string()))
+    services().map(|s| s.document_access_log_repo.clone())
 }
 
 // Project
 pub fn get_project_repo() -> FFIResult<Arc<dyn ProjectRepository>> {
-    PROJECT_REPO.lock().map_err(|_| FFIError::internal("PROJECT_REPO lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("ProjectRepository not initialized".to_string()))
+    services().map(|s| s.project_repo.clone())
 }
 pub fn get_project_delete_service() -> FFIResult<Arc<dyn DeleteService<Project>>> {
-    DELETE_SERVICE_PROJECT.lock().map_err(|_| FFIError::internal("DELETE_SERVICE_PROJECT lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("Project DeleteService not initialized".to_string()))
+    services().map(|s| s.delete_service_project.clone())
 }
 pub fn get_project_entity_merger() -> FFIResult<Arc<ProjectEntityMerger>> {
-    PROJECT_ENTITY_MERGER.lock().map_err(|_| FFIError::internal("PROJECT_ENTITY_MERGER lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("ProjectEntityMerger not initialized".to_string()))
+    services().map(|s| s.project_entity_merger.clone())
 }
 
 // Activity
 pub fn get_activity_repo() -> FFIResult<Arc<dyn ActivityRepository>> {
-    ACTIVITY_REPO.lock().map_err(|_| FFIError::internal("ACTIVITY_REPO lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("ActivityRepository not initialized".to_string()))
+    services().map(|s| s.activity_repo.clone())
 }
 pub fn get_activity_delete_service() -> FFIResult<Arc<dyn DeleteService<Activity>>> {
-    DELETE_SERVICE_ACTIVITY.lock().map_err(|_| FFIError::internal("DELETE_SERVICE_ACTIVITY lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("Activity DeleteService not initialized".to_string()))
+    services().map(|s| s.delete_service_activity.clone())
 }
 pub fn get_activity_entity_merger() -> FFIResult<Arc<ActivityEntityMerger>> {
-    ACTIVITY_ENTITY_MERGER.lock().map_err(|_| FFIError::internal("ACTIVITY_ENTITY_MERGER lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("ActivityEntityMerger not initialized".to_string()))
+    services().map(|s| s.activity_entity_merger.clone())
 }
 
 // ProjectFunding
 pub fn get_project_funding_repo() -> FFIResult<Arc<dyn ProjectFundingRepository>> {
-    PROJECT_FUNDING_REPO.lock().map_err(|_| FFIError::internal("PROJECT_FUNDING_REPO lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("ProjectFundingRepository not initialized".to_string()))
+    services().map(|s| s.project_funding_repo.clone())
 }
 
 // Alias for export compatibility
@@ -318,132 +374,132 @@ pub fn get_funding_repo() -> FFIResult<Arc<dyn ProjectFundingRepository>> {
 }
 
 pub fn get_project_funding_delete_service() -> FFIResult<Arc<dyn DeleteService<ProjectFunding>>> {
-    DELETE_SERVICE_PROJECT_FUNDING.lock().map_err(|_| FFIError::internal("DELETE_SERVICE_PROJECT_FUNDING lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("ProjectFunding DeleteService not initialized".to_string()))
+    services().map(|s| s.delete_service_project_funding.clone())
 }
 
 pub fn get_project_funding_entity_merger() -> FFIResult<Arc<FundingEntityMerger>> {
-    PROJECT_FUNDING_ENTITY_MERGER.lock().map_err(|_| FFIError::internal("PROJECT_FUNDING_ENTITY_MERGER lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("ProjectFundingEntityMerger not initialized".to_string()))
+    services().map(|s| s.project_funding_entity_merger.clone())
 }
 
 // Workshop
 pub fn get_workshop_repo() -> FFIResult<Arc<dyn WorkshopRepository>> {
-    WORKSHOP_REPO.lock().map_err(|_| FFIError::internal("WORKSHOP_REPO lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("WorkshopRepository not initialized".to_string()))
+    services().map(|s| s.workshop_repo.clone())
 }
 pub fn get_workshop_delete_service() -> FFIResult<Arc<dyn DeleteService<Workshop>>> {
-    DELETE_SERVICE_WORKSHOP.lock().map_err(|_| FFIError::internal("DELETE_SERVICE_WORKSHOP lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("Workshop DeleteService not initialized".to_string()))
+    services().map(|s| s.delete_service_workshop.clone())
 }
 pub fn get_workshop_entity_merger() -> FFIResult<Arc<WorkshopEntityMerger>> {
-    WORKSHOP_ENTITY_MERGER.lock().map_err(|_| FFIError::internal("WORKSHOP_ENTITY_MERGER lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("WorkshopEntityMerger not initialized".to_string()))
+    services().map(|s| s.workshop_entity_merger.clone())
 }
 
 // Livelihood
 pub fn get_livelihood_repo() -> FFIResult<Arc<dyn LivehoodRepository>> {
-    LIVELIHOOD_REPO.lock().map_err(|_| FFIError::internal("LIVELIHOOD_REPO lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("LivelihoodRepository not initialized".to_string()))
+    services().map(|s| s.livelihood_repo.clone())
 }
 pub fn get_livelihood_delete_service() -> FFIResult<Arc<dyn DeleteService<Livelihood>>> {
-    DELETE_SERVICE_LIVELIHOOD.lock().map_err(|_| FFIError::internal("DELETE_SERVICE_LIVELIHOOD lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("Livelihood DeleteService not initialized".to_string()))
+    services().map(|s| s.delete_service_livelihood.clone())
 }
 pub fn get_livelihood_entity_merger() -> FFIResult<Arc<LivelihoodEntityMerger>> {
-    LIVELIHOOD_ENTITY_MERGER.lock().map_err(|_| FFIError::internal("LIVELIHOOD_ENTITY_MERGER lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("LivelihoodEntityMerger not initialized".to_string()))
+    services().map(|s| s.livelihood_entity_merger.clone())
 }
 
 // SubsequentGrant
 pub fn get_subsequent_grant_repo() -> FFIResult<Arc<dyn SubsequentGrantRepository>> {
-    SUBSEQUENT_GRANT_REPO.lock().map_err(|_| FFIError::internal("SUBSEQUENT_GRANT_REPO lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("SubsequentGrantRepository not initialized".to_string()))
+    services().map(|s| s.subsequent_grant_repo.clone())
 }
 pub fn get_subsequent_grant_delete_service() -> FFIResult<Arc<dyn DeleteService<SubsequentGrant>>> {
-    DELETE_SERVICE_SUBSEQUENT_GRANT.lock().map_err(|_| FFIError::internal("DELETE_SERVICE_SUBSEQUENT_GRANT lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("SubsequentGrant DeleteService not initialized".to_string()))
+    services().map(|s| s.delete_service_subsequent_grant.clone())
 }
 pub fn get_subsequent_grant_entity_merger() -> FFIResult<Arc<SubsequentGrantEntityMerger>> {
-    SUBSEQUENT_GRANT_ENTITY_MERGER.lock().map_err(|_| FFIError::internal("SUBSEQUENT_GRANT_ENTITY_MERGER lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("SubsequentGrantEntityMerger not initialized".to_string()))
+    services().map(|s| s.subsequent_grant_entity_merger.clone())
 }
 
 // Participant
 pub fn get_participant_repo() -> FFIResult<Arc<dyn ParticipantRepository>> {
-    PARTICIPANT_REPO.lock().map_err(|_| FFIError::internal("PARTICIPANT_REPO lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("ParticipantRepository not initialized".to_string()))
+    services().map(|s| s.participant_repo.clone())
 }
 pub fn get_participant_delete_service() -> FFIResult<Arc<dyn DeleteService<Participant>>> {
-    DELETE_SERVICE_PARTICIPANT.lock().map_err(|_| FFIError::internal("DELETE_SERVICE_PARTICIPANT lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("Participant DeleteService not initialized".to_string()))
+    services().map(|s| s.delete_service_participant.clone())
 }
 pub fn get_participant_entity_merger() -> FFIResult<Arc<ParticipantEntityMerger>> {
-    PARTICIPANT_ENTITY_MERGER.lock().map_err(|_| FFIError::internal("PARTICIPANT_ENTITY_MERGER lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("ParticipantEntityMerger not initialized".to_string()))
+    services().map(|s| s.participant_entity_merger.clone())
 }
 
 // StrategicGoal
 pub fn get_strategic_goal_repo() -> FFIResult<Arc<dyn StrategicGoalRepository>> {
-    STRATEGIC_GOAL_REPO.lock().map_err(|_| FFIError::internal("STRATEGIC_GOAL_REPO lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("StrategicGoalRepository not initialized".to_string()))
+    services().map(|s| s.strategic_goal_repo.clone())
 }
 pub fn get_strategic_goal_delete_service() -> FFIResult<Arc<dyn DeleteService<StrategicGoal>>> {
-    DELETE_SERVICE_STRATEGIC_GOAL.lock().map_err(|_| FFIError::internal("DELETE_SERVICE_STRATEGIC_GOAL lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("StrategicGoal DeleteService not initialized".to_string()))
+    services().map(|s| s.delete_service_strategic_goal.clone())
 }
 pub fn get_strategic_goal_entity_merger() -> FFIResult<Arc<StrategicGoalEntityMerger>> {
-    STRATEGIC_GOAL_ENTITY_MERGER.lock().map_err(|_| FFIError::internal("STRATEGIC_GOAL_ENTITY_MERGER lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("StrategicGoalEntityMerger not initialized".to_string()))
+    services().map(|s| s.strategic_goal_entity_merger.clone())
 }
 
 // WorkshopParticipant
 pub fn get_workshop_participant_repo() -> FFIResult<Arc<dyn WorkshopParticipantRepository>> {
-    WORKSHOP_PARTICIPANT_REPO.lock().map_err(|_| FFIError::internal("WORKSHOP_PARTICIPANT_REPO lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("WorkshopParticipantRepository not initialized".to_string()))
+    services().map(|s| s.workshop_participant_repo.clone())
 }
 pub fn get_workshop_participant_entity_merger() -> FFIResult<Arc<WorkshopParticipantEntityMerger>> {
-    WORKSHOP_PARTICIPANT_ENTITY_MERGER.lock().map_err(|_| FFIError::internal("WORKSHOP_PARTICIPANT_ENTITY_MERGER lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("WorkshopParticipantEntityMerger not initialized".to_string()))
+    services().map(|s| s.workshop_participant_entity_merger.clone())
 }
 
 // Cloud storage
 pub fn get_cloud_storage_service() -> FFIResult<Arc<dyn CloudStorageService>> {
-    CLOUD_STORAGE_SERVICE.lock().map_err(|_| FFIError::internal("CLOUD_STORAGE_SERVICE lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("CloudStorageService not initialized".to_string()))
+    services().map(|s| s.cloud_storage_service.clone())
 }
 
 // Services
 pub fn get_document_service() -> FFIResult<Arc<dyn DocumentService>> {
-    DOCUMENT_SERVICE.lock().map_err(|_| FFIError::internal("DOCUMENT_SERVICE lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("DocumentService not initialized".to_string()))
+    services().map(|s| s.document_service.clone())
 }
 
 pub fn get_project_service() -> FFIResult<Arc<dyn ProjectService>> {
-    PROJECT_SERVICE.lock().map_err(|_| FFIError::internal("PROJECT_SERVICE lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("ProjectService not initialized".to_string()))
+    services().map(|s| s.project_service.clone())
 }
 
 pub fn get_activity_service() -> FFIResult<Arc<dyn ActivityService>> {
-    ACTIVITY_SERVICE.lock().map_err(|_| FFIError::internal("ACTIVITY_SERVICE lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("ActivityService not initialized".to_string()))
+    services().map(|s| s.activity_service.clone())
 }
 
 pub fn get_donor_service() -> FFIResult<Arc<dyn DonorService>> {
-    DONOR_SERVICE.lock().map_err(|_| FFIError::internal("DONOR_SERVICE lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("DonorService not initialized".to_string()))
+    services().map(|s| s.donor_service.clone())
 }
 
 pub fn get_project_funding_service() -> FFIResult<Arc<dyn ProjectFundingService>> {
-    PROJECT_FUNDING_SERVICE.lock().map_err(|_| FFIError::internal("PROJECT_FUNDING_SERVICE lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("ProjectFundingService not initialized".to_string()))
+    services().map(|s| s.project_funding_service.clone())
 }
 
 pub fn get_participant_service() -> FFIResult<Arc<dyn ParticipantService>> {
-    PARTICIPANT_SERVICE.lock().map_err(|_| FFIError::internal("PARTICIPANT_SERVICE lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("ParticipantService not initialized".to_string()))
+    services().map(|s| s.participant_service.clone())
 }
 
 pub fn get_workshop_service() -> FFIResult<Arc<dyn WorkshopService>> {
-    WORKSHOP_SERVICE.lock().map_err(|_| FFIError::internal("WORKSHOP_SERVICE lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("WorkshopService not initialized".to_string()))
+    services().map(|s| s.workshop_service.clone())
 }
 
 pub fn get_livelihood_service() -> FFIResult<Arc<dyn LivehoodService>> {
-    LIVELIHOOD_SERVICE.lock().map_err(|_| FFIError::internal("LIVELIHOOD_SERVICE lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("LivelihoodService not initialized".to_string()))
+    services().map(|s| s.livelihood_service.clone())
 }
 
 pub fn get_strategic_goal_service() -> FFIResult<Arc<dyn StrategicGoalService>> {
-    STRATEGIC_GOAL_SERVICE.lock().map_err(|_| FFIError::internal("STRATEGIC_GOAL_SERVICE lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("StrategicGoalService not initialized".to_string()))
+    services().map(|s| s.strategic_goal_service.clone())
 }
 
 pub fn get_funding_service() -> FFIResult<Arc<dyn ProjectFundingService>> {
-    FUNDING_SERVICE.lock().map_err(|_| FFIError::internal("FUNDING_SERVICE lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("FundingService not initialized".to_string()))
+    services().map(|s| s.funding_service.clone())
 }
 
 pub fn get_sync_repo() -> FFIResult<Arc<dyn SyncRepository>> {
-    SYNC_REPO.lock().map_err(|_| FFIError::internal("SYNC_REPO lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("SyncRepository not initialized".to_string()))
+    services().map(|s| s.sync_repo.clone())
 }
 
 pub fn get_entity_merger() -> FFIResult<Arc<EntityMerger>> {
-    ENTITY_MERGER_GLOBAL.lock().map_err(|_| FFIError::internal("ENTITY_MERGER_GLOBAL lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("EntityMerger not initialized".to_string()))
+    services().map(|s| s.entity_merger.clone())
 }
 
 pub fn get_sync_service() -> FFIResult<Arc<dyn SyncService>> {
-    SYNC_SERVICE_GLOBAL.lock().map_err(|_| FFIError::internal("SYNC_SERVICE_GLOBAL lock poisoned".to_string()))?.clone().ok_or_else(|| FFIError::internal("SyncService not initialized".to_string()))
+    services().map(|s| s.sync_service.clone())
 }
 
 /// Initialize global services
@@ -499,28 +555,33 @@ async fn initialize_internal(
     crate::auth::jwt::initialize(jwt_secret);
     log::debug!("JWT initialized");
 
-    // Create async database connection
-    println!("🗄️ [GLOBALS] Creating database connection...");
-    let pool = sqlx::sqlite::SqlitePoolOptions::new()
-        .max_connections(5)
-        .connect(db_url)
-        .await
-        .map_err(|e| {
-            println!("❌ [GLOBALS] Database connection failed: {}", e);
-            FFIError::internal(format!("Database connection failed: {}", e))
-        })?;
-
-    println!("✅ [GLOBALS] Database connection established");
+    // Create async database connection (reuse the pool if a previous attempt got this far)
+    let started = Instant::now();
+    let profile = STORAGE_PROFILE.get_or_init(StorageProfile::default);
+    let pool = match DB_POOL.get() {
+        Some(existing) => existing.clone(),
+        None => {
+            println!("🗄️ [GLOBALS] Creating database connection...");
+            log::debug!("Storage profile: {:?}", profile);
+            let pool = crate::db_profile::connect_write_pool(db_url, profile)
+                .await
+                .map_err(|e| {
+                    println!("❌ [GLOBALS] Database connection failed: {}", e);
+                    FFIError::internal(e)
+                })?;
+            println!("✅ [GLOBALS] Database connection established");
+
+            // Store the pool first; migrations below look it up through get_db_pool()
+            let _ = DB_POOL.set(pool.clone());
+            println!("✅ [GLOBALS] Database pool stored");
+            pool
+        }
+    };
 
-    // Store the pool first
-    println!("💾 [GLOBALS] Storing database pool...");
-    *DB_POOL.lock().map_err(|_| {
-        println!("❌ [GLOBALS] DB_POOL lock poisoned");
-        FFIError::internal("DB_POOL lock poisoned".to_string())
-    })? = Some(pool.clone());
-    println!("✅ [GLOBALS] Database pool stored");
+    crate::startup::record_phase("database_open", started.elapsed());
 
     // Run database migrations BEFORE creating services
+    let started = Instant::now();
     println!("🔄 [GLOBALS] Running database initialization with consolidated schema...");
     // Since we now use a single consolidated schema, we call our custom initializer.
     // This approach is not compatible with `cargo sqlx prepare` in the traditional sense,
@@ -531,18 +592,67 @@ async fn initialize_internal(
             e
         })?;
     println!("✅ [GLOBALS] Database initialization completed");
+    crate::startup::record_phase("migrations", started.elapsed());
 
-    // Ensure critical lookup data exists
+    // Read-only pool is created after migrations so its connections see the final schema
+    if DB_READ_POOL.get().is_none() {
+        let read_pool = crate::db_profile::build_read_pool(db_url, profile, &pool)
+            .map_err(FFIError::internal)?;
+        let _ = DB_READ_POOL.set(read_pool);
+    }
+
+    // Store device ID and offline mode
+    if DEVICE_ID.set(device_id_str.to_string()).is_err() {
+        log::warn!("Device ID already set by an earlier initialization attempt; keeping it");
+    }
+    OFFLINE_MODE.store(offline_mode_flag, Ordering::Relaxed);
+
+    // Lookup data and revoked tokens are independent; check them side by side
+    let started = Instant::now();
+    let auth_service = match AUTH_SERVICE.get() {
+        Some(existing) => existing.clone(),
+        None => Arc::new(AuthService::new(
+            pool.clone(),
+            device_id_str.to_string(),
+            offline_mode_flag,
+        )),
+    };
     println!("🔧 [GLOBALS] Ensuring critical lookup data...");
-    ensure_status_types_initialized(&pool).await
-        .map_err(|e| {
-            println!("❌ [GLOBALS] Status types initialization failed: {}", e);
-            e
-        })?;
+    let (status_types, revoked_tokens) = tokio::join!(
+        ensure_status_types_initialized(&pool),
+        auth_service.load_revoked_tokens(),
+    );
+    status_types.map_err(|e| {
+        println!("❌ [GLOBALS] Status types initialization failed: {}", e);
+        e
+    })?;
+    revoked_tokens.map_err(|e| FFIError::internal(format!("Failed to load revoked tokens: {}", e)))?;
     println!("✅ [GLOBALS] Status types verified");
-    
-    // Initialize document types IMMEDIATELY after status types and BEFORE starting any background workers
-    // This prevents database concurrency issues with compression worker polling
+    let _ = AUTH_SERVICE.set(auth_service);
+    crate::startup::record_phase("lookup_data", started.elapsed());
+
+    match crate::startup::startup_mode() {
+        crate::startup::StartupMode::Eager => finish_startup().await?,
+        crate::startup::StartupMode::Fast => {
+            log::info!("Fast startup: services build on first use, seeding and workers wait for library_finish_startup");
+        }
+    }
+
+    Ok(())
+}
+
+/// Deferred startup work, run once: seeds the standard document types, builds
+/// the service registry if no call has needed it yet, then starts the
+/// compression and file-deletion workers. Seeding comes first so the
+/// workers' polling does not contend with it.
+pub async fn finish_startup() -> FFIResult<()> {
+    let _guard = FINISH_STARTUP_MUTEX.lock().await;
+    if BACKGROUND_STARTED.load(Ordering::Acquire) {
+        return Ok(());
+    }
+    let pool = get_db_pool()?;
+
+    let started = Instant::now();
     println!("📄 [GLOBALS] Ensuring document types initialized...");
     ensure_document_types_initialized(&pool).await
         .map_err(|e| {
@@ -550,24 +660,35 @@ async fn initialize_internal(
             e
         })?;
     println!("✅ [GLOBALS] Document types verified");
-    
-    // Initialize document types after repositories are created
-    // Note: We'll do this after the document_type_repo is created below
+    crate::startup::record_phase("document_types", started.elapsed());
 
-    // Store device ID and offline mode
-    *DEVICE_ID.lock().map_err(|_| FFIError::internal("DEVICE_ID lock poisoned".to_string()))? = Some(device_id_str.to_string());
-    *OFFLINE_MODE.lock().map_err(|_| FFIError::internal("OFFLINE_MODE lock poisoned".to_string()))? = offline_mode_flag;
+    let registry = services()?;
+
+    let started = Instant::now();
+    start_background_workers(&pool, registry);
+    crate::startup::record_phase("workers", started.elapsed());
+
+    BACKGROUND_STARTED.store(true, Ordering::Release);
+    Ok(())
+}
+
+/// Timings of the startup phases so far
+pub fn startup_report() -> crate::startup::StartupReport {
+    crate::startup::startup_report(SERVICES.get().is_some(), BACKGROUND_STARTED.load(Ordering::Acquire))
+}
+
+/// Build every repository, service and merger. No I/O besides creating the
+/// storage directory, so it can run lazily from any getter.
+fn build_services() -> FFIResult<ServiceRegistry> {
+    let pool = get_db_pool()?;
+    let read_pool = get_db_read_pool()?;
+    let auth_service = get_auth_service()?;
 
     // Core services
     let change_log_repo: Arc<dyn ChangeLogRepository> = Arc::new(SqliteChangeLogRepository::new(pool.clone()));
     let tombstone_repo: Arc<dyn TombstoneRepository> = Arc::new(SqliteTombstoneRepository::new(pool.clone()));
     let dependency_checker: Arc<dyn DependencyChecker> = Arc::new(SqliteDependencyChecker::new(pool.clone()));
     let deletion_manager = Arc::new(PendingDeletionManager::new(pool.clone()));
-    let auth_service = Arc::new(AuthService::new(
-        pool.clone(),
-        device_id_str.to_string(),
-        offline_mode_flag,
-    ));
     // For iOS, use a proper storage path
     let storage_path = if cfg!(target_os = "ios") {
         println!("🔍 [GLOBALS] Detected iOS target, checking IOS_DOCUMENTS_DIR...");
@@ -612,17 +733,17 @@ async fn initialize_internal(
 
     // Repositories
     let user_repo: Arc<dyn UserRepository> = Arc::new(SqliteUserRepository::new(pool.clone(), change_log_repo.clone()));
-    let donor_repo: Arc<dyn DonorRepository> = Arc::new(SqliteDonorRepository::new(pool.clone(), change_log_repo.clone()));
+    let donor_repo: Arc<dyn DonorRepository> = Arc::new(SqliteDonorRepository::new(pool.clone(), change_log_repo.clone()).with_read_pool(read_pool.clone()));
     let media_document_repo: Arc<dyn MediaDocumentRepository> = Arc::new(SqliteMediaDocumentRepository::new(pool.clone(), change_log_repo.clone()));
     let document_type_repo: Arc<dyn DocumentTypeRepository> = Arc::new(SqliteDocumentTypeRepository::new(pool.clone(), change_log_repo.clone()));
-    let project_repo: Arc<dyn ProjectRepository> = Arc::new(SqliteProjectRepository::new(pool.clone(), change_log_repo.clone()));
-    let activity_repo: Arc<dyn ActivityRepository> = Arc::new(SqliteActivityRepository::new(pool.clone(), change_log_repo.clone()));
-    let project_funding_repo: Arc<dyn ProjectFundingRepository> = Arc::new(SqliteProjectFundingRepository::new(pool.clone(), change_log_repo.clone()));
-    let workshop_repo: Arc<dyn WorkshopRepository> = Arc::new(SqliteWorkshopRepository::new(pool.clone(), change_log_repo.clone()));
-    let livelihood_repo: Arc<dyn LivehoodRepository> = Arc::new(SqliteLivelihoodRepository::new(pool.clone(), change_log_repo.clone()));
-    let subsequent_grant_repo: Arc<dyn SubsequentGrantRepository> = Arc::new(SqliteSubsequentGrantRepository::new(pool.clone()));
-    let participant_repo: Arc<dyn ParticipantRepository> = Arc::new(SqliteParticipantRepository::new(pool.clone(), change_log_repo.clone()));
-    let strategic_goal_repo: Arc<dyn StrategicGoalRepository> = Arc::new(SqliteStrategicGoalRepository::new(pool.clone(), change_log_repo.clone()));
+    let project_repo: Arc<dyn ProjectRepository> = Arc::new(SqliteProjectRepository::new(pool.clone(), change_log_repo.clone()).with_read_pool(read_pool.clone()));
+    let activity_repo: Arc<dyn ActivityRepository> = Arc::new(SqliteActivityRepository::new(pool.clone(), change_log_repo.clone()).with_read_pool(read_pool.clone()));
+    let project_funding_repo: Arc<dyn ProjectFundingRepository> = Arc::new(SqliteProjectFundingRepository::new(pool.clone(), change_log_repo.clone()).with_read_pool(read_pool.clone()));
+    let workshop_repo: Arc<dyn WorkshopRepository> = Arc::new(SqliteWorkshopRepository::new(pool.clone(), change_log_repo.clone()).with_read_pool(read_pool.clone()));
+    let livelihood_repo: Arc<dyn LivehoodRepository> = Arc::new(SqliteLivelihoodRepository::new(pool.clone(), change_log_repo.clone()).with_read_pool(read_pool.clone()));
+    let subsequent_grant_repo: Arc<dyn SubsequentGrantRepository> = Arc::new(SqliteSubsequentGrantRepository::new(pool.clone()).with_read_pool(read_pool.clone()));
+    let participant_repo: Arc<dyn ParticipantRepository> = Arc::new(SqliteParticipantRepository::new(pool.clone(), change_log_repo.clone()).with_read_pool(read_pool.clone()));
+    let strategic_goal_repo: Arc<dyn StrategicGoalRepository> = Arc::new(SqliteStrategicGoalRepository::new(pool.clone(), change_log_repo.clone()).with_read_pool(read_pool.clone()));
     let workshop_participant_repo: Arc<dyn WorkshopParticipantRepository> = Arc::new(SqliteWorkshopParticipantRepository::new(pool.clone(), change_log_repo.clone()));
 
     // --- Delete Service Adapters & Services ---
@@ -949,13 +1070,9 @@ async fn initialize_internal(
         deletion_manager.clone(),
     ));
     
-    // Store the service
-    *DELETE_SERVICE_WORKSHOP_PARTICIPANT.lock().map_err(|_| FFIError::internal("DELETE_SERVICE_WORKSHOP_PARTICIPANT lock poisoned".to_string()))? = Some(delete_service_workshop_participant.clone());
-    
     // Create the merger
     let workshop_participant_entity_merger = Arc::new(WorkshopParticipantEntityMerger::new(workshop_participant_repo.clone(), pool.clone(), delete_service_workshop_participant.clone()));
-    
-    *WORKSHOP_PARTICIPANT_ENTITY_MERGER.lock().map_err(|_| FFIError::internal("WORKSHOP_PARTICIPANT_ENTITY_MERGER lock poisoned".to_string()))? = Some(workshop_participant_entity_merger.clone());
+
 
     let media_document_entity_merger = Arc::new(DocumentEntityMerger::new(
         media_document_repo.clone(),
@@ -985,46 +1102,12 @@ async fn initialize_internal(
         None, // ghostscript_path
     ));
     
-    // Use CompressionWorker instead of the problematic CompressionManager
-    // This avoids the unsafe global pool access that was causing crashes
-    let comp_pool = pool.clone();
-    let comp_service = compression_service.clone();
-    let comp_repo = compression_repo.clone();
-    let worker = crate::domains::compression::worker::CompressionWorker::new(
-        comp_service,
-        comp_repo,
-        comp_pool,
-        Some(5_000), // poll interval ms
-        Some(2),     // max_concurrent_jobs
-    );
-    let worker_sender = worker.get_message_sender();
-    
-    // Store the worker sender globally for FFI access
-    *COMPRESSION_WORKER_SENDER.lock().unwrap() = Some(worker_sender);
-    
-    tokio::spawn(async move {
-        let (handle, _shutdown_tx) = worker.start();
-        if let Err(e) = handle.await {
-            log::error!("CompressionWorker exited: {:?}", e);
-        }
-    });
-    
     // Create a stub manager for FFI compatibility
     let compression_manager: Arc<dyn CompressionManager> = Arc::new(StubCompressionManager::new(
         compression_service.clone(),
         compression_repo.clone(),
     ));
 
-    // FileDeletionWorker
-    let fd_pool = pool.clone();
-    let fd_storage = file_storage_service.clone();
-    tokio::spawn(async move {
-        let worker = FileDeletionWorker::new(fd_pool, fd_storage);
-        if let Err(e) = worker.start().await {
-            log::error!("FileDeletionWorker exited: {:?}", e);
-        }
-    });
-
     // Additional Document repositories
     let document_version_repo: Arc<dyn DocumentVersionRepository> = Arc::new(SqliteDocumentVersionRepository::new(pool.clone(), change_log_repo.clone()));
     let document_access_log_repo: Arc<dyn DocumentAccessLogRepository> = Arc::new(SqliteDocumentAccessLogRepository::new(pool.clone()));
@@ -1055,10 +1138,6 @@ async fn initialize_internal(
         media_document_repo.clone(),
         document_service.clone(),
         deletion_manager.clone(),
-        // ADDED: Additional repositories for enrichment
-        user_repo.clone(),
-        activity_repo.clone(),
-        workshop_repo.clone(),
     ));
 
     // Activity Service
@@ -1071,7 +1150,6 @@ async fn initialize_internal(
         dependency_checker.clone(),
         document_service.clone(),
         deletion_manager.clone(),
-        user_repo.clone(),
     ));
 
     // Donor Service
@@ -1132,7 +1210,6 @@ async fn initialize_internal(
         tombstone_repo.clone(),
         change_log_repo.clone(),
         dependency_checker.clone(),
-        project_repo.clone(),
         participant_repo.clone(),
         document_service.clone(),
         media_document_repo.clone(),
@@ -1149,7 +1226,6 @@ async fn initialize_internal(
         dependency_checker.clone(),
         document_service.clone(),
         project_repo.clone(),
-        user_repo.clone(),
         deletion_manager.clone(),
         delete_service_strategic_goal.clone(), // Pass the properly configured delete service
     ));
@@ -1167,85 +1243,6 @@ async fn initialize_internal(
         deletion_manager.clone(),
     ));
 
-    // Store all components (DB_POOL already stored above after connection)
-    *CHANGE_LOG_REPO.lock().map_err(|_| FFIError::internal("CHANGE_LOG_REPO lock poisoned".to_string()))? = Some(change_log_repo.clone());
-    *TOMBSTONE_REPO.lock().map_err(|_| FFIError::internal("TOMBSTONE_REPO lock poisoned".to_string()))? = Some(tombstone_repo.clone());
-    *DEPENDENCY_CHECKER.lock().map_err(|_| FFIError::internal("DEPENDENCY_CHECKER lock poisoned".to_string()))? = Some(dependency_checker.clone());
-    *DELETION_MANAGER.lock().map_err(|_| FFIError::internal("DELETION_MANAGER lock poisoned".to_string()))? = Some(deletion_manager.clone());
-    *AUTH_SERVICE.lock().map_err(|_| FFIError::internal("AUTH_SERVICE lock poisoned".to_string()))? = Some(auth_service.clone());
-    *FILE_STORAGE_SERVICE.lock().map_err(|_| FFIError::internal("FILE_STORAGE_SERVICE lock poisoned".to_string()))? = Some(file_storage_service.clone());
-    *COMPRESSION_REPO.lock().map_err(|_| FFIError::internal("COMPRESSION_REPO lock poisoned".to_string()))? = Some(compression_repo.clone());
-    *COMPRESSION_SERVICE.lock().map_err(|_| FFIError::internal("COMPRESSION_SERVICE lock poisoned".to_string()))? = Some(compression_service.clone());
-    *COMPRESSION_MANAGER.lock().map_err(|_| FFIError::internal("COMPRESSION_MANAGER lock poisoned".to_string()))? = Some(compression_manager.clone());
-    *CLOUD_STORAGE_SERVICE.lock().map_err(|_| FFIError::internal("CLOUD_STORAGE_SERVICE lock poisoned".to_string()))? = Some(cloud_storage_service.clone());
-
-    *USER_REPO.lock().map_err(|_| FFIError::internal("USER_REPO lock poisoned".to_string()))? = Some(user_repo);
-    *USER_SERVICE.lock().map_err(|_| FFIError::internal("USER_SERVICE lock poisoned".to_string()))? = Some(user_service);
-    *DELETE_SERVICE_USER.lock().map_err(|_| FFIError::internal("DELETE_SERVICE_USER lock poisoned".to_string()))? = Some(delete_service_user);
-    *USER_ENTITY_MERGER.lock().map_err(|_| FFIError::internal("USER_ENTITY_MERGER lock poisoned".to_string()))? = Some(user_entity_merger.clone());
-
-    *DONOR_REPO.lock().map_err(|_| FFIError::internal("DONOR_REPO lock poisoned".to_string()))? = Some(donor_repo);
-    *DELETE_SERVICE_DONOR.lock().map_err(|_| FFIError::internal("DELETE_SERVICE_DONOR lock poisoned".to_string()))? = Some(delete_service_donor);
-    *DONOR_ENTITY_MERGER.lock().map_err(|_| FFIError::internal("DONOR_ENTITY_MERGER lock poisoned".to_string()))? = Some(donor_entity_merger.clone());
-
-    *MEDIA_DOCUMENT_REPO.lock().map_err(|_| FFIError::internal("MEDIA_DOCUMENT_REPO lock poisoned".to_string()))? = Some(media_document_repo);
-    *DELETE_SERVICE_MEDIA_DOCUMENT.lock().map_err(|_| FFIError::internal("DELETE_SERVICE_MEDIA_DOCUMENT lock poisoned".to_string()))? = Some(delete_service_media_document);
-    *MEDIA_DOCUMENT_ENTITY_MERGER.lock().map_err(|_| FFIError::internal("MEDIA_DOCUMENT_ENTITY_MERGER lock poisoned".to_string()))? = Some(media_document_entity_merger.clone());
-
-    *DOCUMENT_TYPE_REPO.lock().map_err(|_| FFIError::internal("DOCUMENT_TYPE_REPO lock poisoned".to_string()))? = Some(document_type_repo);
-    *DELETE_SERVICE_DOCUMENT_TYPE.lock().map_err(|_| FFIError::internal("DELETE_SERVICE_DOCUMENT_TYPE lock poisoned".to_string()))? = Some(delete_service_document_type);
-    *DOCUMENT_TYPE_ENTITY_MERGER.lock().map_err(|_| FFIError::internal("DOCUMENT_TYPE_ENTITY_MERGER lock poisoned".to_string()))? = Some(document_type_entity_merger.clone());
-
-    *PROJECT_REPO.lock().map_err(|_| FFIError::internal("PROJECT_REPO lock poisoned".to_string()))? = Some(project_repo);
-    *DELETE_SERVICE_PROJECT.lock().map_err(|_| FFIError::internal("DELETE_SERVICE_PROJECT lock poisoned".to_string()))? = Some(delete_service_project);
-    *PROJECT_ENTITY_MERGER.lock().map_err(|_| FFIError::internal("PROJECT_ENTITY_MERGER lock poisoned".to_string()))? = Some(project_entity_merger.clone());
-
-    *ACTIVITY_REPO.lock().map_err(|_| FFIError::internal("ACTIVITY_REPO lock poisoned".to_string()))? = Some(activity_repo);
-    *DELETE_SERVICE_ACTIVITY.lock().map_err(|_| FFIError::internal("DELETE_SERVICE_ACTIVITY lock poisoned".to_string()))? = Some(delete_service_activity);
-    *ACTIVITY_ENTITY_MERGER.lock().map_err(|_| FFIError::internal("ACTIVITY_ENTITY_MERGER lock poisoned".to_string()))? = Some(activity_entity_merger.clone());
-
-    *PROJECT_FUNDING_REPO.lock().map_err(|_| FFIError::internal("PROJECT_FUNDING_REPO lock poisoned".to_string()))? = Some(project_funding_repo);
-    *DELETE_SERVICE_PROJECT_FUNDING.lock().map_err(|_| FFIError::internal("DELETE_SERVICE_PROJECT_FUNDING lock poisoned".to_string()))? = Some(delete_service_project_funding);
-    *PROJECT_FUNDING_ENTITY_MERGER.lock().map_err(|_| FFIError::internal("PROJECT_FUNDING_ENTITY_MERGER lock poisoned".to_string()))? = Some(project_funding_entity_merger.clone());
-
-    *WORKSHOP_REPO.lock().map_err(|_| FFIError::internal("WORKSHOP_REPO lock poisoned".to_string()))? = Some(workshop_repo);
-    *DELETE_SERVICE_WORKSHOP.lock().map_err(|_| FFIError::internal("DELETE_SERVICE_WORKSHOP lock poisoned".to_string()))? = Some(delete_service_workshop);
-    *WORKSHOP_ENTITY_MERGER.lock().map_err(|_| FFIError::internal("WORKSHOP_ENTITY_MERGER lock poisoned".to_string()))? = Some(workshop_entity_merger.clone());
-
-    *LIVELIHOOD_REPO.lock().map_err(|_| FFIError::internal("LIVELIHOOD_REPO lock poisoned".to_string()))? = Some(livelihood_repo);
-    *DELETE_SERVICE_LIVELIHOOD.lock().map_err(|_| FFIError::internal("DELETE_SERVICE_LIVELIHOOD lock poisoned".to_string()))? = Some(delete_service_livelihood);
-    *LIVELIHOOD_ENTITY_MERGER.lock().map_err(|_| FFIError::internal("LIVELIHOOD_ENTITY_MERGER lock poisoned".to_string()))? = Some(livelihood_entity_merger.clone());
-
-    *SUBSEQUENT_GRANT_REPO.lock().map_err(|_| FFIError::internal("SUBSEQUENT_GRANT_REPO lock poisoned".to_string()))? = Some(subsequent_grant_repo);
-    *DELETE_SERVICE_SUBSEQUENT_GRANT.lock().map_err(|_| FFIError::internal("DELETE_SERVICE_SUBSEQUENT_GRANT lock poisoned".to_string()))? = Some(delete_service_subsequent_grant);
-    *SUBSEQUENT_GRANT_ENTITY_MERGER.lock().map_err(|_| FFIError::internal("SUBSEQUENT_GRANT_ENTITY_MERGER lock poisoned".to_string()))? = Some(subsequent_grant_entity_merger.clone());
-
-    *PARTICIPANT_REPO.lock().map_err(|_| FFIError::internal("PARTICIPANT_REPO lock poisoned".to_string()))? = Some(participant_repo);
-    *DELETE_SERVICE_PARTICIPANT.lock().map_err(|_| FFIError::internal("DELETE_SERVICE_PARTICIPANT lock poisoned".to_string()))? = Some(delete_service_participant);
-    *PARTICIPANT_ENTITY_MERGER.lock().map_err(|_| FFIError::internal("PARTICIPANT_ENTITY_MERGER lock poisoned".to_string()))? = Some(participant_entity_merger.clone());
-
-    *STRATEGIC_GOAL_REPO.lock().map_err(|_| FFIError::internal("STRATEGIC_GOAL_REPO lock poisoned".to_string()))? = Some(strategic_goal_repo);
-    *DELETE_SERVICE_STRATEGIC_GOAL.lock().map_err(|_| FFIError::internal("DELETE_SERVICE_STRATEGIC_GOAL lock poisoned".to_string()))? = Some(delete_service_strategic_goal);
-    *STRATEGIC_GOAL_ENTITY_MERGER.lock().map_err(|_| FFIError::internal("STRATEGIC_GOAL_ENTITY_MERGER lock poisoned".to_string()))? = Some(strategic_goal_entity_merger.clone());
-
-    *WORKSHOP_PARTICIPANT_REPO.lock().map_err(|_| FFIError::internal("WORKSHOP_PARTICIPANT_REPO lock poisoned".to_string()))? = Some(workshop_participant_repo);
-
-    *DOCUMENT_VERSION_REPO.lock().map_err(|_| FFIError::internal("DOCUMENT_VERSION_REPO lock poisoned".to_string()))? = Some(document_version_repo.clone());
-    *DOCUMENT_ACCESS_LOG_REPO.lock().map_err(|_| FFIError::internal("DOCUMENT_ACCESS_LOG_REPO lock poisoned".to_string()))? = Some(document_access_log_repo.clone());
-
-    *DOCUMENT_SERVICE.lock().map_err(|_| FFIError::internal("DOCUMENT_SERVICE lock poisoned".to_string()))? = Some(document_service);
-    *PROJECT_SERVICE.lock().map_err(|_| FFIError::internal("PROJECT_SERVICE lock poisoned".to_string()))? = Some(project_service);
-    *ACTIVITY_SERVICE.lock().map_err(|_| FFIError::internal("ACTIVITY_SERVICE lock poisoned".to_string()))? = Some(activity_service_singleton);
-
-    *DONOR_SERVICE.lock().map_err(|_| FFIError::internal("DONOR_SERVICE lock poisoned".to_string()))? = Some(donor_service);
-    *PROJECT_FUNDING_SERVICE.lock().map_err(|_| FFIError::internal("PROJECT_FUNDING_SERVICE lock poisoned".to_string()))? = Some(project_funding_service);
-    *PARTICIPANT_SERVICE.lock().map_err(|_| FFIError::internal("PARTICIPANT_SERVICE lock poisoned".to_string()))? = Some(participant_service);
-
-    *WORKSHOP_SERVICE.lock().map_err(|_| FFIError::internal("WORKSHOP_SERVICE lock poisoned".to_string()))? = Some(workshop_service);
-    *LIVELIHOOD_SERVICE.lock().map_err(|_| FFIError::internal("LIVELIHOOD_SERVICE lock poisoned".to_string()))? = Some(livelihood_service);
-    *STRATEGIC_GOAL_SERVICE.lock().map_err(|_| FFIError::internal("STRATEGIC_GOAL_SERVICE lock poisoned".to_string()))? = Some(strategic_goal_service);
-    *FUNDING_SERVICE.lock().map_err(|_| FFIError::internal("FUNDING_SERVICE lock poisoned".to_string()))? = Some(funding_service);
-
     // --- Central Entity Merger & Sync components ---
     let mut central_merger = EntityMerger::new(pool.clone());
     central_merger.register_merger(user_entity_merger.clone());
@@ -1278,13 +1275,127 @@ async fn initialize_internal(
         None,
     ));
 
-    *SYNC_REPO.lock().map_err(|_| FFIError::internal("SYNC_REPO lock poisoned".to_string()))? = Some(sync_repo);
-    *ENTITY_MERGER_GLOBAL.lock().map_err(|_| FFIError::internal("ENTITY_MERGER_GLOBAL lock poisoned".to_string()))? = Some(central_merger);
-    *SYNC_SERVICE_GLOBAL.lock().map_err(|_| FFIError::internal("SYNC_SERVICE_GLOBAL lock poisoned".to_string()))? = Some(sync_service);
+    // Published at once by `services()`; getters see either nothing or the full registry
+    let registry = ServiceRegistry {
+        change_log_repo,
+        tombstone_repo,
+        dependency_checker,
+        deletion_manager,
+        file_storage_service,
+        compression_manager,
+        compression_repo,
+        compression_service,
+        cloud_storage_service,
+        user_repo,
+        user_service,
+        delete_service_user,
+        user_entity_merger,
+        donor_repo,
+        delete_service_donor,
+        donor_entity_merger,
+        media_document_repo,
+        delete_service_media_document,
+        media_document_entity_merger,
+        document_type_repo,
+        delete_service_document_type,
+        document_type_entity_merger,
+        project_repo,
+        delete_service_project,
+        project_entity_merger,
+        activity_repo,
+        delete_service_activity,
+        activity_entity_merger,
+        project_funding_repo,
+        delete_service_project_funding,
+        project_funding_entity_merger,
+        workshop_repo,
+        delete_service_workshop,
+        workshop_entity_merger,
+        livelihood_repo,
+        delete_service_livelihood,
+        livelihood_entity_merger,
+        subsequent_grant_repo,
+        delete_service_subsequent_grant,
+        subsequent_grant_entity_merger,
+        participant_repo,
+        delete_service_participant,
+        participant_entity_merger,
+        strategic_goal_repo,
+        delete_service_strategic_goal,
+        strategic_goal_entity_merger,
+        workshop_participant_repo,
+        delete_service_workshop_participant,
+        workshop_participant_entity_merger,
+        document_version_repo,
+        document_access_log_repo,
+        document_service,
+        project_service,
+        activity_service: activity_service_singleton,
+        donor_service,
+        project_funding_service,
+        participant_service,
+        workshop_service,
+        livelihood_service,
+        strategic_goal_service,
+        funding_service,
+        sync_repo,
+        entity_merger: central_merger,
+        sync_service,
+    };
+    Ok(registry)
+}
 
-    // Document types are already initialized before workers started - no need to do it again here
+/// Start the compression and file-deletion workers
+fn start_background_workers(pool: &SqlitePool, registry: &ServiceRegistry) {
+    let file_storage_service = registry.file_storage_service.clone();
 
-    Ok(())
+    // The compression worker may already run, started by an early compression call
+    COMPRESSION_WORKER_SENDER.get_or_init(|| start_compression_worker(pool, registry));
+    
+    // FileDeletionWorker
+    let fd_pool = pool.clone();
+    let fd_storage = file_storage_service.clone();
+    tokio::spawn(async move {
+        let worker = FileDeletionWorker::new(fd_pool, fd_storage);
+        if let Err(e) = worker.start().await {
+            log::error!("FileDeletionWorker exited: {:?}", e);
+        }
+    });
+}
+
+/// Start the compression worker and return its message sender
+fn start_compression_worker(
+    pool: &SqlitePool,
+    registry: &ServiceRegistry,
+) -> tokio::sync::mpsc::Sender<crate::domains::compression::worker::CompressionWorkerMessage> {
+    // Use CompressionWorker instead of the problematic CompressionManager
+    // This avoids the unsafe global pool access that was causing crashes
+    let comp_pool = pool.clone();
+    let comp_service = registry.compression_service.clone();
+    let comp_repo = registry.compression_repo.clone();
+    let worker = crate::domains::compression::worker::CompressionWorker::new(
+        comp_service,
+        comp_repo,
+        comp_pool,
+        Some(30_000), // fallback sweep interval ms; queueing wakes the worker directly
+        Some(2),      // max_concurrent_jobs
+    );
+    let worker_sender = worker.get_message_sender();
+    
+    // The current-thread FFI runtime only polls spawned tasks inside block_on,
+    // so in that mode the worker gets its own thread. Spawn through the FFI
+    // runtime handle: a lazy start may come from outside any runtime context.
+    if crate::ffi::runtime::is_multi_threaded() {
+        crate::ffi::runtime::get_runtime().spawn(async move {
+            let (handle, _shutdown_tx) = worker.start();
+            if let Err(e) = handle.await {
+                log::error!("CompressionWorker exited: {:?}", e);
+            }
+        });
+    } else if let Err(e) = worker.start_on_dedicated_thread() {
+        log::error!("Failed to start CompressionWorker thread: {:?}", e);
+    }
+    worker_sender
 }
 
 
@@ -11,6 +11,9 @@ pub mod validation;
 
 // Private modules
 mod db_migration;
+mod db_profile;
+mod metrics;
+mod startup;
 mod utils;
 
 use crate::ffi::error::FFIResult;
@@ -43,12 +46,9 @@ pub async fn initialize(
     offline_mode: bool, 
     jwt_secret: &str
 ) -> FFIResult<()> {
-    // Initialize global services, passing the secret
+    // Initialize global services, passing the secret (migrations run inside)
     globals::initialize(db_url, device_id, offline_mode, jwt_secret).await?;
     
-    // Initialize database with migrations (now async)
-    db_migration::initialize_database().await?;
-    
     Ok(())  
 }
 
@@ -0,0 +1,707 @@
+//! Always-on hot-path instrumentation.
+//!
+//! Every call through `handle_status_result` / `handle_json_result` (and the
+//! buffer variants) is counted and timed under the name of the exported
+//! function; the name comes from the type of the closure the entry point
+//! passes in, so the ~300 entry points need no changes. Within a call the
+//! time is split into phases:
+//!
+//!   * `parse`     – payload decoding through `ffi::parse_payload` (or the
+//!     auth / export / compression payload helpers)
+//!   * `auth`      – token verification
+//!   * `service`   – everything awaited through `block_on_async`
+//!   * `serialize` – result encoding through `ffi::to_json_result`,
+//!     `handle_json_result` and the buffer variants
+//!   * `other`     – the rest: argument checks, DTO conversion and copying
+//!     the result into a C string
+//!
+//! SQLite reports the run time of every statement through a profile hook
+//! installed on each pool connection, so statements are timed by their SQL
+//! text wherever they are issued. Compression jobs and exports record their
+//! durations, bytes and throughput.
+//!
+//! Counters are relaxed atomics. Each thread resolves a function or statement
+//! to its counters through a thread-local map, so the shared registry lock is
+//! only taken the first time a thread sees a name. Latencies go into log2
+//! histograms of microseconds. `core_get_performance_metrics` returns a
+//! snapshot; `core_set_signpost_callback` forwards call begin/end events to
+//! Swift, for os_signpost intervals in Instruments.
+
+use serde::Serialize;
+use std::cell::RefCell;
+use std::collections::HashMap;
+use std::ffi::{c_void, CStr, CString};
+use std::os::raw::c_char;
+use std::sync::atomic::{AtomicPtr, AtomicU64, Ordering};
+use std::sync::{Arc, Mutex, OnceLock};
+use std::time::{Duration, Instant};
+
+/// Bucket `k` counts latencies in [2^(k-1), 2^k) µs; the last one is open-ended (~67 s)
+const BUCKETS: usize = 28;
+/// Distinct SQL texts tracked; further statements share one overflow entry
+const MAX_STATEMENTS: usize = 512;
+/// Statements reported, by total time
+const REPORTED_STATEMENTS: usize = 100;
+/// Length of the SQL text kept per statement
+const SQL_TEXT_CHARS: usize = 240;
+
+fn micros(elapsed: Duration) -> u64 {
+    elapsed.as_micros().min(u64::MAX as u128) as u64
+}
+
+fn ms(us: u64) -> f64 {
+    us as f64 / 1000.0
+}
+
+fn fetch_max(cell: &AtomicU64, value: u64) {
+    cell.fetch_max(value, Ordering::Relaxed);
+}
+
+#[derive(Default)]
+struct Histogram {
+    buckets: [AtomicU64; BUCKETS],
+}
+
+impl Histogram {
+    fn record(&self, us: u64) {
+        let bucket = (64 - us.leading_zeros() as usize).min(BUCKETS - 1);
+        self.buckets[bucket].fetch_add(1, Ordering::Relaxed);
+    }
+
+    fn snapshot(&self) -> LatencySnapshot {
+        let counts: Vec<u64> = self.buckets.iter().map(|b| b.load(Ordering::Relaxed)).collect();
+        let total: u64 = counts.iter().sum();
+        // Upper bound of a bucket, in ms
+        let bound = |k: usize| if k == 0 { 0.0 } else { ms((1u64 << k) - 1) };
+        let quantile = |q: f64| {
+            let target = ((total as f64) * q).ceil().max(1.0) as u64;
+            let mut seen = 0;
+            for (k, count) in counts.iter().enumerate() {
+                seen += count;
+                if seen >= target {
+                    return bound(k);
+                }
+            }
+            0.0
+        };
+        LatencySnapshot {
+            p50_ms: quantile(0.50),
+            p95_ms: quantile(0.95),
+            p99_ms: quantile(0.99),
+            buckets: counts
+                .iter()
+                .enumerate()
+                .filter(|(_, count)| **count > 0)
+                .map(|(k, count)| BucketSnapshot { le_ms: bound(k), count: *count })
+                .collect(),
+        }
+    }
+}
+
+/// Latency distribution; quantiles are bucket upper bounds
+#[derive(Debug, Clone, Serialize)]
+pub struct LatencySnapshot {
+    pub p50_ms: f64,
+    pub p95_ms: f64,
+    pub p99_ms: f64,
+    /// Non-empty buckets only
+    pub buckets: Vec<BucketSnapshot>,
+}
+
+#[derive(Debug, Clone, Serialize)]
+pub struct BucketSnapshot {
+    pub le_ms: f64,
+    pub count: u64,
+}
+
+// ---------------------------------------------------------------------------
+// FFI calls
+// ---------------------------------------------------------------------------
+
+/// Timed phases of an FFI call; time outside them is reported as `other`
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum Phase {
+    Parse = 0,
+    Auth = 1,
+    Service = 2,
+    Serialize = 3,
+}
+
+const PHASES: usize = 4;
+
+struct FunctionStats {
+    name: String,
+    /// NUL-terminated name handed to the signpost callback
+    c_name: CString,
+    calls: AtomicU64,
+    errors: AtomicU64,
+    total_us: AtomicU64,
+    max_us: AtomicU64,
+    phase_us: [AtomicU64; PHASES],
+    latency: Histogram,
+}
+
+/// Phase times of a call in progress
+struct Frame {
+    phase_us: [u64; PHASES],
+    active: Option<Phase>,
+}
+
+static FUNCTIONS: Mutex<Vec<Arc<FunctionStats>>> = Mutex::new(Vec::new());
+
+thread_local! {
+    /// Counters by closure type name pointer, resolved once per thread
+    static THREAD_FUNCTIONS: RefCell<HashMap<usize, Arc<FunctionStats>>> = RefCell::new(HashMap::new());
+    /// Calls in progress on this thread (batches nest them)
+    static FRAMES: RefCell<Vec<Frame>> = const { RefCell::new(Vec::new()) };
+}
+
+/// Exported function name from the type name of the closure it passes to the
+/// result helpers, e.g. `ipad_rust_core::ffi::project::project_get::{{closure}}`
+fn function_name(type_name: &str) -> &str {
+    let path = type_name.split("::{{closure}}").next().unwrap_or(type_name);
+    let path = path.split('<').next().unwrap_or(path);
+    path.rsplit("::").next().unwrap_or(path)
+}
+
+fn function_stats(type_name: &'static str) -> Arc<FunctionStats> {
+    let key = type_name.as_ptr() as usize;
+    if let Some(stats) = THREAD_FUNCTIONS.with(|map| map.borrow().get(&key).cloned()) {
+        return stats;
+    }
+    let name = function_name(type_name);
+    let stats = {
+        let mut functions = FUNCTIONS.lock().unwrap_or_else(|e| e.into_inner());
+        match functions.iter().find(|f| f.name == name) {
+            Some(stats) => stats.clone(),
+            None => {
+                let stats = Arc::new(FunctionStats {
+                    name: name.to_string(),
+                    c_name: CString::new(name).unwrap_or_default(),
+                    calls: AtomicU64::new(0),
+                    errors: AtomicU64::new(0),
+                    total_us: AtomicU64::new(0),
+                    max_us: AtomicU64::new(0),
+                    phase_us: Default::default(),
+                    latency: Histogram::default(),
+                });
+                functions.push(stats.clone());
+                stats
+            }
+        }
+    };
+    THREAD_FUNCTIONS.with(|map| map.borrow_mut().insert(key, stats.clone()));
+    stats
+}
+
+/// An FFI call being timed; finish it with `CallTimer::finish`
+pub struct CallTimer {
+    stats: Arc<FunctionStats>,
+    started: Instant,
+    signpost_id: u64,
+}
+
+/// Start timing a call of the entry point whose closure has type `F`
+pub fn begin_call<F>() -> CallTimer {
+    let stats = function_stats(std::any::type_name::<F>());
+    FRAMES.with(|frames| frames.borrow_mut().push(Frame { phase_us: [0; PHASES], active: None }));
+    let signpost_id = signpost(&stats.c_name, true, 0);
+    CallTimer { stats, started: Instant::now(), signpost_id }
+}
+
+impl CallTimer {
+    pub fn finish(self, ok: bool) {
+        let us = micros(self.started.elapsed());
+        let phase_us = FRAMES.with(|frames| frames.borrow_mut().pop().map(|f| f.phase_us)).unwrap_or_default();
+        let stats = &self.stats;
+        stats.calls.fetch_add(1, Ordering::Relaxed);
+        if !ok {
+            stats.errors.fetch_add(1, Ordering::Relaxed);
+        }
+        stats.total_us.fetch_add(us, Ordering::Relaxed);
+        fetch_max(&stats.max_us, us);
+        for (total, spent) in stats.phase_us.iter().zip(phase_us) {
+            if spent > 0 {
+                total.fetch_add(spent, Ordering::Relaxed);
+            }
+        }
+        stats.latency.record(us);
+        signpost(&stats.c_name, false, self.signpost_id);
+    }
+}
+
+/// Run `f`, charging its time to `phase` of the call in progress. Nested
+/// phases are charged to the outer one (token verification awaits through
+/// `block_on_async` but counts as auth).
+pub fn in_phase<T>(phase: Phase, f: impl FnOnce() -> T) -> T {
+    let entered = FRAMES.with(|frames| match frames.borrow_mut().last_mut() {
+        Some(frame) if frame.active.is_none() => {
+            frame.active = Some(phase);
+            true
+        }
+        _ => false,
+    });
+    if !entered {
+        return f();
+    }
+    let started = Instant::now();
+    let value = f();
+    let us = micros(started.elapsed());
+    FRAMES.with(|frames| {
+        if let Some(frame) = frames.borrow_mut().last_mut() {
+            frame.phase_us[phase as usize] += us;
+            frame.active = None;
+        }
+    });
+    value
+}
+
+#[derive(Debug, Clone, Serialize)]
+pub struct PhaseSnapshot {
+    pub parse_ms: f64,
+    pub auth_ms: f64,
+    pub service_ms: f64,
+    pub serialize_ms: f64,
+    pub other_ms: f64,
+}
+
+#[derive(Debug, Clone, Serialize)]
+pub struct FunctionSnapshot {
+    pub name: String,
+    pub calls: u64,
+    pub errors: u64,
+    pub total_ms: f64,
+    pub mean_ms: f64,
+    pub max_ms: f64,
+    pub phases: PhaseSnapshot,
+    pub latency: LatencySnapshot,
+}
+
+fn function_snapshots() -> Vec<FunctionSnapshot> {
+    let functions = FUNCTIONS.lock().unwrap_or_else(|e| e.into_inner()).clone();
+    let mut snapshots: Vec<FunctionSnapshot> = functions
+        .iter()
+        .filter(|f| f.calls.load(Ordering::Relaxed) > 0)
+        .map(|f| {
+            let calls = f.calls.load(Ordering::Relaxed);
+            let total_us = f.total_us.load(Ordering::Relaxed);
+            let phase = |p: Phase| f.phase_us[p as usize].load(Ordering::Relaxed);
+            let phased: u64 = f.phase_us.iter().map(|p| p.load(Ordering::Relaxed)).sum();
+            FunctionSnapshot {
+                name: f.name.clone(),
+                calls,
+                errors: f.errors.load(Ordering::Relaxed),
+                total_ms: ms(total_us),
+                mean_ms: ms(total_us) / calls as f64,
+                max_ms: ms(f.max_us.load(Ordering::Relaxed)),
+                phases: PhaseSnapshot {
+                    parse_ms: ms(phase(Phase::Parse)),
+                    auth_ms: ms(phase(Phase::Auth)),
+                    service_ms: ms(phase(Phase::Service)),
+                    serialize_ms: ms(phase(Phase::Serialize)),
+                    other_ms: ms(total_us.saturating_sub(phased)),
+                },
+                latency: f.latency.snapshot(),
+            }
+        })
+        .collect();
+    snapshots.sort_by(|a, b| b.total_ms.total_cmp(&a.total_ms));
+    snapshots
+}
+
+// ---------------------------------------------------------------------------
+// Signposts
+// ---------------------------------------------------------------------------
+
+type SignpostFn = unsafe extern "C" fn(name: *const c_char, is_begin: bool, id: u64);
+
+/// Signpost callback: `void (*)(const char* name, bool is_begin, uint64_t id)`.
+/// The begin and end events of one call carry the same id.
+pub type FfiSignpostCallback = Option<SignpostFn>;
+
+static SIGNPOST_CALLBACK: AtomicPtr<c_void> = AtomicPtr::new(std::ptr::null_mut());
+static SIGNPOST_IDS: AtomicU64 = AtomicU64::new(1);
+
+/// Install (or with None remove) the callback receiving call begin/end events
+pub fn set_signpost_callback(callback: FfiSignpostCallback) {
+    let ptr = callback.map_or(std::ptr::null_mut(), |cb| cb as *mut c_void);
+    SIGNPOST_CALLBACK.store(ptr, Ordering::Release);
+}
+
+/// Forward an event to the signpost callback, if any; returns the id used
+fn signpost(name: &CStr, is_begin: bool, id: u64) -> u64 {
+    let ptr = SIGNPOST_CALLBACK.load(Ordering::Acquire);
+    if ptr.is_null() {
+        return 0;
+    }
+    let id = if is_begin { SIGNPOST_IDS.fetch_add(1, Ordering::Relaxed) } else { id };
+    // SAFETY: only `set_signpost_callback` stores into the pointer, always a `SignpostFn`
+    unsafe {
+        let callback = std::mem::transmute::<*mut c_void, SignpostFn>(ptr);
+        callback(name.as_ptr(), is_begin, id);
+    }
+    id
+}
+
+// ---------------------------------------------------------------------------
+// SQL statements
+// ---------------------------------------------------------------------------
+
+struct StatementStats {
+    sql: String,
+    calls: AtomicU64,
+    total_us: AtomicU64,
+    max_us: AtomicU64,
+    latency: Histogram,
+}
+
+impl StatementStats {
+    fn new(sql: String) -> Self {
+        Self {
+            sql,
+            calls: AtomicU64::new(0),
+            total_us: AtomicU64::new(0),
+            max_us: AtomicU64::new(0),
+            latency: Histogram::default(),
+        }
+    }
+}
+
+static STATEMENTS: Mutex<Option<HashMap<u64, Arc<StatementStats>>>> = Mutex::new(None);
+static OTHER_STATEMENTS: OnceLock<Arc<StatementStats>> = OnceLock::new();
+
+thread_local! {
+    static THREAD_STATEMENTS: RefCell<HashMap<u64, Arc<StatementStats>>> = RefCell::new(HashMap::new());
+}
+
+/// FNV-1a; SQL texts from the repositories are stable, so the hash identifies them
+fn sql_hash(sql: &[u8]) -> u64 {
+    sql.iter().fold(0xcbf2_9ce4_8422_2325u64, |hash, b| (hash ^ *b as u64).wrapping_mul(0x0100_0000_01b3))
+}
+
+/// SQL text for the report: whitespace collapsed, truncated
+fn normalize_sql(sql: &[u8]) -> String {
+    let text = String::from_utf8_lossy(sql);
+    let mut normalized = text.split_whitespace().collect::<Vec<_>>().join(" ");
+    if let Some((cut, _)) = normalized.char_indices().nth(SQL_TEXT_CHARS) {
+        normalized.truncate(cut);
+        normalized.push('…');
+    }
+    normalized
+}
+
+fn statement_stats(sql: &[u8]) -> Arc<StatementStats> {
+    let key = sql_hash(sql);
+    if let Some(stats) = THREAD_STATEMENTS.with(|map| map.try_borrow().ok().and_then(|m| m.get(&key).cloned())) {
+        return stats;
+    }
+    let stats = {
+        let mut statements = STATEMENTS.lock().unwrap_or_else(|e| e.into_inner());
+        let statements = statements.get_or_insert_with(HashMap::new);
+        match statements.get(&key) {
+            Some(stats) => stats.clone(),
+            None if statements.len() < MAX_STATEMENTS => {
+                let stats = Arc::new(StatementStats::new(normalize_sql(sql)));
+                statements.insert(key, stats.clone());
+                stats
+            }
+            None => OTHER_STATEMENTS
+                .get_or_init(|| Arc::new(StatementStats::new("(other statements)".to_string())))
+                .clone(),
+        }
+    };
+    THREAD_STATEMENTS.with(|map| {
+        if let Ok(mut map) = map.try_borrow_mut() {
+            map.insert(key, stats.clone());
+        }
+    });
+    stats
+}
+
+fn record_statement(sql: &[u8], nanos: i64) {
+    let us = (nanos.max(0) as u64) / 1000;
+    let stats = statement_stats(sql);
+    stats.calls.fetch_add(1, Ordering::Relaxed);
+    stats.total_us.fetch_add(us, Ordering::Relaxed);
+    fetch_max(&stats.max_us, us);
+    stats.latency.record(us);
+}
+
+const SQLITE_TRACE_PROFILE: u32 = 0x02;
+
+type TraceCallback = unsafe extern "C" fn(mask: u32, ctx: *mut c_void, p: *mut c_void, x: *mut c_void) -> i32;
+
+// Provided by the SQLite library sqlx links in
+extern "C" {
+    fn sqlite3_trace_v2(db: *mut c_void, mask: u32, callback: Option<TraceCallback>, ctx: *mut c_void) -> i32;
+    fn sqlite3_sql(stmt: *mut c_void) -> *const c_char;
+}
+
+/// SQLITE_TRACE_PROFILE: `p` is the statement, `x` its run time in ns
+unsafe extern "C" fn profile_callback(mask: u32, _ctx: *mut c_void, p: *mut c_void, x: *mut c_void) -> i32 {
+    if mask == SQLITE_TRACE_PROFILE && !p.is_null() && !x.is_null() {
+        let sql = sqlite3_sql(p);
+        if !sql.is_null() {
+            let nanos = *(x as *const i64);
+            // Never unwind into SQLite
+            let sql = CStr::from_ptr(sql).to_bytes();
+            let _ = std::panic::catch_unwind(std::panic::AssertUnwindSafe(|| record_statement(sql, nanos)));
+        }
+    }
+    0
+}
+
+/// Time every statement run on `conn`; installed from the pools' `after_connect`
+pub async fn trace_connection(conn: &mut sqlx::sqlite::SqliteConnection) -> Result<(), sqlx::Error> {
+    let mut handle = conn.lock_handle().await?;
+    let db = handle.as_raw_handle().as_ptr() as *mut c_void;
+    let rc = unsafe { sqlite3_trace_v2(db, SQLITE_TRACE_PROFILE, Some(profile_callback), std::ptr::null_mut()) };
+    if rc != 0 {
+        log::warn!("Could not install the SQL profile hook (SQLite code {})", rc);
+    }
+    Ok(())
+}
+
+#[derive(Debug, Clone, Serialize)]
+pub struct StatementSnapshot {
+    pub sql: String,
+    pub calls: u64,
+    pub total_ms: f64,
+    pub mean_ms: f64,
+    pub max_ms: f64,
+    pub latency: LatencySnapshot,
+}
+
+fn statement_snapshots() -> Vec<StatementSnapshot> {
+    let mut all: Vec<Arc<StatementStats>> = STATEMENTS
+        .lock()
+        .unwrap_or_else(|e| e.into_inner())
+        .as_ref()
+        .map(|m| m.values().cloned().collect())
+        .unwrap_or_default();
+    all.extend(OTHER_STATEMENTS.get().cloned());
+    all.sort_by_key(|s| std::cmp::Reverse(s.total_us.load(Ordering::Relaxed)));
+    all.iter()
+        .filter(|s| s.calls.load(Ordering::Relaxed) > 0)
+        .take(REPORTED_STATEMENTS)
+        .map(|s| {
+            let calls = s.calls.load(Ordering::Relaxed);
+            let total_us = s.total_us.load(Ordering::Relaxed);
+            StatementSnapshot {
+                sql: s.sql.clone(),
+                calls,
+                total_ms: ms(total_us),
+                mean_ms: ms(total_us) / calls as f64,
+                max_ms: ms(s.max_us.load(Ordering::Relaxed)),
+                latency: s.latency.snapshot(),
+            }
+        })
+        .collect()
+}
+
+// ---------------------------------------------------------------------------
+// Compression and export
+// ---------------------------------------------------------------------------
+
+#[derive(Default)]
+struct CompressionStats {
+    jobs: AtomicU64,
+    failed: AtomicU64,
+    original_bytes: AtomicU64,
+    compressed_bytes: AtomicU64,
+    total_us: AtomicU64,
+    latency: Histogram,
+}
+
+#[derive(Default)]
+struct ExportStats {
+    completed: AtomicU64,
+    queued: AtomicU64,
+    failed: AtomicU64,
+    entities: AtomicU64,
+    bytes: AtomicU64,
+    /// Time of completed exports only, for throughput
+    completed_us: AtomicU64,
+    latency: Histogram,
+}
+
+fn compression_stats() -> &'static CompressionStats {
+    static STATS: OnceLock<CompressionStats> = OnceLock::new();
+    STATS.get_or_init(CompressionStats::default)
+}
+
+fn export_stats() -> &'static ExportStats {
+    static STATS: OnceLock<ExportStats> = OnceLock::new();
+    STATS.get_or_init(ExportStats::default)
+}
+
+/// One compression job; `sizes` is (original, compressed) when it succeeded
+pub fn record_compression(elapsed: Duration, sizes: Option<(i64, i64)>) {
+    let stats = compression_stats();
+    let us = micros(elapsed);
+    stats.jobs.fetch_add(1, Ordering::Relaxed);
+    stats.total_us.fetch_add(us, Ordering::Relaxed);
+    stats.latency.record(us);
+    match sizes {
+        Some((original, compressed)) => {
+            stats.original_bytes.fetch_add(original.max(0) as u64, Ordering::Relaxed);
+            stats.compressed_bytes.fetch_add(compressed.max(0) as u64, Ordering::Relaxed);
+        }
+        None => {
+            stats.failed.fetch_add(1, Ordering::Relaxed);
+        }
+    }
+}
+
+/// Outcome of one export request
+pub enum ExportOutcome {
+    /// Written before returning: entities and bytes
+    Completed(u64, u64),
+    /// Handed to the background queue
+    Queued,
+    Failed,
+}
+
+pub fn record_export(elapsed: Duration, outcome: ExportOutcome) {
+    let stats = export_stats();
+    let us = micros(elapsed);
+    match outcome {
+        ExportOutcome::Completed(entities, bytes) => {
+            stats.completed.fetch_add(1, Ordering::Relaxed);
+            stats.entities.fetch_add(entities, Ordering::Relaxed);
+            stats.bytes.fetch_add(bytes, Ordering::Relaxed);
+            stats.completed_us.fetch_add(us, Ordering::Relaxed);
+            stats.latency.record(us);
+        }
+        ExportOutcome::Queued => {
+            stats.queued.fetch_add(1, Ordering::Relaxed);
+        }
+        ExportOutcome::Failed => {
+            stats.failed.fetch_add(1, Ordering::Relaxed);
+        }
+    }
+}
+
+#[derive(Debug, Clone, Serialize)]
+pub struct CompressionSnapshot {
+    pub jobs: u64,
+    pub failed: u64,
+    pub original_bytes: u64,
+    pub compressed_bytes: u64,
+    pub bytes_saved: i64,
+    pub total_ms: f64,
+    pub latency: LatencySnapshot,
+}
+
+#[derive(Debug, Clone, Serialize)]
+pub struct ExportSnapshot {
+    pub completed: u64,
+    pub queued: u64,
+    pub failed: u64,
+    pub entities: u64,
+    pub bytes: u64,
+    pub entities_per_second: f64,
+    pub megabytes_per_second: f64,
+    pub latency: LatencySnapshot,
+}
+
+fn compression_snapshot() -> CompressionSnapshot {
+    let stats = compression_stats();
+    let original = stats.original_bytes.load(Ordering::Relaxed);
+    let compressed = stats.compressed_bytes.load(Ordering::Relaxed);
+    CompressionSnapshot {
+        jobs: stats.jobs.load(Ordering::Relaxed),
+        failed: stats.failed.load(Ordering::Relaxed),
+        original_bytes: original,
+        compressed_bytes: compressed,
+        bytes_saved: original as i64 - compressed as i64,
+        total_ms: ms(stats.total_us.load(Ordering::Relaxed)),
+        latency: stats.latency.snapshot(),
+    }
+}
+
+fn export_snapshot() -> ExportSnapshot {
+    let stats = export_stats();
+    let entities = stats.entities.load(Ordering::Relaxed);
+    let bytes = stats.bytes.load(Ordering::Relaxed);
+    let seconds = stats.completed_us.load(Ordering::Relaxed) as f64 / 1_000_000.0;
+    let per_second = |n: f64| if seconds > 0.0 { n / seconds } else { 0.0 };
+    ExportSnapshot {
+        completed: stats.completed.load(Ordering::Relaxed),
+        queued: stats.queued.load(Ordering::Relaxed),
+        failed: stats.failed.load(Ordering::Relaxed),
+        entities,
+        bytes,
+        entities_per_second: per_second(entities as f64),
+        megabytes_per_second: per_second(bytes as f64 / (1024.0 * 1024.0)),
+        latency: stats.latency.snapshot(),
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Report
+// ---------------------------------------------------------------------------
+
+/// Everything `core_get_performance_metrics` returns
+#[derive(Debug, Clone, Serialize)]
+pub struct PerformanceMetrics {
+    pub uptime_ms: f64,
+    /// Entry points by total time
+    pub functions: Vec<FunctionSnapshot>,
+    /// The slowest statements by total time
+    pub sql: Vec<StatementSnapshot>,
+    pub compression: CompressionSnapshot,
+    pub export: ExportSnapshot,
+}
+
+fn started_at() -> Instant {
+    static STARTED: OnceLock<Instant> = OnceLock::new();
+    *STARTED.get_or_init(Instant::now)
+}
+
+/// Start the uptime clock; called at initialization
+pub fn mark_started() {
+    started_at();
+}
+
+pub fn snapshot() -> PerformanceMetrics {
+    PerformanceMetrics {
+        uptime_ms: started_at().elapsed().as_secs_f64() * 1000.0,
+        functions: function_snapshots(),
+        sql: statement_snapshots(),
+        compression: compression_snapshot(),
+        export: export_snapshot(),
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn calls_are_timed_by_function_and_phase() {
+        fn sample_entry_point() -> CallTimer {
+            let closure = || ();
+            fn timer_for<F>(_: &F) -> CallTimer {
+                begin_call::<F>()
+            }
+            timer_for(&closure)
+        }
+
+        let timer = sample_entry_point();
+        in_phase(Phase::Service, || {
+            // Nested phases are charged to the outer one
+            in_phase(Phase::Parse, || std::thread::sleep(Duration::from_millis(2)))
+        });
+        timer.finish(false);
+
+        let snapshot = function_snapshots();
+        let stats = snapshot.iter().find(|f| f.name == "sample_entry_point").unwrap();
+        assert_eq!((stats.calls, stats.errors), (1, 1));
+        assert!(stats.phases.service_ms >= 2.0);
+        assert_eq!(stats.phases.parse_ms, 0.0);
+        assert_eq!(stats.latency.buckets.iter().map(|b| b.count).sum::<u64>(), 1);
+
+        assert_eq!(function_name("ipad_rust_core::ffi::project::project_get::{{closure}}"), "project_get");
+    }
+}
@@ -0,0 +1,88 @@
+//! Startup mode and phase timings.
+//!
+//! `initialize_library` has to return before Swift can show the login
+//! screen, so only what the first screens need runs there: database pools,
+//! migrations (skipped when the schema stamp matches), lookup data and the
+//! auth service. In `Fast` mode the rest is deferred: the service registry
+//! is built on the first getter call, and seeding the standard document
+//! types plus starting the compression and file-deletion workers (whose
+//! first tick cleans up stale documents) wait for `library_finish_startup`,
+//! which Swift calls after first paint. A compression call made before then
+//! starts the compression worker itself. `Eager` mode, the default, does all
+//! of it inside `initialize_library` as before.
+//!
+//! Every phase records its duration; `library_get_startup_report` returns
+//! them.
+
+use serde::{Deserialize, Serialize};
+use std::sync::atomic::{AtomicU8, Ordering};
+use std::sync::Mutex;
+use std::time::Duration;
+
+/// When the non-critical startup work runs, chosen once at initialization
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq, Serialize, Deserialize)]
+#[serde(rename_all = "snake_case")]
+pub enum StartupMode {
+    /// Everything inside `initialize_library`
+    #[default]
+    Eager = 0,
+    /// Services on first use, seeding and workers in `library_finish_startup`
+    Fast = 1,
+}
+
+static STARTUP_MODE: AtomicU8 = AtomicU8::new(StartupMode::Eager as u8);
+
+pub fn configure_startup_mode(mode: StartupMode) {
+    STARTUP_MODE.store(mode as u8, Ordering::Relaxed);
+}
+
+pub fn startup_mode() -> StartupMode {
+    match STARTUP_MODE.load(Ordering::Relaxed) {
+        1 => StartupMode::Fast,
+        _ => StartupMode::Eager,
+    }
+}
+
+/// One timed startup phase
+#[derive(Debug, Clone, Serialize)]
+pub struct StartupPhase {
+    pub name: &'static str,
+    pub duration_ms: f64,
+}
+
+/// Startup phases so far, as returned by `library_get_startup_report`
+#[derive(Debug, Clone, Serialize)]
+pub struct StartupReport {
+    pub mode: StartupMode,
+    pub phases: Vec<StartupPhase>,
+    pub total_ms: f64,
+    pub services_ready: bool,
+    pub background_started: bool,
+}
+
+static PHASES: Mutex<Vec<StartupPhase>> = Mutex::new(Vec::new());
+
+/// Record how long `name` took
+pub fn record_phase(name: &'static str, elapsed: Duration) {
+    let duration_ms = elapsed.as_secs_f64() * 1000.0;
+    log::info!("Startup phase {} took {:.1} ms", name, duration_ms);
+    PHASES.lock().unwrap().push(StartupPhase { name, duration_ms });
+}
+
+pub fn startup_report(services_ready: bool, background_started: bool) -> StartupReport {
+    let phases = PHASES.lock().unwrap().clone();
+    let total_ms = phases.iter().map(|p| p.duration_ms).sum();
+    StartupReport { mode: startup_mode(), phases, total_ms, services_ready, background_started }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn startup_mode_parses_from_config() {
+        let mode: StartupMode = serde_json::from_str("\"fast\"").unwrap();
+        assert_eq!(mode, StartupMode::Fast);
+        assert_eq!(StartupMode::default(), StartupMode::Eager);
+    }
+}